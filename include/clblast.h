@@ -17,8 +17,9 @@
 #define CLBLAST_CLBLAST_H_
 
 #include <cstdlib> // For size_t
-#include <string> // For OverrideParameters function
-#include <unordered_map> // For OverrideParameters function
+#include <string> // For OverrideParameters and RetrieveParameters functions
+#include <unordered_map> // For OverrideParameters and RetrieveParameters functions
+#include <vector> // For the RetrieveMemoryFallbacks function
 
 // Includes the normal OpenCL C header
 #if defined(__APPLE__) || defined(__MACOSX)
@@ -117,9 +118,32 @@ enum class Triangle { kUpper = 121, kLower = 122 };
 enum class Diagonal { kNonUnit = 131, kUnit = 132 };
 enum class Side { kLeft = 141, kRight = 142 };
 
-// Precision scoped enum (values in bits)
+// Numerics modes: strict IEEE-754 compliant arithmetic, the default (which might use the faster but
+// non-compliant mad() instruction on specific devices), or fast arithmetic using relaxed math
+enum class Numerics { kDefault = 151, kStrict = 152, kFast = 153 };
+
+// Vector statistics as computed by VectorStats. These are bit-flags and can be combined using the
+// | operator, the results are stored in the order of the values below.
+enum class Statistic { kSum = 1, kAbsSum = 2, kSumSquares = 4, kMin = 8, kArgMin = 16,
+                       kMax = 32, kArgMax = 64 };
+inline Statistic operator|(const Statistic a, const Statistic b) {
+  return static_cast<Statistic>(static_cast<int>(a) | static_cast<int>(b));
+}
+
+// Reduction operators for ReduceMatrix. The arg-variants compute the index of the extreme value.
+enum class Reduction { kSum = 161, kAbsSum = 162, kNrm2 = 163, kMax = 164, kArgMax = 165,
+                       kMin = 166, kArgMin = 167 };
+
+// Formats of the quantized matrix of GemmQuantized (values in bits): unsigned integer codes
+enum class Quantization { kInt8 = 8, kInt4 = 4 };
+
+// Policies of a dispatcher to distribute routine calls over its queues (see EnableDispatch)
+enum class Dispatch { kRoundRobin = 171, kLeastLoaded = 172 };
+
+// Precision scoped enum (values in bits). The bfloat16 precision stores 16-bit values in memory
+// but computes in 32-bit single-precision, see 'clblast_half.h' for its host data-type.
 enum class Precision { kHalf = 16, kSingle = 32, kDouble = 64,
-                       kComplexSingle = 3232, kComplexDouble = 6464, kAny = -1 };
+                       kComplexSingle = 3232, kComplexDouble = 6464, kBFloat16 = 1632, kAny = -1 };
 
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
@@ -180,7 +204,7 @@ StatusCode Copy(const size_t n,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
 
-// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
+// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY/BAXPY
 template <typename T>
 StatusCode Axpy(const size_t n,
                 const T alpha,
@@ -188,7 +212,7 @@ StatusCode Axpy(const size_t n,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event = nullptr);
 
-// Dot product of two vectors: SDOT/DDOT/HDOT
+// Dot product of two vectors: SDOT/DDOT/HDOT/BDOT
 template <typename T>
 StatusCode Dot(const size_t n,
                cl_mem dot_buffer, const size_t dot_offset,
@@ -511,7 +535,7 @@ StatusCode Spr2(const Layout layout, const Triangle triangle,
 // BLAS level-3 (matrix-matrix) routines
 // =================================================================================================
 
-// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM/BGEMM
 template <typename T>
 StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                 const size_t m, const size_t n, const size_t k,
@@ -617,6 +641,26 @@ StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                     cl_command_queue* queue, cl_event* event = nullptr);
 
+// Scaled matrix-matrix addition with optional transposes (non-BLAS function): SGEAM/DGEAM/CGEAM/ZGEAM/HGEAM
+template <typename T>
+StatusCode Geam(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
+// Diagonal matrix-matrix multiplication (non-BLAS function): SDGMM/DDGMM/CDGMM/ZDGMM/HDGMM
+template <typename T>
+StatusCode Dgmm(const Layout layout, const Side side,
+                const size_t m, const size_t n,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
 // Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
 template <typename T>
 StatusCode AxpyBatched(const size_t n,
@@ -626,7 +670,7 @@ StatusCode AxpyBatched(const size_t n,
                        const size_t batch_count,
                        cl_command_queue* queue, cl_event* event = nullptr);
 
-// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED/BGEMMBATCHED
 template <typename T>
 StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                        const size_t m, const size_t n, const size_t k,
@@ -640,6 +684,190 @@ StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const T
 
 // =================================================================================================
 
+// Computes the requested statistics of the _n_ elements of vector _x_ in a single pass over the
+// data. The results are stored consecutively in _stats_ in the order of the Statistic values, with
+// the zero-based indices of the minimum/maximum (lowest index in case of ties) stored as values.
+template <typename T>
+StatusCode VectorStats(const Statistic statistics, const size_t n,
+                       cl_mem stats_buffer, const size_t stats_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       cl_command_queue* queue, cl_event* event = nullptr);
+
+// Reduces each row (no transpose) or each column (transpose) of the m-by-n matrix _A_ to a single
+// value, stored in the vector _y_ of m or n elements respectively. Indices of extreme values are
+// zero-based (lowest index in case of ties) and are stored as values.
+template <typename T>
+StatusCode ReduceMatrix(const Reduction reduction, const Layout layout, const Transpose a_transpose,
+                        const size_t m, const size_t n,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                        cl_command_queue* queue, cl_event* event = nullptr);
+
+// Computes a batch of fused scaled-dot-product attentions O = softmax(scale * Q * K^T) * V, with
+// the m-by-d matrices _Q_ and _O_ and the n-by-d matrices _K_ and _V_ of each head at their own
+// offsets. The softmax is computed per row without storing the m-by-n scores. With the causal
+// mask, the queries are the last m positions of the sequence of n keys.
+template <typename T>
+StatusCode Attention(const Layout layout, const bool causal,
+                     const size_t m, const size_t n, const size_t d, const T scale,
+                     const cl_mem q_buffer, const size_t *q_offsets, const size_t q_ld,
+                     const cl_mem k_buffer, const size_t *k_offsets, const size_t k_ld,
+                     const cl_mem v_buffer, const size_t *v_offsets, const size_t v_ld,
+                     cl_mem o_buffer, const size_t *o_offsets, const size_t o_ld,
+                     const size_t batch_count,
+                     cl_command_queue* queue, cl_event* event = nullptr);
+
+// Planar-complex versions of some of the complex routines: the real and imaginary parts of the
+// vectors and matrices are stored in two separate buffers of the real data-type (_x_real_ and
+// _x_imag_), both with the same offset and increment or leading dimension. Planar-complex AXPY:
+// y = alpha * x + y
+template <typename T>
+StatusCode AxpyPlanar(const size_t n,
+                      const T alpha,
+                      const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// Planar-complex SCAL: x = alpha * x
+template <typename T>
+StatusCode ScalPlanar(const size_t n,
+                      const T alpha,
+                      cl_mem x_real_buffer, cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// Planar-complex COPY: y = x
+template <typename T>
+StatusCode CopyPlanar(const size_t n,
+                      const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// Planar-complex GEMV, computed using four real matrix-vector multiplications
+template <typename T>
+StatusCode GemvPlanar(const Layout layout, const Transpose a_transpose,
+                      const size_t m, const size_t n,
+                      const T alpha,
+                      const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                      const T beta,
+                      cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// Planar-complex GEMM, computed using four real matrix-multiplications
+template <typename T>
+StatusCode GemmPlanar(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem b_real_buffer, const cl_mem b_imag_buffer, const size_t b_offset, const size_t b_ld,
+                      const T beta,
+                      cl_mem c_real_buffer, cl_mem c_imag_buffer, const size_t c_offset, const size_t c_ld,
+                      cl_command_queue* queue, cl_event* event = nullptr);
+
+// Converts a vector from one precision to another on the device: y = scale * x, with _x_ of the
+// input precision Ti and _y_ of the output precision To. Supported are all combinations of the real
+// precisions (including bfloat16) and all combinations of the complex precisions.
+template <typename Ti, typename To>
+StatusCode Convert(const size_t n, const double scale,
+                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                   cl_command_queue* queue, cl_event* event = nullptr);
+
+// Permutes the dimensions of the tensor _A_ into the tensor _B_ (a generalized transpose), scaled
+// by _alpha_: dimension i of _B_ is dimension permutation[i] of _A_. The _num_dims_ sizes in _shape_
+// are those of _A_, slowest-varying first (e.g. NCHW). The strides are given per dimension in the
+// order of the respective tensor, a nullptr denotes a packed tensor.
+template <typename T>
+StatusCode Permute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                   const T alpha,
+                   const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                   cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                   cl_command_queue* queue, cl_event* event = nullptr);
+
+// Weight-only quantized matrix-matrix multiplication: C = alpha * A * dequantize(B) + beta * C. The
+// matrix B consists of 8-bit or 4-bit codes and is dequantized on-the-fly using a scale and an
+// optional zero-point (a nullptr for the default) per group of _group_size_ codes in a column.
+template <typename T>
+StatusCode GemmQuantized(const Layout layout, const Transpose a_transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const T alpha,
+                         const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                         const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                         const Quantization b_quantization, const size_t group_size,
+                         const cl_mem scales_buffer, const size_t scales_offset,
+                         const cl_mem zeros_buffer, const size_t zeros_offset,
+                         const T beta,
+                         cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                         cl_command_queue* queue, cl_event* event = nullptr);
+
+// Block-sparse matrix-matrix multiplication: C = alpha * op(A) * op(B) + beta * C, in which op(A)
+// (_sparse_side_ is left) or op(B) (right) consists of _block_size_ by _block_size_ blocks. The
+// occupancy map holds a byte per block, row-major over the blocks: zero blocks are never used.
+template <typename T>
+StatusCode GemmBlockSparse(const Layout layout, const Transpose a_transpose,
+                           const Transpose b_transpose,
+                           const Side sparse_side, const size_t block_size,
+                           const size_t m, const size_t n, const size_t k,
+                           const T alpha,
+                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                           const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                           const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                           const T beta,
+                           cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                           cl_command_queue* queue, cl_event* event = nullptr);
+
+// Householder QR factorization: A = Q * R (as LAPACK's xGEQRF). Matrix R is stored in the upper
+// triangle of A and Q as min(m,n) Householder reflectors below the diagonal, scaled by tau.
+template <typename T>
+StatusCode Geqrf(const Layout layout, const size_t m, const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem tau_buffer, const size_t tau_offset,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Multiplies C with Q or Q^T from the left or right (as LAPACK's xORMQR), in which Q is given by
+// the k Householder reflectors of the QR factorization of A as computed by Geqrf
+template <typename T>
+StatusCode Ormqr(const Layout layout, const Side side, const Transpose a_transpose,
+                 const size_t m, const size_t n, const size_t k,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem tau_buffer, const size_t tau_offset,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Communication-avoiding QR factorization of a tall and skinny matrix (TSQR): A is replaced by the
+// explicit Q with orthonormal columns and the upper-triangular R is stored in a separate matrix
+template <typename T>
+StatusCode Tsqr(const Layout layout, const size_t m, const size_t n,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem r_buffer, const size_t r_offset, const size_t r_ld,
+                cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of Geqrf for many small matrices
+template <typename T>
+StatusCode GeqrfBatched(const Layout layout, const size_t m, const size_t n,
+                        cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                        cl_mem tau_buffer, const size_t *tau_offsets,
+                        const size_t batch_count,
+                        cl_command_queue* queue, cl_event* event = nullptr);
+
+// Inverts a triangular matrix in-place (as LAPACK's xTRTRI): only the given triangle of A is read
+// and overwritten with the inverse. The matrix must be non-singular.
+template <typename T>
+StatusCode Trtri(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                 const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_command_queue* queue, cl_event* event = nullptr);
+
+// Batched version of Trtri
+template <typename T>
+StatusCode TrtriBatched(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                        const size_t n,
+                        cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                        const size_t batch_count,
+                        cl_command_queue* queue, cl_event* event = nullptr);
+
+// =================================================================================================
+
 // CLBlast stores binaries of compiled kernels into a cache in case the same kernel is used later on
 // for the same device. This cache can be cleared to free up system memory or in case of debugging.
 StatusCode PUBLIC_API ClearCache();
@@ -648,14 +876,85 @@ StatusCode PUBLIC_API ClearCache();
 // Further CLBlast routine calls will then run at maximum speed.
 StatusCode PUBLIC_API FillCache(const cl_device_id device);
 
+// CLBlast can record which routines were compiled for which precision and device into a small
+// manifest file. Recording is stopped by passing an empty filename. It can also be enabled by
+// setting the CLBLAST_MANIFEST environmental variable to the name of the manifest file.
+StatusCode PUBLIC_API RecordManifest(const std::string &manifest_file);
+
+// Pre-compiles exactly the routines listed in a previously recorded manifest for a specific device,
+// by default in a background thread. Further calls to these routines will then run at maximum speed.
+StatusCode PUBLIC_API WarmUp(const cl_device_id device, const std::string &manifest_file,
+                             const bool background = true);
+
 // =================================================================================================
 
+// Sets the numerics mode for all further routine calls made from the calling thread. Kernels are
+// compiled and cached separately for each mode, such that e.g. latency-critical calls can use fast
+// relaxed math while other calls keep strict results.
+StatusCode PUBLIC_API SetNumerics(const Numerics numerics);
+
 // Overrides tuning parameters for a specific device-precision-kernel combination. The next time
 // the target routine is called it will re-compile and use the new parameters from then on.
 StatusCode PUBLIC_API OverrideParameters(const cl_device_id device, const std::string &kernel_name,
                                          const Precision precision,
                                          const std::unordered_map<std::string,size_t> &parameters);
 
+// Retrieves the tuning parameters of a specific device-precision-kernel combination as selected
+// from the database, together with a description of the database entry they were taken from.
+StatusCode PUBLIC_API RetrieveParameters(const cl_device_id device, const std::string &kernel_name,
+                                         const Precision precision,
+                                         std::unordered_map<std::string,size_t> &parameters,
+                                         std::string &database_entry);
+
+// =================================================================================================
+
+// Sets a budget (in bytes) for the device memory which a single routine call may allocate for its
+// temporary buffers in the given context. Routines whose regular temporary buffers would exceed the
+// budget switch to a lower-memory algorithm instead (e.g. the direct GEMM kernel or processing in
+// blocks). A budget of zero removes the budget again. A default budget for other contexts can be set
+// through the CLBLAST_MEMORY_BUDGET environmental variable.
+StatusCode PUBLIC_API SetMemoryBudget(const cl_context context, const size_t budget);
+
+// Retrieves the descriptions of the lower-memory algorithms used because of the memory budget of
+// the given context since the previous call, e.g. "GEMM-32: direct kernel instead of [..] bytes of
+// temporary buffers".
+StatusCode PUBLIC_API RetrieveMemoryFallbacks(const cl_context context,
+                                              std::vector<std::string> &fallbacks);
+
+// =================================================================================================
+
+// Turns the given queue into a dispatcher which owns 'num_queues' extra queues on the same device.
+// Further routine calls made with this queue are distributed over these queues, such that small
+// independent calls can run concurrently: either in turn (round-robin) or on the queue with the
+// least estimated work still running (least-loaded), estimated from the sizes of the calls. Each
+// call waits for the commands enqueued on the queue itself before it, but not for other dispatched
+// calls: these must be independent of each other until they are joined.
+StatusCode PUBLIC_API EnableDispatch(const cl_command_queue queue, const size_t num_queues,
+                                     const Dispatch policy = Dispatch::kLeastLoaded);
+
+// Joins the routine calls dispatched so far: further commands on the queue (e.g. reading results or
+// dependent routine calls) wait for them. The optional event completes when they are completed.
+StatusCode PUBLIC_API DispatchJoin(const cl_command_queue queue, cl_event* event = nullptr);
+
+// Joins the dispatched calls and releases the dispatcher's queues: further routine calls made with
+// the queue run on the queue itself again
+StatusCode PUBLIC_API DisableDispatch(const cl_command_queue queue);
+
+// =================================================================================================
+
+// Registers a hot GEMM shape: further GEMM calls with exactly these arguments (in any precision) run
+// kernels specialised for the shape, compiled with the sizes and leading dimensions as constants.
+// This allows the compiler to fully unroll loops and to remove bounds checks. A variant is compiled
+// on the first matching call per precision and is cached separately, calls of other shapes are not
+// affected. The shapes apply to all devices and contexts.
+StatusCode PUBLIC_API RegisterGemmShape(const Layout layout, const Transpose a_transpose,
+                                        const Transpose b_transpose,
+                                        const size_t m, const size_t n, const size_t k,
+                                        const size_t a_ld, const size_t b_ld, const size_t c_ld);
+
+// Removes all registered GEMM shapes: further GEMM calls run the regular kernels again
+StatusCode PUBLIC_API ClearGemmShapes();
+
 // =================================================================================================
 
 } // namespace clblast
@@ -22,6 +22,9 @@
   #include <CL/opencl.h>
 #endif
 
+// Includes the host data-types for half-precision and bfloat16
+#include "clblast_half.h"
+
 // Exports library functions under Windows when building a DLL. See also:
 // https://msdn.microsoft.com/en-us/library/a90k134d.aspx
 #if defined(_WIN32) && defined(CLBLAST_DLL)
@@ -119,11 +122,26 @@ typedef enum CLBlastTriangle_ { CLBlastTriangleUpper = 121,
 typedef enum CLBlastDiagonal_ { CLBlastDiagonalNonUnit = 131,
                                 CLBlastDiagonalUnit = 132 } CLBlastDiagonal;
 typedef enum CLBlastSide_ { CLBlastSideLeft = 141, CLBlastSideRight = 142 } CLBlastSide;
+typedef enum CLBlastNumerics_ { CLBlastNumericsDefault = 151, CLBlastNumericsStrict = 152,
+                                CLBlastNumericsFast = 153 } CLBlastNumerics;
+typedef enum CLBlastStatistic_ { CLBlastStatisticSum = 1, CLBlastStatisticAbsSum = 2,
+                                 CLBlastStatisticSumSquares = 4, CLBlastStatisticMin = 8,
+                                 CLBlastStatisticArgMin = 16, CLBlastStatisticMax = 32,
+                                 CLBlastStatisticArgMax = 64 } CLBlastStatistic;
+typedef enum CLBlastReduction_ { CLBlastReductionSum = 161, CLBlastReductionAbsSum = 162,
+                                 CLBlastReductionNrm2 = 163, CLBlastReductionMax = 164,
+                                 CLBlastReductionArgMax = 165, CLBlastReductionMin = 166,
+                                 CLBlastReductionArgMin = 167 } CLBlastReduction;
+typedef enum CLBlastQuantization_ { CLBlastQuantizationInt8 = 8,
+                                    CLBlastQuantizationInt4 = 4 } CLBlastQuantization;
+typedef enum CLBlastDispatch_ { CLBlastDispatchRoundRobin = 171,
+                                CLBlastDispatchLeastLoaded = 172 } CLBlastDispatch;
 
 // Precision enum (values in bits)
 typedef enum CLBlastPrecision_ { CLBlastPrecisionHalf = 16, CLBlastPrecisionSingle = 32,
                                  CLBlastPrecisionDouble = 64, CLBlastPrecisionComplexSingle = 3232,
-                                 CLBlastPrecisionComplexDouble = 6464 } CLBlastPrecision;
+                                 CLBlastPrecisionComplexDouble = 6464,
+                                 CLBlastPrecisionBFloat16 = 1632 } CLBlastPrecision;
 
 // =================================================================================================
 // BLAS level-1 (vector-vector) routines
@@ -247,7 +265,7 @@ CLBlastStatusCode PUBLIC_API CLBlastHcopy(const size_t n,
                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                                           cl_command_queue* queue, cl_event* event);
 
-// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
+// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY/BAXPY
 CLBlastStatusCode PUBLIC_API CLBlastSaxpy(const size_t n,
                                           const float alpha,
                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -273,8 +291,13 @@ CLBlastStatusCode PUBLIC_API CLBlastHaxpy(const size_t n,
                                           const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                           cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastBaxpy(const size_t n,
+                                          const CLBlastBFloat16 alpha,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                          cl_command_queue* queue, cl_event* event);
 
-// Dot product of two vectors: SDOT/DDOT/HDOT
+// Dot product of two vectors: SDOT/DDOT/HDOT/BDOT
 CLBlastStatusCode PUBLIC_API CLBlastSdot(const size_t n,
                                          cl_mem dot_buffer, const size_t dot_offset,
                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
@@ -290,6 +313,11 @@ CLBlastStatusCode PUBLIC_API CLBlastHdot(const size_t n,
                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                                          const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastBdot(const size_t n,
+                                         cl_mem dot_buffer, const size_t dot_offset,
+                                         const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                         const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                         cl_command_queue* queue, cl_event* event);
 
 // Dot product of two complex vectors: CDOTU/ZDOTU
 CLBlastStatusCode PUBLIC_API CLBlastCdotu(const size_t n,
@@ -1041,7 +1069,7 @@ CLBlastStatusCode PUBLIC_API CLBlastHspr2(const CLBlastLayout layout, const CLBl
 // BLAS level-3 (matrix-matrix) routines
 // =================================================================================================
 
-// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM/BGEMM
 CLBlastStatusCode PUBLIC_API CLBlastSgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                                           const size_t m, const size_t n, const size_t k,
                                           const float alpha,
@@ -1082,6 +1110,14 @@ CLBlastStatusCode PUBLIC_API CLBlastHgemm(const CLBlastLayout layout, const CLBl
                                           const cl_half beta,
                                           cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastBgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const CLBlastBFloat16 alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const CLBlastBFloat16 beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
 
 // Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM/HSYMM
 CLBlastStatusCode PUBLIC_API CLBlastSsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
@@ -1350,6 +1386,80 @@ CLBlastStatusCode PUBLIC_API CLBlastHomatcopy(const CLBlastLayout layout, const
                                               cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                                               cl_command_queue* queue, cl_event* event);
 
+// Scaled matrix-matrix addition with optional transposes (non-BLAS function): SGEAM/DGEAM/CGEAM/ZGEAM/HGEAM
+CLBlastStatusCode PUBLIC_API CLBlastSgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n,
+                                          const float alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const float beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n,
+                                          const double alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const double beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n,
+                                          const cl_float2 alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const cl_float2 beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n,
+                                          const cl_double2 alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const cl_double2 beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const size_t m, const size_t n,
+                                          const cl_half alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const cl_half beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+
+// Diagonal matrix-matrix multiplication (non-BLAS function): SDGMM/DDGMM/CDGMM/ZDGMM/HDGMM
+CLBlastStatusCode PUBLIC_API CLBlastSdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                                          const size_t m, const size_t n,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                                          const size_t m, const size_t n,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                                          const size_t m, const size_t n,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                                          const size_t m, const size_t n,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                                          const size_t m, const size_t n,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event);
+
 // Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
 CLBlastStatusCode PUBLIC_API CLBlastSaxpyBatched(const size_t n,
                                                  const float *alphas,
@@ -1382,7 +1492,7 @@ CLBlastStatusCode PUBLIC_API CLBlastHaxpyBatched(const size_t n,
                                                  const size_t batch_count,
                                                  cl_command_queue* queue, cl_event* event);
 
-// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED/BGEMMBATCHED
 CLBlastStatusCode PUBLIC_API CLBlastSgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                                                  const size_t m, const size_t n, const size_t k,
                                                  const float *alphas,
@@ -1428,6 +1538,368 @@ CLBlastStatusCode PUBLIC_API CLBlastHgemmBatched(const CLBlastLayout layout, con
                                                  cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
                                                  const size_t batch_count,
                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastBgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                 const size_t m, const size_t n, const size_t k,
+                                                 const CLBlastBFloat16 *alphas,
+                                                 const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                 const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                                 const CLBlastBFloat16 *betas,
+                                                 cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
+                                                 const size_t batch_count,
+                                                 cl_command_queue* queue, cl_event* event);
+
+// =================================================================================================
+
+// Multiple vector statistics in a single pass (non-BLAS function): SVECTORSTATS/DVECTORSTATS/
+// HVECTORSTATS. The statistics are a bitwise-or of CLBlastStatistic values.
+CLBlastStatusCode PUBLIC_API CLBlastSVectorStats(const int statistics, const size_t n,
+                                                 cl_mem stats_buffer, const size_t stats_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDVectorStats(const int statistics, const size_t n,
+                                                 cl_mem stats_buffer, const size_t stats_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHVectorStats(const int statistics, const size_t n,
+                                                 cl_mem stats_buffer, const size_t stats_offset,
+                                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                                 cl_command_queue* queue, cl_event* event);
+
+
+// Row-wise or column-wise matrix reductions (non-BLAS function): SREDUCEMATRIX/DREDUCEMATRIX/
+// HREDUCEMATRIX
+CLBlastStatusCode PUBLIC_API CLBlastSReduceMatrix(const CLBlastReduction reduction, const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                  const size_t m, const size_t n,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDReduceMatrix(const CLBlastReduction reduction, const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                  const size_t m, const size_t n,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHReduceMatrix(const CLBlastReduction reduction, const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                  const size_t m, const size_t n,
+                                                  const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                  cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                                  cl_command_queue* queue, cl_event* event);
+
+// Fused scaled-dot-product attention (non-BLAS function): SATTENTION/DATTENTION/HATTENTION
+CLBlastStatusCode PUBLIC_API CLBlastSAttention(const CLBlastLayout layout, const int causal,
+                                               const size_t m, const size_t n, const size_t d, const float scale,
+                                               const cl_mem q_buffer, const size_t *q_offsets, const size_t q_ld,
+                                               const cl_mem k_buffer, const size_t *k_offsets, const size_t k_ld,
+                                               const cl_mem v_buffer, const size_t *v_offsets, const size_t v_ld,
+                                               cl_mem o_buffer, const size_t *o_offsets, const size_t o_ld,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDAttention(const CLBlastLayout layout, const int causal,
+                                               const size_t m, const size_t n, const size_t d, const double scale,
+                                               const cl_mem q_buffer, const size_t *q_offsets, const size_t q_ld,
+                                               const cl_mem k_buffer, const size_t *k_offsets, const size_t k_ld,
+                                               const cl_mem v_buffer, const size_t *v_offsets, const size_t v_ld,
+                                               cl_mem o_buffer, const size_t *o_offsets, const size_t o_ld,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHAttention(const CLBlastLayout layout, const int causal,
+                                               const size_t m, const size_t n, const size_t d, const cl_half scale,
+                                               const cl_mem q_buffer, const size_t *q_offsets, const size_t q_ld,
+                                               const cl_mem k_buffer, const size_t *k_offsets, const size_t k_ld,
+                                               const cl_mem v_buffer, const size_t *v_offsets, const size_t v_ld,
+                                               cl_mem o_buffer, const size_t *o_offsets, const size_t o_ld,
+                                               const size_t batch_count,
+                                               cl_command_queue* queue, cl_event* event);
+
+// Planar-complex AXPY (non-BLAS function): CAXPYPLANAR/ZAXPYPLANAR
+CLBlastStatusCode PUBLIC_API CLBlastCaxpyPlanar(const size_t n,
+                                                const cl_float2 alpha,
+                                                const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZaxpyPlanar(const size_t n,
+                                                const cl_double2 alpha,
+                                                const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Planar-complex SCAL (non-BLAS function): CSCALPLANAR/ZSCALPLANAR
+CLBlastStatusCode PUBLIC_API CLBlastCscalPlanar(const size_t n,
+                                                const cl_float2 alpha,
+                                                cl_mem x_real_buffer, cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZscalPlanar(const size_t n,
+                                                const cl_double2 alpha,
+                                                cl_mem x_real_buffer, cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Planar-complex COPY (non-BLAS function): CCOPYPLANAR/ZCOPYPLANAR
+CLBlastStatusCode PUBLIC_API CLBlastCcopyPlanar(const size_t n,
+                                                const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZcopyPlanar(const size_t n,
+                                                const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                                cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Planar-complex GEMV (non-BLAS function): CGEMVPLANAR/ZGEMVPLANAR
+CLBlastStatusCode PUBLIC_API CLBlastCgemvPlanar(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                const size_t m, const size_t n,
+                                                const cl_float2 alpha,
+                                                const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                                const cl_float2 beta,
+                                                cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemvPlanar(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                const size_t m, const size_t n,
+                                                const cl_double2 alpha,
+                                                const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                                const cl_double2 beta,
+                                                cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Planar-complex GEMM (non-BLAS function): CGEMMPLANAR/ZGEMMPLANAR
+CLBlastStatusCode PUBLIC_API CLBlastCgemmPlanar(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_float2 alpha,
+                                                const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_real_buffer, const cl_mem b_imag_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_float2 beta,
+                                                cl_mem c_real_buffer, cl_mem c_imag_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZgemmPlanar(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                const size_t m, const size_t n, const size_t k,
+                                                const cl_double2 alpha,
+                                                const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                                                const cl_mem b_real_buffer, const cl_mem b_imag_buffer, const size_t b_offset, const size_t b_ld,
+                                                const cl_double2 beta,
+                                                cl_mem c_real_buffer, cl_mem c_imag_buffer, const size_t c_offset, const size_t c_ld,
+                                                cl_command_queue* queue, cl_event* event);
+
+// Converts a vector from one precision to another (non-BLAS function): y = scale * x. Supported
+// are all combinations of the real precisions and all combinations of the complex precisions.
+CLBlastStatusCode PUBLIC_API CLBlastConvert(const CLBlastPrecision x_precision, const CLBlastPrecision y_precision,
+                                            const size_t n, const double scale,
+                                            const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                            cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                            cl_command_queue* queue, cl_event* event);
+
+// Permutation of the dimensions of a tensor (non-BLAS function): SPERMUTE/DPERMUTE/CPERMUTE/
+// ZPERMUTE/HPERMUTE
+CLBlastStatusCode PUBLIC_API CLBlastSPermute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                                             const float alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDPermute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                                             const double alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCPermute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                                             const cl_float2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZPermute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                                             const cl_double2 alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                                             cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHPermute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                                             const cl_half alpha,
+                                             const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                                             cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                                             cl_command_queue* queue, cl_event* event);
+
+// Weight-only quantized matrix-matrix multiplication (non-BLAS function): SGEMMQUANTIZED/
+// DGEMMQUANTIZED/HGEMMQUANTIZED
+CLBlastStatusCode PUBLIC_API CLBlastSGemmQuantized(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                   const size_t m, const size_t n, const size_t k,
+                                                   const float alpha,
+                                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                   const CLBlastQuantization b_quantization, const size_t group_size,
+                                                   const cl_mem scales_buffer, const size_t scales_offset,
+                                                   const cl_mem zeros_buffer, const size_t zeros_offset,
+                                                   const float beta,
+                                                   cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                   cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDGemmQuantized(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                   const size_t m, const size_t n, const size_t k,
+                                                   const double alpha,
+                                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                   const CLBlastQuantization b_quantization, const size_t group_size,
+                                                   const cl_mem scales_buffer, const size_t scales_offset,
+                                                   const cl_mem zeros_buffer, const size_t zeros_offset,
+                                                   const double beta,
+                                                   cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                   cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHGemmQuantized(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                                   const size_t m, const size_t n, const size_t k,
+                                                   const cl_half alpha,
+                                                   const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                   const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                   const CLBlastQuantization b_quantization, const size_t group_size,
+                                                   const cl_mem scales_buffer, const size_t scales_offset,
+                                                   const cl_mem zeros_buffer, const size_t zeros_offset,
+                                                   const cl_half beta,
+                                                   cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                   cl_command_queue* queue, cl_event* event);
+
+// Block-sparse matrix-matrix multiplication (non-BLAS function): SGEMMBLOCKSPARSE/
+// DGEMMBLOCKSPARSE/CGEMMBLOCKSPARSE/ZGEMMBLOCKSPARSE/HGEMMBLOCKSPARSE
+CLBlastStatusCode PUBLIC_API CLBlastSGemmBlockSparse(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                     const CLBlastSide sparse_side, const size_t block_size,
+                                                     const size_t m, const size_t n, const size_t k,
+                                                     const float alpha,
+                                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                     const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                                                     const float beta,
+                                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDGemmBlockSparse(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                     const CLBlastSide sparse_side, const size_t block_size,
+                                                     const size_t m, const size_t n, const size_t k,
+                                                     const double alpha,
+                                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                     const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                                                     const double beta,
+                                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCGemmBlockSparse(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                     const CLBlastSide sparse_side, const size_t block_size,
+                                                     const size_t m, const size_t n, const size_t k,
+                                                     const cl_float2 alpha,
+                                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                     const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                                                     const cl_float2 beta,
+                                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZGemmBlockSparse(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                     const CLBlastSide sparse_side, const size_t block_size,
+                                                     const size_t m, const size_t n, const size_t k,
+                                                     const cl_double2 alpha,
+                                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                     const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                                                     const cl_double2 beta,
+                                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                     cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHGemmBlockSparse(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                                     const CLBlastSide sparse_side, const size_t block_size,
+                                                     const size_t m, const size_t n, const size_t k,
+                                                     const cl_half alpha,
+                                                     const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                                     const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                                     const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                                                     const cl_half beta,
+                                                     cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                                     cl_command_queue* queue, cl_event* event);
+
+// Householder QR factorization (non-BLAS function): SGEQRF/DGEQRF
+CLBlastStatusCode PUBLIC_API CLBlastSGeqrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem tau_buffer, const size_t tau_offset,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDGeqrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_mem tau_buffer, const size_t tau_offset,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Multiplication with the Q factor of a QR factorization (non-BLAS function): SORMQR/DORMQR
+CLBlastStatusCode PUBLIC_API CLBlastSOrmqr(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose a_transpose,
+                                           const size_t m, const size_t n, const size_t k,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem tau_buffer, const size_t tau_offset,
+                                           cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDOrmqr(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose a_transpose,
+                                           const size_t m, const size_t n, const size_t k,
+                                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           const cl_mem tau_buffer, const size_t tau_offset,
+                                           cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Communication-avoiding QR factorization of a tall and skinny matrix (non-BLAS function): STSQR/
+// DTSQR
+CLBlastStatusCode PUBLIC_API CLBlastSTsqr(const CLBlastLayout layout, const size_t m, const size_t n,
+                                          cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          cl_mem r_buffer, const size_t r_offset, const size_t r_ld,
+                                          cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDTsqr(const CLBlastLayout layout, const size_t m, const size_t n,
+                                          cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          cl_mem r_buffer, const size_t r_offset, const size_t r_ld,
+                                          cl_command_queue* queue, cl_event* event);
+
+// Batched version of the Householder QR factorization (non-BLAS function): SGEQRFBATCHED/
+// DGEQRFBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSGeqrfBatched(const CLBlastLayout layout, const size_t m, const size_t n,
+                                                  cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                  cl_mem tau_buffer, const size_t *tau_offsets,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDGeqrfBatched(const CLBlastLayout layout, const size_t m, const size_t n,
+                                                  cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                  cl_mem tau_buffer, const size_t *tau_offsets,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+
+// Triangular matrix inverse (non-BLAS function): STRTRI/DTRTRI/CTRTRI/ZTRTRI/HTRTRI
+CLBlastStatusCode PUBLIC_API CLBlastSTrtri(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDTrtri(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCTrtri(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZTrtri(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHTrtri(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                           const size_t n,
+                                           cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                           cl_command_queue* queue, cl_event* event);
+
+// Batched version of the triangular matrix inverse (non-BLAS function): STRTRIBATCHED/DTRTRIBATCHED/
+// CTRTRIBATCHED/ZTRTRIBATCHED/HTRTRIBATCHED
+CLBlastStatusCode PUBLIC_API CLBlastSTrtriBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                                  const size_t n,
+                                                  cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastDTrtriBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                                  const size_t n,
+                                                  cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastCTrtriBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                                  const size_t n,
+                                                  cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastZTrtriBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                                  const size_t n,
+                                                  cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
+CLBlastStatusCode PUBLIC_API CLBlastHTrtriBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                                  const size_t n,
+                                                  cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                                  const size_t batch_count,
+                                                  cl_command_queue* queue, cl_event* event);
 
 // =================================================================================================
 
@@ -1439,14 +1911,78 @@ CLBlastStatusCode PUBLIC_API CLBlastClearCache();
 // Further CLBlast routine calls will then run at maximum speed.
 CLBlastStatusCode PUBLIC_API CLBlastFillCache(const cl_device_id device);
 
+// CLBlast can record which routines were compiled for which precision and device into a small
+// manifest file. Recording is stopped by passing an empty filename. It can also be enabled by
+// setting the CLBLAST_MANIFEST environmental variable to the name of the manifest file.
+CLBlastStatusCode PUBLIC_API CLBlastRecordManifest(const char* manifest_file);
+
+// Pre-compiles exactly the routines listed in a previously recorded manifest for a specific device,
+// in a background thread if 'background' is non-zero. Further calls to these routines will then
+// run at maximum speed.
+CLBlastStatusCode PUBLIC_API CLBlastWarmUp(const cl_device_id device, const char* manifest_file,
+                                           const int background);
+
 // =================================================================================================
 
+// Sets the numerics mode for all further routine calls made from the calling thread. Kernels are
+// compiled and cached separately for each mode, such that e.g. latency-critical calls can use fast
+// relaxed math while other calls keep strict results.
+CLBlastStatusCode PUBLIC_API CLBlastSetNumerics(const CLBlastNumerics numerics);
+
 // Overrides tuning parameters for a specific device-precision-kernel combination. The next time
 // the target routine is called it will re-compile and use the new parameters from then on.
 CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device, const char* kernel_name,
                                                        const CLBlastPrecision precision, const size_t num_parameters,
                                                        const char** parameters_names, const size_t* parameters_values);
 
+// Retrieves the values of the given tuning parameters of a specific device-precision-kernel
+// combination as selected from the database, together with a description of the database entry
+// they were taken from (truncated to fit 'database_entry_size' characters, can be NULL).
+CLBlastStatusCode PUBLIC_API CLBlastRetrieveParameters(const cl_device_id device, const char* kernel_name,
+                                                       const CLBlastPrecision precision, const size_t num_parameters,
+                                                       const char** parameters_names, size_t* parameters_values,
+                                                       char* database_entry, const size_t database_entry_size);
+
+// =================================================================================================
+
+// Sets a budget (in bytes) for the device memory which a single routine call may allocate for its
+// temporary buffers in the given context. Routines whose regular temporary buffers would exceed the
+// budget switch to a lower-memory algorithm instead. A budget of zero removes the budget again.
+CLBlastStatusCode PUBLIC_API CLBlastSetMemoryBudget(const cl_context context, const size_t budget);
+
+// Retrieves the number of times a lower-memory algorithm was used because of the memory budget of
+// the given context since the previous call
+CLBlastStatusCode PUBLIC_API CLBlastRetrieveMemoryFallbackCount(const cl_context context,
+                                                                size_t* num_fallbacks);
+
+// =================================================================================================
+
+// Turns the given queue into a dispatcher which owns 'num_queues' extra queues on the same device,
+// over which further independent routine calls made with this queue are distributed
+CLBlastStatusCode PUBLIC_API CLBlastEnableDispatch(const cl_command_queue queue, const size_t num_queues,
+                                                   const CLBlastDispatch policy);
+
+// Makes further commands on the queue wait for the routine calls dispatched so far. The event is
+// optional (can be NULL) and completes when these calls are completed.
+CLBlastStatusCode PUBLIC_API CLBlastDispatchJoin(const cl_command_queue queue, cl_event* event);
+
+// Joins the dispatched calls and releases the dispatcher's queues
+CLBlastStatusCode PUBLIC_API CLBlastDisableDispatch(const cl_command_queue queue);
+
+// =================================================================================================
+
+// Registers a hot GEMM shape: further GEMM calls with exactly these arguments run kernels which are
+// compiled specifically for the shape
+CLBlastStatusCode PUBLIC_API CLBlastRegisterGemmShape(const CLBlastLayout layout,
+                                                      const CLBlastTranspose a_transpose,
+                                                      const CLBlastTranspose b_transpose,
+                                                      const size_t m, const size_t n, const size_t k,
+                                                      const size_t a_ld, const size_t b_ld,
+                                                      const size_t c_ld);
+
+// Removes all registered GEMM shapes
+CLBlastStatusCode PUBLIC_API CLBlastClearGemmShapes();
+
 // =================================================================================================
 
 #ifdef __cplusplus
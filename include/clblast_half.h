@@ -9,7 +9,8 @@
 //
 // This file provides simple conversion operations between fp16 (half) and fp32 (float). These
 // conversion functions are based on ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf and
-// are also part of the C++ half-precision header (http://half.sourceforge.net/).
+// are also part of the C++ half-precision header (http://half.sourceforge.net/). It also provides
+// the bfloat16 host data-type and its conversions to and from fp32 (float).
 //
 // This file is pure C99.
 //
@@ -256,5 +257,36 @@ inline float HalfToFloat(const cl_half value) {
 
 // =================================================================================================
 
+// The host data-type for bfloat16 (16-bit) holds the upper 16 bits of an IEEE single-precision
+// value: the sign, the full 8-bit exponent and the 7 most significant bits of the mantissa. It is
+// a struct rather than a typedef for unsigned short, such that it can't be confused with `cl_half`.
+typedef struct CLBlastBFloat16_ {
+  unsigned short bits;
+} CLBlastBFloat16;
+
+// Converts a IEEE-compliant single-precision value to bfloat16. This function rounds to the nearest
+// value (ties to even) and keeps NaN values as (quiet) NaNs.
+inline CLBlastBFloat16 FloatToBFloat16(const float value) {
+  CLBlastBFloat16 result;
+  ConversionBits bits;
+  bits.f32 = value;
+  if ((bits.i32 & 0x7FFFFFFFU) > 0x7F800000U) { // NaN
+    result.bits = (unsigned short)((bits.i32 >> 16) | 0x0040U);
+  }
+  else {
+    result.bits = (unsigned short)((bits.i32 + 0x7FFFU + ((bits.i32 >> 16) & 1U)) >> 16);
+  }
+  return result;
+}
+
+// Converts a bfloat16 value to IEEE-compliant single-precision floating-point. This is exact.
+inline float BFloat16ToFloat(const CLBlastBFloat16 value) {
+  ConversionBits bits;
+  bits.i32 = ((unsigned int)value.bits) << 16;
+  return bits.f32;
+}
+
+// =================================================================================================
+
 // CLBLAST_HALF_H_
 #endif
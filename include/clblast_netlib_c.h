@@ -154,7 +154,7 @@ void PUBLIC_API cblas_zcopy(const int n,
                             const void* x, const int x_inc,
                             void* y, const int y_inc);
 
-// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
+// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY/BAXPY
 void PUBLIC_API cblas_saxpy(const int n,
                             const float alpha,
                             const float* x, const int x_inc,
@@ -172,7 +172,7 @@ void PUBLIC_API cblas_zaxpy(const int n,
                             const void* x, const int x_inc,
                             void* y, const int y_inc);
 
-// Dot product of two vectors: SDOT/DDOT/HDOT
+// Dot product of two vectors: SDOT/DDOT/HDOT/BDOT
 float PUBLIC_API cblas_sdot(const int n,
                             const float* x, const int x_inc,
                             const float* y, const int y_inc);
@@ -688,7 +688,7 @@ void PUBLIC_API cblas_dspr2(const CLBlastLayout layout, const CLBlastTriangle tr
 // BLAS level-3 (matrix-matrix) routines
 // =================================================================================================
 
-// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM/BGEMM
 void PUBLIC_API cblas_sgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
                             const int m, const int n, const int k,
                             const float alpha,
@@ -920,6 +920,58 @@ void PUBLIC_API cblas_zomatcopy(const CLBlastLayout layout, const CLBlastTranspo
                                 const void* a, const int a_ld,
                                 void* b, const int b_ld);
 
+// Scaled matrix-matrix addition with optional transposes (non-BLAS function): SGEAM/DGEAM/CGEAM/ZGEAM/HGEAM
+void PUBLIC_API cblas_sgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                            const int m, const int n,
+                            const float alpha,
+                            const float* a, const int a_ld,
+                            const float* b, const int b_ld,
+                            const float beta,
+                            float* c, const int c_ld);
+void PUBLIC_API cblas_dgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                            const int m, const int n,
+                            const double alpha,
+                            const double* a, const int a_ld,
+                            const double* b, const int b_ld,
+                            const double beta,
+                            double* c, const int c_ld);
+void PUBLIC_API cblas_cgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                            const int m, const int n,
+                            const void* alpha,
+                            const void* a, const int a_ld,
+                            const void* b, const int b_ld,
+                            const void* beta,
+                            void* c, const int c_ld);
+void PUBLIC_API cblas_zgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                            const int m, const int n,
+                            const void* alpha,
+                            const void* a, const int a_ld,
+                            const void* b, const int b_ld,
+                            const void* beta,
+                            void* c, const int c_ld);
+
+// Diagonal matrix-matrix multiplication (non-BLAS function): SDGMM/DDGMM/CDGMM/ZDGMM/HDGMM
+void PUBLIC_API cblas_sdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                            const int m, const int n,
+                            const float* a, const int a_ld,
+                            const float* x, const int x_inc,
+                            float* c, const int c_ld);
+void PUBLIC_API cblas_ddgmm(const CLBlastLayout layout, const CLBlastSide side,
+                            const int m, const int n,
+                            const double* a, const int a_ld,
+                            const double* x, const int x_inc,
+                            double* c, const int c_ld);
+void PUBLIC_API cblas_cdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                            const int m, const int n,
+                            const void* a, const int a_ld,
+                            const void* x, const int x_inc,
+                            void* c, const int c_ld);
+void PUBLIC_API cblas_zdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                            const int m, const int n,
+                            const void* a, const int a_ld,
+                            const void* x, const int x_inc,
+                            void* c, const int c_ld);
+
 // =================================================================================================
 
 #ifdef __cplusplus
@@ -11,6 +11,7 @@ import os
 VENDOR_DEFAULT = "default"
 DEVICE_TYPE_DEFAULT = "All"
 DEVICE_NAME_DEFAULT = "default"
+MAX_PARAMETERS = 16  # The 'kMaxParameters' constant
 
 # List of attributes
 DEVICE_TYPE_ATTRIBUTES = ["device_vendor", "device_type"]
@@ -33,6 +34,8 @@ def precision_to_string(precision):
         return "ComplexSingle"
     elif precision == "6464":
         return "ComplexDouble"
+    elif precision == "1632":
+        return "BFloat16"
     else:
         raise("Unknown precision: " + precision)
 
@@ -63,20 +66,92 @@ def get_cpp_footer():
     return "\n} // namespace database\n" + "} // namespace clblast\n"
 
 
-def get_cpp_precision(family, precision):
-    """Retrieves the C++ code for the start of a new precision"""
-    precision_string = precision_to_string(precision)
-    camelcase_name = family.title().replace("_", "")
-    return("\n\nconst Database::DatabaseEntry %s%s = {\n  \"%s\", Precision::k%s, {\n"
-           % (camelcase_name, precision_string, camelcase_name, precision_string))
+def get_cpp_family_name(family):
+    """Retrieves the C++ (camel-case) name of a kernel family"""
+    return family.title().replace("_", "")
+
+
+def get_cpp_parameters(family, parameter_names):
+    """Retrieves the C++ code for the list of parameter names of a kernel family"""
+    names = ", ".join(["\"%s\"" % name for name in parameter_names])
+    return "\n\nconstexpr const char* %sParameters[] = {\n  %s\n};\n\n" % (get_cpp_family_name(family), names) + \
+        get_cpp_separator()
 
 
 def get_cpp_device_vendor(vendor, device_type):
-    """Retrieves the C++ code for the (default) vendor and device type"""
+    """Retrieves the C++ code for the (default) vendor and device type, as a comment and as a name"""
     if vendor == VENDOR_DEFAULT and device_type == DEVICE_TYPE_DEFAULT:
-        return "    { // Default\n      kDeviceType%s, \"%s\", {\n" % (device_type, vendor)
+        return "Default", "kDeviceType%s" % device_type
     device_type_caps = device_type[0].upper() + device_type[1:]
-    return "    { // %s %ss\n      kDeviceType%s, \"%s\", {\n" % (vendor, device_type, device_type_caps, vendor)
+    return "%s %ss" % (vendor, device_type), "kDeviceType%s" % device_type_caps
+
+
+def database_hash(text):
+    """Computes the 32-bit FNV-1a hash of a string, matching the 'DatabaseHash' function of the C++ code"""
+    hash_value = 2166136261
+    for byte in bytearray(text.encode("utf-8")):
+        hash_value = ((hash_value ^ byte) * 16777619) & 0xFFFFFFFF
+    return hash_value
+
+
+def get_cpp_index(device_names):
+    """Computes the device index of a database entry: an open-addressing hash table with linear probing, holding
+    the position of each device plus one (zero for empty slots). Its size is a power of two at least twice the number
+    of devices, such that the look-ups in the C++ code need only few probes."""
+    index_size = 2
+    while index_size < 2 * len(device_names):
+        index_size *= 2
+    index = [0] * index_size
+    for device_id, device_name in enumerate(device_names):
+        slot = database_hash(device_name) & (index_size - 1)
+        while index[slot] != 0:
+            slot = (slot + 1) & (index_size - 1)
+        index[slot] = device_id + 1
+    return index
+
+
+def get_cpp_precision(family, precision, parameter_names, vendors):
+    """Retrieves the C++ code for a single precision of a kernel family: the tables of devices, of vendors and the
+    device index and finally the database entry itself. The 'vendors' argument is a list of tuples holding the vendor
+    name, the device type, and a list of device names with their parameter values."""
+    precision_string = precision_to_string(precision)
+    name = get_cpp_family_name(family) + precision_string
+    assert len(parameter_names) <= MAX_PARAMETERS
+
+    # The devices of all vendors together, with a comment per vendor-type combination
+    result = "\n\nconstexpr Database::StaticDevice %sDevices[] = {\n" % name
+    device_names = []
+    for vendor, device_type, devices in vendors:
+        result += "  // %s\n" % get_cpp_device_vendor(vendor, device_type)[0]
+        for device_name, values in devices:
+            device_name_quoted = "\"%s\"," % device_name
+            result += "  { %-50s { %s } },\n" % (device_name_quoted, ", ".join([str(v) for v in values]))
+            device_names.append(device_name)
+    result += "};\n"
+
+    # The vendors, each with their device type and their range of devices
+    result += "constexpr Database::StaticVendor %sVendors[] = {\n" % name
+    first_device = 0
+    for vendor, device_type, devices in vendors:
+        result += "  { %s, \"%s\", %d, %d },\n" % (get_cpp_device_vendor(vendor, device_type)[1], vendor,
+                                                  first_device, len(devices))
+        first_device += len(devices)
+    result += "};\n"
+
+    # The device index, 32 values per line
+    index = get_cpp_index(device_names)
+    result += "constexpr uint16_t %sIndex[] = {\n" % name
+    for i in range(0, len(index), 32):
+        result += "  " + ", ".join([str(v) for v in index[i:i + 32]]) + ",\n"
+    result += "};\n"
+
+    # The entry itself
+    result += "constexpr Database::StaticEntry %s = {\n" % name
+    result += "  \"%s\", Precision::k%s, %sParameters, %d,\n" % (get_cpp_family_name(family), precision_string,
+                                                              get_cpp_family_name(family), len(parameter_names))
+    result += "  %sDevices, %sVendors, %d, %sIndex, %d\n" % (name, name, len(vendors), name, len(index))
+    result += "};\n\n" + get_cpp_separator()
+    return result
 
 
 def print_cpp_database(database, output_dir):
@@ -87,70 +162,69 @@ def print_cpp_database(database, output_dir):
     for family_name in kernel_families:
         family_database = [s for s in database["sections"] if s["kernel_family"] == family_name]
 
-        # Opens a new file for each kernel family
+        # Loops over the different precision (e.g. 16, 32, 3232, 64, 6464). The bfloat16 precision (1632) is
+        # always included, such that it falls back to the single-precision defaults if it isn't tuned yet
+        family_parameter_names = None
+        family_precisions = []
+        precisions = set([s["precision"] for s in database["sections"]])  # Based on full database
+        precisions = sorted(precisions | {"1632"})
+        for precision in precisions:
+            precision_database = [s for s in family_database if s["precision"] == precision]
+
+            # In case there is nothing found at all (e.g. 16-bit): continue as if this was a precision of 32 but
+            # with the defaults only
+            if len(precision_database) == 0:
+                print("[database] No results found for %s:%s, retrieving defaults from %s:32" %
+                      (family_name, precision, family_name))
+                precision_database = [s for s in family_database if s["precision"] == "32"
+                                      and s["device_vendor"] == VENDOR_DEFAULT
+                                      and s["device_type"] == DEVICE_TYPE_DEFAULT
+                                      and s["device"] == DEVICE_NAME_DEFAULT]
+
+            # Loops over device vendors (e.g. AMD) and device types (e.g. GPU)
+            vendors = []
+            device_vendors = sorted(set([s["device_vendor"] for s in precision_database]))
+            for vendor in device_vendors:
+                vendor_database = [s for s in precision_database if s["device_vendor"] == vendor]
+                device_types = sorted(set([s["device_type"] for s in vendor_database]))
+                for device_type in device_types:
+                    type_database = [s for s in vendor_database if s["device_type"] == device_type]
+
+                    # Loops over every device of this vendor-type combination
+                    devices = []
+                    device_names = sorted(set([s["device"] for s in type_database]))
+                    for device_name in device_names:
+                        device_database = [s for s in type_database if s["device"] == device_name]
+
+                        # Collects the parameters for this entry
+                        parameter_names = []
+                        parameter_values = []
+                        kernels = sorted(set([s["kernel"] for s in device_database]))
+                        for kernel in kernels:
+                            kernel_database = [s for s in device_database if s["kernel"] == kernel]
+
+                            assert len(kernel_database) == 1
+                            results = kernel_database[0]["results"]
+
+                            assert len(results) == 1
+                            new_parameters = results[0]["parameters"]
+                            for parameter_name in sorted(new_parameters):
+                                parameter_names.append(parameter_name)
+                                parameter_values.append(new_parameters[parameter_name])
+
+                        # All devices of a kernel family share the same parameter names
+                        if family_parameter_names is None:
+                            family_parameter_names = parameter_names
+                        assert parameter_names == family_parameter_names
+                        devices.append((device_name.strip(), parameter_values))
+                    vendors.append((vendor, device_type, devices))
+            family_precisions.append((precision, vendors))
+
+        # Outputs a new file for each kernel family
         full_path = os.path.join(output_dir, family_name + ".hpp")
         with open(full_path, 'w+') as f:
             f.write(get_cpp_header(family_name))
-
-            # Loops over the different precision (e.g. 16, 32, 3232, 64, 6464)
-            precisions = sorted(set([s["precision"] for s in database["sections"]]))  # Based on full database
-            for precision in precisions:
-                precision_database = [s for s in family_database if s["precision"] == precision]
-                f.write(get_cpp_precision(family_name, precision))
-
-                # In case there is nothing found at all (e.g. 16-bit): continue as if this was a precision of 32 but
-                # with the defaults only
-                if len(precision_database) == 0:
-                    print("[database] No results found for %s:%s, retrieving defaults from %s:32" %
-                          (family_name, precision, family_name))
-                    precision_database = [s for s in family_database if s["precision"] == "32"
-                                          and s["device_vendor"] == VENDOR_DEFAULT
-                                          and s["device_type"] == DEVICE_TYPE_DEFAULT
-                                          and s["device"] == DEVICE_NAME_DEFAULT]
-
-                # Loops over device vendors (e.g. AMD)
-                device_vendors = sorted(set([s["device_vendor"] for s in precision_database]))
-                for vendor in device_vendors:
-                    vendor_database = [s for s in precision_database if s["device_vendor"] == vendor]
-
-                    # Loops over device types (e.g. GPU)
-                    device_types = sorted(set([s["device_type"] for s in vendor_database]))
-                    for device_type in device_types:
-                        type_database = [s for s in vendor_database if s["device_type"] == device_type]
-                        f.write(get_cpp_device_vendor(vendor, device_type))
-
-                        # Loops over every device of this vendor-type combination
-                        devices = sorted(set([s["device"] for s in type_database]))
-                        for device_name in devices:
-                            device_database = [s for s in type_database if s["device"] == device_name]
-                            device_name_quoted = "\"%s\"," % device_name.strip()
-                            device_name_cpp = "        { %-50s { " % device_name_quoted
-                            f.write(device_name_cpp)
-
-                            # Collects the parameters for this entry
-                            parameters = []
-                            kernels = sorted(set([s["kernel"] for s in device_database]))
-                            for kernel in kernels:
-                                kernel_database = [s for s in device_database if s["kernel"] == kernel]
-
-                                assert len(kernel_database) == 1
-                                results = kernel_database[0]["results"]
-
-                                assert len(results) == 1
-                                new_parameters = results[0]["parameters"]
-                                for parameter_name in sorted(new_parameters):
-                                    parameter_value = new_parameters[parameter_name]
-                                    parameters.append("{\"" + parameter_name + "\"," + str(parameter_value) + "}")
-
-                            # Prints the entry
-                            f.write(", ".join(parameters))
-                            f.write(" } },\n")
-
-                        # Prints the vendor-type combination footer
-                        f.write("      }\n    },\n")
-
-                # Prints the precision footer
-                f.write("  }\n};\n\n" + get_cpp_separator())
-
-            # Prints the file footer
+            f.write(get_cpp_parameters(family_name, family_parameter_names))
+            for precision, vendors in family_precisions:
+                f.write(get_cpp_precision(family_name, precision, family_parameter_names, vendors))
             f.write(get_cpp_footer())
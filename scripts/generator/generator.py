@@ -29,7 +29,7 @@ import argparse
 import generator.cpp as cpp
 import generator.doc as doc
 from generator.routine import Routine
-from generator.datatype import H, S, D, C, Z, Sc, Dz, iH, iS, iD, iC, iZ, Css, Zdd, Ccs, Zzd, T, Tc, TU
+from generator.datatype import H, S, D, C, Z, B, Sc, Dz, iH, iS, iD, iC, iZ, Css, Zdd, Ccs, Zzd, T, Tc, TU
 
 FILES = [
     "/include/clblast.h",
@@ -42,10 +42,10 @@ FILES = [
     "/include/clblast_netlib_c.h",
     "/src/clblast_netlib_c.cpp",
 ]
-HEADER_LINES = [122, 78, 126, 24, 29, 41, 29, 65, 32]
-FOOTER_LINES = [25, 139, 27, 38, 6, 6, 6, 9, 2]
+HEADER_LINES = [146, 101, 144, 25, 29, 41, 29, 65, 32]
+FOOTER_LINES = [280, 1290, 444, 1161, 6, 6, 6, 9, 2]
 HEADER_LINES_DOC = 0
-FOOTER_LINES_DOC = 63
+FOOTER_LINES_DOC = 1407
 
 # Different possibilities for requirements
 ald_m = "The value of `a_ld` must be at least `m`."
@@ -54,10 +54,12 @@ ald_k_one = "The value of `a_ld` must be at least `k + 1`."
 ald_kl_ku_one = "The value of `a_ld` must be at least `kl + ku + 1`."
 ald_transa_m_k = "When `transpose_a == Transpose::kNo`, then `a_ld` must be at least `m`, otherwise `a_ld` must be at least `k`."
 ald_trans_n_k = "When `transpose == Transpose::kNo`, then `a_ld` must be at least `n`, otherwise `a_ld` must be at least `k`."
+ald_transa_m_n = "When `transpose_a == Transpose::kNo`, then `a_ld` must be at least `m`, otherwise `a_ld` must be at least `n`."
 ald_side_m_n = "When `side = Side::kLeft` then `a_ld` must be at least `m`, otherwise `a_ld` must be at least `n`."
 bld_m = "The value of `b_ld` must be at least `m`."
 bld_n = "The value of `b_ld` must be at least `n`."
 bld_transb_k_n = "When `transpose_b == Transpose::kNo`, then `b_ld` must be at least `k`, otherwise `b_ld` must be at least `n`."
+bld_transb_m_n = "When `transpose_b == Transpose::kNo`, then `b_ld` must be at least `m`, otherwise `b_ld` must be at least `n`."
 bld_trans_n_k = "When `transpose == Transpose::kNo`, then `b_ld` must be at least `n`, otherwise `b_ld` must be at least `k`."
 cld_m = "The value of `c_ld` must be at least `m`."
 cld_n = "The value of `c_ld` must be at least `n`."
@@ -83,15 +85,18 @@ an = "n * a_ld"
 apn = "((n*(n+1)) / 2)"
 cn = "n * c_ld"
 xmn = size_helper("a_transpose != CLBlastTransposeNo", "m", "n", "x_inc")
+xmns = size_helper("side == CLBlastSideLeft", "m", "n", "x_inc")
 ynm = size_helper("a_transpose != CLBlastTransposeNo", "n", "m", "y_inc")
 amn = size_helper("layout == CLBlastLayoutRowMajor", "m", "n", "a_ld")
 amns = size_helper("side == CLBlastSideLeft", "m", "n", "a_ld")
+amna = size_helper(layout_transpose_condition("a"), "m", "n", "a_ld")
 amk = size_helper(layout_transpose_condition("a"), "m", "k", "a_ld")
 ank = size_helper(layout_transpose_condition("a"), "n", "k", "a_ld")
 ankab = size_helper(layout_transpose_condition("ab"), "n", "k", "a_ld")
 bkn = size_helper(layout_transpose_condition("b"), "k", "n", "b_ld")
 bnkab = size_helper(layout_transpose_condition("ab"), "n", "k", "b_ld")
 bmn = size_helper("layout == CLBlastLayoutRowMajor", "m", "n", "b_ld")
+bmnb = size_helper(layout_transpose_condition("b"), "m", "n", "b_ld")
 bnma = size_helper(layout_transpose_condition("a"), "n", "m", "b_ld")
 cmn = size_helper("layout == CLBlastLayoutRowMajor", "m", "n", "c_ld")
 ammn = size_helper("layout == CLBlastLayoutRowMajor", "m", "((side == CLBlastSideLeft) ? m : n)", "a_ld")
@@ -109,8 +114,8 @@ ROUTINES = [
   Routine(True,  True,  False, "1", "swap",  T, [S,D,C,Z,H],      ["n"],               [],                                                     [],         ["x","y"],                    [xn,yn],       [],           "",    "Swap two vectors", "Interchanges _n_ elements of vectors _x_ and _y_.", []),
   Routine(True,  True,  False, "1", "scal",  T, [S,D,C,Z,H],      ["n"],               [],                                                     [],         ["x"],                        [xn],          ["alpha"],    "",    "Vector scaling", "Multiplies _n_ elements of vector _x_ by a scalar constant _alpha_.", []),
   Routine(True,  True,  False, "1", "copy",  T, [S,D,C,Z,H],      ["n"],               [],                                                     ["x"],      ["y"],                        [xn,yn],       [],           "",    "Vector copy", "Copies the contents of vector _x_ into vector _y_.", []),
-  Routine(True,  True,  False, "1", "axpy",  T, [S,D,C,Z,H],      ["n"],               [],                                                     ["x"],      ["y"],                        [xn,yn],       ["alpha"],    "",    "Vector-times-constant plus vector", "Performs the operation _y = alpha * x + y_, in which _x_ and _y_ are vectors and _alpha_ is a scalar constant.", []),
-  Routine(True,  True,  False, "1", "dot",   T, [S,D,H],          ["n"],               [],                                                     ["x","y"],  ["dot"],                      [xn,yn,"1"],   [],           "n",   "Dot product of two vectors", "Multiplies _n_ elements of the vectors _x_ and _y_ element-wise and accumulates the results. The sum is stored in the _dot_ buffer.", []),
+  Routine(True,  True,  False, "1", "axpy",  T, [S,D,C,Z,H,B],    ["n"],               [],                                                     ["x"],      ["y"],                        [xn,yn],       ["alpha"],    "",    "Vector-times-constant plus vector", "Performs the operation _y = alpha * x + y_, in which _x_ and _y_ are vectors and _alpha_ is a scalar constant.", []),
+  Routine(True,  True,  False, "1", "dot",   T, [S,D,H,B],        ["n"],               [],                                                     ["x","y"],  ["dot"],                      [xn,yn,"1"],   [],           "n",   "Dot product of two vectors", "Multiplies _n_ elements of the vectors _x_ and _y_ element-wise and accumulates the results. The sum is stored in the _dot_ buffer.", []),
   Routine(True,  True,  False, "1", "dotu",  T, [C,Z],            ["n"],               [],                                                     ["x","y"],  ["dot"],                      [xn,yn,"1"],   [],           "n",   "Dot product of two complex vectors", "See the regular xDOT routine.", []),
   Routine(True,  True,  False, "1", "dotc",  T, [C,Z],            ["n"],               [],                                                     ["x","y"],  ["dot"],                      [xn,yn,"1"],   [],           "n",   "Dot product of two complex vectors, one conjugated", "See the regular xDOT routine.", []),
   Routine(True,  True,  False, "1", "nrm2",  T, [S,D,Sc,Dz,H],    ["n"],               [],                                                     ["x"],      ["nrm2"],                     [xn,"1"],      [],           "2*n", "Euclidian norm of a vector", "Accumulates the square of _n_ elements in the _x_ vector and takes the square root. The resulting L2 norm is stored in the _nrm2_ buffer.", []),
@@ -134,8 +139,8 @@ ROUTINES = [
   Routine(True,  True,  False, "2a", "tbmv",  T,  [S,D,C,Z,H],    ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "n",   "Triangular banded matrix-vector multiplication", "Same operation as xGEMV, but matrix _A_ is triangular and banded instead.", [ald_k_one]),
   Routine(True,  True,  False, "2a", "tpmv",  T,  [S,D,C,Z,H],    ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "n",   "Triangular packed matrix-vector multiplication", "Same operation as xGEMV, but matrix _A_ is a triangular packed matrix instead and repreented as _AP_.", []),
   Routine(True,  True,  False, "2a", "trsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a triangular system of equations", "", []),
-  Routine(False, True,  False, "2a", "tbsv",  T,  [S,D,C,Z],      ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a banded triangular system of equations", "", [ald_k_one]),
-  Routine(False, True,  False, "2a", "tpsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "",    "Solves a packed triangular system of equations", "", []),
+  Routine(True,  True,  False, "2a", "tbsv",  T,  [S,D,C,Z],      ["n","k"],           ["layout","triangle","a_transpose","diagonal"],         ["a"],      ["x"],                        [an,xn],       [],               "",    "Solves a banded triangular system of equations", "", [ald_k_one]),
+  Routine(True,  True,  False, "2a", "tpsv",  T,  [S,D,C,Z],      ["n"],               ["layout","triangle","a_transpose","diagonal"],         ["ap"],     ["x"],                        [apn,xn],      [],               "",    "Solves a packed triangular system of equations", "", []),
   # Level 2: matrix update
   Routine(True,  True,  False, "2b", "ger",   T,  [S,D,H],        ["m","n"],           ["layout"],                                             ["x","y"],  ["a"],                        [xm,yn,amn],   ["alpha"],        "",    "General rank-1 matrix update", "Performs the operation _A = alpha * x * y^T + A_, in which _x_ is an input vector, _y^T_ is the transpose of the input vector _y_, _A_ is the matrix to be updated, and _alpha_ is a scalar value.", [ald_m]),
   Routine(True,  True,  False, "2b", "geru",  T,  [C,Z],          ["m","n"],           ["layout"],                                             ["x","y"],  ["a"],                        [xm,yn,amn],   ["alpha"],        "",    "General rank-1 complex matrix update", "Same operation as xGER, but with complex data-types.", [ald_m]),
@@ -150,7 +155,7 @@ ROUTINES = [
   Routine(True,  True,  False, "2b", "spr2",  T,  [S,D,H],        ["n"],               ["layout","triangle"],                                  ["x","y"],  ["ap"],                       [xn,yn,apn],   ["alpha"],        "",    "Symmetric packed rank-2 matrix update", "Same operation as xSPR2, but matrix _A_ is a symmetric packed matrix instead and represented as _AP_.", []),
 ],
 [  # Level 3: matrix-matrix
-  Routine(True,  True,  False, "3", "gemm",  T,  [S,D,C,Z,H],     ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "General matrix-matrix multiplication", "Performs the matrix product _C = alpha * A * B + beta * C_, in which _A_ (_m_ by _k_) and _B_ (_k_ by _n_) are two general rectangular input matrices, _C_ (_m_ by _n_) is the matrix to be updated, and _alpha_ and _beta_ are scalar values. The matrices _A_ and/or _B_ can optionally be transposed before performing the operation.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
+  Routine(True,  True,  False, "3", "gemm",  T,  [S,D,C,Z,H,B],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "General matrix-matrix multiplication", "Performs the matrix product _C = alpha * A * B + beta * C_, in which _A_ (_m_ by _k_) and _B_ (_k_ by _n_) are two general rectangular input matrices, _C_ (_m_ by _n_) is the matrix to be updated, and _alpha_ and _beta_ are scalar values. The matrices _A_ and/or _B_ can optionally be transposed before performing the operation.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
   Routine(True,  True,  False, "3", "symm",  T,  [S,D,C,Z,H],     ["m","n"],            ["layout","side","triangle"],                          ["a","b"],  ["c"],                        [ammn,bmnn,cmn], ["alpha","beta"], "",    "Symmetric matrix-matrix multiplication", "Same operation as xGEMM, but _A_ is symmetric instead. In case of `side == kLeft`, _A_ is a symmetric _m_ by _m_ matrix and _C = alpha * A * B + beta * C_ is performed. Otherwise, in case of `side == kRight`, _A_ is a symmtric _n_ by _n_ matrix and _C = alpha * B * A + beta * C_ is performed.", [ald_side_m_n, bld_m, cld_m]),
   Routine(True,  True,  False, "3", "hemm",  T,  [C,Z],           ["m","n"],            ["layout","side","triangle"],                          ["a","b"],  ["c"],                        [ammn,bmnn,cmn], ["alpha","beta"], "",    "Hermitian matrix-matrix multiplication", "Same operation as xSYMM, but _A_ is an Hermitian matrix instead.", [ald_side_m_n, bld_m, cld_m]),
   Routine(True,  True,  False, "3", "syrk",  T,  [S,D,C,Z,H],     ["n","k"],            ["layout","triangle","a_transpose"],                   ["a"],      ["c"],                        [ank,cn],        ["alpha","beta"], "",    "Rank-K update of a symmetric matrix", "Performs the matrix product _C = alpha * A * A^T + beta * C_ or _C = alpha * A^T * A + beta * C_, in which _A_ is a general matrix and _A^T_ is its transpose, _C_ (_n_ by _n_) is the symmetric matrix to be updated, and _alpha_ and _beta_ are scalar values.", [ald_trans_n_k, cld_m]),
@@ -163,9 +168,11 @@ ROUTINES = [
 [  # Level X: extra routines (not part of BLAS)
   # Special routines:
   Routine(True,  True,  False, "x", "omatcopy", T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose"],                              ["a"],      ["b"],                        [amn,bnma],      ["alpha"],        "",    "Scaling and out-place transpose/copy (non-BLAS function)", "Performs scaling and out-of-place transposition/copying of matrices according to _B = alpha*op(A)_, in which _A_ is an input matrix (_m_ rows by _n_ columns), _B_ an output matrix, and _alpha_ a scalar value. The operation _op_ can be a normal matrix copy, a transposition or a conjugate transposition.", [ald_m, bld_n]),
+  Routine(True,  True,  False, "x", "geam",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amna,bmnb,cmn], ["alpha","beta"], "",    "Scaled matrix-matrix addition with optional transposes (non-BLAS function)", "Performs the operation _C = alpha * op(A) + beta * op(B)_, in which _A_ and _B_ are input matrices, _C_ is an output matrix (_m_ rows by _n_ columns), and _alpha_ and _beta_ are scalar values. Each operation _op_ can be a normal matrix copy, a transposition or a conjugate transposition. The matrix _C_ can be the same as _A_ or _B_ (in-place) as long as that input is not transposed and has the same offset and leading dimension as _C_.", [ald_transa_m_n, bld_transb_m_n, cld_m]),
+  Routine(True,  True,  False, "x", "dgmm",     T, [S,D,C,Z,H],   ["m","n"],            ["layout","side"],                                     ["a","x"],  ["c"],                        [amn,xmns,cmn],  [],               "",    "Diagonal matrix-matrix multiplication (non-BLAS function)", "Performs the operation _C = diag(x) * A_ in case of `side == kLeft` or _C = A * diag(x)_ in case of `side == kRight`, in which _A_ is an input matrix (_m_ rows by _n_ columns), _x_ is an input vector holding the diagonal (_m_ or _n_ elements respectively), and _C_ is an output matrix (_m_ rows by _n_ columns). The matrix _C_ can be the same as _A_ (in-place) as long as it has the same offset and leading dimension as _A_.", [ald_m, cld_m]),
   # Batched routines:
   Routine(True,  True,  True,  "x", "axpy",     T, [S,D,C,Z,H],   ["n"],                [],                                                    ["x"],      ["y"],                        [xn,yn],         ["alpha"],        "",    "Batched version of AXPY", "As AXPY, but multiple operations are batched together for better performance.", []),
-  Routine(True,  True,  True,  "x", "gemm",     T, [S,D,C,Z,H],   ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "Batched version of GEMM", "As GEMM, but multiple operations are batched together for better performance.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
+  Routine(True,  True,  True,  "x", "gemm",     T, [S,D,C,Z,H,B], ["m","n","k"],        ["layout","a_transpose","b_transpose"],                ["a","b"],  ["c"],                        [amk,bkn,cmn],   ["alpha","beta"], "",    "Batched version of GEMM", "As GEMM, but multiple operations are batched together for better performance.", [ald_transa_m_k, bld_transb_k_n, cld_m]),
 ]]
 
 
@@ -14,6 +14,7 @@ def precision_to_full_name(x):
         'D': "Double",
         'C': "ComplexSingle",
         'Z': "ComplexDouble",
+        'B': "BFloat16",
     }[x]
 
 
@@ -50,7 +50,7 @@ def clblast_cc(routine):
     if routine.implemented:
         result += routine.routine_header_cpp(12, "") + " {" + NL
         result += "  try {" + NL
-        result += "    auto queue_cpp = Queue(*queue);" + NL
+        result += "    auto queue_cpp = Queue(DispatchQueue(*queue, " + routine.dispatch_cost() + "));" + NL
         result += "    auto routine = X" + routine.plain_name() + "<" + routine.template.template + ">(queue_cpp, event);" + NL
         if routine.batched:
             result += "    " + (NL + "    ").join(routine.batched_transform_to_cpp()) + NL
@@ -197,22 +197,22 @@ def wrapper_clblas(routine):
                 result += "," + NL + indent + "num_queues, queues, num_wait_events, wait_events, events);"
 
             # There is no clBLAS available, forward the call to one of the available functions
-            else:  # Half-precision
+            else:  # Half-precision or bfloat16
                 indent = " " * (24 + routine.length())
 
                 # Convert to float (note: also integer buffers are stored as half/float)
                 for buf in routine.inputs + routine.outputs:
-                    result += "  auto " + buf + "_buffer_bis = HalfToFloatBuffer(" + buf + "_buffer, queues[0]);" + NL
+                    result += "  auto " + buf + "_buffer_bis = " + flavour.to_float() + "Buffer(" + buf + "_buffer, queues[0]);" + NL
 
                 # Call the float routine
                 result += "  auto status = clblasX" + routine.name + "("
-                result += ("," + NL + indent).join([a for a in routine.arguments_half()])
+                result += ("," + NL + indent).join([a for a in routine.arguments_half(flavour)])
                 result += "," + NL + indent + "num_queues, queues, num_wait_events, wait_events, events);"
                 result += NL
 
                 # Convert back to half
                 for buf in routine.outputs:
-                    result += "  FloatToHalfBuffer(" + buf + "_buffer, " + buf + "_buffer_bis, queues[0]);" + NL
+                    result += "  " + flavour.from_float() + "Buffer(" + buf + "_buffer, " + buf + "_buffer_bis, queues[0]);" + NL
                 result += "  return status;"
 
             # Complete
@@ -269,21 +269,21 @@ def wrapper_cblas(routine):
                 result += extra_argument + end_of_line + ");" + NL
 
             # There is no CBLAS available, forward the call to one of the available functions
-            else:  # Half-precision
+            else:  # Half-precision or bfloat16
                 indent = " " * (9 + routine.length())
 
                 # Convert to float (note: also integer buffers are stored as half/float)
                 for buf in routine.inputs + routine.outputs:
-                    result += "  auto " + buf + "_buffer_bis = HalfToFloatBuffer(" + buf + "_buffer);" + NL
+                    result += "  auto " + buf + "_buffer_bis = " + flavour.to_float() + "Buffer(" + buf + "_buffer);" + NL
 
                 # Call the float routine
                 result += "  cblasX" + routine.name + "("
-                result += ("," + NL + indent).join([a for a in routine.arguments_half()])
+                result += ("," + NL + indent).join([a for a in routine.arguments_half(flavour)])
                 result += ");" + NL
 
                 # Convert back to half
                 for buf in routine.outputs:
-                    result += "  FloatToHalfBuffer(" + buf + "_buffer, " + buf + "_buffer_bis);" + NL
+                    result += "  " + flavour.from_float() + "Buffer(" + buf + "_buffer, " + buf + "_buffer_bis);" + NL
 
             # Complete
             result += "}" + NL
@@ -324,7 +324,7 @@ def wrapper_cublas(routine):
                 result += "  return status;"
 
             # There is no cuBLAS available, forward the call to one of the available functions
-            else:  # Half-precision
+            else:  # Half-precision or bfloat16
                 result += "  return CUBLAS_STATUS_NOT_SUPPORTED;"
             #     indent = " " * (24 + routine.length())
 
@@ -358,7 +358,7 @@ def performance_test(routine, level_string):
     result += "  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);" + NL
     default = convert.precision_to_full_name(routine.flavours[0].precision_name)
     result += "  switch(clblast::GetPrecision(command_line_args, clblast::Precision::k" + default + ")) {" + NL
-    for precision in ["H", "S", "D", "C", "Z"]:
+    for precision in ["H", "S", "D", "C", "Z", "B"]:
         result += "    case clblast::Precision::k" + convert.precision_to_full_name(precision) + ":"
         found = False
         for flavour in routine.flavours:
@@ -8,11 +8,13 @@
 
 # Short-hands for data-types
 D_HALF = "half"
+D_BFLOAT16 = "bfloat16"
 D_FLOAT = "float"
 D_DOUBLE = "double"
 D_FLOAT2 = "float2"
 D_DOUBLE2 = "double2"
 D_HALF_OPENCL = "cl_half"
+D_BFLOAT16_OPENCL = "CLBlastBFloat16"
 D_FLOAT2_OPENCL = "cl_float2"
 D_DOUBLE2_OPENCL = "cl_double2"
 
@@ -73,7 +75,7 @@ class DataType:
     def test_template(self):
         """Returns the template as used in the correctness/performance tests"""
         buffer_type = "clblast::" + self.buffer_type if self.is_non_standard() else self.buffer_type
-        beta_cpp = "clblast::" + self.beta_cpp if self.beta_cpp in [D_HALF, D_FLOAT2, D_DOUBLE2] else self.beta_cpp
+        beta_cpp = "clblast::" + self.beta_cpp if self.beta_cpp in [D_HALF, D_BFLOAT16, D_FLOAT2, D_DOUBLE2] else self.beta_cpp
         if self.buffer_type != self.beta_cpp:
             return "<" + buffer_type + "," + self.beta_cpp + ">, " + buffer_type + ", " + beta_cpp
         return "<" + buffer_type + ">, " + buffer_type + ", " + beta_cpp
@@ -85,7 +87,15 @@ class DataType:
 
     def is_non_standard(self):
         """Current type is of a non-standard type"""
-        return self.buffer_type in [D_HALF, D_FLOAT2, D_DOUBLE2]
+        return self.buffer_type in [D_HALF, D_BFLOAT16, D_FLOAT2, D_DOUBLE2]
+
+    def to_float(self):
+        """Name of the conversion function from this storage-only type to single-precision (half & bfloat16)"""
+        return "BFloat16ToFloat" if self.precision_name == "B" else "HalfToFloat"
+
+    def from_float(self):
+        """As above, but for the conversion in the opposite direction"""
+        return "FloatToBFloat16" if self.precision_name == "B" else "FloatToHalf"
 
     def name_cublas(self):
         if "i" in self.name:
@@ -99,6 +109,7 @@ S = DataType("S", "S", D_FLOAT, [D_FLOAT] * 4, D_FLOAT)  # single (32)
 D = DataType("D", "D", D_DOUBLE, [D_DOUBLE] * 4, D_DOUBLE)  # double (64)
 C = DataType("C", "C", D_FLOAT2, [D_FLOAT2] * 2 + [D_FLOAT2_OPENCL] * 2, D_FLOAT2)  # single-complex (3232)
 Z = DataType("Z", "Z", D_DOUBLE2, [D_DOUBLE2] * 2 + [D_DOUBLE2_OPENCL] * 2, D_DOUBLE2)  # double-complex (6464)
+B = DataType("B", "B", D_BFLOAT16, [D_BFLOAT16] * 2 + [D_BFLOAT16_OPENCL] * 2, D_BFLOAT16)  # bfloat16 (1632)
 
 # Special cases
 Sc = DataType("C", "Sc", D_FLOAT2, [D_FLOAT2] * 4, D_FLOAT2)  # As C, but with real output
@@ -67,6 +67,22 @@ class Routine:
     def batch_count_doc(self):
         return ["`const size_t batch_count`: Number of batches. This value must be positive."] if self.batched else []
 
+    def dispatch_cost(self):
+        """Estimated cost of a call (proportional to the number of operations), as a C++ expression"""
+        if self.name == "gbmv":
+            cost = ["m", "(kl + ku + 1)"]
+        elif self.level in ["2a", "2b"] and self.sizes == ["n"]:
+            cost = ["n", "n"]
+        elif self.level == "2a" and self.sizes == ["n", "k"]:
+            cost = ["n", "(k + 1)"]
+        elif self.level == "3" and "side" in self.options:
+            cost = ["m", "n", "((side == Side::kLeft) ? m : n)"]
+        elif self.level == "3" and len(self.sizes) == 2:
+            cost = ["n", "n", "k"]
+        else:
+            cost = self.sizes
+        return " * ".join(cost + self.batch_count_list()) or "1"
+
     def batched_transform_to_cpp(self):
         result = []
         for scalar in self.scalars:
@@ -208,8 +224,9 @@ class Routine:
     def short_names_tested(self):
         """As above, but excludes some"""
         names = [f.name + self.upper_name() for f in self.flavours]
-        if "H" + self.upper_name() in names:
-            names.remove("H" + self.upper_name())
+        for precision in ["H", "B"]:
+            if precision + self.upper_name() in names:
+                names.remove(precision + self.upper_name())
         return "/".join(names)
 
     def buffers_first(self):
@@ -409,10 +426,10 @@ class Routine:
             return [name + "_cpp"]
         return []
 
-    def scalar_half_to_float(self, name):
-        """As above, but converts from float to half"""
+    def scalar_half_to_float(self, name, flavour):
+        """As above, but converts from half (or bfloat16) to float"""
         if name in self.scalars:
-            return ["HalfToFloat(" + name + ")"]
+            return [flavour.to_float() + "(" + name + ")"]
         return []
 
     def scalar_use(self, name, flavour):
@@ -626,13 +643,13 @@ class Routine:
                 list(chain(*[self.buffer(b) for b in self.scalar_buffers_second()])) +
                 list(chain(*[self.scalar(s) for s in self.other_scalars()])))
 
-    def arguments_half(self):
-        """As above, but with conversions from half to float"""
+    def arguments_half(self, flavour):
+        """As above, but with conversions from half (or bfloat16) to float"""
         return (self.options_list() + self.sizes_list() +
                 list(chain(*[self.buffer_bis(b) for b in self.scalar_buffers_first()])) +
-                self.scalar_half_to_float("alpha") +
+                self.scalar_half_to_float("alpha", flavour) +
                 list(chain(*[self.buffer_bis(b) for b in self.buffers_first()])) +
-                self.scalar_half_to_float("beta") +
+                self.scalar_half_to_float("beta", flavour) +
                 list(chain(*[self.buffer_bis(b) for b in self.buffers_second()])) +
                 list(chain(*[self.buffer_bis(b) for b in self.scalar_buffers_second()])) +
                 list(chain(*[self.scalar(s) for s in self.other_scalars()])))
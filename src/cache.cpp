@@ -54,10 +54,9 @@ void Cache<Key, Value>::Store(Key &&key, Value &&value) {
 
 #if __cplusplus >= 201402L
   // emplace() into a map
-  auto r = cache_.emplace(std::move(key), std::move(value));
-  if (!r.second) {
-    throw LogicError("Cache::Store: object already in cache");
-  }
+  // an object might already be there in case it was concurrently built by another thread (e.g.
+  // by the WarmUp function), in that case the existing object is kept
+  cache_.emplace(std::move(key), std::move(value));
 #else
   // emplace_back() into a vector
   cache_.emplace_back(std::move(key), std::move(value));
@@ -95,6 +94,20 @@ void Cache<Key, Value>::RemoveBySubset(const Key &key) {
   }
 }
 
+template <typename Key, typename Value>
+template <int I>
+void Cache<Key, Value>::RemoveByPrefix(const Key &key) {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  const auto &prefix = std::get<I>(key);
+  auto it = cache_.begin();
+  while (it != cache_.end()) {
+    if (std::get<I>((*it).first).compare(0, prefix.size(), prefix) == 0) {
+      it = cache_.erase(it);
+    }
+    else ++it;
+  }
+}
+
 template <typename Key, typename Value>
 void Cache<Key, Value>::Invalidate() {
   std::lock_guard<std::mutex> lock(cache_mutex_);
@@ -114,12 +127,14 @@ Cache<Key, Value> Cache<Key, Value>::instance_;
 
 template class Cache<BinaryKey, std::string>;
 template std::string BinaryCache::Get(const BinaryKeyRef &, bool *) const;
+template void BinaryCache::RemoveByPrefix<2>(const BinaryKey &); // routine name
 
 // =================================================================================================
 
 template class Cache<ProgramKey, Program>;
 template Program ProgramCache::Get(const ProgramKeyRef &, bool *) const;
-template void ProgramCache::RemoveBySubset<1, 2>(const ProgramKey &); // precision and routine name
+template void ProgramCache::RemoveBySubset<1, 3>(const ProgramKey &); // precision and routine name
+template void ProgramCache::RemoveByPrefix<3>(const ProgramKey &); // routine name
 
 // =================================================================================================
 
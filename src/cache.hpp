@@ -46,6 +46,9 @@ public:
   void Remove(const Key &key);
   template <int I1, int I2> void RemoveBySubset(const Key &key); // currently supports 2 indices
 
+  // Removes all entries of which the string at index I starts with that of a given key
+  template <int I> void RemoveByPrefix(const Key &key);
+
   static Cache<Key, Value> &Instance();
 
 private:
@@ -67,9 +70,10 @@ private:
 // =================================================================================================
 
 // The key struct for the cache of compiled OpenCL binaries
-// Order of fields: precision, routine_name, device_name (smaller fields first)
-typedef std::tuple<Precision, std::string, std::string> BinaryKey;
-typedef std::tuple<const Precision &, const std::string &, const std::string &> BinaryKeyRef;
+// Order of fields: precision, numerics, routine_name, device_name (smaller fields first)
+typedef std::tuple<Precision, Numerics, std::string, std::string> BinaryKey;
+typedef std::tuple<const Precision &, const Numerics &,
+                   const std::string &, const std::string &> BinaryKeyRef;
 
 typedef Cache<BinaryKey, std::string> BinaryCache;
 
@@ -79,9 +83,10 @@ extern template std::string BinaryCache::Get(const BinaryKeyRef &, bool *) const
 // =================================================================================================
 
 // The key struct for the cache of compiled OpenCL programs (context-dependent)
-// Order of fields: context, precision, routine_name (smaller fields first)
-typedef std::tuple<cl_context, Precision, std::string> ProgramKey;
-typedef std::tuple<const cl_context &, const Precision &, const std::string &> ProgramKeyRef;
+// Order of fields: context, precision, numerics, routine_name (smaller fields first)
+typedef std::tuple<cl_context, Precision, Numerics, std::string> ProgramKey;
+typedef std::tuple<const cl_context &, const Precision &, const Numerics &,
+                   const std::string &> ProgramKeyRef;
 
 typedef Cache<ProgramKey, Program> ProgramCache;
 
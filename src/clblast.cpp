@@ -14,8 +14,14 @@
 // =================================================================================================
 
 #include <string>
+#include <thread>
+#include <mutex>
 
 #include "cache.hpp"
+#include "manifest.hpp"
+#include "memory_budget.hpp"
+#include "dispatcher.hpp"
+#include "gemm_shapes.hpp"
 #include "clblast.h"
 
 // BLAS level-1 includes
@@ -47,6 +53,8 @@
 #include "routines/level2/xtbmv.hpp"
 #include "routines/level2/xtpmv.hpp"
 #include "routines/level2/xtrsv.hpp"
+#include "routines/level2/xtbsv.hpp"
+#include "routines/level2/xtpsv.hpp"
 #include "routines/level2/xger.hpp"
 #include "routines/level2/xgeru.hpp"
 #include "routines/level2/xgerc.hpp"
@@ -72,8 +80,23 @@
 
 // Level-x includes (non-BLAS)
 #include "routines/levelx/xomatcopy.hpp"
+#include "routines/levelx/xinvert.hpp"
+#include "routines/levelx/xgeam.hpp"
+#include "routines/levelx/xdgmm.hpp"
 #include "routines/levelx/xaxpybatched.hpp"
 #include "routines/levelx/xgemmbatched.hpp"
+#include "routines/levelx/xstats.hpp"
+#include "routines/levelx/xreduce.hpp"
+#include "routines/levelx/xattention.hpp"
+#include "routines/levelx/xaxpbyplanar.hpp"
+#include "routines/levelx/xgemvplanar.hpp"
+#include "routines/levelx/xgemmplanar.hpp"
+#include "routines/levelx/xconvert.hpp"
+#include "routines/levelx/xpermute.hpp"
+#include "routines/levelx/xgemmquantized.hpp"
+#include "routines/levelx/xgemmblocksparse.hpp"
+#include "routines/levelx/xgeqrf.hpp"
+#include "routines/levelx/xtrtri.hpp"
 
 namespace clblast {
 
@@ -174,7 +197,7 @@ StatusCode Swap(const size_t n,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xswap<T>(queue_cpp, event);
     routine.DoSwap(n,
                    Buffer<T>(x_buffer), x_offset, x_inc,
@@ -210,7 +233,7 @@ StatusCode Scal(const size_t n,
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xscal<T>(queue_cpp, event);
     routine.DoScal(n,
                    alpha,
@@ -246,7 +269,7 @@ StatusCode Copy(const size_t n,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xcopy<T>(queue_cpp, event);
     routine.DoCopy(n,
                    Buffer<T>(x_buffer), x_offset, x_inc,
@@ -275,7 +298,7 @@ template StatusCode PUBLIC_API Copy<half>(const size_t,
                                           cl_mem, const size_t, const size_t,
                                           cl_command_queue*, cl_event*);
 
-// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
+// Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY/BAXPY
 template <typename T>
 StatusCode Axpy(const size_t n,
                 const T alpha,
@@ -283,7 +306,7 @@ StatusCode Axpy(const size_t n,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xaxpy<T>(queue_cpp, event);
     routine.DoAxpy(n,
                    alpha,
@@ -317,8 +340,13 @@ template StatusCode PUBLIC_API Axpy<half>(const size_t,
                                           const cl_mem, const size_t, const size_t,
                                           cl_mem, const size_t, const size_t,
                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Axpy<bfloat16>(const size_t,
+                                              const bfloat16,
+                                              const cl_mem, const size_t, const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
 
-// Dot product of two vectors: SDOT/DDOT/HDOT
+// Dot product of two vectors: SDOT/DDOT/HDOT/BDOT
 template <typename T>
 StatusCode Dot(const size_t n,
                cl_mem dot_buffer, const size_t dot_offset,
@@ -326,7 +354,7 @@ StatusCode Dot(const size_t n,
                const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xdot<T>(queue_cpp, event);
     routine.DoDot(n,
                   Buffer<T>(dot_buffer), dot_offset,
@@ -350,6 +378,11 @@ template StatusCode PUBLIC_API Dot<half>(const size_t,
                                          const cl_mem, const size_t, const size_t,
                                          const cl_mem, const size_t, const size_t,
                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dot<bfloat16>(const size_t,
+                                             cl_mem, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
 
 // Dot product of two complex vectors: CDOTU/ZDOTU
 template <typename T>
@@ -359,7 +392,7 @@ StatusCode Dotu(const size_t n,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xdotu<T>(queue_cpp, event);
     routine.DoDotu(n,
                    Buffer<T>(dot_buffer), dot_offset,
@@ -387,7 +420,7 @@ StatusCode Dotc(const size_t n,
                 const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xdotc<T>(queue_cpp, event);
     routine.DoDotc(n,
                    Buffer<T>(dot_buffer), dot_offset,
@@ -414,7 +447,7 @@ StatusCode Nrm2(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xnrm2<T>(queue_cpp, event);
     routine.DoNrm2(n,
                    Buffer<T>(nrm2_buffer), nrm2_offset,
@@ -450,7 +483,7 @@ StatusCode Asum(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xasum<T>(queue_cpp, event);
     routine.DoAsum(n,
                    Buffer<T>(asum_buffer), asum_offset,
@@ -486,7 +519,7 @@ StatusCode Sum(const size_t n,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xsum<T>(queue_cpp, event);
     routine.DoSum(n,
                   Buffer<T>(sum_buffer), sum_offset,
@@ -522,7 +555,7 @@ StatusCode Amax(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xamax<T>(queue_cpp, event);
     routine.DoAmax(n,
                    Buffer<unsigned int>(imax_buffer), imax_offset,
@@ -558,7 +591,7 @@ StatusCode Amin(const size_t n,
                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xamin<T>(queue_cpp, event);
     routine.DoAmin(n,
                    Buffer<unsigned int>(imin_buffer), imin_offset,
@@ -594,7 +627,7 @@ StatusCode Max(const size_t n,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xmax<T>(queue_cpp, event);
     routine.DoMax(n,
                   Buffer<unsigned int>(imax_buffer), imax_offset,
@@ -630,7 +663,7 @@ StatusCode Min(const size_t n,
                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
     auto routine = Xmin<T>(queue_cpp, event);
     routine.DoMin(n,
                   Buffer<unsigned int>(imin_buffer), imin_offset,
@@ -674,7 +707,7 @@ StatusCode Gemv(const Layout layout, const Transpose a_transpose,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n));
     auto routine = Xgemv<T>(queue_cpp, event);
     routine.DoGemv(layout, a_transpose,
                    m, n,
@@ -738,7 +771,7 @@ StatusCode Gbmv(const Layout layout, const Transpose a_transpose,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * (kl + ku + 1)));
     auto routine = Xgbmv<T>(queue_cpp, event);
     routine.DoGbmv(layout, a_transpose,
                    m, n, kl, ku,
@@ -802,7 +835,7 @@ StatusCode Hemv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xhemv<T>(queue_cpp, event);
     routine.DoHemv(layout, triangle,
                    n,
@@ -842,7 +875,7 @@ StatusCode Hbmv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * (k + 1)));
     auto routine = Xhbmv<T>(queue_cpp, event);
     routine.DoHbmv(layout, triangle,
                    n, k,
@@ -882,7 +915,7 @@ StatusCode Hpmv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xhpmv<T>(queue_cpp, event);
     routine.DoHpmv(layout, triangle,
                    n,
@@ -922,7 +955,7 @@ StatusCode Symv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xsymv<T>(queue_cpp, event);
     routine.DoSymv(layout, triangle,
                    n,
@@ -970,7 +1003,7 @@ StatusCode Sbmv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * (k + 1)));
     auto routine = Xsbmv<T>(queue_cpp, event);
     routine.DoSbmv(layout, triangle,
                    n, k,
@@ -1018,7 +1051,7 @@ StatusCode Spmv(const Layout layout, const Triangle triangle,
                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xspmv<T>(queue_cpp, event);
     routine.DoSpmv(layout, triangle,
                    n,
@@ -1063,7 +1096,7 @@ StatusCode Trmv(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xtrmv<T>(queue_cpp, event);
     routine.DoTrmv(layout, triangle, a_transpose, diagonal,
                    n,
@@ -1106,7 +1139,7 @@ StatusCode Tbmv(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * (k + 1)));
     auto routine = Xtbmv<T>(queue_cpp, event);
     routine.DoTbmv(layout, triangle, a_transpose, diagonal,
                    n, k,
@@ -1149,7 +1182,7 @@ StatusCode Tpmv(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xtpmv<T>(queue_cpp, event);
     routine.DoTpmv(layout, triangle, a_transpose, diagonal,
                    n,
@@ -1192,7 +1225,7 @@ StatusCode Trsv(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xtrsv<T>(queue_cpp, event);
     routine.DoTrsv(layout, triangle, a_transpose, diagonal,
                    n,
@@ -1224,12 +1257,20 @@ template StatusCode PUBLIC_API Trsv<double2>(const Layout, const Triangle, const
 
 // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
 template <typename T>
-StatusCode Tbsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t, const size_t,
-                const cl_mem, const size_t, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Tbsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n, const size_t k,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * (k + 1)));
+    auto routine = Xtbsv<T>(queue_cpp, event);
+    routine.DoTbsv(layout, triangle, a_transpose, diagonal,
+                   n, k,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tbsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t, const size_t,
@@ -1254,12 +1295,20 @@ template StatusCode PUBLIC_API Tbsv<double2>(const Layout, const Triangle, const
 
 // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
 template <typename T>
-StatusCode Tpsv(const Layout, const Triangle, const Transpose, const Diagonal,
-                const size_t,
-                const cl_mem, const size_t,
-                cl_mem, const size_t, const size_t,
-                cl_command_queue*, cl_event*) {
-  return StatusCode::kNotImplemented;
+StatusCode Tpsv(const Layout layout, const Triangle triangle, const Transpose a_transpose, const Diagonal diagonal,
+                const size_t n,
+                const cl_mem ap_buffer, const size_t ap_offset,
+                cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
+    auto routine = Xtpsv<T>(queue_cpp, event);
+    routine.DoTpsv(layout, triangle, a_transpose, diagonal,
+                   n,
+                   Buffer<T>(ap_buffer), ap_offset,
+                   Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
 }
 template StatusCode PUBLIC_API Tpsv<float>(const Layout, const Triangle, const Transpose, const Diagonal,
                                            const size_t,
@@ -1292,7 +1341,7 @@ StatusCode Ger(const Layout layout,
                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n));
     auto routine = Xger<T>(queue_cpp, event);
     routine.DoGer(layout,
                   m, n,
@@ -1335,7 +1384,7 @@ StatusCode Geru(const Layout layout,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n));
     auto routine = Xgeru<T>(queue_cpp, event);
     routine.DoGeru(layout,
                    m, n,
@@ -1371,7 +1420,7 @@ StatusCode Gerc(const Layout layout,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n));
     auto routine = Xgerc<T>(queue_cpp, event);
     routine.DoGerc(layout,
                    m, n,
@@ -1406,7 +1455,7 @@ StatusCode Her(const Layout layout, const Triangle triangle,
                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xher<std::complex<T>,T>(queue_cpp, event);
     routine.DoHer(layout, triangle,
                   n,
@@ -1438,7 +1487,7 @@ StatusCode Hpr(const Layout layout, const Triangle triangle,
                cl_mem ap_buffer, const size_t ap_offset,
                cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xhpr<std::complex<T>,T>(queue_cpp, event);
     routine.DoHpr(layout, triangle,
                   n,
@@ -1471,7 +1520,7 @@ StatusCode Her2(const Layout layout, const Triangle triangle,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xher2<T>(queue_cpp, event);
     routine.DoHer2(layout, triangle,
                    n,
@@ -1507,7 +1556,7 @@ StatusCode Hpr2(const Layout layout, const Triangle triangle,
                 cl_mem ap_buffer, const size_t ap_offset,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xhpr2<T>(queue_cpp, event);
     routine.DoHpr2(layout, triangle,
                    n,
@@ -1542,7 +1591,7 @@ StatusCode Syr(const Layout layout, const Triangle triangle,
                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xsyr<T>(queue_cpp, event);
     routine.DoSyr(layout, triangle,
                   n,
@@ -1580,7 +1629,7 @@ StatusCode Spr(const Layout layout, const Triangle triangle,
                cl_mem ap_buffer, const size_t ap_offset,
                cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xspr<T>(queue_cpp, event);
     routine.DoSpr(layout, triangle,
                   n,
@@ -1619,7 +1668,7 @@ StatusCode Syr2(const Layout layout, const Triangle triangle,
                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xsyr2<T>(queue_cpp, event);
     routine.DoSyr2(layout, triangle,
                    n,
@@ -1662,7 +1711,7 @@ StatusCode Spr2(const Layout layout, const Triangle triangle,
                 cl_mem ap_buffer, const size_t ap_offset,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n));
     auto routine = Xspr2<T>(queue_cpp, event);
     routine.DoSpr2(layout, triangle,
                    n,
@@ -1699,7 +1748,7 @@ template StatusCode PUBLIC_API Spr2<half>(const Layout, const Triangle,
 // BLAS level-3 (matrix-matrix) routines
 // =================================================================================================
 
-// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+// General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM/BGEMM
 template <typename T>
 StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                 const size_t m, const size_t n, const size_t k,
@@ -1710,7 +1759,7 @@ StatusCode Gemm(const Layout layout, const Transpose a_transpose, const Transpos
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * k));
     auto routine = Xgemm<T>(queue_cpp, event);
     routine.DoGemm(layout, a_transpose, b_transpose,
                    m, n, k,
@@ -1762,6 +1811,14 @@ template StatusCode PUBLIC_API Gemm<half>(const Layout, const Transpose, const T
                                           const half,
                                           cl_mem, const size_t, const size_t,
                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Gemm<bfloat16>(const Layout, const Transpose, const Transpose,
+                                              const size_t, const size_t, const size_t,
+                                              const bfloat16,
+                                              const cl_mem, const size_t, const size_t,
+                                              const cl_mem, const size_t, const size_t,
+                                              const bfloat16,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
 
 // Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM/HSYMM
 template <typename T>
@@ -1774,7 +1831,7 @@ StatusCode Symm(const Layout layout, const Side side, const Triangle triangle,
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * ((side == Side::kLeft) ? m : n)));
     auto routine = Xsymm<T>(queue_cpp, event);
     routine.DoSymm(layout, side, triangle,
                    m, n,
@@ -1838,7 +1895,7 @@ StatusCode Hemm(const Layout layout, const Side side, const Triangle triangle,
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * ((side == Side::kLeft) ? m : n)));
     auto routine = Xhemm<T>(queue_cpp, event);
     routine.DoHemm(layout, side, triangle,
                    m, n,
@@ -1877,7 +1934,7 @@ StatusCode Syrk(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n * k));
     auto routine = Xsyrk<T>(queue_cpp, event);
     routine.DoSyrk(layout, triangle, a_transpose,
                    n, k,
@@ -1934,7 +1991,7 @@ StatusCode Herk(const Layout layout, const Triangle triangle, const Transpose a_
                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n * k));
     auto routine = Xherk<std::complex<T>,T>(queue_cpp, event);
     routine.DoHerk(layout, triangle, a_transpose,
                    n, k,
@@ -1971,7 +2028,7 @@ StatusCode Syr2k(const Layout layout, const Triangle triangle, const Transpose a
                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                  cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n * k));
     auto routine = Xsyr2k<T>(queue_cpp, event);
     routine.DoSyr2k(layout, triangle, ab_transpose,
                     n, k,
@@ -2035,7 +2092,7 @@ StatusCode Her2k(const Layout layout, const Triangle triangle, const Transpose a
                  cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
                  cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n * k));
     auto routine = Xher2k<T,U>(queue_cpp, event);
     routine.DoHer2k(layout, triangle, ab_transpose,
                     n, k,
@@ -2073,7 +2130,7 @@ StatusCode Trmm(const Layout layout, const Side side, const Triangle triangle, c
                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * ((side == Side::kLeft) ? m : n)));
     auto routine = Xtrmm<T>(queue_cpp, event);
     routine.DoTrmm(layout, side, triangle, a_transpose, diagonal,
                    m, n,
@@ -2123,7 +2180,7 @@ StatusCode Trsm(const Layout layout, const Side side, const Triangle triangle, c
                 cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                 cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * ((side == Side::kLeft) ? m : n)));
     auto routine = Xtrsm<T>(queue_cpp, event);
     routine.DoTrsm(layout, side, triangle, a_transpose, diagonal,
                    m, n,
@@ -2171,7 +2228,7 @@ StatusCode Omatcopy(const Layout layout, const Transpose a_transpose,
                     cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
                     cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n));
     auto routine = Xomatcopy<T>(queue_cpp, event);
     routine.DoOmatcopy(layout, a_transpose,
                        m, n,
@@ -2212,6 +2269,120 @@ template StatusCode PUBLIC_API Omatcopy<half>(const Layout, const Transpose,
                                               cl_mem, const size_t, const size_t,
                                               cl_command_queue*, cl_event*);
 
+// Scaled matrix-matrix addition with optional transposes (non-BLAS function): SGEAM/DGEAM/CGEAM/ZGEAM/HGEAM
+template <typename T>
+StatusCode Geam(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                const size_t m, const size_t n,
+                const T alpha,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                const T beta,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n));
+    auto routine = Xgeam<T>(queue_cpp, event);
+    routine.DoGeam(layout, a_transpose, b_transpose,
+                   m, n,
+                   alpha,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(b_buffer), b_offset, b_ld,
+                   beta,
+                   Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Geam<float>(const Layout, const Transpose, const Transpose,
+                                           const size_t, const size_t,
+                                           const float,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           const float,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Geam<double>(const Layout, const Transpose, const Transpose,
+                                            const size_t, const size_t,
+                                            const double,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const double,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Geam<float2>(const Layout, const Transpose, const Transpose,
+                                            const size_t, const size_t,
+                                            const float2,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const float2,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Geam<double2>(const Layout, const Transpose, const Transpose,
+                                             const size_t, const size_t,
+                                             const double2,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const double2,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Geam<half>(const Layout, const Transpose, const Transpose,
+                                          const size_t, const size_t,
+                                          const half,
+                                          const cl_mem, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          const half,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
+
+// Diagonal matrix-matrix multiplication (non-BLAS function): SDGMM/DDGMM/CDGMM/ZDGMM/HDGMM
+template <typename T>
+StatusCode Dgmm(const Layout layout, const Side side,
+                const size_t m, const size_t n,
+                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n));
+    auto routine = Xdgmm<T>(queue_cpp, event);
+    routine.DoDgmm(layout, side,
+                   m, n,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(x_buffer), x_offset, x_inc,
+                   Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Dgmm<float>(const Layout, const Side,
+                                           const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           const cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dgmm<double>(const Layout, const Side,
+                                            const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dgmm<float2>(const Layout, const Side,
+                                            const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dgmm<double2>(const Layout, const Side,
+                                             const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Dgmm<half>(const Layout, const Side,
+                                          const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          const cl_mem, const size_t, const size_t,
+                                          cl_mem, const size_t, const size_t,
+                                          cl_command_queue*, cl_event*);
+
 // Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
 template <typename T>
 StatusCode AxpyBatched(const size_t n,
@@ -2221,7 +2392,7 @@ StatusCode AxpyBatched(const size_t n,
                        const size_t batch_count,
                        cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * batch_count));
     auto routine = XaxpyBatched<T>(queue_cpp, event);
     auto alphas_cpp = std::vector<T>();
     auto x_offsets_cpp = std::vector<size_t>();
@@ -2270,7 +2441,7 @@ template StatusCode PUBLIC_API AxpyBatched<half>(const size_t,
                                                  const size_t,
                                                  cl_command_queue*, cl_event*);
 
-// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+// Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED/BGEMMBATCHED
 template <typename T>
 StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
                        const size_t m, const size_t n, const size_t k,
@@ -2282,7 +2453,7 @@ StatusCode GemmBatched(const Layout layout, const Transpose a_transpose, const T
                        const size_t batch_count,
                        cl_command_queue* queue, cl_event* event) {
   try {
-    auto queue_cpp = Queue(*queue);
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * k * batch_count));
     auto routine = XgemmBatched<T>(queue_cpp, event);
     auto alphas_cpp = std::vector<T>();
     auto betas_cpp = std::vector<T>();
@@ -2352,6 +2523,779 @@ template StatusCode PUBLIC_API GemmBatched<half>(const Layout, const Transpose,
                                                  cl_mem, const size_t*, const size_t,
                                                  const size_t,
                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBatched<bfloat16>(const Layout, const Transpose, const Transpose,
+                                                     const size_t, const size_t, const size_t,
+                                                     const bfloat16*,
+                                                     const cl_mem, const size_t*, const size_t,
+                                                     const cl_mem, const size_t*, const size_t,
+                                                     const bfloat16*,
+                                                     cl_mem, const size_t*, const size_t,
+                                                     const size_t,
+                                                     cl_command_queue*, cl_event*);
+
+// =================================================================================================
+
+// Multiple vector statistics in a single pass (non-BLAS function): SVECTORSTATS/DVECTORSTATS/...
+template <typename T>
+StatusCode VectorStats(const Statistic statistics, const size_t n,
+                       cl_mem stats_buffer, const size_t stats_offset,
+                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                       cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
+    auto routine = Xstats<T>(queue_cpp, event);
+    routine.DoStats(statistics, n,
+                    Buffer<T>(stats_buffer), stats_offset,
+                    Buffer<T>(x_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API VectorStats<float>(const Statistic, const size_t,
+                                                  cl_mem, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API VectorStats<double>(const Statistic, const size_t,
+                                                   cl_mem, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API VectorStats<half>(const Statistic, const size_t,
+                                                 cl_mem, const size_t,
+                                                 const cl_mem, const size_t, const size_t,
+                                                 cl_command_queue*, cl_event*);
+
+// Row-wise or column-wise matrix reductions (non-BLAS function): SREDUCEMATRIX/DREDUCEMATRIX/...
+template <typename T>
+StatusCode ReduceMatrix(const Reduction reduction, const Layout layout, const Transpose a_transpose,
+                        const size_t m, const size_t n,
+                        const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                        cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                        cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n));
+    auto routine = Xreduce<T>(queue_cpp, event);
+    routine.DoReduce(reduction, layout, a_transpose,
+                     m, n,
+                     Buffer<T>(a_buffer), a_offset, a_ld,
+                     Buffer<T>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ReduceMatrix<float>(const Reduction, const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceMatrix<double>(const Reduction, const Layout, const Transpose,
+                                                    const size_t, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ReduceMatrix<half>(const Reduction, const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+
+// Fused scaled-dot-product attention (non-BLAS function): SATTENTION/DATTENTION/HATTENTION
+template <typename T>
+StatusCode Attention(const Layout layout, const bool causal,
+                     const size_t m, const size_t n, const size_t d, const T scale,
+                     const cl_mem q_buffer, const size_t *q_offsets, const size_t q_ld,
+                     const cl_mem k_buffer, const size_t *k_offsets, const size_t k_ld,
+                     const cl_mem v_buffer, const size_t *v_offsets, const size_t v_ld,
+                     cl_mem o_buffer, const size_t *o_offsets, const size_t o_ld,
+                     const size_t batch_count,
+                     cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * d * batch_count));
+    auto routine = Xattention<T>(queue_cpp, event);
+    auto q_offsets_cpp = std::vector<size_t>();
+    auto k_offsets_cpp = std::vector<size_t>();
+    auto v_offsets_cpp = std::vector<size_t>();
+    auto o_offsets_cpp = std::vector<size_t>();
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      q_offsets_cpp.push_back(q_offsets[batch]);
+      k_offsets_cpp.push_back(k_offsets[batch]);
+      v_offsets_cpp.push_back(v_offsets[batch]);
+      o_offsets_cpp.push_back(o_offsets[batch]);
+    }
+    routine.DoAttention(layout, causal,
+                        m, n, d, scale,
+                        Buffer<T>(q_buffer), q_offsets_cpp, q_ld,
+                        Buffer<T>(k_buffer), k_offsets_cpp, k_ld,
+                        Buffer<T>(v_buffer), v_offsets_cpp, v_ld,
+                        Buffer<T>(o_buffer), o_offsets_cpp, o_ld,
+                        batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Attention<float>(const Layout, const bool,
+                                                const size_t, const size_t, const size_t, const float,
+                                                const cl_mem, const size_t*, const size_t,
+                                                const cl_mem, const size_t*, const size_t,
+                                                const cl_mem, const size_t*, const size_t,
+                                                cl_mem, const size_t*, const size_t,
+                                                const size_t,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Attention<double>(const Layout, const bool,
+                                                 const size_t, const size_t, const size_t, const double,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 const cl_mem, const size_t*, const size_t,
+                                                 cl_mem, const size_t*, const size_t,
+                                                 const size_t,
+                                                 cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Attention<half>(const Layout, const bool,
+                                               const size_t, const size_t, const size_t, const half,
+                                               const cl_mem, const size_t*, const size_t,
+                                               const cl_mem, const size_t*, const size_t,
+                                               const cl_mem, const size_t*, const size_t,
+                                               cl_mem, const size_t*, const size_t,
+                                               const size_t,
+                                               cl_command_queue*, cl_event*);
+
+// Planar-complex AXPY (non-BLAS function): CAXPYPLANAR/ZAXPYPLANAR
+template <typename T>
+StatusCode AxpyPlanar(const size_t n,
+                      const T alpha,
+                      const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  using R = typename BaseType<T>::Type;
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
+    auto routine = XaxpbyPlanar<T>(queue_cpp, event);
+    routine.DoAxpyPlanar(n,
+                         alpha,
+                         Buffer<R>(x_real_buffer), Buffer<R>(x_imag_buffer), x_offset, x_inc,
+                         Buffer<R>(y_real_buffer), Buffer<R>(y_imag_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API AxpyPlanar<float2>(const size_t,
+                                                  const float2,
+                                                  const cl_mem, const cl_mem, const size_t, const size_t,
+                                                  cl_mem, cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API AxpyPlanar<double2>(const size_t,
+                                                   const double2,
+                                                   const cl_mem, const cl_mem, const size_t, const size_t,
+                                                   cl_mem, cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+
+
+// Planar-complex SCAL (non-BLAS function): CSCALPLANAR/ZSCALPLANAR
+template <typename T>
+StatusCode ScalPlanar(const size_t n,
+                      const T alpha,
+                      cl_mem x_real_buffer, cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  using R = typename BaseType<T>::Type;
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
+    auto routine = XaxpbyPlanar<T>(queue_cpp, event);
+    routine.DoScalPlanar(n,
+                         alpha,
+                         Buffer<R>(x_real_buffer), Buffer<R>(x_imag_buffer), x_offset, x_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API ScalPlanar<float2>(const size_t,
+                                                  const float2,
+                                                  cl_mem, cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API ScalPlanar<double2>(const size_t,
+                                                   const double2,
+                                                   cl_mem, cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+
+
+// Planar-complex COPY (non-BLAS function): CCOPYPLANAR/ZCOPYPLANAR
+template <typename T>
+StatusCode CopyPlanar(const size_t n,
+                      const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                      cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  using R = typename BaseType<T>::Type;
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
+    auto routine = XaxpbyPlanar<T>(queue_cpp, event);
+    routine.DoCopyPlanar(n,
+                         Buffer<R>(x_real_buffer), Buffer<R>(x_imag_buffer), x_offset, x_inc,
+                         Buffer<R>(y_real_buffer), Buffer<R>(y_imag_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API CopyPlanar<float2>(const size_t,
+                                                  const cl_mem, const cl_mem, const size_t, const size_t,
+                                                  cl_mem, cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API CopyPlanar<double2>(const size_t,
+                                                   const cl_mem, const cl_mem, const size_t, const size_t,
+                                                   cl_mem, cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+
+
+// Planar-complex GEMV (non-BLAS function): CGEMVPLANAR/ZGEMVPLANAR
+template <typename T>
+StatusCode GemvPlanar(const Layout layout, const Transpose a_transpose,
+                      const size_t m, const size_t n,
+                      const T alpha,
+                      const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                      const T beta,
+                      cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                      cl_command_queue* queue, cl_event* event) {
+  using R = typename BaseType<T>::Type;
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n));
+    auto routine = XgemvPlanar<T>(queue_cpp, event);
+    routine.DoGemvPlanar(layout, a_transpose,
+                         m, n,
+                         alpha,
+                         Buffer<R>(a_real_buffer), Buffer<R>(a_imag_buffer), a_offset, a_ld,
+                         Buffer<R>(x_real_buffer), Buffer<R>(x_imag_buffer), x_offset, x_inc,
+                         beta,
+                         Buffer<R>(y_real_buffer), Buffer<R>(y_imag_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemvPlanar<float2>(const Layout, const Transpose,
+                                                  const size_t, const size_t,
+                                                  const float2,
+                                                  const cl_mem, const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const cl_mem, const size_t, const size_t,
+                                                  const float2,
+                                                  cl_mem, cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemvPlanar<double2>(const Layout, const Transpose,
+                                                   const size_t, const size_t,
+                                                   const double2,
+                                                   const cl_mem, const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const cl_mem, const size_t, const size_t,
+                                                   const double2,
+                                                   cl_mem, cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+
+
+// Planar-complex GEMM (non-BLAS function): CGEMMPLANAR/ZGEMMPLANAR
+template <typename T>
+StatusCode GemmPlanar(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const size_t k,
+                      const T alpha,
+                      const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                      const cl_mem b_real_buffer, const cl_mem b_imag_buffer, const size_t b_offset, const size_t b_ld,
+                      const T beta,
+                      cl_mem c_real_buffer, cl_mem c_imag_buffer, const size_t c_offset, const size_t c_ld,
+                      cl_command_queue* queue, cl_event* event) {
+  using R = typename BaseType<T>::Type;
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * k));
+    auto routine = XgemmPlanar<T>(queue_cpp, event);
+    routine.DoGemmPlanar(layout, a_transpose, b_transpose,
+                         m, n, k,
+                         alpha,
+                         Buffer<R>(a_real_buffer), Buffer<R>(a_imag_buffer), a_offset, a_ld,
+                         Buffer<R>(b_real_buffer), Buffer<R>(b_imag_buffer), b_offset, b_ld,
+                         beta,
+                         Buffer<R>(c_real_buffer), Buffer<R>(c_imag_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmPlanar<float2>(const Layout, const Transpose, const Transpose,
+                                                  const size_t, const size_t, const size_t,
+                                                  const float2,
+                                                  const cl_mem, const cl_mem, const size_t, const size_t,
+                                                  const cl_mem, const cl_mem, const size_t, const size_t,
+                                                  const float2,
+                                                  cl_mem, cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmPlanar<double2>(const Layout, const Transpose, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const double2,
+                                                   const cl_mem, const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const cl_mem, const size_t, const size_t,
+                                                   const double2,
+                                                   cl_mem, cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+
+// Precision conversion (non-BLAS function)
+template <typename Ti, typename To>
+StatusCode Convert(const size_t n, const double scale,
+                   const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                   cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                   cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, n));
+    auto routine = Xconvert<Ti,To>(queue_cpp, event);
+    routine.DoConvert(n, scale,
+                      Buffer<Ti>(x_buffer), x_offset, x_inc,
+                      Buffer<To>(y_buffer), y_offset, y_inc);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Convert<half,half>(const size_t, const double,
+                                                  const cl_mem, const size_t, const size_t,
+                                                  cl_mem, const size_t, const size_t,
+                                                  cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<half,float>(const size_t, const double,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<half,double>(const size_t, const double,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<half,bfloat16>(const size_t, const double,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      cl_mem, const size_t, const size_t,
+                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<float,half>(const size_t, const double,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<float,float>(const size_t, const double,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<float,double>(const size_t, const double,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     cl_mem, const size_t, const size_t,
+                                                     cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<float,bfloat16>(const size_t, const double,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       cl_mem, const size_t, const size_t,
+                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<double,half>(const size_t, const double,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<double,float>(const size_t, const double,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     cl_mem, const size_t, const size_t,
+                                                     cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<double,double>(const size_t, const double,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      cl_mem, const size_t, const size_t,
+                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<double,bfloat16>(const size_t, const double,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        cl_mem, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<bfloat16,half>(const size_t, const double,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      cl_mem, const size_t, const size_t,
+                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<bfloat16,float>(const size_t, const double,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       cl_mem, const size_t, const size_t,
+                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<bfloat16,double>(const size_t, const double,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        cl_mem, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<bfloat16,bfloat16>(const size_t, const double,
+                                                          const cl_mem, const size_t, const size_t,
+                                                          cl_mem, const size_t, const size_t,
+                                                          cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<float2,float2>(const size_t, const double,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      cl_mem, const size_t, const size_t,
+                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<float2,double2>(const size_t, const double,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       cl_mem, const size_t, const size_t,
+                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<double2,float2>(const size_t, const double,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       cl_mem, const size_t, const size_t,
+                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Convert<double2,double2>(const size_t, const double,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        cl_mem, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+
+// Permutation of the dimensions of a tensor (non-BLAS function)
+template <typename T>
+StatusCode Permute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                   const T alpha,
+                   const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                   cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                   cl_command_queue* queue, cl_event* event) {
+  try {
+    if (shape == nullptr || permutation == nullptr) { return StatusCode::kInvalidDimension; }
+    const auto to_vector = [num_dims](const size_t *values) {
+      return (values == nullptr) ? std::vector<size_t>() :
+                                   std::vector<size_t>(values, values + num_dims);
+    };
+    auto num_elements = size_t{1};
+    for (auto dim = size_t{0}; dim < num_dims; ++dim) { num_elements *= shape[dim]; }
+    auto queue_cpp = Queue(DispatchQueue(*queue, num_elements));
+    auto routine = Xpermute<T>(queue_cpp, event);
+    routine.DoPermute(to_vector(shape), to_vector(permutation), alpha,
+                      Buffer<T>(a_buffer), a_offset, to_vector(a_strides),
+                      Buffer<T>(b_buffer), b_offset, to_vector(b_strides));
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Permute<float>(const size_t, const size_t*, const size_t*,
+                                              const float,
+                                              const cl_mem, const size_t, const size_t*,
+                                              cl_mem, const size_t, const size_t*,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Permute<double>(const size_t, const size_t*, const size_t*,
+                                               const double,
+                                               const cl_mem, const size_t, const size_t*,
+                                               cl_mem, const size_t, const size_t*,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Permute<float2>(const size_t, const size_t*, const size_t*,
+                                               const float2,
+                                               const cl_mem, const size_t, const size_t*,
+                                               cl_mem, const size_t, const size_t*,
+                                               cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Permute<double2>(const size_t, const size_t*, const size_t*,
+                                                const double2,
+                                                const cl_mem, const size_t, const size_t*,
+                                                cl_mem, const size_t, const size_t*,
+                                                cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Permute<half>(const size_t, const size_t*, const size_t*,
+                                             const half,
+                                             const cl_mem, const size_t, const size_t*,
+                                             cl_mem, const size_t, const size_t*,
+                                             cl_command_queue*, cl_event*);
+
+// Weight-only quantized matrix-matrix multiplication (non-BLAS function)
+template <typename T>
+StatusCode GemmQuantized(const Layout layout, const Transpose a_transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const T alpha,
+                         const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                         const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                         const Quantization b_quantization, const size_t group_size,
+                         const cl_mem scales_buffer, const size_t scales_offset,
+                         const cl_mem zeros_buffer, const size_t zeros_offset,
+                         const T beta,
+                         cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                         cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * k));
+    auto routine = XgemmQuantized<T>(queue_cpp, event);
+    const auto has_zeros = (zeros_buffer != nullptr);
+    routine.DoGemmQuantized(layout, a_transpose, m, n, k, alpha,
+                            Buffer<T>(a_buffer), a_offset, a_ld,
+                            Buffer<unsigned char>(b_buffer), b_offset, b_ld,
+                            b_quantization, group_size,
+                            Buffer<T>(scales_buffer), scales_offset,
+                            has_zeros, Buffer<T>((has_zeros) ? zeros_buffer : scales_buffer),
+                            zeros_offset, beta,
+                            Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmQuantized<float>(const Layout, const Transpose,
+                                                    const size_t, const size_t, const size_t,
+                                                    const float,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const cl_mem, const size_t, const size_t,
+                                                    const Quantization, const size_t,
+                                                    const cl_mem, const size_t,
+                                                    const cl_mem, const size_t,
+                                                    const float,
+                                                    cl_mem, const size_t, const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmQuantized<double>(const Layout, const Transpose,
+                                                     const size_t, const size_t, const size_t,
+                                                     const double,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const Quantization, const size_t,
+                                                     const cl_mem, const size_t,
+                                                     const cl_mem, const size_t,
+                                                     const double,
+                                                     cl_mem, const size_t, const size_t,
+                                                     cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmQuantized<half>(const Layout, const Transpose,
+                                                   const size_t, const size_t, const size_t,
+                                                   const half,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const cl_mem, const size_t, const size_t,
+                                                   const Quantization, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const cl_mem, const size_t,
+                                                   const half,
+                                                   cl_mem, const size_t, const size_t,
+                                                   cl_command_queue*, cl_event*);
+
+// Block-sparse matrix-matrix multiplication (non-BLAS function)
+template <typename T>
+StatusCode GemmBlockSparse(const Layout layout, const Transpose a_transpose,
+                           const Transpose b_transpose,
+                           const Side sparse_side, const size_t block_size,
+                           const size_t m, const size_t n, const size_t k,
+                           const T alpha,
+                           const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                           const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                           const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                           const T beta,
+                           cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                           cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * k));
+    auto routine = XgemmBlockSparse<T>(queue_cpp, event);
+    routine.DoGemmBlockSparse(layout, a_transpose, b_transpose, sparse_side, block_size,
+                              m, n, k, alpha,
+                              Buffer<T>(a_buffer), a_offset, a_ld,
+                              Buffer<T>(b_buffer), b_offset, b_ld,
+                              Buffer<unsigned char>(occupancy_buffer), occupancy_offset, beta,
+                              Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GemmBlockSparse<float>(const Layout, const Transpose, const Transpose,
+                                                      const Side, const size_t,
+                                                      const size_t, const size_t, const size_t,
+                                                      const float,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      const cl_mem, const size_t, const size_t,
+                                                      const cl_mem, const size_t,
+                                                      const float,
+                                                      cl_mem, const size_t, const size_t,
+                                                      cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBlockSparse<double>(const Layout, const Transpose, const Transpose,
+                                                       const Side, const size_t,
+                                                       const size_t, const size_t, const size_t,
+                                                       const double,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       const cl_mem, const size_t,
+                                                       const double,
+                                                       cl_mem, const size_t, const size_t,
+                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBlockSparse<float2>(const Layout, const Transpose, const Transpose,
+                                                       const Side, const size_t,
+                                                       const size_t, const size_t, const size_t,
+                                                       const float2,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       const cl_mem, const size_t, const size_t,
+                                                       const cl_mem, const size_t,
+                                                       const float2,
+                                                       cl_mem, const size_t, const size_t,
+                                                       cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBlockSparse<double2>(const Layout, const Transpose, const Transpose,
+                                                        const Side, const size_t,
+                                                        const size_t, const size_t, const size_t,
+                                                        const double2,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t, const size_t,
+                                                        const cl_mem, const size_t,
+                                                        const double2,
+                                                        cl_mem, const size_t, const size_t,
+                                                        cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GemmBlockSparse<half>(const Layout, const Transpose, const Transpose,
+                                                     const Side, const size_t,
+                                                     const size_t, const size_t, const size_t,
+                                                     const half,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const cl_mem, const size_t, const size_t,
+                                                     const cl_mem, const size_t,
+                                                     const half,
+                                                     cl_mem, const size_t, const size_t,
+                                                     cl_command_queue*, cl_event*);
+
+// Householder QR factorization (non-BLAS function)
+template <typename T>
+StatusCode Geqrf(const Layout layout, const size_t m, const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_mem tau_buffer, const size_t tau_offset,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * std::min(m, n)));
+    auto routine = Xgeqrf<T>(queue_cpp, event);
+    routine.DoGeqrf(layout, m, n,
+                    Buffer<T>(a_buffer), a_offset, a_ld,
+                    Buffer<T>(tau_buffer), tau_offset);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Geqrf<float>(const Layout, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Geqrf<double>(const Layout, const size_t, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_mem, const size_t,
+                                             cl_command_queue*, cl_event*);
+
+// Multiplication with the Q factor of a QR factorization (non-BLAS function)
+template <typename T>
+StatusCode Ormqr(const Layout layout, const Side side, const Transpose a_transpose,
+                 const size_t m, const size_t n, const size_t k,
+                 const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 const cl_mem tau_buffer, const size_t tau_offset,
+                 cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * k));
+    auto routine = Xgeqrf<T>(queue_cpp, event);
+    routine.DoOrmqr(layout, side, a_transpose, m, n, k,
+                    Buffer<T>(a_buffer), a_offset, a_ld,
+                    Buffer<T>(tau_buffer), tau_offset,
+                    Buffer<T>(c_buffer), c_offset, c_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Ormqr<float>(const Layout, const Side, const Transpose,
+                                            const size_t, const size_t, const size_t,
+                                            const cl_mem, const size_t, const size_t,
+                                            const cl_mem, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Ormqr<double>(const Layout, const Side, const Transpose,
+                                             const size_t, const size_t, const size_t,
+                                             const cl_mem, const size_t, const size_t,
+                                             const cl_mem, const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+
+// Communication-avoiding QR factorization of a tall and skinny matrix (non-BLAS function)
+template <typename T>
+StatusCode Tsqr(const Layout layout, const size_t m, const size_t n,
+                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                cl_mem r_buffer, const size_t r_offset, const size_t r_ld,
+                cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * n));
+    auto routine = Xgeqrf<T>(queue_cpp, event);
+    routine.DoTsqr(layout, m, n,
+                   Buffer<T>(a_buffer), a_offset, a_ld,
+                   Buffer<T>(r_buffer), r_offset, r_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Tsqr<float>(const Layout, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Tsqr<double>(const Layout, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+
+// Batched version of the Householder QR factorization (non-BLAS function)
+template <typename T>
+StatusCode GeqrfBatched(const Layout layout, const size_t m, const size_t n,
+                        cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                        cl_mem tau_buffer, const size_t *tau_offsets,
+                        const size_t batch_count,
+                        cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, m * n * std::min(m, n) * batch_count));
+    auto routine = Xgeqrf<T>(queue_cpp, event);
+    auto a_offsets_cpp = std::vector<size_t>(batch_count);
+    auto tau_offsets_cpp = std::vector<size_t>(batch_count);
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      a_offsets_cpp[batch] = a_offsets[batch];
+      tau_offsets_cpp[batch] = tau_offsets[batch];
+    }
+    routine.DoGeqrfBatched(layout, m, n,
+                           Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                           Buffer<T>(tau_buffer), tau_offsets_cpp,
+                           batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API GeqrfBatched<float>(const Layout, const size_t, const size_t,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   cl_mem, const size_t*,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API GeqrfBatched<double>(const Layout, const size_t, const size_t,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    cl_mem, const size_t*,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+
+// Triangular matrix inverse (non-BLAS function)
+template <typename T>
+StatusCode Trtri(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                 const size_t n,
+                 cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                 cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n * n));
+    auto routine = Xtrtri<T>(queue_cpp, event);
+    routine.DoTrtri(layout, triangle, diagonal, n,
+                    Buffer<T>(a_buffer), a_offset, a_ld);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API Trtri<float>(const Layout, const Triangle, const Diagonal,
+                                            const size_t,
+                                            cl_mem, const size_t, const size_t,
+                                            cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trtri<double>(const Layout, const Triangle, const Diagonal,
+                                             const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trtri<float2>(const Layout, const Triangle, const Diagonal,
+                                             const size_t,
+                                             cl_mem, const size_t, const size_t,
+                                             cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trtri<double2>(const Layout, const Triangle, const Diagonal,
+                                              const size_t,
+                                              cl_mem, const size_t, const size_t,
+                                              cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API Trtri<half>(const Layout, const Triangle, const Diagonal,
+                                           const size_t,
+                                           cl_mem, const size_t, const size_t,
+                                           cl_command_queue*, cl_event*);
+
+// Batched version of the triangular matrix inverse (non-BLAS function)
+template <typename T>
+StatusCode TrtriBatched(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                        const size_t n,
+                        cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                        const size_t batch_count,
+                        cl_command_queue* queue, cl_event* event) {
+  try {
+    auto queue_cpp = Queue(DispatchQueue(*queue, n * n * n * batch_count));
+    auto routine = Xtrtri<T>(queue_cpp, event);
+    auto a_offsets_cpp = std::vector<size_t>(batch_count);
+    for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+      a_offsets_cpp[batch] = a_offsets[batch];
+    }
+    routine.DoTrtriBatched(layout, triangle, diagonal, n,
+                           Buffer<T>(a_buffer), a_offsets_cpp, a_ld,
+                           batch_count);
+    return StatusCode::kSuccess;
+  } catch (...) { return DispatchException(); }
+}
+template StatusCode PUBLIC_API TrtriBatched<float>(const Layout, const Triangle, const Diagonal,
+                                                   const size_t,
+                                                   cl_mem, const size_t*, const size_t,
+                                                   const size_t,
+                                                   cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrtriBatched<double>(const Layout, const Triangle, const Diagonal,
+                                                    const size_t,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrtriBatched<float2>(const Layout, const Triangle, const Diagonal,
+                                                    const size_t,
+                                                    cl_mem, const size_t*, const size_t,
+                                                    const size_t,
+                                                    cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrtriBatched<double2>(const Layout, const Triangle, const Diagonal,
+                                                     const size_t,
+                                                     cl_mem, const size_t*, const size_t,
+                                                     const size_t,
+                                                     cl_command_queue*, cl_event*);
+template StatusCode PUBLIC_API TrtriBatched<half>(const Layout, const Triangle, const Diagonal,
+                                                  const size_t,
+                                                  cl_mem, const size_t*, const size_t,
+                                                  const size_t,
+                                                  cl_command_queue*, cl_event*);
+
 // =================================================================================================
 
 // Clears the cache of stored binaries
@@ -2419,6 +3363,12 @@ void FillCacheForPrecision(Queue &queue) {
 
     // Runs all the non-BLAS set-up functions
     Xomatcopy<Real>(queue, nullptr); Xomatcopy<Complex>(queue, nullptr);
+    Xgeam<Real>(queue, nullptr); Xgeam<Complex>(queue, nullptr);
+    Xdgmm<Real>(queue, nullptr); Xdgmm<Complex>(queue, nullptr);
+    Xstats<Real>(queue, nullptr);
+    Xreduce<Real>(queue, nullptr);
+    Xattention<Real>(queue, nullptr);
+    XaxpbyPlanar<Complex>(queue, nullptr);
 
   } catch(const RuntimeErrorCode &e) {
     if (e.status() != StatusCode::kNoDoublePrecision &&
@@ -2447,6 +3397,265 @@ StatusCode FillCache(const cl_device_id device) {
 
 // =================================================================================================
 
+// Starts or stops recording the used routines to a manifest file
+StatusCode RecordManifest(const std::string &manifest_file) {
+  try {
+    SetManifestFile(manifest_file);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Constructs (and thus compiles) a single routine by its name, either one available for all
+// data-types, only for real data-types, or only for complex data-types. These return false if the
+// routine is unknown for the data-type.
+template <typename T>
+bool WarmUpRoutine(Queue &queue, const std::string &name) {
+  if (name == "SWAP") { Xswap<T>(queue, nullptr); }
+  else if (name == "SCAL") { Xscal<T>(queue, nullptr); }
+  else if (name == "COPY") { Xcopy<T>(queue, nullptr); }
+  else if (name == "AXPY") { Xaxpy<T>(queue, nullptr); }
+  else if (name == "NRM2") { Xnrm2<T>(queue, nullptr); }
+  else if (name == "ASUM") { Xasum<T>(queue, nullptr); }
+  else if (name == "SUM") { Xsum<T>(queue, nullptr); }
+  else if (name == "AMAX") { Xamax<T>(queue, nullptr); }
+  else if (name == "AMIN") { Xamin<T>(queue, nullptr); }
+  else if (name == "MAX") { Xmax<T>(queue, nullptr); }
+  else if (name == "MIN") { Xmin<T>(queue, nullptr); }
+  else if (name == "GEMV") { Xgemv<T>(queue, nullptr); }
+  else if (name == "GBMV") { Xgbmv<T>(queue, nullptr); }
+  else if (name == "TRMV") { Xtrmv<T>(queue, nullptr); }
+  else if (name == "TBMV") { Xtbmv<T>(queue, nullptr); }
+  else if (name == "TPMV") { Xtpmv<T>(queue, nullptr); }
+  else if (name == "TRSV") { Xtrsv<T>(queue, nullptr); }
+  else if (name == "TBSV") { Xtbsv<T>(queue, nullptr); }
+  else if (name == "TPSV") { Xtpsv<T>(queue, nullptr); }
+  else if (name == "GEMM") { Xgemm<T>(queue, nullptr); }
+  else if (name == "SYMM") { Xsymm<T>(queue, nullptr); }
+  else if (name == "SYRK") { Xsyrk<T>(queue, nullptr); }
+  else if (name == "SYR2K") { Xsyr2k<T>(queue, nullptr); }
+  else if (name == "TRMM") { Xtrmm<T>(queue, nullptr); }
+  else if (name == "TRSM") { Xtrsm<T>(queue, nullptr); }
+  else if (name == "INVERT") { Xinvert<T>(queue, nullptr); }
+  else if (name == "TRTRI") { Xtrtri<T>(queue, nullptr); }
+  else if (name == "OMATCOPY") { Xomatcopy<T>(queue, nullptr); }
+  else if (name == "PERMUTE") { Xpermute<T>(queue, nullptr); }
+  else if (name == "GEAM") { Xgeam<T>(queue, nullptr); }
+  else if (name == "DGMM") { Xdgmm<T>(queue, nullptr); }
+  else if (name == "AXPYBATCHED") { XaxpyBatched<T>(queue, nullptr); }
+  else if (name == "GEMMBATCHED") { XgemmBatched<T>(queue, nullptr); }
+  else if (name == "GEMMBLOCKSPARSE") { XgemmBlockSparse<T>(queue, nullptr); }
+  else { return false; }
+  return true;
+}
+template <typename T>
+bool WarmUpRealRoutine(Queue &queue, const std::string &name) {
+  if (WarmUpRoutine<T>(queue, name)) { return true; }
+  if (name == "DOT") { Xdot<T>(queue, nullptr); }
+  else if (name == "SYMV") { Xsymv<T>(queue, nullptr); }
+  else if (name == "SBMV") { Xsbmv<T>(queue, nullptr); }
+  else if (name == "SPMV") { Xspmv<T>(queue, nullptr); }
+  else if (name == "GER") { Xger<T>(queue, nullptr); }
+  else if (name == "SYR") { Xsyr<T>(queue, nullptr); }
+  else if (name == "SPR") { Xspr<T>(queue, nullptr); }
+  else if (name == "SYR2") { Xsyr2<T>(queue, nullptr); }
+  else if (name == "SPR2") { Xspr2<T>(queue, nullptr); }
+  else if (name == "STATS") { Xstats<T>(queue, nullptr); }
+  else if (name == "REDUCE") { Xreduce<T>(queue, nullptr); }
+  else if (name == "ATTENTION") { Xattention<T>(queue, nullptr); }
+  else if (name == "GEMMQUANTIZED") { XgemmQuantized<T>(queue, nullptr); }
+  else if (name == "CONVERT16") { Xconvert<half,T>(queue, nullptr); }
+  else if (name == "CONVERT32") { Xconvert<float,T>(queue, nullptr); }
+  else if (name == "CONVERT64") { Xconvert<double,T>(queue, nullptr); }
+  else if (name == "CONVERT1632") { Xconvert<bfloat16,T>(queue, nullptr); }
+  else { return false; }
+  return true;
+}
+template <typename T, typename U>
+bool WarmUpComplexRoutine(Queue &queue, const std::string &name) {
+  if (WarmUpRoutine<T>(queue, name)) { return true; }
+  if (name == "DOTU") { Xdotu<T>(queue, nullptr); }
+  else if (name == "DOTC") { Xdotc<T>(queue, nullptr); }
+  else if (name == "HEMV") { Xhemv<T>(queue, nullptr); }
+  else if (name == "HBMV") { Xhbmv<T>(queue, nullptr); }
+  else if (name == "HPMV") { Xhpmv<T>(queue, nullptr); }
+  else if (name == "GERU") { Xgeru<T>(queue, nullptr); }
+  else if (name == "GERC") { Xgerc<T>(queue, nullptr); }
+  else if (name == "HER") { Xher<T,U>(queue, nullptr); }
+  else if (name == "HPR") { Xhpr<T,U>(queue, nullptr); }
+  else if (name == "HER2") { Xher2<T>(queue, nullptr); }
+  else if (name == "HPR2") { Xhpr2<T>(queue, nullptr); }
+  else if (name == "HEMM") { Xhemm<T>(queue, nullptr); }
+  else if (name == "HERK") { Xherk<T,U>(queue, nullptr); }
+  else if (name == "HER2K") { Xher2k<T,U>(queue, nullptr); }
+  else if (name == "CONVERT3232") { Xconvert<float2,T>(queue, nullptr); }
+  else if (name == "CONVERT6464") { Xconvert<double2,T>(queue, nullptr); }
+  else { return false; }
+  return true;
+}
+// The planar-complex routines are compiled for (and thus recorded with) the real precision
+template <typename T>
+bool WarmUpPlanarRoutine(Queue &queue, const std::string &name) {
+  if (name == "AXPBYPLANAR") { XaxpbyPlanar<T>(queue, nullptr); }
+  else if (name == "GEMVPLANAR") { XgemvPlanar<T>(queue, nullptr); }
+  else if (name == "GEMMPLANAR") { XgemmPlanar<T>(queue, nullptr); }
+  else { return false; }
+  return true;
+}
+// The factorization routines are only available in single and double precision
+template <typename T>
+bool WarmUpFactorizationRoutine(Queue &queue, const std::string &name) {
+  if (name == "GEQRF") { Xgeqrf<T>(queue, nullptr); }
+  else { return false; }
+  return true;
+}
+bool WarmUpBFloat16Routine(Queue &queue, const std::string &name) {
+  if (name == "AXPY") { Xaxpy<bfloat16>(queue, nullptr); }
+  else if (name == "DOT") { Xdot<bfloat16>(queue, nullptr); }
+  else if (name == "GEMM") { Xgemm<bfloat16>(queue, nullptr); }
+  else if (name == "GEMMBATCHED") { XgemmBatched<bfloat16>(queue, nullptr); }
+  else if (name == "CONVERT16") { Xconvert<half,bfloat16>(queue, nullptr); }
+  else if (name == "CONVERT32") { Xconvert<float,bfloat16>(queue, nullptr); }
+  else if (name == "CONVERT64") { Xconvert<double,bfloat16>(queue, nullptr); }
+  else if (name == "CONVERT1632") { Xconvert<bfloat16,bfloat16>(queue, nullptr); }
+  else { return false; }
+  return true;
+}
+
+// Compiles a regular routine in the precision of a manifest entry
+void WarmUpRoutineForPrecision(Queue &queue, const ManifestEntry &entry) {
+  switch (entry.precision) {
+    case Precision::kHalf: WarmUpRealRoutine<half>(queue, entry.routine_name); break;
+    case Precision::kSingle:
+      if (!WarmUpRealRoutine<float>(queue, entry.routine_name) &&
+          !WarmUpPlanarRoutine<float2>(queue, entry.routine_name)) {
+        WarmUpFactorizationRoutine<float>(queue, entry.routine_name);
+      }
+      break;
+    case Precision::kDouble:
+      if (!WarmUpRealRoutine<double>(queue, entry.routine_name) &&
+          !WarmUpPlanarRoutine<double2>(queue, entry.routine_name)) {
+        WarmUpFactorizationRoutine<double>(queue, entry.routine_name);
+      }
+      break;
+    case Precision::kComplexSingle:
+      WarmUpComplexRoutine<float2,float>(queue, entry.routine_name); break;
+    case Precision::kComplexDouble:
+      WarmUpComplexRoutine<double2,double>(queue, entry.routine_name); break;
+    case Precision::kBFloat16: WarmUpBFloat16Routine(queue, entry.routine_name); break;
+    default: break;
+  }
+}
+
+// Compiles the GEMM kernels of a routine specialised for a GEMM shape (see RegisterGemmShape)
+bool WarmUpGemmShapeVariant(Queue &queue, const ManifestEntry &entry) {
+  auto shape = GemmShape{};
+  if (!GemmShapeFromName(entry.variant_name, shape)) { return false; }
+  const auto &name = entry.routine_name;
+  switch (entry.precision) {
+    case Precision::kHalf: Xgemm<half>(queue, nullptr, name, shape); break;
+    case Precision::kSingle: Xgemm<float>(queue, nullptr, name, shape); break;
+    case Precision::kDouble: Xgemm<double>(queue, nullptr, name, shape); break;
+    case Precision::kComplexSingle: Xgemm<float2>(queue, nullptr, name, shape); break;
+    case Precision::kComplexDouble: Xgemm<double2>(queue, nullptr, name, shape); break;
+    case Precision::kBFloat16: Xgemm<bfloat16>(queue, nullptr, name, shape); break;
+    default: return false;
+  }
+  return true;
+}
+
+// Pre-compiles all the routines of a manifest which were recorded for the given device, each in
+// the numerics mode and as the variant it was recorded with. Entries which are unknown (e.g.
+// recorded by another version of CLBlast) are skipped.
+void WarmUpForDevice(const cl_device_id device, const std::vector<ManifestEntry> &entries) {
+
+  // Creates a sample context and queue to match the normal routine calling conventions
+  auto device_cpp = Device(device);
+  auto context = Context(device_cpp);
+  auto queue = Queue(context, device_cpp);
+  const auto device_name = device_cpp.Name();
+
+  const auto thread_numerics = Routine::ThreadNumerics();
+  try {
+    for (const auto &entry : entries) {
+      if (entry.device_name != device_name) { continue; }
+      Routine::SetThreadNumerics(entry.numerics);
+      if (!entry.variant_name.empty()) { WarmUpGemmShapeVariant(queue, entry); }
+      else { WarmUpRoutineForPrecision(queue, entry); }
+    }
+  } catch (...) {
+    Routine::SetThreadNumerics(thread_numerics);
+    throw;
+  }
+  Routine::SetThreadNumerics(thread_numerics);
+}
+
+
+// Keeps track of the background warm-up threads, such that they are finished before the caches
+// are destroyed at program exit
+class WarmUpThreads {
+ public:
+  static WarmUpThreads& Instance() {
+    static WarmUpThreads instance;
+    return instance;
+  }
+  void Add(std::thread &&thread) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    threads_.push_back(std::move(thread));
+  }
+  ~WarmUpThreads() {
+    for (auto &thread : threads_) { thread.join(); }
+  }
+ private:
+  std::mutex mutex_;
+  std::vector<std::thread> threads_;
+};
+
+// Pre-compiles the routines listed in a manifest for a specific device
+StatusCode WarmUp(const cl_device_id device, const std::string &manifest_file,
+                  const bool background) {
+  try {
+    const auto entries = ReadManifest(manifest_file);
+    if (!background) {
+      SetManifestRecordingForThread(false);
+      try {
+        WarmUpForDevice(device, entries);
+      } catch (...) {
+        SetManifestRecordingForThread(true);
+        throw;
+      }
+      SetManifestRecordingForThread(true);
+      return StatusCode::kSuccess;
+    }
+
+    // Makes sure the caches are constructed before (and thus destroyed after) the thread holder
+    ProgramCache::Instance();
+    BinaryCache::Instance();
+    DatabaseCache::Instance();
+    WarmUpThreads::Instance().Add(std::thread([device, entries]() {
+      SetManifestRecordingForThread(false);
+      try {
+        WarmUpForDevice(device, entries);
+      } catch (...) { } // errors are ignored, the routines will be compiled again when used
+    }));
+
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Sets the numerics mode for the calling thread
+StatusCode SetNumerics(const Numerics numerics) {
+  try {
+    if (numerics != Numerics::kDefault && numerics != Numerics::kStrict &&
+        numerics != Numerics::kFast) {
+      return StatusCode::kInvalidArgValue;
+    }
+    Routine::SetThreadNumerics(numerics);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
 // Overrides the tuning parameters for this device-precision-kernel combination
 StatusCode OverrideParameters(const cl_device_id device, const std::string &kernel_name,
                               const Precision precision,
@@ -2467,11 +3676,20 @@ StatusCode OverrideParameters(const cl_device_id device, const std::string &kern
       }
     }
 
-    // Clears the existing program & binary cache for routines with the target kernel
+    // Clears the existing program & binary cache for routines with the target kernel, including all
+    // cached variants of these routines (e.g. for GEMM shapes which are no longer registered)
     const auto routine_names = Routine::routines_by_kernel.at(kernel_name);
     for (const auto &routine_name : routine_names) {
-      ProgramCache::Instance().RemoveBySubset<1, 2>(ProgramKey{nullptr, precision, routine_name});
-      BinaryCache::Instance().Remove(BinaryKey{precision, routine_name, device_name});
+      const auto program_key = ProgramKey{nullptr, precision, Numerics::kDefault, routine_name};
+      ProgramCache::Instance().RemoveBySubset<1, 3>(program_key); // for all numerics modes
+      for (const auto numerics : {Numerics::kDefault, Numerics::kStrict, Numerics::kFast}) {
+        BinaryCache::Instance().Remove(BinaryKey{precision, numerics, routine_name, device_name});
+      }
+      const auto variant_prefix = routine_name + "_"; // for all precisions and numerics modes
+      ProgramCache::Instance().RemoveByPrefix<3>(ProgramKey{nullptr, precision, Numerics::kDefault,
+                                                            variant_prefix});
+      BinaryCache::Instance().RemoveByPrefix<2>(BinaryKey{precision, Numerics::kDefault,
+                                                          variant_prefix, device_name});
     }
 
     // Creates a small custom database based on the provided parameters
@@ -2489,5 +3707,118 @@ StatusCode OverrideParameters(const cl_device_id device, const std::string &kern
   return StatusCode::kSuccess;
 }
 
+// Retrieves the tuning parameters for this device-precision-kernel combination
+StatusCode RetrieveParameters(const cl_device_id device, const std::string &kernel_name,
+                              const Precision precision,
+                              std::unordered_map<std::string,size_t> &parameters,
+                              std::string &database_entry) {
+  try {
+
+    // Retrieves the database from the cache (e.g. when overridden) or else from the database
+    const auto device_cpp = Device(device);
+    const auto device_name = device_cpp.Name();
+    auto in_cache = false;
+    auto database = DatabaseCache::Instance().Get(DatabaseKeyRef{ precision, device_name, kernel_name }, &in_cache);
+    if (!in_cache) {
+      if (Routine::routines_by_kernel.find(kernel_name) == Routine::routines_by_kernel.end()) {
+        return StatusCode::kInvalidOverrideKernel;
+      }
+      database = Database(device_cpp, kernel_name, precision, {});
+    }
+
+    // Copies the parameters and the description of the entry
+    parameters.clear();
+    for (const auto &parameter_name : database.GetParameterNames()) {
+      parameters[parameter_name] = database[parameter_name];
+    }
+    database_entry = database.GetEntryDescription();
+
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Sets the memory budget for the temporary buffers of the routines in this context
+StatusCode SetMemoryBudget(const cl_context context, const size_t budget) {
+  try {
+    if (context == nullptr) { return StatusCode::kInvalidArgValue; }
+    SetContextMemoryBudget(context, budget);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Retrieves (and clears) the fallbacks to lower-memory algorithms in this context
+StatusCode RetrieveMemoryFallbacks(const cl_context context, std::vector<std::string> &fallbacks) {
+  try {
+    if (context == nullptr) { return StatusCode::kInvalidArgValue; }
+    fallbacks = TakeMemoryFallbacks(context);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Creates (or changes) the dispatcher of a queue
+StatusCode EnableDispatch(const cl_command_queue queue, const size_t num_queues,
+                          const Dispatch policy) {
+  try {
+    if (queue == nullptr || num_queues == 0) { return StatusCode::kInvalidArgValue; }
+    CreateDispatcher(queue, num_queues, policy);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Joins the dispatched calls of a queue
+StatusCode DispatchJoin(const cl_command_queue queue, cl_event* event) {
+  try {
+    if (queue == nullptr) { return StatusCode::kInvalidArgValue; }
+    JoinDispatcher(queue, event);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Removes the dispatcher of a queue
+StatusCode DisableDispatch(const cl_command_queue queue) {
+  try {
+    if (queue == nullptr) { return StatusCode::kInvalidArgValue; }
+    ReleaseDispatcher(queue);
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// Registers a GEMM shape for which specialised kernels are compiled
+StatusCode RegisterGemmShape(const Layout layout, const Transpose a_transpose,
+                             const Transpose b_transpose,
+                             const size_t m, const size_t n, const size_t k,
+                             const size_t a_ld, const size_t b_ld, const size_t c_ld) {
+  try {
+    if ((m == 0) || (n == 0) || (k == 0)) { return StatusCode::kInvalidDimension; }
+
+    // Tests the leading dimensions in the same way as the GEMM routine itself
+    const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                           (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+    const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                           (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+    const auto c_rotated = (layout == Layout::kRowMajor);
+    if (a_ld < ((a_rotated) ? k : m)) { return StatusCode::kInvalidLeadDimA; }
+    if (b_ld < ((b_rotated) ? n : k)) { return StatusCode::kInvalidLeadDimB; }
+    if (c_ld < ((c_rotated) ? n : m)) { return StatusCode::kInvalidLeadDimC; }
+
+    RegisterGemmShapeEntry(GemmShape{layout, a_transpose, b_transpose, m, n, k, a_ld, b_ld, c_ld});
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
+// Removes all registered GEMM shapes
+StatusCode ClearGemmShapes() {
+  try {
+    ClearGemmShapeEntries();
+  } catch (...) { return DispatchException(); }
+  return StatusCode::kSuccess;
+}
+
 // =================================================================================================
 } // namespace clblast
@@ -20,6 +20,7 @@
 
 // Shortcuts to the clblast namespace
 using half = clblast::half;
+using bfloat16 = clblast::bfloat16;
 using float2 = clblast::float2;
 using double2 = clblast::double2;
 
@@ -440,6 +441,21 @@ CLBlastStatusCode CLBlastHaxpy(const size_t n,
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
+CLBlastStatusCode CLBlastBaxpy(const size_t n,
+                               const CLBlastBFloat16 alpha,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Axpy(n,
+                    alpha,
+                    x_buffer, x_offset, x_inc,
+                    y_buffer, y_offset, y_inc,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
 
 // DOT
 CLBlastStatusCode CLBlastSdot(const size_t n,
@@ -487,6 +503,21 @@ CLBlastStatusCode CLBlastHdot(const size_t n,
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
+CLBlastStatusCode CLBlastBdot(const size_t n,
+                              cl_mem dot_buffer, const size_t dot_offset,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              const cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dot<bfloat16>(n,
+                             dot_buffer, dot_offset,
+                             x_buffer, x_offset, x_inc,
+                             y_buffer, y_offset, y_inc,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
 
 // DOTU
 CLBlastStatusCode CLBlastCdotu(const size_t n,
@@ -2744,6 +2775,29 @@ CLBlastStatusCode CLBlastHgemm(const CLBlastLayout layout, const CLBlastTranspos
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
+CLBlastStatusCode CLBlastBgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n, const size_t k,
+                               const CLBlastBFloat16 alpha,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                               const CLBlastBFloat16 beta,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Gemm(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n, k,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
 
 // SYMM
 CLBlastStatusCode CLBlastSsymm(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTriangle triangle,
@@ -3515,6 +3569,215 @@ CLBlastStatusCode CLBlastHomatcopy(const CLBlastLayout layout, const CLBlastTran
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// GEAM
+CLBlastStatusCode CLBlastSgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n,
+                               const float alpha,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                               const float beta,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Geam(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n,
+                               const double alpha,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                               const double beta,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Geam(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n,
+                               const cl_float2 alpha,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                               const cl_float2 beta,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Geam(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n,
+                    float2{alpha.s[0], alpha.s[1]},
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    float2{beta.s[0], beta.s[1]},
+                    c_buffer, c_offset, c_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n,
+                               const cl_double2 alpha,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                               const cl_double2 beta,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Geam(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n,
+                    double2{alpha.s[0], alpha.s[1]},
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    double2{beta.s[0], beta.s[1]},
+                    c_buffer, c_offset, c_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                               const size_t m, const size_t n,
+                               const cl_half alpha,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                               const cl_half beta,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Geam(static_cast<clblast::Layout>(layout),
+                    static_cast<clblast::Transpose>(a_transpose),
+                    static_cast<clblast::Transpose>(b_transpose),
+                    m, n,
+                    alpha,
+                    a_buffer, a_offset, a_ld,
+                    b_buffer, b_offset, b_ld,
+                    beta,
+                    c_buffer, c_offset, c_ld,
+                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// DGMM
+CLBlastStatusCode CLBlastSdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                               const size_t m, const size_t n,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dgmm<float>(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Side>(side),
+                           m, n,
+                           a_buffer, a_offset, a_ld,
+                           x_buffer, x_offset, x_inc,
+                           c_buffer, c_offset, c_ld,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                               const size_t m, const size_t n,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dgmm<double>(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Side>(side),
+                            m, n,
+                            a_buffer, a_offset, a_ld,
+                            x_buffer, x_offset, x_inc,
+                            c_buffer, c_offset, c_ld,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                               const size_t m, const size_t n,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dgmm<float2>(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Side>(side),
+                            m, n,
+                            a_buffer, a_offset, a_ld,
+                            x_buffer, x_offset, x_inc,
+                            c_buffer, c_offset, c_ld,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                               const size_t m, const size_t n,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dgmm<double2>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Side>(side),
+                             m, n,
+                             a_buffer, a_offset, a_ld,
+                             x_buffer, x_offset, x_inc,
+                             c_buffer, c_offset, c_ld,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                               const size_t m, const size_t n,
+                               const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                               cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Dgmm<half>(static_cast<clblast::Layout>(layout),
+                          static_cast<clblast::Side>(side),
+                          m, n,
+                          a_buffer, a_offset, a_ld,
+                          x_buffer, x_offset, x_inc,
+                          c_buffer, c_offset, c_ld,
+                          queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // AXPY
 CLBlastStatusCode CLBlastSaxpyBatched(const size_t n,
                                       const float *alphas,
@@ -3778,25 +4041,1081 @@ CLBlastStatusCode CLBlastHgemmBatched(const CLBlastLayout layout, const CLBlastT
     );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-
-// =================================================================================================
-
-// Clears the cache of stored binaries
-CLBlastStatusCode CLBlastClearCache() {
+CLBlastStatusCode CLBlastBgemmBatched(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                      const size_t m, const size_t n, const size_t k,
+                                      const CLBlastBFloat16 *alphas,
+                                      const cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                      const cl_mem b_buffer, const size_t *b_offsets, const size_t b_ld,
+                                      const CLBlastBFloat16 *betas,
+                                      cl_mem c_buffer, const size_t *c_offsets, const size_t c_ld,
+                                      const size_t batch_count,
+                                      cl_command_queue* queue, cl_event* event) {
+  auto alphas_cpp = std::vector<bfloat16>();
+  auto betas_cpp = std::vector<bfloat16>();
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    alphas_cpp.push_back(alphas[batch]);
+    betas_cpp.push_back(betas[batch]);
+  }
   try {
-    return static_cast<CLBlastStatusCode>(clblast::ClearCache());
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBatched(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Transpose>(a_transpose),
+                           static_cast<clblast::Transpose>(b_transpose),
+                           m, n, k,
+                           alphas_cpp.data(),
+                           a_buffer, a_offsets, a_ld,
+                           b_buffer, b_offsets, b_ld,
+                           betas_cpp.data(),
+                           c_buffer, c_offsets, c_ld,
+                           batch_count,
+                           queue, event)
+    );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
-// Fills the cache with binaries for a specific device
-CLBlastStatusCode CLBlastFillCache(const cl_device_id device) {
+// =================================================================================================
+
+// VECTORSTATS
+CLBlastStatusCode CLBlastSVectorStats(const int statistics, const size_t n,
+                                      cl_mem stats_buffer, const size_t stats_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      cl_command_queue* queue, cl_event* event) {
   try {
-    return static_cast<CLBlastStatusCode>(clblast::FillCache(device));
+    return static_cast<CLBlastStatusCode>(
+      clblast::VectorStats<float>(static_cast<clblast::Statistic>(statistics), n,
+                                  stats_buffer, stats_offset,
+                                  x_buffer, x_offset, x_inc,
+                                  queue, event)
+    );
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
-
+CLBlastStatusCode CLBlastDVectorStats(const int statistics, const size_t n,
+                                      cl_mem stats_buffer, const size_t stats_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::VectorStats<double>(static_cast<clblast::Statistic>(statistics), n,
+                                   stats_buffer, stats_offset,
+                                   x_buffer, x_offset, x_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHVectorStats(const int statistics, const size_t n,
+                                      cl_mem stats_buffer, const size_t stats_offset,
+                                      const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                      cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::VectorStats<half>(static_cast<clblast::Statistic>(statistics), n,
+                                 stats_buffer, stats_offset,
+                                 x_buffer, x_offset, x_inc,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// REDUCEMATRIX
+CLBlastStatusCode CLBlastSReduceMatrix(const CLBlastReduction reduction, const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                       const size_t m, const size_t n,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ReduceMatrix<float>(static_cast<clblast::Reduction>(reduction),
+                                   static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Transpose>(a_transpose),
+                                   m, n,
+                                   a_buffer, a_offset, a_ld,
+                                   y_buffer, y_offset, y_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDReduceMatrix(const CLBlastReduction reduction, const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                       const size_t m, const size_t n,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ReduceMatrix<double>(static_cast<clblast::Reduction>(reduction),
+                                    static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Transpose>(a_transpose),
+                                    m, n,
+                                    a_buffer, a_offset, a_ld,
+                                    y_buffer, y_offset, y_inc,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHReduceMatrix(const CLBlastReduction reduction, const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                       const size_t m, const size_t n,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ReduceMatrix<half>(static_cast<clblast::Reduction>(reduction),
+                                  static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  a_buffer, a_offset, a_ld,
+                                  y_buffer, y_offset, y_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// ATTENTION
+CLBlastStatusCode CLBlastSAttention(const CLBlastLayout layout, const int causal,
+                                    const size_t m, const size_t n, const size_t d, const float scale,
+                                    const cl_mem q_buffer, const size_t *q_offsets, const size_t q_ld,
+                                    const cl_mem k_buffer, const size_t *k_offsets, const size_t k_ld,
+                                    const cl_mem v_buffer, const size_t *v_offsets, const size_t v_ld,
+                                    cl_mem o_buffer, const size_t *o_offsets, const size_t o_ld,
+                                    const size_t batch_count,
+                                    cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Attention<float>(static_cast<clblast::Layout>(layout), causal != 0,
+                                m, n, d, scale,
+                                q_buffer, q_offsets, q_ld,
+                                k_buffer, k_offsets, k_ld,
+                                v_buffer, v_offsets, v_ld,
+                                o_buffer, o_offsets, o_ld,
+                                batch_count,
+                                queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDAttention(const CLBlastLayout layout, const int causal,
+                                    const size_t m, const size_t n, const size_t d, const double scale,
+                                    const cl_mem q_buffer, const size_t *q_offsets, const size_t q_ld,
+                                    const cl_mem k_buffer, const size_t *k_offsets, const size_t k_ld,
+                                    const cl_mem v_buffer, const size_t *v_offsets, const size_t v_ld,
+                                    cl_mem o_buffer, const size_t *o_offsets, const size_t o_ld,
+                                    const size_t batch_count,
+                                    cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Attention<double>(static_cast<clblast::Layout>(layout), causal != 0,
+                                 m, n, d, scale,
+                                 q_buffer, q_offsets, q_ld,
+                                 k_buffer, k_offsets, k_ld,
+                                 v_buffer, v_offsets, v_ld,
+                                 o_buffer, o_offsets, o_ld,
+                                 batch_count,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHAttention(const CLBlastLayout layout, const int causal,
+                                    const size_t m, const size_t n, const size_t d, const cl_half scale,
+                                    const cl_mem q_buffer, const size_t *q_offsets, const size_t q_ld,
+                                    const cl_mem k_buffer, const size_t *k_offsets, const size_t k_ld,
+                                    const cl_mem v_buffer, const size_t *v_offsets, const size_t v_ld,
+                                    cl_mem o_buffer, const size_t *o_offsets, const size_t o_ld,
+                                    const size_t batch_count,
+                                    cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Attention<half>(static_cast<clblast::Layout>(layout), causal != 0,
+                               m, n, d, scale,
+                               q_buffer, q_offsets, q_ld,
+                               k_buffer, k_offsets, k_ld,
+                               v_buffer, v_offsets, v_ld,
+                               o_buffer, o_offsets, o_ld,
+                               batch_count,
+                               queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// AXPYPLANAR
+CLBlastStatusCode CLBlastCaxpyPlanar(const size_t n,
+                                     const cl_float2 alpha,
+                                     const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyPlanar<float2>(n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  x_real_buffer, x_imag_buffer, x_offset, x_inc,
+                                  y_real_buffer, y_imag_buffer, y_offset, y_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZaxpyPlanar(const size_t n,
+                                     const cl_double2 alpha,
+                                     const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::AxpyPlanar<double2>(n,
+                                   double2{alpha.s[0], alpha.s[1]},
+                                   x_real_buffer, x_imag_buffer, x_offset, x_inc,
+                                   y_real_buffer, y_imag_buffer, y_offset, y_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// SCALPLANAR
+CLBlastStatusCode CLBlastCscalPlanar(const size_t n,
+                                     const cl_float2 alpha,
+                                     cl_mem x_real_buffer, cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalPlanar<float2>(n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  x_real_buffer, x_imag_buffer, x_offset, x_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZscalPlanar(const size_t n,
+                                     const cl_double2 alpha,
+                                     cl_mem x_real_buffer, cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::ScalPlanar<double2>(n,
+                                   double2{alpha.s[0], alpha.s[1]},
+                                   x_real_buffer, x_imag_buffer, x_offset, x_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// COPYPLANAR
+CLBlastStatusCode CLBlastCcopyPlanar(const size_t n,
+                                     const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::CopyPlanar<float2>(n,
+                                  x_real_buffer, x_imag_buffer, x_offset, x_inc,
+                                  y_real_buffer, y_imag_buffer, y_offset, y_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZcopyPlanar(const size_t n,
+                                     const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                     cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::CopyPlanar<double2>(n,
+                                   x_real_buffer, x_imag_buffer, x_offset, x_inc,
+                                   y_real_buffer, y_imag_buffer, y_offset, y_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMVPLANAR
+CLBlastStatusCode CLBlastCgemvPlanar(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                     const size_t m, const size_t n,
+                                     const cl_float2 alpha,
+                                     const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                     const cl_float2 beta,
+                                     cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvPlanar<float2>(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+                                  m, n,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_real_buffer, a_imag_buffer, a_offset, a_ld,
+                                  x_real_buffer, x_imag_buffer, x_offset, x_inc,
+                                  float2{beta.s[0], beta.s[1]},
+                                  y_real_buffer, y_imag_buffer, y_offset, y_inc,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemvPlanar(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                     const size_t m, const size_t n,
+                                     const cl_double2 alpha,
+                                     const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem x_real_buffer, const cl_mem x_imag_buffer, const size_t x_offset, const size_t x_inc,
+                                     const cl_double2 beta,
+                                     cl_mem y_real_buffer, cl_mem y_imag_buffer, const size_t y_offset, const size_t y_inc,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemvPlanar<double2>(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose),
+                                   m, n,
+                                   double2{alpha.s[0], alpha.s[1]},
+                                   a_real_buffer, a_imag_buffer, a_offset, a_ld,
+                                   x_real_buffer, x_imag_buffer, x_offset, x_inc,
+                                   double2{beta.s[0], beta.s[1]},
+                                   y_real_buffer, y_imag_buffer, y_offset, y_inc,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// GEMMPLANAR
+CLBlastStatusCode CLBlastCgemmPlanar(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_float2 alpha,
+                                     const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_real_buffer, const cl_mem b_imag_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_float2 beta,
+                                     cl_mem c_real_buffer, cl_mem c_imag_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanar<float2>(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), static_cast<clblast::Transpose>(b_transpose),
+                                  m, n, k,
+                                  float2{alpha.s[0], alpha.s[1]},
+                                  a_real_buffer, a_imag_buffer, a_offset, a_ld,
+                                  b_real_buffer, b_imag_buffer, b_offset, b_ld,
+                                  float2{beta.s[0], beta.s[1]},
+                                  c_real_buffer, c_imag_buffer, c_offset, c_ld,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZgemmPlanar(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                     const size_t m, const size_t n, const size_t k,
+                                     const cl_double2 alpha,
+                                     const cl_mem a_real_buffer, const cl_mem a_imag_buffer, const size_t a_offset, const size_t a_ld,
+                                     const cl_mem b_real_buffer, const cl_mem b_imag_buffer, const size_t b_offset, const size_t b_ld,
+                                     const cl_double2 beta,
+                                     cl_mem c_real_buffer, cl_mem c_imag_buffer, const size_t c_offset, const size_t c_ld,
+                                     cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmPlanar<double2>(static_cast<clblast::Layout>(layout), static_cast<clblast::Transpose>(a_transpose), static_cast<clblast::Transpose>(b_transpose),
+                                   m, n, k,
+                                   double2{alpha.s[0], alpha.s[1]},
+                                   a_real_buffer, a_imag_buffer, a_offset, a_ld,
+                                   b_real_buffer, b_imag_buffer, b_offset, b_ld,
+                                   double2{beta.s[0], beta.s[1]},
+                                   c_real_buffer, c_imag_buffer, c_offset, c_ld,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Precision conversion
+namespace {
+template <typename Ti, typename To>
+CLBlastStatusCode ConvertForC(const size_t n, const double scale,
+                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                              cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Convert<Ti,To>(n, scale,
+                              x_buffer, x_offset, x_inc,
+                              y_buffer, y_offset, y_inc,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+template <typename Ti>
+CLBlastStatusCode ConvertFromPrecision(const CLBlastPrecision y_precision,
+                                       const size_t n, const double scale,
+                                       const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                       cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                       cl_command_queue* queue, cl_event* event) {
+  switch (y_precision) {
+    case CLBlastPrecisionHalf:
+      return ConvertForC<Ti,half>(n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    case CLBlastPrecisionSingle:
+      return ConvertForC<Ti,float>(n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    case CLBlastPrecisionDouble:
+      return ConvertForC<Ti,double>(n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    case CLBlastPrecisionBFloat16:
+      return ConvertForC<Ti,bfloat16>(n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    default: return CLBlastNotImplemented;
+  }
+}
+template <typename Ti>
+CLBlastStatusCode ConvertFromComplexPrecision(const CLBlastPrecision y_precision,
+                                              const size_t n, const double scale,
+                                              const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                              cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                              cl_command_queue* queue, cl_event* event) {
+  switch (y_precision) {
+    case CLBlastPrecisionComplexSingle:
+      return ConvertForC<Ti,float2>(n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    case CLBlastPrecisionComplexDouble:
+      return ConvertForC<Ti,double2>(n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    default: return CLBlastNotImplemented;
+  }
+}
+} // anonymous namespace
+CLBlastStatusCode CLBlastConvert(const CLBlastPrecision x_precision, const CLBlastPrecision y_precision,
+                                 const size_t n, const double scale,
+                                 const cl_mem x_buffer, const size_t x_offset, const size_t x_inc,
+                                 cl_mem y_buffer, const size_t y_offset, const size_t y_inc,
+                                 cl_command_queue* queue, cl_event* event) {
+  switch (x_precision) {
+    case CLBlastPrecisionHalf:
+      return ConvertFromPrecision<half>(y_precision, n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    case CLBlastPrecisionSingle:
+      return ConvertFromPrecision<float>(y_precision, n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    case CLBlastPrecisionDouble:
+      return ConvertFromPrecision<double>(y_precision, n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    case CLBlastPrecisionBFloat16:
+      return ConvertFromPrecision<bfloat16>(y_precision, n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    case CLBlastPrecisionComplexSingle:
+      return ConvertFromComplexPrecision<float2>(y_precision, n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    case CLBlastPrecisionComplexDouble:
+      return ConvertFromComplexPrecision<double2>(y_precision, n, scale, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event);
+    default: return CLBlastNotImplemented;
+  }
+}
+
+// Permutation of the dimensions of a tensor
+CLBlastStatusCode CLBlastSPermute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                                 const float alpha,
+                                 const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                                 cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Permute<float>(num_dims, shape, permutation,
+                      alpha,
+                      a_buffer, a_offset, a_strides,
+                      b_buffer, b_offset, b_strides,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDPermute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                                 const double alpha,
+                                 const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                                 cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Permute<double>(num_dims, shape, permutation,
+                      alpha,
+                      a_buffer, a_offset, a_strides,
+                      b_buffer, b_offset, b_strides,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCPermute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                                 const cl_float2 alpha,
+                                 const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                                 cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Permute<float2>(num_dims, shape, permutation,
+                      float2{alpha.s[0], alpha.s[1]},
+                      a_buffer, a_offset, a_strides,
+                      b_buffer, b_offset, b_strides,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZPermute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                                 const cl_double2 alpha,
+                                 const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                                 cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Permute<double2>(num_dims, shape, permutation,
+                      double2{alpha.s[0], alpha.s[1]},
+                      a_buffer, a_offset, a_strides,
+                      b_buffer, b_offset, b_strides,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHPermute(const size_t num_dims, const size_t *shape, const size_t *permutation,
+                                 const cl_half alpha,
+                                 const cl_mem a_buffer, const size_t a_offset, const size_t *a_strides,
+                                 cl_mem b_buffer, const size_t b_offset, const size_t *b_strides,
+                                 cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Permute<half>(num_dims, shape, permutation,
+                      alpha,
+                      a_buffer, a_offset, a_strides,
+                      b_buffer, b_offset, b_strides,
+                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Weight-only quantized matrix-matrix multiplication
+CLBlastStatusCode CLBlastSGemmQuantized(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const float alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const CLBlastQuantization b_quantization, const size_t group_size,
+                                       const cl_mem scales_buffer, const size_t scales_offset,
+                                       const cl_mem zeros_buffer, const size_t zeros_offset,
+                                       const float beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmQuantized<float>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Transpose>(a_transpose),
+                                 m, n, k,
+                                 alpha,
+                                 a_buffer, a_offset, a_ld,
+                                 b_buffer, b_offset, b_ld,
+                                 static_cast<clblast::Quantization>(b_quantization), group_size,
+                                 scales_buffer, scales_offset,
+                                 zeros_buffer, zeros_offset,
+                                 beta,
+                                 c_buffer, c_offset, c_ld,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDGemmQuantized(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const double alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const CLBlastQuantization b_quantization, const size_t group_size,
+                                       const cl_mem scales_buffer, const size_t scales_offset,
+                                       const cl_mem zeros_buffer, const size_t zeros_offset,
+                                       const double beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmQuantized<double>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Transpose>(a_transpose),
+                                 m, n, k,
+                                 alpha,
+                                 a_buffer, a_offset, a_ld,
+                                 b_buffer, b_offset, b_ld,
+                                 static_cast<clblast::Quantization>(b_quantization), group_size,
+                                 scales_buffer, scales_offset,
+                                 zeros_buffer, zeros_offset,
+                                 beta,
+                                 c_buffer, c_offset, c_ld,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHGemmQuantized(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+                                       const size_t m, const size_t n, const size_t k,
+                                       const cl_half alpha,
+                                       const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                       const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                       const CLBlastQuantization b_quantization, const size_t group_size,
+                                       const cl_mem scales_buffer, const size_t scales_offset,
+                                       const cl_mem zeros_buffer, const size_t zeros_offset,
+                                       const cl_half beta,
+                                       cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmQuantized<half>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Transpose>(a_transpose),
+                                 m, n, k,
+                                 alpha,
+                                 a_buffer, a_offset, a_ld,
+                                 b_buffer, b_offset, b_ld,
+                                 static_cast<clblast::Quantization>(b_quantization), group_size,
+                                 scales_buffer, scales_offset,
+                                 zeros_buffer, zeros_offset,
+                                 beta,
+                                 c_buffer, c_offset, c_ld,
+                                 queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Block-sparse matrix-matrix multiplication
+CLBlastStatusCode CLBlastSGemmBlockSparse(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const CLBlastSide sparse_side, const size_t block_size,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const float alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                                          const float beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBlockSparse<float>(static_cast<clblast::Layout>(layout),
+                                      static_cast<clblast::Transpose>(a_transpose),
+                                      static_cast<clblast::Transpose>(b_transpose),
+                                      static_cast<clblast::Side>(sparse_side), block_size,
+                                      m, n, k,
+                                      alpha,
+                                      a_buffer, a_offset, a_ld,
+                                      b_buffer, b_offset, b_ld,
+                                      occupancy_buffer, occupancy_offset,
+                                      beta,
+                                      c_buffer, c_offset, c_ld,
+                                      queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDGemmBlockSparse(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const CLBlastSide sparse_side, const size_t block_size,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const double alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                                          const double beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBlockSparse<double>(static_cast<clblast::Layout>(layout),
+                                       static_cast<clblast::Transpose>(a_transpose),
+                                       static_cast<clblast::Transpose>(b_transpose),
+                                       static_cast<clblast::Side>(sparse_side), block_size,
+                                       m, n, k,
+                                       alpha,
+                                       a_buffer, a_offset, a_ld,
+                                       b_buffer, b_offset, b_ld,
+                                       occupancy_buffer, occupancy_offset,
+                                       beta,
+                                       c_buffer, c_offset, c_ld,
+                                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCGemmBlockSparse(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const CLBlastSide sparse_side, const size_t block_size,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_float2 alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                                          const cl_float2 beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBlockSparse<float2>(static_cast<clblast::Layout>(layout),
+                                       static_cast<clblast::Transpose>(a_transpose),
+                                       static_cast<clblast::Transpose>(b_transpose),
+                                       static_cast<clblast::Side>(sparse_side), block_size,
+                                       m, n, k,
+                                       float2{alpha.s[0], alpha.s[1]},
+                                       a_buffer, a_offset, a_ld,
+                                       b_buffer, b_offset, b_ld,
+                                       occupancy_buffer, occupancy_offset,
+                                       float2{beta.s[0], beta.s[1]},
+                                       c_buffer, c_offset, c_ld,
+                                       queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZGemmBlockSparse(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const CLBlastSide sparse_side, const size_t block_size,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_double2 alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                                          const cl_double2 beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBlockSparse<double2>(static_cast<clblast::Layout>(layout),
+                                        static_cast<clblast::Transpose>(a_transpose),
+                                        static_cast<clblast::Transpose>(b_transpose),
+                                        static_cast<clblast::Side>(sparse_side), block_size,
+                                        m, n, k,
+                                        double2{alpha.s[0], alpha.s[1]},
+                                        a_buffer, a_offset, a_ld,
+                                        b_buffer, b_offset, b_ld,
+                                        occupancy_buffer, occupancy_offset,
+                                        double2{beta.s[0], beta.s[1]},
+                                        c_buffer, c_offset, c_ld,
+                                        queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHGemmBlockSparse(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                                          const CLBlastSide sparse_side, const size_t block_size,
+                                          const size_t m, const size_t n, const size_t k,
+                                          const cl_half alpha,
+                                          const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                          const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+                                          const cl_mem occupancy_buffer, const size_t occupancy_offset,
+                                          const cl_half beta,
+                                          cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                          cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GemmBlockSparse<half>(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Transpose>(a_transpose),
+                                     static_cast<clblast::Transpose>(b_transpose),
+                                     static_cast<clblast::Side>(sparse_side), block_size,
+                                     m, n, k,
+                                     alpha,
+                                     a_buffer, a_offset, a_ld,
+                                     b_buffer, b_offset, b_ld,
+                                     occupancy_buffer, occupancy_offset,
+                                     beta,
+                                     c_buffer, c_offset, c_ld,
+                                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Householder QR factorization
+CLBlastStatusCode CLBlastSGeqrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem tau_buffer, const size_t tau_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Geqrf<float>(static_cast<clblast::Layout>(layout), m, n,
+                            a_buffer, a_offset, a_ld,
+                            tau_buffer, tau_offset,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDGeqrf(const CLBlastLayout layout, const size_t m, const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_mem tau_buffer, const size_t tau_offset,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Geqrf<double>(static_cast<clblast::Layout>(layout), m, n,
+                             a_buffer, a_offset, a_ld,
+                             tau_buffer, tau_offset,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Multiplication with the Q factor of a QR factorization
+CLBlastStatusCode CLBlastSOrmqr(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose a_transpose,
+                                const size_t m, const size_t n, const size_t k,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                const cl_mem tau_buffer, const size_t tau_offset,
+                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Ormqr<float>(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Side>(side),
+                            static_cast<clblast::Transpose>(a_transpose),
+                            m, n, k,
+                            a_buffer, a_offset, a_ld,
+                            tau_buffer, tau_offset,
+                            c_buffer, c_offset, c_ld,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDOrmqr(const CLBlastLayout layout, const CLBlastSide side, const CLBlastTranspose a_transpose,
+                                const size_t m, const size_t n, const size_t k,
+                                const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                const cl_mem tau_buffer, const size_t tau_offset,
+                                cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Ormqr<double>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Side>(side),
+                             static_cast<clblast::Transpose>(a_transpose),
+                             m, n, k,
+                             a_buffer, a_offset, a_ld,
+                             tau_buffer, tau_offset,
+                             c_buffer, c_offset, c_ld,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Communication-avoiding QR factorization of a tall and skinny matrix
+CLBlastStatusCode CLBlastSTsqr(const CLBlastLayout layout, const size_t m, const size_t n,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               cl_mem r_buffer, const size_t r_offset, const size_t r_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Tsqr<float>(static_cast<clblast::Layout>(layout), m, n,
+                           a_buffer, a_offset, a_ld,
+                           r_buffer, r_offset, r_ld,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDTsqr(const CLBlastLayout layout, const size_t m, const size_t n,
+                               cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                               cl_mem r_buffer, const size_t r_offset, const size_t r_ld,
+                               cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Tsqr<double>(static_cast<clblast::Layout>(layout), m, n,
+                            a_buffer, a_offset, a_ld,
+                            r_buffer, r_offset, r_ld,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Batched version of the Householder QR factorization
+CLBlastStatusCode CLBlastSGeqrfBatched(const CLBlastLayout layout, const size_t m, const size_t n,
+                                       cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                       cl_mem tau_buffer, const size_t *tau_offsets,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GeqrfBatched<float>(static_cast<clblast::Layout>(layout), m, n,
+                                   a_buffer, a_offsets, a_ld,
+                                   tau_buffer, tau_offsets,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDGeqrfBatched(const CLBlastLayout layout, const size_t m, const size_t n,
+                                       cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                       cl_mem tau_buffer, const size_t *tau_offsets,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::GeqrfBatched<double>(static_cast<clblast::Layout>(layout), m, n,
+                                    a_buffer, a_offsets, a_ld,
+                                    tau_buffer, tau_offsets,
+                                    batch_count,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Triangular matrix inverse
+CLBlastStatusCode CLBlastSTrtri(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Trtri<float>(static_cast<clblast::Layout>(layout),
+                            static_cast<clblast::Triangle>(triangle),
+                            static_cast<clblast::Diagonal>(diag),
+                            n,
+                            a_buffer, a_offset, a_ld,
+                            queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDTrtri(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Trtri<double>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Triangle>(triangle),
+                             static_cast<clblast::Diagonal>(diag),
+                             n,
+                             a_buffer, a_offset, a_ld,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCTrtri(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Trtri<float2>(static_cast<clblast::Layout>(layout),
+                             static_cast<clblast::Triangle>(triangle),
+                             static_cast<clblast::Diagonal>(diag),
+                             n,
+                             a_buffer, a_offset, a_ld,
+                             queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZTrtri(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Trtri<double2>(static_cast<clblast::Layout>(layout),
+                              static_cast<clblast::Triangle>(triangle),
+                              static_cast<clblast::Diagonal>(diag),
+                              n,
+                              a_buffer, a_offset, a_ld,
+                              queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHTrtri(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                const size_t n,
+                                cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+                                cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::Trtri<half>(static_cast<clblast::Layout>(layout),
+                           static_cast<clblast::Triangle>(triangle),
+                           static_cast<clblast::Diagonal>(diag),
+                           n,
+                           a_buffer, a_offset, a_ld,
+                           queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Batched version of the triangular matrix inverse
+CLBlastStatusCode CLBlastSTrtriBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                       const size_t n,
+                                       cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrtriBatched<float>(static_cast<clblast::Layout>(layout),
+                                   static_cast<clblast::Triangle>(triangle),
+                                   static_cast<clblast::Diagonal>(diag),
+                                   n,
+                                   a_buffer, a_offsets, a_ld,
+                                   batch_count,
+                                   queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastDTrtriBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                       const size_t n,
+                                       cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrtriBatched<double>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Triangle>(triangle),
+                                    static_cast<clblast::Diagonal>(diag),
+                                    n,
+                                    a_buffer, a_offsets, a_ld,
+                                    batch_count,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastCTrtriBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                       const size_t n,
+                                       cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrtriBatched<float2>(static_cast<clblast::Layout>(layout),
+                                    static_cast<clblast::Triangle>(triangle),
+                                    static_cast<clblast::Diagonal>(diag),
+                                    n,
+                                    a_buffer, a_offsets, a_ld,
+                                    batch_count,
+                                    queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastZTrtriBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                       const size_t n,
+                                       cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrtriBatched<double2>(static_cast<clblast::Layout>(layout),
+                                     static_cast<clblast::Triangle>(triangle),
+                                     static_cast<clblast::Diagonal>(diag),
+                                     n,
+                                     a_buffer, a_offsets, a_ld,
+                                     batch_count,
+                                     queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+CLBlastStatusCode CLBlastHTrtriBatched(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastDiagonal diag,
+                                       const size_t n,
+                                       cl_mem a_buffer, const size_t *a_offsets, const size_t a_ld,
+                                       const size_t batch_count,
+                                       cl_command_queue* queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::TrtriBatched<half>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Triangle>(triangle),
+                                  static_cast<clblast::Diagonal>(diag),
+                                  n,
+                                  a_buffer, a_offsets, a_ld,
+                                  batch_count,
+                                  queue, event)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Clears the cache of stored binaries
+CLBlastStatusCode CLBlastClearCache() {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::ClearCache());
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Fills the cache with binaries for a specific device
+CLBlastStatusCode CLBlastFillCache(const cl_device_id device) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::FillCache(device));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Starts or stops recording the used routines to a manifest file
+CLBlastStatusCode CLBlastRecordManifest(const char* manifest_file) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::RecordManifest(std::string(manifest_file)));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Pre-compiles the routines listed in a manifest for a specific device
+CLBlastStatusCode CLBlastWarmUp(const cl_device_id device, const char* manifest_file,
+                                const int background) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::WarmUp(device, std::string(manifest_file),
+                                                          background != 0));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // =================================================================================================
 
+// Sets the numerics mode for the calling thread
+CLBlastStatusCode CLBlastSetNumerics(const CLBlastNumerics numerics) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::SetNumerics(static_cast<clblast::Numerics>(numerics))
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // Overrides the tuning parameters for this device-precision-kernel combination
 CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device, const char* kernel_name,
                                                        const CLBlastPrecision precision, const size_t num_parameters,
@@ -3815,4 +5134,102 @@ CLBlastStatusCode PUBLIC_API CLBlastOverrideParameters(const cl_device_id device
   } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
 }
 
+// Retrieves the tuning parameters for this device-precision-kernel combination
+CLBlastStatusCode PUBLIC_API CLBlastRetrieveParameters(const cl_device_id device, const char* kernel_name,
+                                                       const CLBlastPrecision precision, const size_t num_parameters,
+                                                       const char** parameters_names, size_t* parameters_values,
+                                                       char* database_entry, const size_t database_entry_size) {
+  try {
+    const auto kernel_name_cpp = std::string(kernel_name);
+    const auto precision_cpp = static_cast<clblast::Precision>(precision);
+    auto parameters = std::unordered_map<std::string, size_t>();
+    auto database_entry_cpp = std::string();
+    const auto status = clblast::RetrieveParameters(device, kernel_name_cpp, precision_cpp, parameters,
+                                                    database_entry_cpp);
+    if (status != clblast::StatusCode::kSuccess) { return static_cast<CLBlastStatusCode>(status); }
+    for (auto i = size_t{0}; i < num_parameters; ++i) {
+      const auto parameter = parameters.find(std::string(parameters_names[i]));
+      if (parameter == parameters.end()) { return CLBlastMissingOverrideParameter; }
+      parameters_values[i] = parameter->second;
+    }
+    if (database_entry != nullptr && database_entry_size > 0) {
+      const auto length = (database_entry_cpp.size() < database_entry_size) ?
+                          database_entry_cpp.size() : database_entry_size - 1;
+      database_entry_cpp.copy(database_entry, length);
+      database_entry[length] = '\0';
+    }
+    return CLBlastSuccess;
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Sets the memory budget for the temporary buffers of the routines in this context
+CLBlastStatusCode CLBlastSetMemoryBudget(const cl_context context, const size_t budget) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::SetMemoryBudget(context, budget));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Retrieves (and clears) the number of fallbacks to lower-memory algorithms in this context
+CLBlastStatusCode CLBlastRetrieveMemoryFallbackCount(const cl_context context,
+                                                     size_t* num_fallbacks) {
+  try {
+    auto fallbacks = std::vector<std::string>();
+    const auto status = clblast::RetrieveMemoryFallbacks(context, fallbacks);
+    *num_fallbacks = fallbacks.size();
+    return static_cast<CLBlastStatusCode>(status);
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Creates (or changes) the dispatcher of a queue
+CLBlastStatusCode CLBlastEnableDispatch(const cl_command_queue queue, const size_t num_queues,
+                                        const CLBlastDispatch policy) {
+  try {
+    const auto policy_cpp = static_cast<clblast::Dispatch>(policy);
+    return static_cast<CLBlastStatusCode>(clblast::EnableDispatch(queue, num_queues, policy_cpp));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Joins the dispatched calls of a queue
+CLBlastStatusCode CLBlastDispatchJoin(const cl_command_queue queue, cl_event* event) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::DispatchJoin(queue, event));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Removes the dispatcher of a queue
+CLBlastStatusCode CLBlastDisableDispatch(const cl_command_queue queue) {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::DisableDispatch(queue));
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// =================================================================================================
+
+// Registers a hot GEMM shape
+CLBlastStatusCode CLBlastRegisterGemmShape(const CLBlastLayout layout,
+                                           const CLBlastTranspose a_transpose,
+                                           const CLBlastTranspose b_transpose,
+                                           const size_t m, const size_t n, const size_t k,
+                                           const size_t a_ld, const size_t b_ld, const size_t c_ld) {
+  try {
+    return static_cast<CLBlastStatusCode>(
+      clblast::RegisterGemmShape(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Transpose>(a_transpose),
+                                 static_cast<clblast::Transpose>(b_transpose),
+                                 m, n, k, a_ld, b_ld, c_ld)
+    );
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
+// Removes all registered GEMM shapes
+CLBlastStatusCode CLBlastClearGemmShapes() {
+  try {
+    return static_cast<CLBlastStatusCode>(clblast::ClearGemmShapes());
+  } catch (...) { return static_cast<CLBlastStatusCode>(clblast::DispatchExceptionForC()); }
+}
+
 // =================================================================================================
@@ -4735,4 +4735,276 @@ void cblas_zomatcopy(const CLBlastLayout layout, const CLBlastTranspose a_transp
   b_buffer.Read(queue, b_size, reinterpret_cast<double2*>(b));
 }
 
+// GEAM
+void cblas_sgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                 const int m, const int n,
+                 const float alpha,
+                 const float* a, const int a_ld,
+                 const float* b, const int b_ld,
+                 const float beta,
+                 float* c, const int c_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : n * a_ld;
+  const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? m * b_ld : n * b_ld;
+  const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
+  auto a_buffer = clblast::Buffer<float>(context, a_size);
+  auto b_buffer = clblast::Buffer<float>(context, b_size);
+  auto c_buffer = clblast::Buffer<float>(context, c_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
+  b_buffer.Write(queue, b_size, reinterpret_cast<const float*>(b));
+  c_buffer.Write(queue, c_size, reinterpret_cast<float*>(c));
+  auto queue_cl = queue();
+  auto s = clblast::Geam(static_cast<clblast::Layout>(layout),
+                         static_cast<clblast::Transpose>(a_transpose),
+                         static_cast<clblast::Transpose>(b_transpose),
+                         m, n,
+                         alpha_cpp,
+                         a_buffer(), 0, a_ld,
+                         b_buffer(), 0, b_ld,
+                         beta_cpp,
+                         c_buffer(), 0, c_ld,
+                         &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  c_buffer.Read(queue, c_size, reinterpret_cast<float*>(c));
+}
+void cblas_dgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                 const int m, const int n,
+                 const double alpha,
+                 const double* a, const int a_ld,
+                 const double* b, const int b_ld,
+                 const double beta,
+                 double* c, const int c_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = alpha;
+  const auto beta_cpp = beta;
+  const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : n * a_ld;
+  const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? m * b_ld : n * b_ld;
+  const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
+  auto a_buffer = clblast::Buffer<double>(context, a_size);
+  auto b_buffer = clblast::Buffer<double>(context, b_size);
+  auto c_buffer = clblast::Buffer<double>(context, c_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
+  b_buffer.Write(queue, b_size, reinterpret_cast<const double*>(b));
+  c_buffer.Write(queue, c_size, reinterpret_cast<double*>(c));
+  auto queue_cl = queue();
+  auto s = clblast::Geam(static_cast<clblast::Layout>(layout),
+                         static_cast<clblast::Transpose>(a_transpose),
+                         static_cast<clblast::Transpose>(b_transpose),
+                         m, n,
+                         alpha_cpp,
+                         a_buffer(), 0, a_ld,
+                         b_buffer(), 0, b_ld,
+                         beta_cpp,
+                         c_buffer(), 0, c_ld,
+                         &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  c_buffer.Read(queue, c_size, reinterpret_cast<double*>(c));
+}
+void cblas_cgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                 const int m, const int n,
+                 const void* alpha,
+                 const void* a, const int a_ld,
+                 const void* b, const int b_ld,
+                 const void* beta,
+                 void* c, const int c_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = float2{reinterpret_cast<const float*>(alpha)[0], reinterpret_cast<const float*>(alpha)[1]};
+  const auto beta_cpp = float2{reinterpret_cast<const float*>(beta)[0], reinterpret_cast<const float*>(beta)[1]};
+  const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : n * a_ld;
+  const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? m * b_ld : n * b_ld;
+  const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
+  auto a_buffer = clblast::Buffer<float2>(context, a_size);
+  auto b_buffer = clblast::Buffer<float2>(context, b_size);
+  auto c_buffer = clblast::Buffer<float2>(context, c_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
+  b_buffer.Write(queue, b_size, reinterpret_cast<const float2*>(b));
+  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  auto queue_cl = queue();
+  auto s = clblast::Geam(static_cast<clblast::Layout>(layout),
+                         static_cast<clblast::Transpose>(a_transpose),
+                         static_cast<clblast::Transpose>(b_transpose),
+                         m, n,
+                         alpha_cpp,
+                         a_buffer(), 0, a_ld,
+                         b_buffer(), 0, b_ld,
+                         beta_cpp,
+                         c_buffer(), 0, c_ld,
+                         &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  c_buffer.Read(queue, c_size, reinterpret_cast<float2*>(c));
+}
+void cblas_zgeam(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+                 const int m, const int n,
+                 const void* alpha,
+                 const void* a, const int a_ld,
+                 const void* b, const int b_ld,
+                 const void* beta,
+                 void* c, const int c_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto alpha_cpp = double2{reinterpret_cast<const double*>(alpha)[0], reinterpret_cast<const double*>(alpha)[1]};
+  const auto beta_cpp = double2{reinterpret_cast<const double*>(beta)[0], reinterpret_cast<const double*>(beta)[1]};
+  const auto a_size = ((layout == CLBlastLayoutColMajor && a_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && a_transpose == CLBlastTransposeNo)) ? m * a_ld : n * a_ld;
+  const auto b_size = ((layout == CLBlastLayoutColMajor && b_transpose != CLBlastTransposeNo) || (layout == CLBlastLayoutRowMajor && b_transpose == CLBlastTransposeNo)) ? m * b_ld : n * b_ld;
+  const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
+  auto a_buffer = clblast::Buffer<double2>(context, a_size);
+  auto b_buffer = clblast::Buffer<double2>(context, b_size);
+  auto c_buffer = clblast::Buffer<double2>(context, c_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
+  b_buffer.Write(queue, b_size, reinterpret_cast<const double2*>(b));
+  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  auto queue_cl = queue();
+  auto s = clblast::Geam(static_cast<clblast::Layout>(layout),
+                         static_cast<clblast::Transpose>(a_transpose),
+                         static_cast<clblast::Transpose>(b_transpose),
+                         m, n,
+                         alpha_cpp,
+                         a_buffer(), 0, a_ld,
+                         b_buffer(), 0, b_ld,
+                         beta_cpp,
+                         c_buffer(), 0, c_ld,
+                         &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  c_buffer.Read(queue, c_size, reinterpret_cast<double2*>(c));
+}
+
+// DGMM
+void cblas_sdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                 const int m, const int n,
+                 const float* a, const int a_ld,
+                 const float* x, const int x_inc,
+                 float* c, const int c_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
+  const auto x_size = (side == CLBlastSideLeft) ? m * x_inc : n * x_inc;
+  const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
+  auto a_buffer = clblast::Buffer<float>(context, a_size);
+  auto x_buffer = clblast::Buffer<float>(context, x_size);
+  auto c_buffer = clblast::Buffer<float>(context, c_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const float*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float*>(x));
+  c_buffer.Write(queue, c_size, reinterpret_cast<float*>(c));
+  auto queue_cl = queue();
+  auto s = clblast::Dgmm<float>(static_cast<clblast::Layout>(layout),
+                                static_cast<clblast::Side>(side),
+                                m, n,
+                                a_buffer(), 0, a_ld,
+                                x_buffer(), 0, x_inc,
+                                c_buffer(), 0, c_ld,
+                                &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  c_buffer.Read(queue, c_size, reinterpret_cast<float*>(c));
+}
+void cblas_ddgmm(const CLBlastLayout layout, const CLBlastSide side,
+                 const int m, const int n,
+                 const double* a, const int a_ld,
+                 const double* x, const int x_inc,
+                 double* c, const int c_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
+  const auto x_size = (side == CLBlastSideLeft) ? m * x_inc : n * x_inc;
+  const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
+  auto a_buffer = clblast::Buffer<double>(context, a_size);
+  auto x_buffer = clblast::Buffer<double>(context, x_size);
+  auto c_buffer = clblast::Buffer<double>(context, c_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const double*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double*>(x));
+  c_buffer.Write(queue, c_size, reinterpret_cast<double*>(c));
+  auto queue_cl = queue();
+  auto s = clblast::Dgmm<double>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Side>(side),
+                                 m, n,
+                                 a_buffer(), 0, a_ld,
+                                 x_buffer(), 0, x_inc,
+                                 c_buffer(), 0, c_ld,
+                                 &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  c_buffer.Read(queue, c_size, reinterpret_cast<double*>(c));
+}
+void cblas_cdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                 const int m, const int n,
+                 const void* a, const int a_ld,
+                 const void* x, const int x_inc,
+                 void* c, const int c_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
+  const auto x_size = (side == CLBlastSideLeft) ? m * x_inc : n * x_inc;
+  const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
+  auto a_buffer = clblast::Buffer<float2>(context, a_size);
+  auto x_buffer = clblast::Buffer<float2>(context, x_size);
+  auto c_buffer = clblast::Buffer<float2>(context, c_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const float2*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const float2*>(x));
+  c_buffer.Write(queue, c_size, reinterpret_cast<float2*>(c));
+  auto queue_cl = queue();
+  auto s = clblast::Dgmm<float2>(static_cast<clblast::Layout>(layout),
+                                 static_cast<clblast::Side>(side),
+                                 m, n,
+                                 a_buffer(), 0, a_ld,
+                                 x_buffer(), 0, x_inc,
+                                 c_buffer(), 0, c_ld,
+                                 &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  c_buffer.Read(queue, c_size, reinterpret_cast<float2*>(c));
+}
+void cblas_zdgmm(const CLBlastLayout layout, const CLBlastSide side,
+                 const int m, const int n,
+                 const void* a, const int a_ld,
+                 const void* x, const int x_inc,
+                 void* c, const int c_ld) {
+  auto device = get_device();
+  auto context = clblast::Context(device);
+  auto queue = clblast::Queue(context, device);
+  const auto a_size = (layout == CLBlastLayoutRowMajor) ? m * a_ld : n * a_ld;
+  const auto x_size = (side == CLBlastSideLeft) ? m * x_inc : n * x_inc;
+  const auto c_size = (layout == CLBlastLayoutRowMajor) ? m * c_ld : n * c_ld;
+  auto a_buffer = clblast::Buffer<double2>(context, a_size);
+  auto x_buffer = clblast::Buffer<double2>(context, x_size);
+  auto c_buffer = clblast::Buffer<double2>(context, c_size);
+  a_buffer.Write(queue, a_size, reinterpret_cast<const double2*>(a));
+  x_buffer.Write(queue, x_size, reinterpret_cast<const double2*>(x));
+  c_buffer.Write(queue, c_size, reinterpret_cast<double2*>(c));
+  auto queue_cl = queue();
+  auto s = clblast::Dgmm<double2>(static_cast<clblast::Layout>(layout),
+                                  static_cast<clblast::Side>(side),
+                                  m, n,
+                                  a_buffer(), 0, a_ld,
+                                  x_buffer(), 0, x_inc,
+                                  c_buffer(), 0, c_ld,
+                                  &queue_cl);
+  if (s != clblast::StatusCode::kSuccess) {
+    throw std::runtime_error("CLBlast returned with error code " + clblast::ToString(s));
+  }
+  c_buffer.Read(queue, c_size, reinterpret_cast<double2*>(c));
+}
+
 // =================================================================================================
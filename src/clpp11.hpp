@@ -37,7 +37,7 @@
 #define CLBLAST_CLPP11_H_
 
 // C++
-#include <algorithm> // std::copy
+#include <algorithm> // std::copy, std::any_of
 #include <string>    // std::string
 #include <vector>    // std::vector
 #include <memory>    // std::shared_ptr
@@ -55,6 +55,14 @@
 // Exception classes
 #include "cxpp11_common.hpp"
 
+// Vendor-specific device queries (from the 'cl_nv_device_attribute_query' extension)
+#ifndef CL_DEVICE_COMPUTE_CAPABILITY_MAJOR_NV
+  #define CL_DEVICE_COMPUTE_CAPABILITY_MAJOR_NV 0x4000
+#endif
+#ifndef CL_DEVICE_COMPUTE_CAPABILITY_MINOR_NV
+  #define CL_DEVICE_COMPUTE_CAPABILITY_MINOR_NV 0x4001
+#endif
+
 namespace clblast {
 // =================================================================================================
 
@@ -239,6 +247,15 @@ class Device {
     size_t version = (size_t) (100.0 * std::stod(version_string.substr(0, next_whitespace)));
     return version;
   }
+  std::string CVersion() const { return GetInfoString(CL_DEVICE_OPENCL_C_VERSION); }
+  size_t CVersionNumber() const
+  {
+    // The version string is formatted as "OpenCL C <major>.<minor> <vendor-specific information>"
+    std::string version_string = CVersion().substr(9);
+    size_t next_whitespace = version_string.find(' ');
+    size_t version = (size_t) (100.0 * std::stod(version_string.substr(0, next_whitespace)));
+    return version;
+  }
   std::string Vendor() const { return GetInfoString(CL_DEVICE_VENDOR); }
   std::string Name() const { return GetInfoString(CL_DEVICE_NAME); }
   std::string Type() const {
@@ -273,9 +290,26 @@ class Device {
   unsigned long MaxAllocSize() const {
     return static_cast<unsigned long>(GetInfo<cl_ulong>(CL_DEVICE_MAX_MEM_ALLOC_SIZE));
   }
+  bool SupportsNonUniformWorkGroups() const {
+    if (VersionNumber() < 200) { return false; }
+    if (VersionNumber() < 300) { return true; } // mandatory in OpenCL 2.x
+    #ifdef CL_DEVICE_NON_UNIFORM_WORK_GROUP_SUPPORT
+      return GetInfo<cl_bool>(CL_DEVICE_NON_UNIFORM_WORK_GROUP_SUPPORT) == CL_TRUE;
+    #else
+      return false; // optional in OpenCL 3.0, but can't be queried with these headers
+    #endif
+  }
   size_t MemoryClock() const { return 0; } // Not exposed in OpenCL
   size_t MemoryBusWidth() const { return 0; } // Not exposed in OpenCL
 
+  // Retrieves the compute capability of NVIDIA devices (e.g. 52 for 5.2), or 0 if not available
+  size_t NVIDIAComputeCapability() const {
+    if (Capabilities().find("cl_nv_device_attribute_query") == std::string::npos) { return 0; }
+    const auto major = GetInfo<cl_uint>(CL_DEVICE_COMPUTE_CAPABILITY_MAJOR_NV);
+    const auto minor = GetInfo<cl_uint>(CL_DEVICE_COMPUTE_CAPABILITY_MINOR_NV);
+    return static_cast<size_t>(10 * major + minor);
+  }
+
   // Configuration-validity checks
   bool IsLocalMemoryValid(const cl_ulong local_mem_usage) const {
     return (local_mem_usage <= LocalMemSize());
@@ -411,7 +445,13 @@ class Program {
 
   // Compiles the device program and returns whether or not there where any warnings/errors
   void Build(const Device &device, std::vector<std::string> &options) {
-    options.push_back("-cl-std=CL1.1");
+
+    // Compiles as OpenCL C 1.1 unless a specific version is requested in the options
+    const auto has_standard = std::any_of(options.begin(), options.end(),
+                                          [](const std::string &option) {
+                                            return option.find("-cl-std=") != std::string::npos;
+                                          });
+    if (!has_standard) { options.push_back("-cl-std=CL1.1"); }
     auto options_string = std::accumulate(options.begin(), options.end(), std::string{" "});
     const cl_device_id dev = device();
     CheckError(clBuildProgram(*program_, 1, &dev, options_string.c_str(), nullptr, nullptr));
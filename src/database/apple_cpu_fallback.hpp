@@ -22,47 +22,88 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry XaxpyApple = {
-  "Xaxpy", Precision::kAny, { { kDeviceTypeAll, "default", { { "default", { {"VW",8}, {"WGS",1}, {"WPT",4} } } } } }
+// All entries consist of a single default device of the default vendor
+constexpr Database::StaticVendor AppleVendors[] = { { kDeviceTypeAll, "default", 0, 1 } };
+
+constexpr const char* XaxpyAppleParameters[] = { "VW", "WGS", "WPT" };
+constexpr Database::StaticDevice XaxpyAppleDevices[] = { { "default", { 8, 1, 4 } } };
+constexpr Database::StaticEntry XaxpyApple = {
+  "Xaxpy", Precision::kAny, XaxpyAppleParameters, 3, XaxpyAppleDevices, AppleVendors, 1, nullptr, 0
+};
+constexpr const char* XdotAppleParameters[] = { "WGS1", "WGS2" };
+constexpr Database::StaticDevice XdotAppleDevices[] = { { "default", { 1, 1 } } };
+constexpr Database::StaticEntry XdotApple = {
+  "Xdot", Precision::kAny, XdotAppleParameters, 2, XdotAppleDevices, AppleVendors, 1, nullptr, 0
+};
+constexpr const char* XgemvAppleParameters[] = { "WGS1", "WPT1", "UNROLL1" };
+constexpr Database::StaticDevice XgemvAppleDevices[] = { { "default", { 1, 4, 1 } } };
+constexpr Database::StaticEntry XgemvApple = {
+  "Xgemv", Precision::kAny, XgemvAppleParameters, 3, XgemvAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry XdotApple = {
-  "Xdot", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS1",1}, {"WGS2",1} } } } } }
+constexpr const char* XgemvFastAppleParameters[] = { "VW2", "WGS2", "WPT2" };
+constexpr Database::StaticDevice XgemvFastAppleDevices[] = { { "default", { 1, 1, 1 } } };
+constexpr Database::StaticEntry XgemvFastApple = {
+  "XgemvFast", Precision::kAny, XgemvFastAppleParameters, 3, XgemvFastAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry XgemvApple = {
-  "Xgemv", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS1",1}, {"WPT1",4}, {"UNROLL1", 1} } } } } }
+constexpr const char* XgemvFastRotAppleParameters[] = { "VW3", "WGS3", "WPT3" };
+constexpr Database::StaticDevice XgemvFastRotAppleDevices[] = { { "default", { 1, 1, 1 } } };
+constexpr Database::StaticEntry XgemvFastRotApple = {
+  "XgemvFastRot", Precision::kAny, XgemvFastRotAppleParameters, 3, XgemvFastRotAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry XgemvFastApple = {
-  "XgemvFast", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"VW2",1}, {"WGS2",1}, {"WPT2",1} } } } } }
+constexpr const char* XgerAppleParameters[] = { "WGS1", "WGS2", "WPT" };
+constexpr Database::StaticDevice XgerAppleDevices[] = { { "default", { 64, 1, 2 } } };
+constexpr Database::StaticEntry XgerApple = {
+  "Xger", Precision::kAny, XgerAppleParameters, 3, XgerAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry XgemvFastRotApple = {
-  "XgemvFastRot", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"VW3",1}, {"WGS3",1}, {"WPT3",1} } } } } }
+constexpr const char* XtrsvAppleParameters[] = { "TRSV_BLOCK_SIZE" };
+constexpr Database::StaticDevice XtrsvAppleDevices[] = { { "default", { 32 } } };
+constexpr Database::StaticEntry XtrsvApple = {
+  "Xtrsv", Precision::kAny, XtrsvAppleParameters, 1, XtrsvAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry XgerApple = {
-  "Xger", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } } } } }
+constexpr const char* XsymvAppleParameters[] = { "WGS1", "WGS2", "WPT1" };
+constexpr Database::StaticDevice XsymvAppleDevices[] = { { "default", { 1, 1, 4 } } };
+constexpr Database::StaticEntry XsymvApple = {
+  "Xsymv", Precision::kAny, XsymvAppleParameters, 3, XsymvAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry XtrsvApple = {
-  "Xtrsv", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"TRSV_BLOCK_SIZE",32} } } } } }
+constexpr const char* XgemmAppleParameters[] = { "KWG", "KWI", "MDIMA", "MDIMC", "MWG", "NDIMB", "NDIMC", "NWG", "SA", "SB", "STRM", "STRN", "VWM", "VWN" };
+constexpr Database::StaticDevice XgemmAppleDevices[] = { { "default", { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1 } } };
+constexpr Database::StaticEntry XgemmApple = {
+  "Xgemm", Precision::kAny, XgemmAppleParameters, 14, XgemmAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry XgemmApple = {
-  "Xgemm", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"KWG",1}, {"KWI",1}, {"MDIMA",1}, {"MDIMC",1}, {"MWG",1}, {"NDIMB",1}, {"NDIMC",1}, {"NWG",1}, {"SA",1}, {"SB",1}, {"STRM",0}, {"STRN",0}, {"VWM",1}, {"VWN",1} } } } } }
+constexpr const char* XgemmDirectAppleParameters[] = { "KWID", "MDIMAD", "MDIMCD", "NDIMBD", "NDIMCD", "PADA", "PADB", "VWMD", "VWND", "WGD" };
+constexpr Database::StaticDevice XgemmDirectAppleDevices[] = { { "default", { 1, 1, 1, 1, 1, 0, 0, 1, 1, 1 } } };
+constexpr Database::StaticEntry XgemmDirectApple = {
+  "XgemmDirect", Precision::kAny, XgemmDirectAppleParameters, 10, XgemmDirectAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry XgemmDirectApple = {
-  "XgemmDirect", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"KWID",1}, {"MDIMAD",1}, {"MDIMCD",1}, {"NDIMBD",1}, {"NDIMCD",1}, {"PADA",0}, {"PADB",0}, {"VWMD",1}, {"VWND",1}, {"WGD",1} } } } } }
+constexpr const char* XgemmQuantizedAppleParameters[] = { "KWID", "MDIMAD", "MDIMCD", "NDIMBD", "NDIMCD", "PADA", "PADB", "VWMD", "VWND", "WGD" };
+constexpr Database::StaticDevice XgemmQuantizedAppleDevices[] = { { "default", { 1, 1, 1, 1, 1, 0, 0, 1, 1, 1 } } };
+constexpr Database::StaticEntry XgemmQuantizedApple = {
+  "XgemmQuantized", Precision::kAny, XgemmQuantizedAppleParameters, 10, XgemmQuantizedAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry CopyApple = {
-  "Copy", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"COPY_DIMX",1}, {"COPY_DIMY",1}, {"COPY_VW",1}, {"COPY_WPT",1} } } } } }
+constexpr const char* CopyAppleParameters[] = { "COPY_DIMX", "COPY_DIMY", "COPY_VW", "COPY_WPT" };
+constexpr Database::StaticDevice CopyAppleDevices[] = { { "default", { 1, 1, 1, 1 } } };
+constexpr Database::StaticEntry CopyApple = {
+  "Copy", Precision::kAny, CopyAppleParameters, 4, CopyAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry PadApple = {
-  "Pad", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"PAD_DIMX",1}, {"PAD_DIMY",1}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } } } } }
+constexpr const char* PadAppleParameters[] = { "PAD_DIMX", "PAD_DIMY", "PAD_WPTX", "PAD_WPTY" };
+constexpr Database::StaticDevice PadAppleDevices[] = { { "default", { 1, 1, 1, 1 } } };
+constexpr Database::StaticEntry PadApple = {
+  "Pad", Precision::kAny, PadAppleParameters, 4, PadAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry TransposeApple = {
-  "Transpose", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"TRA_DIM",1}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } } } } }
+constexpr const char* TransposeAppleParameters[] = { "TRA_DIM", "TRA_PAD", "TRA_SHUFFLE", "TRA_WPT" };
+constexpr Database::StaticDevice TransposeAppleDevices[] = { { "default", { 1, 0, 0, 1 } } };
+constexpr Database::StaticEntry TransposeApple = {
+  "Transpose", Precision::kAny, TransposeAppleParameters, 4, TransposeAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry PadtransposeApple = {
-  "Padtranspose", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"PADTRA_PAD",0}, {"PADTRA_TILE",1}, {"PADTRA_WPT",1} } } } } }
+constexpr const char* PadtransposeAppleParameters[] = { "PADTRA_PAD", "PADTRA_TILE", "PADTRA_WPT" };
+constexpr Database::StaticDevice PadtransposeAppleDevices[] = { { "default", { 0, 1, 1 } } };
+constexpr Database::StaticEntry PadtransposeApple = {
+  "Padtranspose", Precision::kAny, PadtransposeAppleParameters, 3, PadtransposeAppleDevices, AppleVendors, 1, nullptr, 0
 };
-const Database::DatabaseEntry InvertApple = {
-  "Invert", Precision::kAny, { {  kDeviceTypeAll, "default", { { "default", { {"INTERNAL_BLOCK_SIZE",16} } } } } }
+constexpr const char* InvertAppleParameters[] = { "INTERNAL_BLOCK_SIZE", "TRTRI_BLOCK_SIZE" };
+constexpr Database::StaticDevice InvertAppleDevices[] = { { "default", { 16, 64 } } };
+constexpr Database::StaticEntry InvertApple = {
+  "Invert", Precision::kAny, InvertAppleParameters, 2, InvertAppleDevices, AppleVendors, 1, nullptr, 0
 };
 
 // =================================================================================================
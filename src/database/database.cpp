@@ -11,7 +11,8 @@
 //
 // =================================================================================================
 
-#include <list>
+#include <cctype>
+#include <cstring>
 
 #include "utilities/utilities.hpp"
 
@@ -23,8 +24,10 @@
 #include "database/kernels/xgemv_fast_rot.hpp"
 #include "database/kernels/xger.hpp"
 #include "database/kernels/xtrsv.hpp"
+#include "database/kernels/xsymv.hpp"
 #include "database/kernels/xgemm.hpp"
 #include "database/kernels/xgemm_direct.hpp"
+#include "database/kernels/xgemm_quantized.hpp"
 #include "database/kernels/copy.hpp"
 #include "database/kernels/pad.hpp"
 #include "database/kernels/transpose.hpp"
@@ -37,41 +40,48 @@ namespace clblast {
 // =================================================================================================
 
 // Initializes the databases
-const std::vector<Database::DatabaseEntry> Database::database = std::vector<Database::DatabaseEntry>{
-  database::XaxpyHalf, database::XaxpySingle, database::XaxpyDouble, database::XaxpyComplexSingle, database::XaxpyComplexDouble,
-  database::XdotHalf, database::XdotSingle, database::XdotDouble, database::XdotComplexSingle, database::XdotComplexDouble,
-  database::XgemvHalf, database::XgemvSingle, database::XgemvDouble, database::XgemvComplexSingle, database::XgemvComplexDouble,
-  database::XgemvFastHalf, database::XgemvFastSingle, database::XgemvFastDouble, database::XgemvFastComplexSingle, database::XgemvFastComplexDouble,
-  database::XgemvFastRotHalf, database::XgemvFastRotSingle, database::XgemvFastRotDouble, database::XgemvFastRotComplexSingle, database::XgemvFastRotComplexDouble,
-  database::XgerHalf, database::XgerSingle, database::XgerDouble, database::XgerComplexSingle, database::XgerComplexDouble,
-  database::XtrsvHalf, database::XtrsvSingle, database::XtrsvDouble, database::XtrsvComplexSingle, database::XtrsvComplexDouble,
-  database::XgemmHalf, database::XgemmSingle, database::XgemmDouble, database::XgemmComplexSingle, database::XgemmComplexDouble,
-  database::XgemmDirectHalf, database::XgemmDirectSingle, database::XgemmDirectDouble, database::XgemmDirectComplexSingle, database::XgemmDirectComplexDouble,
-  database::CopyHalf, database::CopySingle, database::CopyDouble, database::CopyComplexSingle, database::CopyComplexDouble,
-  database::PadHalf, database::PadSingle, database::PadDouble, database::PadComplexSingle, database::PadComplexDouble,
-  database::TransposeHalf, database::TransposeSingle, database::TransposeDouble, database::TransposeComplexSingle, database::TransposeComplexDouble,
-  database::PadtransposeHalf, database::PadtransposeSingle, database::PadtransposeDouble, database::PadtransposeComplexSingle, database::PadtransposeComplexDouble,
-  database::InvertHalf, database::InvertSingle, database::InvertDouble, database::InvertComplexSingle, database::InvertComplexDouble,
-  database::KernelSelectionHalf, database::KernelSelectionSingle, database::KernelSelectionDouble, database::KernelSelectionComplexSingle, database::KernelSelectionComplexDouble
+const Database::StaticEntry* const Database::database[] = {
+  &database::XaxpyHalf, &database::XaxpySingle, &database::XaxpyDouble, &database::XaxpyComplexSingle, &database::XaxpyComplexDouble, &database::XaxpyBFloat16,
+  &database::XdotHalf, &database::XdotSingle, &database::XdotDouble, &database::XdotComplexSingle, &database::XdotComplexDouble, &database::XdotBFloat16,
+  &database::XgemvHalf, &database::XgemvSingle, &database::XgemvDouble, &database::XgemvComplexSingle, &database::XgemvComplexDouble, &database::XgemvBFloat16,
+  &database::XgemvFastHalf, &database::XgemvFastSingle, &database::XgemvFastDouble, &database::XgemvFastComplexSingle, &database::XgemvFastComplexDouble, &database::XgemvFastBFloat16,
+  &database::XgemvFastRotHalf, &database::XgemvFastRotSingle, &database::XgemvFastRotDouble, &database::XgemvFastRotComplexSingle, &database::XgemvFastRotComplexDouble, &database::XgemvFastRotBFloat16,
+  &database::XgerHalf, &database::XgerSingle, &database::XgerDouble, &database::XgerComplexSingle, &database::XgerComplexDouble, &database::XgerBFloat16,
+  &database::XtrsvHalf, &database::XtrsvSingle, &database::XtrsvDouble, &database::XtrsvComplexSingle, &database::XtrsvComplexDouble, &database::XtrsvBFloat16,
+  &database::XsymvHalf, &database::XsymvSingle, &database::XsymvDouble, &database::XsymvComplexSingle, &database::XsymvComplexDouble, &database::XsymvBFloat16,
+  &database::XgemmHalf, &database::XgemmSingle, &database::XgemmDouble, &database::XgemmComplexSingle, &database::XgemmComplexDouble, &database::XgemmBFloat16,
+  &database::XgemmDirectHalf, &database::XgemmDirectSingle, &database::XgemmDirectDouble, &database::XgemmDirectComplexSingle, &database::XgemmDirectComplexDouble, &database::XgemmDirectBFloat16,
+  &database::XgemmQuantizedHalf, &database::XgemmQuantizedSingle, &database::XgemmQuantizedDouble, &database::XgemmQuantizedComplexSingle, &database::XgemmQuantizedComplexDouble, &database::XgemmQuantizedBFloat16,
+  &database::CopyHalf, &database::CopySingle, &database::CopyDouble, &database::CopyComplexSingle, &database::CopyComplexDouble, &database::CopyBFloat16,
+  &database::PadHalf, &database::PadSingle, &database::PadDouble, &database::PadComplexSingle, &database::PadComplexDouble, &database::PadBFloat16,
+  &database::TransposeHalf, &database::TransposeSingle, &database::TransposeDouble, &database::TransposeComplexSingle, &database::TransposeComplexDouble, &database::TransposeBFloat16,
+  &database::PadtransposeHalf, &database::PadtransposeSingle, &database::PadtransposeDouble, &database::PadtransposeComplexSingle, &database::PadtransposeComplexDouble, &database::PadtransposeBFloat16,
+  &database::InvertHalf, &database::InvertSingle, &database::InvertDouble, &database::InvertComplexSingle, &database::InvertComplexDouble, &database::InvertBFloat16,
+  &database::KernelSelectionHalf, &database::KernelSelectionSingle, &database::KernelSelectionDouble, &database::KernelSelectionComplexSingle, &database::KernelSelectionComplexDouble, &database::KernelSelectionBFloat16
 };
-const std::vector<Database::DatabaseEntry> Database::apple_cpu_fallback = std::vector<Database::DatabaseEntry>{
-  database::XaxpyApple, database::XdotApple,
-  database::XgemvApple, database::XgemvFastApple, database::XgemvFastRotApple, database::XgerApple, database::XtrsvApple,
-  database::XgemmApple, database::XgemmDirectApple,
-  database::CopyApple, database::PadApple, database::TransposeApple, database::PadtransposeApple,
-  database::InvertApple
+const size_t Database::database_size = sizeof(Database::database) / sizeof(Database::database[0]);
+const Database::StaticEntry* const Database::apple_cpu_fallback[] = {
+  &database::XaxpyApple, &database::XdotApple,
+  &database::XgemvApple, &database::XgemvFastApple, &database::XgemvFastRotApple, &database::XgerApple, &database::XtrsvApple, &database::XsymvApple,
+  &database::XgemmApple, &database::XgemmDirectApple, &database::XgemmQuantizedApple,
+  &database::CopyApple, &database::PadApple, &database::TransposeApple, &database::PadtransposeApple,
+  &database::InvertApple
 };
+const size_t Database::apple_cpu_fallback_size = sizeof(Database::apple_cpu_fallback) /
+                                                 sizeof(Database::apple_cpu_fallback[0]);
 
 // The default values
 const std::string Database::kDeviceVendorAll = "default";
 
 // Alternative names for some OpenCL vendors
-const std::unordered_map<std::string, std::string> Database::kVendorNames{
+const Database::VendorName Database::kVendorNames[] = {
   { "Intel(R) Corporation", "Intel" },
   { "GenuineIntel", "Intel" },
   { "Advanced Micro Devices, Inc.", "AMD" },
   { "NVIDIA Corporation", "NVIDIA" },
 };
+const size_t Database::kNumVendorNames = sizeof(Database::kVendorNames) /
+                                         sizeof(Database::kVendorNames[0]);
 
 // =================================================================================================
 
@@ -87,37 +97,44 @@ Database::Database(const Device &device, const std::string &kernel_name,
   auto device_name = device.Name();
 
   // Set the short vendor name
-  for (auto &combination : kVendorNames) {
-    if (device_vendor == combination.first) {
-      device_vendor = combination.second;
+  for (auto i = size_t{0}; i < kNumVendorNames; ++i) {
+    if (device_vendor == kVendorNames[i].name) {
+      device_vendor = kVendorNames[i].short_name;
     }
   }
 
-  // Sets the databases to search through
-  auto databases = std::list<std::vector<DatabaseEntry>>{overlay, database};
+  // Derives the architecture family, used in case the device itself is not in the database
+  const auto device_family = GetArchitectureFamily(device, device_vendor);
 
-  // Special case: modifies the database if the device is a CPU with Apple OpenCL
+  // Searches potentially multiple databases: first the special case of a CPU with Apple OpenCL,
+  // then the user-provided overlay database, and finally the built-in database
+  auto search_result = false;
   #if defined(__APPLE__) || defined(__MACOSX)
     if (device.Type() == "CPU") {
       auto extensions = device.Capabilities();
       const auto is_apple = (extensions.find("cl_APPLE_SetMemObjectDestructor") == std::string::npos) ? false : true;
       if (is_apple) {
-        databases.push_front(apple_cpu_fallback);
+        search_result = Search(kernel_name, device_type, device_vendor, device_name, device_family,
+                               precision, apple_cpu_fallback, apple_cpu_fallback_size,
+                               entry_description_);
       }
     }
   #endif
-
-  // Searches potentially multiple databases
-  auto search_result = ParametersPtr{};
-  for (auto &db: databases) {
-    search_result = Search(kernel_name, device_type, device_vendor, device_name, precision, db);
-    if (search_result) {
-      parameters_->insert(search_result->begin(), search_result->end());
-      break;
-    }
+  if (!search_result && !overlay.empty()) {
+    search_result = Search(kernel_name, device_type, device_vendor, device_name, device_family,
+                           precision, overlay, entry_description_);
+    if (search_result) { entry_description_ = "user-provided parameters"; }
+  }
+  if (!search_result) {
+    search_result = Search(kernel_name, device_type, device_vendor, device_name, device_family,
+                           precision, database, database_size, entry_description_);
   }
 
   if (!search_result) { throw RuntimeErrorCode(StatusCode::kDatabaseError); }
+  #ifdef VERBOSE
+    printf("[DEBUG] Database for '%s' on device '%s': %s\n", kernel_name.c_str(),
+           device_name.c_str(), entry_description_.c_str());
+  #endif
 }
 
 // =================================================================================================
@@ -142,13 +159,12 @@ std::vector<std::string> Database::GetParameterNames() const {
 
 // =================================================================================================
 
-// Searches a particular database for the right kernel and precision
-Database::ParametersPtr Database::Search(const std::string &this_kernel,
-                                         const std::string &this_type,
-                                         const std::string &this_vendor,
-                                         const std::string &this_device,
-                                         const Precision this_precision,
-                                         const std::vector<DatabaseEntry> &this_database) const {
+// Searches a user-provided database for the right kernel and precision
+bool Database::Search(const std::string &this_kernel, const std::string &this_type,
+                      const std::string &this_vendor, const std::string &this_device,
+                      const std::string &this_family, const Precision this_precision,
+                      const std::vector<DatabaseEntry> &this_database,
+                      std::string &entry_description) {
 
   // Selects the right kernel
   for (auto &db: this_database) {
@@ -160,25 +176,345 @@ Database::ParametersPtr Database::Search(const std::string &this_kernel,
       for (auto &vendor: db.vendors) {
         if ((vendor.name == this_vendor || vendor.name == kDeviceVendorAll) &&
             (vendor.type == this_type || vendor.type == database::kDeviceTypeAll)) {
-
-          // Searches for the right device. If the current device is unavailable, selects the vendor
-          // default parameters. This assumes the default is last in the database.
+          auto exact_match = static_cast<const DatabaseDevice*>(nullptr);
           for (auto &device: vendor.devices) {
+            if (device.name == this_device) { exact_match = &device; break; }
+          }
+          const auto device = SelectDevice(exact_match, vendor.devices.data(),
+                                           vendor.devices.size(), vendor.name, vendor.type,
+                                           this_device, this_family, entry_description);
+          if (device != nullptr) {
+            parameters_->insert(device->parameters.begin(), device->parameters.end());
+            return true;
+          }
+        }
+      }
+    }
+  }
+
+  // If we reached this point, the entry was not found in this database
+  return false;
+}
+
+// As above, but for the built-in database. The kernel is found by comparing the strings directly
+// (there are few entries and kernel names differ early on) and the device using the hash index.
+bool Database::Search(const std::string &this_kernel, const std::string &this_type,
+                      const std::string &this_vendor, const std::string &this_device,
+                      const std::string &this_family, const Precision this_precision,
+                      const StaticEntry* const* this_database, const size_t this_database_size,
+                      std::string &entry_description) {
+  const auto this_hash = database::DatabaseHash(this_device.c_str());
 
-            if (device.name == this_device || device.name == "default") {
+  // Selects the right kernel
+  for (auto i = size_t{0}; i < this_database_size; ++i) {
+    const auto &db = *this_database[i];
+    if ((db.precision == this_precision || db.precision == Precision::kAny) &&
+        (std::strcmp(db.kernel, this_kernel.c_str()) == 0)) {
+
+      // Searches for the right vendor and device type, or selects the default if unavailable. This
+      // assumes that the default vendor / device type is last in the database.
+      for (auto v = size_t{0}; v < db.num_vendors; ++v) {
+        const auto &vendor = db.vendors[v];
+        if ((vendor.name == this_vendor || vendor.name == kDeviceVendorAll) &&
+            (vendor.type == this_type || std::strcmp(vendor.type, database::kDeviceTypeAll) == 0)) {
 
-              // Sets the parameters accordingly
-              return &device.parameters;
+          // Looks-up the device by its exact name in the hash index, skipping devices with the
+          // same hash or the same name but of a different vendor. Entries without an index (only
+          // the hand-written ones) are searched linearly instead.
+          const auto is_match = [&](const size_t device_id) {
+            return device_id >= vendor.first_device &&
+                   device_id < vendor.first_device + vendor.num_devices &&
+                   std::strcmp(db.devices[device_id].name, this_device.c_str()) == 0;
+          };
+          auto exact_match = static_cast<const StaticDevice*>(nullptr);
+          if (db.index_size == 0) {
+            for (auto d = vendor.first_device; d < vendor.first_device + vendor.num_devices; ++d) {
+              if (is_match(d)) { exact_match = &db.devices[d]; break; }
             }
           }
+          else {
+            const auto mask = db.index_size - 1;
+            for (auto slot = this_hash & mask; db.index[slot] != 0; slot = (slot + 1) & mask) {
+              const auto device_id = static_cast<size_t>(db.index[slot] - 1);
+              if (is_match(device_id)) { exact_match = &db.devices[device_id]; break; }
+            }
+          }
+          const auto device = SelectDevice(exact_match, db.devices + vendor.first_device,
+                                           vendor.num_devices, vendor.name, vendor.type,
+                                           this_device, this_family, entry_description);
+          if (device != nullptr) {
+            for (auto p = size_t{0}; p < db.num_parameters; ++p) {
+              (*parameters_)[db.parameter_names[p]] = device->values[p];
+            }
+            return true;
+          }
         }
       }
     }
   }
 
   // If we reached this point, the entry was not found in this database
+  return false;
+}
+
+// Selects the device amongst the devices of a single vendor (see the header for details)
+template <typename DeviceType>
+const DeviceType* Database::SelectDevice(const DeviceType* exact_match, const DeviceType* devices,
+                                         const size_t num_devices, const std::string &vendor_name,
+                                         const std::string &vendor_type,
+                                         const std::string &this_device,
+                                         const std::string &this_family,
+                                         std::string &entry_description) {
+  const auto device_name = [](const DeviceType &device) { return std::string{device.name}; };
+
+  // Searches for the right device: first by its exact name, then by its name without decorations
+  // such as "(TM)" (e.g. as a result of a different driver version)
+  if (exact_match != nullptr) {
+    entry_description = "tuned parameters of device '" + device_name(*exact_match) + "'";
+    return exact_match;
+  }
+  const auto this_normalized_name = NormalizeDeviceName(this_device);
+  for (auto d = size_t{0}; d < num_devices; ++d) {
+    const auto name = device_name(devices[d]);
+    if (name != "default" && NormalizeDeviceName(name) == this_normalized_name) {
+      entry_description = "tuned parameters of device '" + name + "' (same name)";
+      return &devices[d];
+    }
+  }
+
+  // If the device is unavailable, selects the closest device of the same architecture family, i.e.
+  // the one with the nearest model number (e.g. a GTX 1070 for a GTX 1080)
+  if (!this_family.empty()) {
+    const auto this_model_number = GetModelNumber(this_device);
+    auto closest = static_cast<const DeviceType*>(nullptr);
+    auto closest_distance = size_t{0};
+    for (auto d = size_t{0}; d < num_devices; ++d) {
+      const auto name = device_name(devices[d]);
+      if (name == "default") { continue; }
+      if (GetArchitectureFamily(vendor_name, vendor_type, name) != this_family) { continue; }
+      const auto model_number = GetModelNumber(name);
+      const auto distance = (model_number > this_model_number) ?
+                            model_number - this_model_number :
+                            this_model_number - model_number;
+      if (closest == nullptr || distance < closest_distance) {
+        closest = &devices[d];
+        closest_distance = distance;
+      }
+    }
+    if (closest != nullptr) {
+      entry_description = "tuned parameters of device '" + device_name(*closest) + "' (closest "
+                          "device of the " + this_family + " architecture)";
+      return closest;
+    }
+  }
+
+  // Otherwise selects the vendor default parameters. This assumes the default is last.
+  for (auto d = size_t{0}; d < num_devices; ++d) {
+    if (device_name(devices[d]) == "default") {
+      entry_description = (vendor_name == kDeviceVendorAll) ?
+                          "default parameters" :
+                          "default parameters of " + vendor_name + " " + vendor_type + "s";
+      return &devices[d];
+    }
+  }
   return nullptr;
 }
 
+// =================================================================================================
+
+// Removes decorations such as "(R)" and "(TM)" as well as redundant spaces, and converts to lower
+// case. This is used to match device names reported differently by different driver versions.
+std::string Database::NormalizeDeviceName(const std::string &name) {
+  auto result = std::string{};
+  for (auto i = size_t{0}; i < name.size(); ++i) {
+    if (name[i] == '(') {
+      const auto end = name.find(')', i);
+      const auto decoration = name.substr(i, end - i + 1);
+      if (decoration == "(R)" || decoration == "(r)" || decoration == "(TM)" ||
+          decoration == "(tm)") {
+        i = end;
+        continue;
+      }
+    }
+    if (name[i] == ' ' && (result.empty() || result.back() == ' ')) { continue; }
+    result += static_cast<char>(std::tolower(static_cast<unsigned char>(name[i])));
+  }
+  while (!result.empty() && result.back() == ' ') { result.pop_back(); }
+  return result;
+}
+
+// Extracts the model number of a device: the first number of at least three digits (e.g. 1080 in
+// "GeForce GTX 1080" or 4790 in "Core(TM) i7-4790K CPU @ 4.00GHz"), or else the first number
+size_t Database::GetModelNumber(const std::string &name) {
+  const auto find_number = [&name](const size_t min_digits) {
+    for (auto i = size_t{0}; i < name.size(); ++i) {
+      auto digits = size_t{0};
+      while (i + digits < name.size() && std::isdigit(static_cast<unsigned char>(name[i + digits]))) {
+        ++digits;
+      }
+      if (digits > 0 && digits >= min_digits) { return i; }
+      i += digits;
+    }
+    return std::string::npos;
+  };
+  auto position = find_number(3);
+  if (position == std::string::npos) { position = find_number(1); }
+  if (position == std::string::npos) { return 0; }
+  return static_cast<size_t>(std::stoul(name.substr(position, 9)));
+}
+
+// =================================================================================================
+
+// Derives the architecture family from the name of the device. The database only stores the names
+// of the tuned devices, so the same function is applied to the entries of the database. For NVIDIA
+// GPUs the compute capability (if known) takes precedence, since product names are ambiguous.
+std::string Database::GetArchitectureFamily(const std::string &vendor, const std::string &type,
+                                            const std::string &name,
+                                            const size_t nvidia_compute_capability) {
+  const auto device = NormalizeDeviceName(name);
+  const auto contains = [&device](const std::string &text) {
+    return device.find(text) != std::string::npos;
+  };
+  const auto model = GetModelNumber(device);
+
+  // NVIDIA GPUs: by compute capability or else by product line and model number
+  if (vendor == "NVIDIA" && type == database::kDeviceTypeGPU) {
+    switch (nvidia_compute_capability / 10) {
+      case 2: return "Fermi";
+      case 3: return "Kepler";
+      case 5: return "Maxwell";
+      case 6: return "Pascal";
+      case 7: return (nvidia_compute_capability % 10 >= 5) ? "Turing" : "Volta";
+      case 8: return "Ampere";
+      default: break;
+    }
+    if (contains("titan rtx")) { return "Turing"; }
+    if (contains("titan v")) { return "Volta"; }
+    if (contains("titan xp") || contains("pascal")) { return "Pascal"; }
+    if (contains("titan x")) { return "Maxwell"; }
+    if (contains("titan")) { return "Kepler"; } // e.g. the original TITAN, TITAN Black and TITAN Z
+    for (const auto &line: {"tesla ", "quadro ", "grid "}) {
+      const auto position = device.find(line);
+      if (position == std::string::npos) { continue; }
+      const auto product = device.substr(position + std::strlen(line));
+      const auto letter = product[0];
+      if (product.compare(0, 5, "rtx a") == 0) { return "Ampere"; }
+      if (product.compare(0, 4, "rtx ") == 0) { return "Turing"; }
+      if (product.compare(0, 2, "gv") == 0) { return "Volta"; }
+      if (product.compare(0, 2, "gp") == 0) { return "Pascal"; }
+      if (letter == 'k') { return "Kepler"; }
+      if (letter == 'm') { // Maxwell, except for the Fermi Tesla M20x0 products
+        return (std::string{line} == "tesla " && model / 100 == 20) ? "Fermi" : "Maxwell";
+      }
+      if (letter == 'p') { return "Pascal"; }
+      if (letter == 'v') { return "Volta"; }
+      if (letter == 't') { return "Turing"; }
+      if (letter == 'a') { return "Ampere"; }
+      if (letter == 'c' || std::isdigit(static_cast<unsigned char>(letter))) { return "Fermi"; }
+    }
+    if (contains("rtx")) {
+      if (contains("rtx a")) { return "Ampere"; }
+      if (model >= 2000 && model < 3000) { return "Turing"; }
+      if (model >= 3000 && model < 4000) { return "Ampere"; }
+    }
+    if (contains("gtx") || contains("gts") || contains("gt ")) {
+      if (model >= 1600 && model < 1700) { return "Turing"; }
+      if (model >= 1000 && model < 1100) { return "Pascal"; }
+      if (model == 745 || model == 750 || (model >= 900 && model < 1000)) { return "Maxwell"; }
+      if (model >= 600 && model < 800) { return "Kepler"; }
+      if (model >= 400 && model < 600) { return "Fermi"; }
+    }
+    return "";
+  }
+
+  // AMD GPUs: by codename (as reported by AMD's OpenCL) or by product series
+  if (vendor == "AMD" && type == database::kDeviceTypeGPU) {
+    const auto families = std::vector<std::pair<std::string, std::vector<std::string>>>{
+      {"TeraScale", {"cypress", "juniper", "redwood", "cedar", "barts", "turks", "caicos",
+                     "cayman", "devastator", "scrapper", "beavercreek", "winterpark"}},
+      {"GFX6", {"tahiti", "pitcairn", "cape verde", "capeverde", "oland", "hainan"}},
+      {"GFX7", {"hawaii", "grenada", "bonaire", "kaveri", "spectre", "spooky", "kalindi",
+                "mullins"}},
+      {"GFX8", {"tonga", "fiji", "iceland", "carrizo", "stoney", "ellesmere", "baffin", "lexa",
+                "polaris"}},
+      {"GFX9", {"vega", "raven"}},
+    };
+    for (const auto &family: families) {
+      for (const auto &codename: family.second) {
+        if (contains(codename)) { return family.first; }
+      }
+    }
+    if (contains("gfx")) { return "GFX" + device.substr(device.find("gfx") + 3, 1); }
+    if (contains("radeon hd")) {
+      if (model >= 5000 && model < 7000) { return "TeraScale"; }
+      if (model >= 7000 && model < 8000) { return (model == 7790) ? "GFX7" : "GFX6"; }
+    }
+    return "";
+  }
+
+  // Intel GPUs: by codename or by the product number of the graphics
+  if (vendor == "Intel" && type == database::kDeviceTypeGPU) {
+    if (contains("skylake") || contains("kabylake") || contains("kaby lake")) { return "Gen9"; }
+    if (contains("broadwell")) { return "Gen8"; }
+    if (contains("haswell")) { return "Gen7.5"; }
+    if (contains("ivybridge") || contains("ivy bridge")) { return "Gen7"; }
+    if (contains("graphics")) {
+      if (model >= 500 && model < 700) { return "Gen9"; }
+      if ((model >= 5300 && model < 5400) || (model >= 5500 && model < 5700) ||
+          (model >= 6000 && model < 6400)) { return "Gen8"; }
+      if ((model >= 4200 && model < 4700) || (model >= 5000 && model < 5300)) { return "Gen7.5"; }
+      if (model == 2500 || model == 4000) { return "Gen7"; }
+    }
+    if (contains("iris pro") && model == 0) { return "Gen7.5"; }
+    return "";
+  }
+
+  // Intel CPUs: by generation of the Core processors or by version of the Xeon processors
+  if (vendor == "Intel" && type == database::kDeviceTypeCPU) {
+    const auto core = device.find("core i");
+    if (core != std::string::npos && model >= 1000 && model < 10000) {
+      return "Core gen" + std::to_string(model / 1000);
+    }
+    const auto xeon_version = device.find(" v", device.find("xeon"));
+    if (contains("xeon") && xeon_version != std::string::npos &&
+        std::isdigit(static_cast<unsigned char>(device[xeon_version + 2]))) {
+      return "Xeon v" + device.substr(xeon_version + 2, 1);
+    }
+    return "";
+  }
+
+  // ARM GPUs: by Mali architecture
+  if (vendor == "ARM" && type == database::kDeviceTypeGPU) {
+    if (contains("mali-t")) { return "Midgard"; }
+    if (contains("mali-g")) { return "Bifrost"; }
+    return "";
+  }
+  return "";
+}
+
+// As above, but for the current device: if the name is inconclusive (e.g. for a new product) the
+// family is derived from device properties such as the compute capability or the OpenCL version
+std::string Database::GetArchitectureFamily(const Device &device, const std::string &vendor) {
+  const auto type = device.Type();
+
+  // NVIDIA GPUs report their compute capability through an extension
+  const auto compute_capability = (vendor == "NVIDIA" && type == database::kDeviceTypeGPU) ?
+                                  device.NVIDIAComputeCapability() : size_t{0};
+  const auto family = GetArchitectureFamily(vendor, type, device.Name(), compute_capability);
+  if (!family.empty()) { return family; }
+
+  // Intel GPUs: OpenCL 2.1 is supported from Gen9 onwards and OpenCL 2.0 from Gen8 onwards, before
+  // that Gen7.5 has a larger amount of compute units than Gen7 for the same product tier
+  if (vendor == "Intel" && type == database::kDeviceTypeGPU) {
+    const auto version = device.VersionNumber();
+    if (version >= 210) { return "Gen9"; }
+    if (version >= 200) { return "Gen8"; }
+    if (version >= 120 && device.LocalMemSize() >= 64 * 1024) {
+      return (device.ComputeUnits() > 16) ? "Gen7.5" : "Gen7";
+    }
+  }
+  return "";
+}
+
 // =================================================================================================
 } // namespace clblast
@@ -12,6 +12,10 @@
 // found entry by parameter-key. The database itself is filled in the corresponding source-file and
 // partially also by the database/xxxxx.h files, in which kernel-specific parameters are found.
 //
+// The built-in database consists of constant plain-old-data tables, such that loading the library
+// does not allocate any memory. Each entry comes with a hash index of its device names, computed
+// by the database generator (scripts/database) with the same hash function as DatabaseHash below.
+//
 // =================================================================================================
 
 #ifndef CLBLAST_DATABASE_H_
@@ -20,6 +24,7 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <cstdint>
 
 #include "utilities/utilities.hpp"
 
@@ -30,10 +35,24 @@ namespace clblast {
 namespace database {
 
   // The OpenCL device types
-  const std::string kDeviceTypeCPU = "CPU";
-  const std::string kDeviceTypeGPU = "GPU";
-  const std::string kDeviceTypeAccelerator = "accelerator";
-  const std::string kDeviceTypeAll = "default";
+  constexpr const char* kDeviceTypeCPU = "CPU";
+  constexpr const char* kDeviceTypeGPU = "GPU";
+  constexpr const char* kDeviceTypeAccelerator = "accelerator";
+  constexpr const char* kDeviceTypeAll = "default";
+
+  // The maximum number of parameters of a single entry of the built-in database
+  constexpr size_t kMaxParameters = 16;
+
+  // The 32-bit FNV-1a hash of a string, as used for the device index of the built-in database. This
+  // has to match the 'database_hash' function of the database generator.
+  inline uint32_t DatabaseHash(const char* text) {
+    auto hash = uint32_t{2166136261u};
+    for (; *text != '\0'; ++text) {
+      hash ^= static_cast<uint32_t>(static_cast<unsigned char>(*text));
+      hash *= uint32_t{16777619u};
+    }
+    return hash;
+  }
 
 } // namespace database
 
@@ -63,17 +82,47 @@ class Database {
     std::vector<DatabaseVendor> vendors;
   };
 
+  // Structures for the built-in database. The devices of all vendors are stored consecutively, each
+  // with one value per parameter name of the entry. The device index is an open-addressing hash
+  // table (linear probing) of 'index_size' slots (a power of two), each holding the position of a
+  // device plus one, or zero if the slot is empty.
+  struct StaticDevice {
+    const char* name;
+    size_t values[database::kMaxParameters];
+  };
+  struct StaticVendor {
+    const char* type;
+    const char* name;
+    size_t first_device;
+    size_t num_devices;
+  };
+  struct StaticEntry {
+    const char* kernel;
+    Precision precision;
+    const char* const* parameter_names;
+    size_t num_parameters;
+    const StaticDevice* devices;
+    const StaticVendor* vendors;
+    size_t num_vendors;
+    const uint16_t* index;
+    size_t index_size;
+  };
+
   // The OpenCL device vendors
   static const std::string kDeviceVendorAll;
 
   // Alternative names for some OpenCL vendors
-  static const std::unordered_map<std::string, std::string> kVendorNames;
+  struct VendorName { const char* name; const char* short_name; };
+  static const VendorName kVendorNames[];
+  static const size_t kNumVendorNames;
 
-  // The database consists of separate database entries, stored together in a vector
-  static const std::vector<DatabaseEntry> database;
+  // The database consists of separate (built-in) database entries, stored together in an array
+  static const StaticEntry* const database[];
+  static const size_t database_size;
 
   // Database for a special case: Apple CPUs support limited number of threads
-  static const std::vector<DatabaseEntry> apple_cpu_fallback;
+  static const StaticEntry* const apple_cpu_fallback[];
+  static const size_t apple_cpu_fallback_size;
 
   Database() = default;
 
@@ -91,15 +140,48 @@ class Database {
   // Retrieves the names of all the parameters
   std::vector<std::string> GetParameterNames() const;
 
+  // Describes the database entry the parameters were taken from (e.g. for debugging purposes)
+  std::string GetEntryDescription() const { return entry_description_; }
+
+  // Derives the architecture family of a device (e.g. "Kepler" or "GFX8"), from the compute
+  // capability of NVIDIA GPUs (if known, i.e. non-zero), else from the name and if that is
+  // inconclusive from the device's properties. Returns an empty string if unknown.
+  static std::string GetArchitectureFamily(const Device &device, const std::string &vendor);
+  static std::string GetArchitectureFamily(const std::string &vendor, const std::string &type,
+                                           const std::string &name,
+                                           const size_t nvidia_compute_capability = 0);
+
  private:
-  // Search method for a specified database, returning pointer (possibly a nullptr)
-  ParametersPtr Search(const std::string &this_kernel, const std::string &this_type,
-                       const std::string &this_vendor, const std::string &this_device,
-                       const Precision this_precision,
-                       const std::vector<DatabaseEntry> &db) const;
+  // Search methods for a user-provided or a built-in database, returning whether parameters were
+  // found. If so, these are stored in 'parameters_'.
+  bool Search(const std::string &this_kernel, const std::string &this_type,
+              const std::string &this_vendor, const std::string &this_device,
+              const std::string &this_family, const Precision this_precision,
+              const std::vector<DatabaseEntry> &db, std::string &entry_description);
+  bool Search(const std::string &this_kernel, const std::string &this_type,
+              const std::string &this_vendor, const std::string &this_device,
+              const std::string &this_family, const Precision this_precision,
+              const StaticEntry* const* db, const size_t db_size,
+              std::string &entry_description);
+
+  // Selects the device of a vendor matching the current device: an exact match (if found by the
+  // caller), else a device with the same normalized name or the closest device of the same
+  // architecture family, or else the vendor's default. Returns a nullptr if none of these exists.
+  template <typename DeviceType>
+  static const DeviceType* SelectDevice(const DeviceType* exact_match, const DeviceType* devices,
+                                        const size_t num_devices, const std::string &vendor_name,
+                                        const std::string &vendor_type,
+                                        const std::string &this_device,
+                                        const std::string &this_family,
+                                        std::string &entry_description);
+
+  // Helpers to match device names: removes decorations such as "(TM)" and extracts model numbers
+  static std::string NormalizeDeviceName(const std::string &name);
+  static size_t GetModelNumber(const std::string &name);
 
   // Found parameters suitable for this device/kernel
   std::shared_ptr<Parameters> parameters_;
+  std::string entry_description_;
 };
 
 // =================================================================================================
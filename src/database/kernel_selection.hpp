@@ -18,112 +18,62 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry KernelSelectionHalf = {
-  "KernelSelection", Precision::kHalf, {
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512} } },
-      }
-    },
-  }
+constexpr const char* KernelSelectionParameters[] = {
+  "XGEMM_MIN_INDIRECT_SIZE"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry KernelSelectionSingle = {
-  "KernelSelection", Precision::kSingle, {
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512} } },
-      }
-    },
-  }
+// The values for all precisions except bfloat16 (see below)
+constexpr Database::StaticDevice KernelSelectionDevices[] = {
+  // Intel GPUs
+  { "default",                                         { 1*1*1 } },
+  // NVIDIA GPUs
+  { "default",                                         { 1280*1280*1280 } },
+  // Default
+  { "default",                                         { 512*512*512 } },
 };
-
-// =================================================================================================
-
-const Database::DatabaseEntry KernelSelectionComplexSingle = {
-  "KernelSelection", Precision::kComplexSingle, {
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512} } },
-      }
-    },
-  }
+constexpr Database::StaticVendor KernelSelectionVendors[] = {
+  { kDeviceTypeGPU, "Intel", 0, 1 },
+  { kDeviceTypeGPU, "NVIDIA", 1, 1 },
+  { kDeviceTypeAll, "default", 2, 1 },
 };
 
-// =================================================================================================
-
-const Database::DatabaseEntry KernelSelectionDouble = {
-  "KernelSelection", Precision::kDouble, {
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512} } },
-      }
-    },
-  }
+// These entries only hold default values, so they don't come with a device index
+constexpr Database::StaticEntry KernelSelectionHalf = {
+  "KernelSelection", Precision::kHalf, KernelSelectionParameters, 1,
+  KernelSelectionDevices, KernelSelectionVendors, 3, nullptr, 0
+};
+constexpr Database::StaticEntry KernelSelectionSingle = {
+  "KernelSelection", Precision::kSingle, KernelSelectionParameters, 1,
+  KernelSelectionDevices, KernelSelectionVendors, 3, nullptr, 0
+};
+constexpr Database::StaticEntry KernelSelectionComplexSingle = {
+  "KernelSelection", Precision::kComplexSingle, KernelSelectionParameters, 1,
+  KernelSelectionDevices, KernelSelectionVendors, 3, nullptr, 0
+};
+constexpr Database::StaticEntry KernelSelectionDouble = {
+  "KernelSelection", Precision::kDouble, KernelSelectionParameters, 1,
+  KernelSelectionDevices, KernelSelectionVendors, 3, nullptr, 0
+};
+constexpr Database::StaticEntry KernelSelectionComplexDouble = {
+  "KernelSelection", Precision::kComplexDouble, KernelSelectionParameters, 1,
+  KernelSelectionDevices, KernelSelectionVendors, 3, nullptr, 0
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry KernelSelectionComplexDouble = {
-  "KernelSelection", Precision::kComplexDouble, {
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1*1*1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",1280*1280*1280} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"XGEMM_MIN_INDIRECT_SIZE",512*512*512} } },
-      }
-    },
-  }
+// Default: the direct GEMM kernel does not support bfloat16, so always use the in-direct one
+constexpr Database::StaticDevice KernelSelectionBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 1*1*1 } },
+};
+constexpr Database::StaticVendor KernelSelectionBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr Database::StaticEntry KernelSelectionBFloat16 = {
+  "KernelSelection", Precision::kBFloat16, KernelSelectionParameters, 1,
+  KernelSelectionBFloat16Devices, KernelSelectionBFloat16Vendors, 1, nullptr, 0
 };
 
 // =================================================================================================
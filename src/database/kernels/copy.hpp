@@ -15,315 +15,329 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry CopyHalf = {
-  "Copy", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",8} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",8} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-      }
-    },
-  }
+constexpr const char* CopyParameters[] = {
+  "COPY_DIMX", "COPY_DIMY", "COPY_VW", "COPY_WPT"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry CopySingle = {
-  "Copy", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "ATI Radeon HD 6750M",                             { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Ellesmere",                                       { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",8} } },
-        { "Fiji",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Oland",                                           { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",2} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Tahiti",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Tonga",                                           { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-        { "Turks",                                           { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",2} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",2} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",8} } },
-        { "Iris",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Iris Pro",                                        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-        { "GeForce GTX TITAN Black",                         { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",8} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "TITAN X (Pascal)",                                { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",4} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice CopyHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 16, 8, 4, 4 } },
+  { "default",                                         { 16, 8, 4, 4 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 8, 16, 8, 4 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 8, 32, 4, 8 } },
+  { "default",                                         { 8, 32, 4, 8 } },
+  // Default
+  { "default",                                         { 16, 8, 4, 4 } },
+};
+constexpr Database::StaticVendor CopyHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 3 },
+  { kDeviceTypeAll, "default", 5, 1 },
+};
+constexpr uint16_t CopyHalfIndex[] = {
+  3, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry CopyHalf = {
+  "Copy", Precision::kHalf, CopyParameters, 4,
+  CopyHalfDevices, CopyHalfVendors, 3, CopyHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice CopyBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 32, 8, 4, 4 } },
+};
+constexpr Database::StaticVendor CopyBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t CopyBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry CopyBFloat16 = {
+  "Copy", Precision::kBFloat16, CopyParameters, 4,
+  CopyBFloat16Devices, CopyBFloat16Vendors, 1, CopyBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice CopySingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 32, 8, 4, 1 } },
+  { "ATI Radeon HD 6750M",                             { 16, 8, 2, 1 } },
+  { "Ellesmere",                                       { 8, 8, 4, 8 } },
+  { "Fiji",                                            { 16, 16, 1, 2 } },
+  { "Hawaii",                                          { 32, 8, 2, 2 } },
+  { "Oland",                                           { 32, 8, 4, 2 } },
+  { "Pitcairn",                                        { 8, 16, 4, 1 } },
+  { "Tahiti",                                          { 32, 8, 2, 2 } },
+  { "Tonga",                                           { 32, 8, 4, 4 } },
+  { "Turks",                                           { 8, 8, 4, 2 } },
+  { "default",                                         { 8, 16, 4, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 32, 8, 2, 4 } },
+  { "default",                                         { 32, 8, 2, 4 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 32, 16, 8, 1 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 32, 16, 8, 2 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 32, 16, 8, 1 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 32, 16, 8, 2 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 32, 8, 8, 1 } },
+  { "default",                                         { 32, 16, 8, 2 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 8, 8, 2, 1 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 32, 16, 4, 1 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 32, 16, 4, 1 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 16, 8, 2, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 16, 8, 4, 8 } },
+  { "Iris",                                            { 16, 8, 1, 2 } },
+  { "Iris Pro",                                        { 32, 8, 4, 4 } },
+  { "default",                                         { 8, 8, 2, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 32, 8, 8, 1 } },
+  { "default",                                         { 32, 8, 8, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 16, 8, 4, 1 } },
+  { "GeForce GTX 1070",                                { 8, 16, 4, 1 } },
+  { "GeForce GTX 1080",                                { 8, 32, 4, 1 } },
+  { "GeForce GTX 480",                                 { 8, 8, 4, 1 } },
+  { "GeForce GTX 670",                                 { 16, 32, 4, 1 } },
+  { "GeForce GTX 680",                                 { 32, 16, 4, 1 } },
+  { "GeForce GTX 750",                                 { 32, 8, 2, 2 } },
+  { "GeForce GTX 750 Ti",                              { 16, 32, 2, 2 } },
+  { "GeForce GTX 980",                                 { 32, 16, 1, 1 } },
+  { "GeForce GTX TITAN",                               { 32, 8, 2, 4 } },
+  { "GeForce GTX TITAN Black",                         { 8, 32, 4, 8 } },
+  { "GeForce GTX TITAN X",                             { 32, 8, 1, 2 } },
+  { "TITAN X (Pascal)",                                { 8, 32, 4, 1 } },
+  { "Tesla K20m",                                      { 8, 8, 4, 4 } },
+  { "Tesla K40m",                                      { 8, 8, 4, 2 } },
+  { "default",                                         { 8, 32, 4, 1 } },
+  // Default
+  { "default",                                         { 32, 8, 4, 4 } },
+};
+constexpr Database::StaticVendor CopySingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 6 },
+  { kDeviceTypeGPU, "Intel", 19, 8 },
+  { kDeviceTypeAccelerator, "Intel", 27, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 29, 16 },
+  { kDeviceTypeAll, "default", 45, 1 },
+};
+constexpr uint16_t CopySingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 24, 40, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 35, 17, 0, 0, 0, 44, 33, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 42, 0, 8, 0, 0, 1, 30, 39,
+  0, 0, 32, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 38, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 36, 0, 0, 0, 0, 11, 3,
+  6, 13, 16, 19, 27, 22, 29, 31, 34, 7, 23, 26, 45, 46, 9, 0, 5, 18, 0, 2, 12, 15, 43, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+};
+constexpr Database::StaticEntry CopySingle = {
+  "Copy", Precision::kSingle, CopyParameters, 4,
+  CopySingleDevices, CopySingleVendors, 7, CopySingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry CopyComplexSingle = {
-  "Copy", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "ATI Radeon HD 6750M",                             { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Ellesmere",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "Fiji",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Oland",                                           { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Tahiti",                                          { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Tonga",                                           { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Turks",                                           { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",4}, {"COPY_WPT",2} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",32}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Iris",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Iris Pro",                                        { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice CopyComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 32, 8, 1, 1 } },
+  { "ATI Radeon HD 6750M",                             { 8, 8, 1, 1 } },
+  { "Ellesmere",                                       { 16, 16, 1, 4 } },
+  { "Fiji",                                            { 16, 8, 1, 2 } },
+  { "Hawaii",                                          { 32, 8, 1, 2 } },
+  { "Oland",                                           { 8, 16, 1, 1 } },
+  { "Pitcairn",                                        { 8, 8, 1, 2 } },
+  { "Tahiti",                                          { 8, 8, 2, 2 } },
+  { "Tonga",                                           { 8, 32, 1, 2 } },
+  { "Turks",                                           { 32, 8, 4, 1 } },
+  { "default",                                         { 16, 8, 1, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 32, 16, 4, 2 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 16, 16, 8, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 32, 8, 2, 2 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 32, 32, 4, 1 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 16, 8, 8, 1 } },
+  { "default",                                         { 32, 8, 8, 1 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 16, 8, 2, 1 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 16, 16, 2, 2 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 8, 8, 1, 1 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 8, 32, 2, 4 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 8, 8, 2, 1 } },
+  { "Iris",                                            { 16, 8, 1, 2 } },
+  { "Iris Pro",                                        { 32, 16, 1, 4 } },
+  { "default",                                         { 16, 8, 1, 2 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 32, 8, 4, 1 } },
+  { "default",                                         { 32, 8, 4, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 16, 8, 1, 1 } },
+  { "GeForce GTX 1070",                                { 16, 8, 1, 1 } },
+  { "GeForce GTX 1080",                                { 32, 8, 1, 2 } },
+  { "GeForce GTX 480",                                 { 16, 16, 1, 1 } },
+  { "GeForce GTX 670",                                 { 16, 8, 1, 1 } },
+  { "GeForce GTX 750",                                 { 16, 8, 1, 2 } },
+  { "GeForce GTX 750 Ti",                              { 16, 32, 1, 1 } },
+  { "GeForce GTX 980",                                 { 8, 8, 1, 1 } },
+  { "GeForce GTX TITAN Black",                         { 16, 8, 1, 1 } },
+  { "GeForce GTX TITAN X",                             { 16, 8, 1, 1 } },
+  { "TITAN X (Pascal)",                                { 8, 16, 2, 1 } },
+  { "Tesla K20m",                                      { 8, 8, 1, 4 } },
+  { "Tesla K40m",                                      { 16, 8, 1, 1 } },
+  { "default",                                         { 32, 8, 1, 1 } },
+  // Default
+  { "default",                                         { 16, 8, 1, 2 } },
+};
+constexpr Database::StaticVendor CopyComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeGPU, "Intel", 17, 8 },
+  { kDeviceTypeAccelerator, "Intel", 25, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 27, 14 },
+  { kDeviceTypeAll, "default", 41, 1 },
+};
+constexpr uint16_t CopyComplexSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 22, 36, 18, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 40, 31, 0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 38, 0, 8, 0, 0, 1, 28, 0,
+  0, 0, 30, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 35, 0, 12, 0, 0, 0, 0, 0, 10, 0, 0, 33, 0, 0, 0, 0, 11, 3,
+  6, 14, 17, 25, 27, 20, 29, 32, 41, 7, 21, 24, 42, 0, 9, 0, 5, 16, 0, 2, 13, 0, 39, 0, 0, 0, 0, 0, 34, 0, 0, 0,
+};
+constexpr Database::StaticEntry CopyComplexSingle = {
+  "Copy", Precision::kComplexSingle, CopyParameters, 4,
+  CopyComplexSingleDevices, CopyComplexSingleVendors, 6, CopyComplexSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry CopyDouble = {
-  "Copy", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Ellesmere",                                       { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "Fiji",                                            { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Oland",                                           { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",8} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tahiti",                                          { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Tonga",                                           { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",4} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",2} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",4}, {"COPY_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"COPY_DIMX",16}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",8} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",32}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice CopyDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 32, 8, 1, 1 } },
+  { "Ellesmere",                                       { 32, 8, 1, 4 } },
+  { "Fiji",                                            { 16, 8, 1, 2 } },
+  { "Hawaii",                                          { 32, 8, 1, 2 } },
+  { "Oland",                                           { 32, 8, 2, 8 } },
+  { "Pitcairn",                                        { 32, 8, 1, 1 } },
+  { "Tahiti",                                          { 8, 32, 2, 1 } },
+  { "Tonga",                                           { 8, 32, 2, 4 } },
+  { "default",                                         { 16, 8, 2, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 16, 8, 8, 2 } },
+  { "default",                                         { 16, 8, 8, 2 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 16, 32, 8, 1 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 16, 8, 8, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 16, 32, 2, 1 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 16, 32, 8, 1 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 16, 16, 8, 1 } },
+  { "default",                                         { 16, 8, 8, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 8, 8, 8, 1 } },
+  { "default",                                         { 8, 8, 8, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 32, 16, 2, 1 } },
+  { "GeForce GTX 1070",                                { 8, 8, 4, 1 } },
+  { "GeForce GTX 1080",                                { 8, 8, 4, 1 } },
+  { "GeForce GTX 480",                                 { 8, 8, 2, 1 } },
+  { "GeForce GTX 670",                                 { 8, 8, 2, 1 } },
+  { "GeForce GTX 680",                                 { 16, 32, 2, 1 } },
+  { "GeForce GTX 750",                                 { 8, 16, 2, 1 } },
+  { "GeForce GTX 750 Ti",                              { 16, 8, 2, 1 } },
+  { "GeForce GTX 980",                                 { 32, 8, 2, 1 } },
+  { "GeForce GTX TITAN",                               { 16, 32, 2, 2 } },
+  { "GeForce GTX TITAN Black",                         { 16, 8, 2, 8 } },
+  { "GeForce GTX TITAN X",                             { 32, 16, 1, 1 } },
+  { "TITAN X (Pascal)",                                { 8, 8, 2, 2 } },
+  { "Tesla K20m",                                      { 8, 8, 2, 1 } },
+  { "Tesla K40m",                                      { 8, 8, 2, 2 } },
+  { "default",                                         { 32, 32, 2, 1 } },
+  // Default
+  { "default",                                         { 16, 8, 2, 1 } },
+};
+constexpr Database::StaticVendor CopyDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeAccelerator, "Intel", 17, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 19, 16 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t CopyDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 30, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 25, 15, 0, 0, 0, 34, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 7, 0, 0, 1, 20, 29,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 9, 2,
+  5, 11, 14, 17, 19, 21, 24, 35, 36, 6, 0, 0, 0, 0, 8, 0, 4, 16, 0, 10, 13, 0, 33, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+};
+constexpr Database::StaticEntry CopyDouble = {
+  "Copy", Precision::kDouble, CopyParameters, 4,
+  CopyDoubleDevices, CopyDoubleVendors, 6, CopyDoubleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry CopyComplexDouble = {
-  "Copy", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Ellesmere",                                       { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Fiji",                                            { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Hawaii",                                          { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",8} } },
-        { "Oland",                                           { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Pitcairn",                                        { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tahiti",                                          { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "Tonga",                                           { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",2}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"COPY_DIMX",32}, {"COPY_DIMY",32}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"COPY_DIMX",32}, {"COPY_DIMY",16}, {"COPY_VW",8}, {"COPY_WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",8}, {"COPY_WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"COPY_DIMX",8}, {"COPY_DIMY",32}, {"COPY_VW",1}, {"COPY_WPT",4} } },
-        { "GeForce GTX 1080",                                { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"COPY_DIMX",32}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"COPY_DIMX",16}, {"COPY_DIMY",16}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Tesla K20m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",2} } },
-        { "Tesla K40m",                                      { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-        { "default",                                         { {"COPY_DIMX",8}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"COPY_DIMX",16}, {"COPY_DIMY",8}, {"COPY_VW",1}, {"COPY_WPT",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice CopyComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 8, 16, 1, 1 } },
+  { "Ellesmere",                                       { 8, 32, 1, 2 } },
+  { "Fiji",                                            { 8, 16, 1, 1 } },
+  { "Hawaii",                                          { 32, 8, 2, 8 } },
+  { "Oland",                                           { 8, 16, 1, 1 } },
+  { "Pitcairn",                                        { 16, 8, 1, 1 } },
+  { "Tahiti",                                          { 8, 16, 1, 1 } },
+  { "Tonga",                                           { 16, 8, 2, 1 } },
+  { "default",                                         { 8, 16, 1, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 32, 8, 1, 2 } },
+  { "default",                                         { 32, 8, 1, 2 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 8, 8, 8, 1 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 32, 8, 8, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 32, 32, 8, 1 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 32, 16, 8, 4 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 8, 8, 8, 1 } },
+  { "default",                                         { 16, 8, 8, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 32, 8, 8, 1 } },
+  { "default",                                         { 32, 8, 8, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 8, 8, 1, 1 } },
+  { "GeForce GTX 1070",                                { 8, 32, 1, 4 } },
+  { "GeForce GTX 1080",                                { 8, 8, 1, 1 } },
+  { "GeForce GTX 480",                                 { 16, 8, 1, 1 } },
+  { "GeForce GTX 670",                                 { 16, 8, 1, 1 } },
+  { "GeForce GTX 680",                                 { 8, 8, 1, 1 } },
+  { "GeForce GTX 750",                                 { 32, 8, 1, 1 } },
+  { "GeForce GTX 750 Ti",                              { 16, 16, 1, 1 } },
+  { "GeForce GTX 980",                                 { 8, 8, 1, 1 } },
+  { "GeForce GTX TITAN",                               { 16, 16, 1, 1 } },
+  { "GeForce GTX TITAN Black",                         { 8, 8, 1, 2 } },
+  { "GeForce GTX TITAN X",                             { 16, 8, 1, 1 } },
+  { "TITAN X (Pascal)",                                { 8, 8, 1, 2 } },
+  { "Tesla K20m",                                      { 8, 8, 1, 2 } },
+  { "Tesla K40m",                                      { 8, 8, 1, 1 } },
+  { "default",                                         { 8, 8, 1, 1 } },
+  // Default
+  { "default",                                         { 16, 8, 1, 1 } },
+};
+constexpr Database::StaticVendor CopyComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeAccelerator, "Intel", 17, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 19, 16 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t CopyComplexDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 30, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 25, 15, 0, 0, 0, 34, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 7, 0, 0, 1, 20, 29,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 9, 2,
+  5, 11, 14, 17, 19, 21, 24, 35, 36, 6, 0, 0, 0, 0, 8, 0, 4, 16, 0, 10, 13, 0, 33, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+};
+constexpr Database::StaticEntry CopyComplexDouble = {
+  "Copy", Precision::kComplexDouble, CopyParameters, 4,
+  CopyComplexDoubleDevices, CopyComplexDoubleVendors, 6, CopyComplexDoubleIndex, 128
 };
 
 // =================================================================================================
@@ -5,9 +5,9 @@
 // width of 100 characters per line.
 //
 // Author(s):
-//   Cedric Nugteren <www.cedricnugteren.nl>
+//   Database generator <database.py>
 //
-// Tuning parameters for the diagonal matrix inversion kernels
+// This file populates the database with best-found tuning parameters for the 'Invert' kernels.
 //
 // =================================================================================================
 
@@ -15,62 +15,110 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry InvertHalf = {
-  "Invert", Precision::kHalf, {
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
-      }
-    },
-  }
+constexpr const char* InvertParameters[] = {
+  "INTERNAL_BLOCK_SIZE", "TRTRI_BLOCK_SIZE"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry InvertSingle = {
-  "Invert", Precision::kSingle, {
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice InvertHalfDevices[] = {
+  // Default
+  { "default",                                         { 16, 64 } },
+};
+constexpr Database::StaticVendor InvertHalfVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t InvertHalfIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry InvertHalf = {
+  "Invert", Precision::kHalf, InvertParameters, 2,
+  InvertHalfDevices, InvertHalfVendors, 1, InvertHalfIndex, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice InvertBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 16, 64 } },
+};
+constexpr Database::StaticVendor InvertBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t InvertBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry InvertBFloat16 = {
+  "Invert", Precision::kBFloat16, InvertParameters, 2,
+  InvertBFloat16Devices, InvertBFloat16Vendors, 1, InvertBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice InvertSingleDevices[] = {
+  // Default
+  { "default",                                         { 16, 64 } },
+};
+constexpr Database::StaticVendor InvertSingleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t InvertSingleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry InvertSingle = {
+  "Invert", Precision::kSingle, InvertParameters, 2,
+  InvertSingleDevices, InvertSingleVendors, 1, InvertSingleIndex, 2
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry InvertComplexSingle = {
-  "Invert", Precision::kComplexSingle, {
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice InvertComplexSingleDevices[] = {
+  // Default
+  { "default",                                         { 16, 64 } },
+};
+constexpr Database::StaticVendor InvertComplexSingleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t InvertComplexSingleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry InvertComplexSingle = {
+  "Invert", Precision::kComplexSingle, InvertParameters, 2,
+  InvertComplexSingleDevices, InvertComplexSingleVendors, 1, InvertComplexSingleIndex, 2
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry InvertDouble = {
-  "Invert", Precision::kDouble, {
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice InvertDoubleDevices[] = {
+  // Default
+  { "default",                                         { 16, 64 } },
+};
+constexpr Database::StaticVendor InvertDoubleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t InvertDoubleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry InvertDouble = {
+  "Invert", Precision::kDouble, InvertParameters, 2,
+  InvertDoubleDevices, InvertDoubleVendors, 1, InvertDoubleIndex, 2
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry InvertComplexDouble = {
-  "Invert", Precision::kComplexDouble, {
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"INTERNAL_BLOCK_SIZE",16} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice InvertComplexDoubleDevices[] = {
+  // Default
+  { "default",                                         { 16, 64 } },
+};
+constexpr Database::StaticVendor InvertComplexDoubleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t InvertComplexDoubleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry InvertComplexDouble = {
+  "Invert", Precision::kComplexDouble, InvertParameters, 2,
+  InvertComplexDoubleDevices, InvertComplexDoubleVendors, 1, InvertComplexDoubleIndex, 2
 };
 
 // =================================================================================================
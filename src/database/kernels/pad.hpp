@@ -15,323 +15,335 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry PadHalf = {
-  "Pad", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"PAD_DIMX",8}, {"PAD_DIMY",32}, {"PAD_WPTX",2}, {"PAD_WPTY",2} } },
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-      }
-    },
-  }
+constexpr const char* PadParameters[] = {
+  "PAD_DIMX", "PAD_DIMY", "PAD_WPTX", "PAD_WPTY"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry PadSingle = {
-  "Pad", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "ATI Radeon HD 6750M",                             { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Ellesmere",                                       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",2} } },
-        { "Fiji",                                            { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Hawaii",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-        { "Oland",                                           { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Pitcairn",                                        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tahiti",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tonga",                                           { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",2} } },
-        { "Turks",                                           { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PAD_DIMX",16}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",4}, {"PAD_WPTY",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",4} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",4} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
-        { "Iris",                                            { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Iris Pro",                                        { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 1070",                                { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 1080",                                { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 480",                                 { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-        { "GeForce GTX 670",                                 { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",2} } },
-        { "GeForce GTX 680",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 750",                                 { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
-        { "GeForce GTX 750 Ti",                              { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 980",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN",                               { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN Black",                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "GeForce GTX TITAN X",                             { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "TITAN X (Pascal)",                                { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tesla K20m",                                      { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Tesla K40m",                                      { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice PadHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 16, 8, 1, 2 } },
+  { "default",                                         { 16, 8, 1, 2 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 8, 8, 4, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 8, 32, 2, 2 } },
+  { "default",                                         { 8, 8, 2, 1 } },
+  // Default
+  { "default",                                         { 8, 8, 2, 1 } },
+};
+constexpr Database::StaticVendor PadHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 3 },
+  { kDeviceTypeAll, "default", 5, 1 },
+};
+constexpr uint16_t PadHalfIndex[] = {
+  3, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry PadHalf = {
+  "Pad", Precision::kHalf, PadParameters, 4,
+  PadHalfDevices, PadHalfVendors, 3, PadHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice PadBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 32, 8, 2, 1 } },
+};
+constexpr Database::StaticVendor PadBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t PadBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry PadBFloat16 = {
+  "Pad", Precision::kBFloat16, PadParameters, 4,
+  PadBFloat16Devices, PadBFloat16Vendors, 1, PadBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice PadSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 32, 8, 1, 1 } },
+  { "ATI Radeon HD 6750M",                             { 8, 16, 2, 1 } },
+  { "Ellesmere",                                       { 32, 8, 2, 2 } },
+  { "Fiji",                                            { 16, 16, 1, 2 } },
+  { "Hawaii",                                          { 32, 8, 1, 4 } },
+  { "Oland",                                           { 8, 8, 1, 2 } },
+  { "Pitcairn",                                        { 32, 8, 1, 2 } },
+  { "Tahiti",                                          { 32, 8, 1, 2 } },
+  { "Tonga",                                           { 16, 16, 2, 2 } },
+  { "Turks",                                           { 32, 8, 2, 1 } },
+  { "default",                                         { 8, 16, 1, 2 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 32, 8, 1, 4 } },
+  { "default",                                         { 32, 8, 1, 4 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 32, 32, 4, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 32, 16, 4, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 16, 32, 4, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 32, 16, 4, 4 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 32, 8, 4, 1 } },
+  { "default",                                         { 32, 8, 4, 2 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 32, 8, 2, 4 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 32, 8, 2, 4 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 16, 8, 1, 2 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 16, 8, 4, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 32, 8, 4, 2 } },
+  { "Iris",                                            { 32, 16, 2, 1 } },
+  { "Iris Pro",                                        { 16, 8, 2, 1 } },
+  { "default",                                         { 32, 8, 4, 2 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 32, 16, 2, 1 } },
+  { "default",                                         { 32, 16, 2, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 32, 8, 2, 1 } },
+  { "GeForce GTX 1070",                                { 16, 8, 1, 1 } },
+  { "GeForce GTX 1080",                                { 16, 8, 1, 1 } },
+  { "GeForce GTX 480",                                 { 32, 8, 1, 4 } },
+  { "GeForce GTX 670",                                 { 32, 8, 2, 2 } },
+  { "GeForce GTX 680",                                 { 16, 8, 4, 1 } },
+  { "GeForce GTX 750",                                 { 32, 16, 4, 2 } },
+  { "GeForce GTX 750 Ti",                              { 16, 8, 4, 1 } },
+  { "GeForce GTX 980",                                 { 16, 8, 1, 1 } },
+  { "GeForce GTX TITAN",                               { 32, 8, 2, 1 } },
+  { "GeForce GTX TITAN Black",                         { 32, 8, 1, 2 } },
+  { "GeForce GTX TITAN X",                             { 16, 16, 1, 1 } },
+  { "TITAN X (Pascal)",                                { 16, 8, 1, 2 } },
+  { "Tesla K20m",                                      { 32, 8, 2, 1 } },
+  { "Tesla K40m",                                      { 32, 8, 1, 1 } },
+  { "default",                                         { 32, 8, 1, 4 } },
+  // Default
+  { "default",                                         { 32, 8, 2, 1 } },
+};
+constexpr Database::StaticVendor PadSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 6 },
+  { kDeviceTypeGPU, "Intel", 19, 8 },
+  { kDeviceTypeAccelerator, "Intel", 27, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 29, 16 },
+  { kDeviceTypeAll, "default", 45, 1 },
+};
+constexpr uint16_t PadSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 24, 40, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 35, 17, 0, 0, 0, 44, 33, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 42, 0, 8, 0, 0, 1, 30, 39,
+  0, 0, 32, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 38, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 36, 0, 0, 0, 0, 11, 3,
+  6, 13, 16, 19, 27, 22, 29, 31, 34, 7, 23, 26, 45, 46, 9, 0, 5, 18, 0, 2, 12, 15, 43, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+};
+constexpr Database::StaticEntry PadSingle = {
+  "Pad", Precision::kSingle, PadParameters, 4,
+  PadSingleDevices, PadSingleVendors, 7, PadSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry PadComplexSingle = {
-  "Pad", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "ATI Radeon HD 6750M",                             { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Ellesmere",                                       { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",4} } },
-        { "Fiji",                                            { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Hawaii",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Oland",                                           { {"PAD_DIMX",8}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Pitcairn",                                        { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tahiti",                                          { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tonga",                                           { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Turks",                                           { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",4} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Iris",                                            { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",4} } },
-        { "Iris Pro",                                        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 1070",                                { {"PAD_DIMX",8}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 1080",                                { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 480",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 670",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "GeForce GTX 680",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "GeForce GTX 750",                                 { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 750 Ti",                              { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 980",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN",                               { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN Black",                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "GeForce GTX TITAN X",                             { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "TITAN X (Pascal)",                                { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tesla K20m",                                      { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tesla K40m",                                      { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice PadComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 32, 8, 1, 1 } },
+  { "ATI Radeon HD 6750M",                             { 16, 8, 2, 1 } },
+  { "Ellesmere",                                       { 16, 16, 2, 4 } },
+  { "Fiji",                                            { 16, 8, 1, 2 } },
+  { "Hawaii",                                          { 32, 8, 1, 2 } },
+  { "Oland",                                           { 8, 32, 1, 1 } },
+  { "Pitcairn",                                        { 8, 8, 1, 2 } },
+  { "Tahiti",                                          { 16, 16, 1, 1 } },
+  { "Tonga",                                           { 16, 8, 1, 2 } },
+  { "Turks",                                           { 16, 8, 4, 4 } },
+  { "default",                                         { 16, 8, 1, 2 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 32, 8, 1, 4 } },
+  { "default",                                         { 32, 8, 1, 4 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 32, 8, 4, 2 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 32, 8, 2, 2 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 32, 32, 4, 1 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 32, 8, 2, 4 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 32, 16, 4, 1 } },
+  { "default",                                         { 32, 8, 4, 2 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 8, 8, 1, 2 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 8, 8, 1, 1 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 8, 8, 1, 1 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 32, 8, 1, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 32, 8, 1, 1 } },
+  { "Iris",                                            { 32, 16, 2, 4 } },
+  { "Iris Pro",                                        { 32, 8, 2, 1 } },
+  { "default",                                         { 32, 8, 1, 4 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 32, 8, 1, 1 } },
+  { "default",                                         { 32, 8, 1, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 16, 16, 1, 1 } },
+  { "GeForce GTX 1070",                                { 8, 32, 1, 1 } },
+  { "GeForce GTX 1080",                                { 32, 8, 1, 1 } },
+  { "GeForce GTX 480",                                 { 16, 8, 2, 1 } },
+  { "GeForce GTX 670",                                 { 16, 8, 1, 2 } },
+  { "GeForce GTX 680",                                 { 16, 32, 1, 2 } },
+  { "GeForce GTX 750",                                 { 32, 8, 2, 1 } },
+  { "GeForce GTX 750 Ti",                              { 16, 8, 1, 1 } },
+  { "GeForce GTX 980",                                 { 16, 16, 1, 1 } },
+  { "GeForce GTX TITAN",                               { 16, 8, 2, 1 } },
+  { "GeForce GTX TITAN Black",                         { 16, 8, 1, 2 } },
+  { "GeForce GTX TITAN X",                             { 16, 8, 1, 1 } },
+  { "TITAN X (Pascal)",                                { 32, 32, 1, 2 } },
+  { "Tesla K20m",                                      { 32, 8, 1, 2 } },
+  { "Tesla K40m",                                      { 16, 8, 1, 1 } },
+  { "default",                                         { 32, 8, 1, 2 } },
+  // Default
+  { "default",                                         { 32, 8, 1, 2 } },
+};
+constexpr Database::StaticVendor PadComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 6 },
+  { kDeviceTypeGPU, "Intel", 19, 8 },
+  { kDeviceTypeAccelerator, "Intel", 27, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 29, 16 },
+  { kDeviceTypeAll, "default", 45, 1 },
+};
+constexpr uint16_t PadComplexSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 24, 40, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 35, 17, 0, 0, 0, 44, 33, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 42, 0, 8, 0, 0, 1, 30, 39,
+  0, 0, 32, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 38, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 36, 0, 0, 0, 0, 11, 3,
+  6, 13, 16, 19, 27, 22, 29, 31, 34, 7, 23, 26, 45, 46, 9, 0, 5, 18, 0, 2, 12, 15, 43, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+};
+constexpr Database::StaticEntry PadComplexSingle = {
+  "Pad", Precision::kComplexSingle, PadParameters, 4,
+  PadComplexSingleDevices, PadComplexSingleVendors, 7, PadComplexSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry PadDouble = {
-  "Pad", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Ellesmere",                                       { {"PAD_DIMX",8}, {"PAD_DIMY",32}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Fiji",                                            { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Hawaii",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Oland",                                           { {"PAD_DIMX",8}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Pitcairn",                                        { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tahiti",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tonga",                                           { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",2} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 1070",                                { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 1080",                                { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 480",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 670",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 680",                                 { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "GeForce GTX 750",                                 { {"PAD_DIMX",32}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 750 Ti",                              { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 980",                                 { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN",                               { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN Black",                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN X",                             { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "TITAN X (Pascal)",                                { {"PAD_DIMX",8}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Tesla K20m",                                      { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tesla K40m",                                      { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice PadDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 32, 8, 1, 1 } },
+  { "Ellesmere",                                       { 8, 32, 2, 1 } },
+  { "Fiji",                                            { 8, 16, 1, 2 } },
+  { "Hawaii",                                          { 32, 8, 1, 2 } },
+  { "Oland",                                           { 8, 32, 1, 1 } },
+  { "Pitcairn",                                        { 8, 8, 1, 2 } },
+  { "Tahiti",                                          { 32, 8, 1, 1 } },
+  { "Tonga",                                           { 32, 8, 4, 1 } },
+  { "default",                                         { 16, 16, 1, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 32, 8, 4, 2 } },
+  { "default",                                         { 32, 8, 4, 2 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 32, 8, 4, 2 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 32, 8, 4, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 32, 32, 4, 1 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 32, 32, 4, 1 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 32, 8, 2, 1 } },
+  { "default",                                         { 32, 16, 4, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 32, 8, 1, 1 } },
+  { "default",                                         { 32, 8, 1, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 32, 8, 1, 1 } },
+  { "GeForce GTX 1070",                                { 8, 8, 1, 1 } },
+  { "GeForce GTX 1080",                                { 32, 32, 2, 1 } },
+  { "GeForce GTX 480",                                 { 16, 8, 1, 1 } },
+  { "GeForce GTX 670",                                 { 16, 16, 2, 1 } },
+  { "GeForce GTX 680",                                 { 32, 32, 1, 2 } },
+  { "GeForce GTX 750",                                 { 32, 16, 1, 1 } },
+  { "GeForce GTX 750 Ti",                              { 8, 16, 1, 1 } },
+  { "GeForce GTX 980",                                 { 8, 16, 1, 1 } },
+  { "GeForce GTX TITAN",                               { 32, 8, 1, 1 } },
+  { "GeForce GTX TITAN Black",                         { 16, 8, 1, 1 } },
+  { "GeForce GTX TITAN X",                             { 16, 8, 1, 1 } },
+  { "TITAN X (Pascal)",                                { 8, 32, 4, 1 } },
+  { "Tesla K20m",                                      { 32, 8, 1, 1 } },
+  { "Tesla K40m",                                      { 16, 8, 1, 2 } },
+  { "default",                                         { 32, 8, 1, 1 } },
+  // Default
+  { "default",                                         { 32, 8, 1, 1 } },
+};
+constexpr Database::StaticVendor PadDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeAccelerator, "Intel", 17, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 19, 16 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t PadDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 30, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 25, 15, 0, 0, 0, 34, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 7, 0, 0, 1, 20, 29,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 9, 2,
+  5, 11, 14, 17, 19, 21, 24, 35, 36, 6, 0, 0, 0, 0, 8, 0, 4, 16, 0, 10, 13, 0, 33, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+};
+constexpr Database::StaticEntry PadDouble = {
+  "Pad", Precision::kDouble, PadParameters, 4,
+  PadDoubleDevices, PadDoubleVendors, 6, PadDoubleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry PadComplexDouble = {
-  "Pad", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Ellesmere",                                       { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Fiji",                                            { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Hawaii",                                          { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Oland",                                           { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Pitcairn",                                        { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tahiti",                                          { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tonga",                                           { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PAD_DIMX",16}, {"PAD_DIMY",32}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",32}, {"PAD_WPTX",2}, {"PAD_WPTY",2} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",4}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 1070",                                { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",2}, {"PAD_WPTY",2} } },
-        { "GeForce GTX 1080",                                { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 480",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 670",                                 { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 680",                                 { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 750",                                 { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 750 Ti",                              { {"PAD_DIMX",16}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX 980",                                 { {"PAD_DIMX",16}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "GeForce GTX TITAN",                               { {"PAD_DIMX",8}, {"PAD_DIMY",32}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "GeForce GTX TITAN Black",                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",4} } },
-        { "GeForce GTX TITAN X",                             { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "TITAN X (Pascal)",                                { {"PAD_DIMX",8}, {"PAD_DIMY",16}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "Tesla K20m",                                      { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",2} } },
-        { "Tesla K40m",                                      { {"PAD_DIMX",8}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-        { "default",                                         { {"PAD_DIMX",16}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"PAD_DIMX",32}, {"PAD_DIMY",8}, {"PAD_WPTX",1}, {"PAD_WPTY",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice PadComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 16, 8, 1, 1 } },
+  { "Ellesmere",                                       { 8, 16, 1, 2 } },
+  { "Fiji",                                            { 32, 8, 2, 1 } },
+  { "Hawaii",                                          { 32, 8, 1, 1 } },
+  { "Oland",                                           { 8, 16, 2, 1 } },
+  { "Pitcairn",                                        { 16, 8, 1, 1 } },
+  { "Tahiti",                                          { 8, 16, 1, 1 } },
+  { "Tonga",                                           { 8, 16, 1, 1 } },
+  { "default",                                         { 8, 16, 1, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 16, 8, 4, 1 } },
+  { "default",                                         { 16, 8, 4, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 16, 16, 4, 1 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 32, 8, 2, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 16, 32, 4, 1 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 32, 32, 2, 2 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 32, 8, 2, 1 } },
+  { "default",                                         { 32, 8, 4, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 32, 8, 4, 1 } },
+  { "default",                                         { 32, 8, 4, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 8, 8, 1, 1 } },
+  { "GeForce GTX 1070",                                { 8, 8, 2, 2 } },
+  { "GeForce GTX 1080",                                { 8, 8, 1, 1 } },
+  { "GeForce GTX 480",                                 { 16, 8, 1, 1 } },
+  { "GeForce GTX 670",                                 { 32, 8, 1, 1 } },
+  { "GeForce GTX 680",                                 { 8, 8, 1, 1 } },
+  { "GeForce GTX 750",                                 { 8, 8, 1, 1 } },
+  { "GeForce GTX 750 Ti",                              { 16, 32, 1, 1 } },
+  { "GeForce GTX 980",                                 { 16, 16, 1, 1 } },
+  { "GeForce GTX TITAN",                               { 8, 32, 1, 2 } },
+  { "GeForce GTX TITAN Black",                         { 16, 8, 1, 4 } },
+  { "GeForce GTX TITAN X",                             { 16, 8, 1, 1 } },
+  { "TITAN X (Pascal)",                                { 8, 16, 1, 1 } },
+  { "Tesla K20m",                                      { 8, 8, 1, 2 } },
+  { "Tesla K40m",                                      { 8, 8, 1, 1 } },
+  { "default",                                         { 16, 8, 1, 1 } },
+  // Default
+  { "default",                                         { 32, 8, 1, 1 } },
+};
+constexpr Database::StaticVendor PadComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeAccelerator, "Intel", 17, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 19, 16 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t PadComplexDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 30, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 25, 15, 0, 0, 0, 34, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 7, 0, 0, 1, 20, 29,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 9, 2,
+  5, 11, 14, 17, 19, 21, 24, 35, 36, 6, 0, 0, 0, 0, 8, 0, 4, 16, 0, 10, 13, 0, 33, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+};
+constexpr Database::StaticEntry PadComplexDouble = {
+  "Pad", Precision::kComplexDouble, PadParameters, 4,
+  PadComplexDoubleDevices, PadComplexDoubleVendors, 6, PadComplexDoubleIndex, 128
 };
 
 // =================================================================================================
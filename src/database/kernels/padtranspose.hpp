@@ -15,323 +15,335 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry PadtransposeHalf = {
-  "Padtranspose", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-      }
-    },
-  }
+constexpr const char* PadtransposeParameters[] = {
+  "PADTRA_PAD", "PADTRA_TILE", "PADTRA_WPT"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry PadtransposeSingle = {
-  "Padtranspose", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "ATI Radeon HD 6750M",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Ellesmere",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Fiji",                                            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Oland",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Tonga",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Turks",                                           { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Iris",                                            { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Iris Pro",                                        { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 1070",                                { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 670",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 750",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice PadtransposeHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 0, 16, 4 } },
+  { "default",                                         { 0, 16, 4 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 0, 8, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 1, 8, 2 } },
+  { "default",                                         { 0, 8, 1 } },
+  // Default
+  { "default",                                         { 0, 8, 1 } },
+};
+constexpr Database::StaticVendor PadtransposeHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 3 },
+  { kDeviceTypeAll, "default", 5, 1 },
+};
+constexpr uint16_t PadtransposeHalfIndex[] = {
+  3, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry PadtransposeHalf = {
+  "Padtranspose", Precision::kHalf, PadtransposeParameters, 3,
+  PadtransposeHalfDevices, PadtransposeHalfVendors, 3, PadtransposeHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice PadtransposeBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 1, 16, 2 } },
+};
+constexpr Database::StaticVendor PadtransposeBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t PadtransposeBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry PadtransposeBFloat16 = {
+  "Padtranspose", Precision::kBFloat16, PadtransposeParameters, 3,
+  PadtransposeBFloat16Devices, PadtransposeBFloat16Vendors, 1, PadtransposeBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice PadtransposeSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 0, 16, 4 } },
+  { "ATI Radeon HD 6750M",                             { 1, 16, 1 } },
+  { "Ellesmere",                                       { 1, 8, 4 } },
+  { "Fiji",                                            { 0, 16, 2 } },
+  { "Hawaii",                                          { 1, 16, 4 } },
+  { "Oland",                                           { 0, 16, 4 } },
+  { "Pitcairn",                                        { 0, 16, 4 } },
+  { "Tahiti",                                          { 0, 16, 4 } },
+  { "Tonga",                                           { 0, 16, 2 } },
+  { "Turks",                                           { 1, 16, 1 } },
+  { "default",                                         { 0, 16, 4 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 0, 8, 2 } },
+  { "default",                                         { 0, 8, 2 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 0, 8, 8 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 0, 16, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 0, 8, 8 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 0, 8, 8 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 0, 32, 1 } },
+  { "default",                                         { 0, 8, 8 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 1, 16, 2 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 0, 16, 4 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 1, 16, 2 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 0, 16, 4 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 1, 16, 2 } },
+  { "Iris",                                            { 1, 16, 2 } },
+  { "Iris Pro",                                        { 1, 16, 2 } },
+  { "default",                                         { 1, 16, 2 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 0, 16, 2 } },
+  { "default",                                         { 0, 16, 2 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 1, 32, 2 } },
+  { "GeForce GTX 1070",                                { 0, 16, 1 } },
+  { "GeForce GTX 1080",                                { 1, 16, 2 } },
+  { "GeForce GTX 480",                                 { 1, 16, 2 } },
+  { "GeForce GTX 670",                                 { 1, 32, 2 } },
+  { "GeForce GTX 680",                                 { 1, 16, 2 } },
+  { "GeForce GTX 750",                                 { 1, 32, 2 } },
+  { "GeForce GTX 750 Ti",                              { 1, 32, 2 } },
+  { "GeForce GTX 980",                                 { 0, 16, 1 } },
+  { "GeForce GTX TITAN",                               { 1, 16, 2 } },
+  { "GeForce GTX TITAN Black",                         { 1, 32, 2 } },
+  { "GeForce GTX TITAN X",                             { 1, 32, 1 } },
+  { "TITAN X (Pascal)",                                { 1, 16, 2 } },
+  { "Tesla K20m",                                      { 1, 16, 2 } },
+  { "Tesla K40m",                                      { 1, 32, 2 } },
+  { "default",                                         { 1, 32, 2 } },
+  // Default
+  { "default",                                         { 1, 16, 2 } },
+};
+constexpr Database::StaticVendor PadtransposeSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 6 },
+  { kDeviceTypeGPU, "Intel", 19, 8 },
+  { kDeviceTypeAccelerator, "Intel", 27, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 29, 16 },
+  { kDeviceTypeAll, "default", 45, 1 },
+};
+constexpr uint16_t PadtransposeSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 24, 40, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 35, 17, 0, 0, 0, 44, 33, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 42, 0, 8, 0, 0, 1, 30, 39,
+  0, 0, 32, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 38, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 36, 0, 0, 0, 0, 11, 3,
+  6, 13, 16, 19, 27, 22, 29, 31, 34, 7, 23, 26, 45, 46, 9, 0, 5, 18, 0, 2, 12, 15, 43, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+};
+constexpr Database::StaticEntry PadtransposeSingle = {
+  "Padtranspose", Precision::kSingle, PadtransposeParameters, 3,
+  PadtransposeSingleDevices, PadtransposeSingleVendors, 7, PadtransposeSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry PadtransposeComplexSingle = {
-  "Padtranspose", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "ATI Radeon HD 6750M",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Ellesmere",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Fiji",                                            { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Oland",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Tonga",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Turks",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Iris",                                            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Iris Pro",                                        { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice PadtransposeComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 0, 16, 4 } },
+  { "ATI Radeon HD 6750M",                             { 1, 16, 1 } },
+  { "Ellesmere",                                       { 0, 8, 4 } },
+  { "Fiji",                                            { 1, 16, 2 } },
+  { "Hawaii",                                          { 0, 16, 2 } },
+  { "Oland",                                           { 0, 8, 4 } },
+  { "Pitcairn",                                        { 0, 8, 4 } },
+  { "Tahiti",                                          { 0, 16, 2 } },
+  { "Tonga",                                           { 0, 16, 2 } },
+  { "Turks",                                           { 0, 16, 4 } },
+  { "default",                                         { 0, 8, 4 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 1, 16, 2 } },
+  { "default",                                         { 1, 16, 2 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 0, 8, 8 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 1, 8, 4 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 0, 8, 8 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 0, 8, 8 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 0, 8, 4 } },
+  { "default",                                         { 0, 8, 8 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 1, 16, 2 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 0, 16, 2 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 1, 16, 2 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 0, 16, 2 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 0, 16, 4 } },
+  { "Iris",                                            { 0, 16, 2 } },
+  { "Iris Pro",                                        { 1, 16, 2 } },
+  { "default",                                         { 1, 16, 2 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 1, 16, 1 } },
+  { "default",                                         { 1, 16, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 1, 16, 1 } },
+  { "GeForce GTX 1070",                                { 1, 16, 1 } },
+  { "GeForce GTX 1080",                                { 0, 8, 1 } },
+  { "GeForce GTX 480",                                 { 1, 16, 1 } },
+  { "GeForce GTX 670",                                 { 1, 16, 1 } },
+  { "GeForce GTX 680",                                 { 1, 16, 1 } },
+  { "GeForce GTX 750",                                 { 1, 16, 2 } },
+  { "GeForce GTX 750 Ti",                              { 1, 16, 1 } },
+  { "GeForce GTX 980",                                 { 0, 16, 1 } },
+  { "GeForce GTX TITAN",                               { 1, 16, 1 } },
+  { "GeForce GTX TITAN Black",                         { 0, 16, 1 } },
+  { "GeForce GTX TITAN X",                             { 1, 32, 1 } },
+  { "TITAN X (Pascal)",                                { 1, 8, 1 } },
+  { "Tesla K20m",                                      { 0, 16, 1 } },
+  { "Tesla K40m",                                      { 1, 16, 1 } },
+  { "default",                                         { 1, 16, 1 } },
+  // Default
+  { "default",                                         { 1, 16, 2 } },
+};
+constexpr Database::StaticVendor PadtransposeComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 6 },
+  { kDeviceTypeGPU, "Intel", 19, 8 },
+  { kDeviceTypeAccelerator, "Intel", 27, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 29, 16 },
+  { kDeviceTypeAll, "default", 45, 1 },
+};
+constexpr uint16_t PadtransposeComplexSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 24, 40, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 35, 17, 0, 0, 0, 44, 33, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 42, 0, 8, 0, 0, 1, 30, 39,
+  0, 0, 32, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 38, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 36, 0, 0, 0, 0, 11, 3,
+  6, 13, 16, 19, 27, 22, 29, 31, 34, 7, 23, 26, 45, 46, 9, 0, 5, 18, 0, 2, 12, 15, 43, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+};
+constexpr Database::StaticEntry PadtransposeComplexSingle = {
+  "Padtranspose", Precision::kComplexSingle, PadtransposeParameters, 3,
+  PadtransposeComplexSingleDevices, PadtransposeComplexSingleVendors, 7, PadtransposeComplexSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry PadtransposeDouble = {
-  "Padtranspose", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Ellesmere",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Fiji",                                            { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Oland",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "Tonga",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",4} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice PadtransposeDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 0, 16, 4 } },
+  { "Ellesmere",                                       { 0, 16, 4 } },
+  { "Fiji",                                            { 0, 16, 2 } },
+  { "Hawaii",                                          { 0, 16, 2 } },
+  { "Oland",                                           { 0, 16, 4 } },
+  { "Pitcairn",                                        { 0, 8, 4 } },
+  { "Tahiti",                                          { 1, 16, 2 } },
+  { "Tonga",                                           { 0, 8, 2 } },
+  { "default",                                         { 0, 16, 4 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 0, 16, 2 } },
+  { "default",                                         { 0, 16, 2 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 0, 8, 8 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 1, 8, 4 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 0, 8, 8 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 0, 8, 8 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 1, 32, 1 } },
+  { "default",                                         { 1, 8, 4 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 0, 16, 1 } },
+  { "default",                                         { 0, 16, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 1, 16, 1 } },
+  { "GeForce GTX 1070",                                { 1, 16, 1 } },
+  { "GeForce GTX 1080",                                { 0, 8, 1 } },
+  { "GeForce GTX 480",                                 { 1, 16, 1 } },
+  { "GeForce GTX 670",                                 { 1, 16, 1 } },
+  { "GeForce GTX 680",                                 { 1, 16, 1 } },
+  { "GeForce GTX 750",                                 { 1, 16, 2 } },
+  { "GeForce GTX 750 Ti",                              { 1, 32, 2 } },
+  { "GeForce GTX 980",                                 { 1, 32, 1 } },
+  { "GeForce GTX TITAN",                               { 0, 16, 1 } },
+  { "GeForce GTX TITAN Black",                         { 0, 16, 1 } },
+  { "GeForce GTX TITAN X",                             { 1, 32, 1 } },
+  { "TITAN X (Pascal)",                                { 0, 8, 1 } },
+  { "Tesla K20m",                                      { 0, 16, 1 } },
+  { "Tesla K40m",                                      { 1, 16, 1 } },
+  { "default",                                         { 1, 16, 1 } },
+  // Default
+  { "default",                                         { 1, 16, 2 } },
+};
+constexpr Database::StaticVendor PadtransposeDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeAccelerator, "Intel", 17, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 19, 16 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t PadtransposeDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 30, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 25, 15, 0, 0, 0, 34, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 7, 0, 0, 1, 20, 29,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 9, 2,
+  5, 11, 14, 17, 19, 21, 24, 35, 36, 6, 0, 0, 0, 0, 8, 0, 4, 16, 0, 10, 13, 0, 33, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+};
+constexpr Database::StaticEntry PadtransposeDouble = {
+  "Padtranspose", Precision::kDouble, PadtransposeParameters, 3,
+  PadtransposeDoubleDevices, PadtransposeDoubleVendors, 6, PadtransposeDoubleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry PadtransposeComplexDouble = {
-  "Padtranspose", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Ellesmere",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Fiji",                                            { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "Hawaii",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Oland",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Pitcairn",                                        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Tahiti",                                          { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "Tonga",                                           { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",4} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"PADTRA_PAD",1}, {"PADTRA_TILE",32}, {"PADTRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"PADTRA_PAD",1}, {"PADTRA_TILE",8}, {"PADTRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-        { "default",                                         { {"PADTRA_PAD",1}, {"PADTRA_TILE",16}, {"PADTRA_WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"PADTRA_PAD",0}, {"PADTRA_TILE",8}, {"PADTRA_WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice PadtransposeComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 0, 8, 4 } },
+  { "Ellesmere",                                       { 0, 8, 4 } },
+  { "Fiji",                                            { 0, 8, 2 } },
+  { "Hawaii",                                          { 0, 8, 4 } },
+  { "Oland",                                           { 0, 8, 4 } },
+  { "Pitcairn",                                        { 0, 8, 4 } },
+  { "Tahiti",                                          { 0, 8, 2 } },
+  { "Tonga",                                           { 0, 8, 2 } },
+  { "default",                                         { 0, 8, 4 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 0, 8, 1 } },
+  { "default",                                         { 0, 8, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 0, 8, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 1, 8, 2 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 1, 8, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 0, 8, 4 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 1, 8, 4 } },
+  { "default",                                         { 0, 8, 4 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 0, 16, 1 } },
+  { "default",                                         { 0, 16, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 1, 16, 1 } },
+  { "GeForce GTX 1070",                                { 1, 16, 1 } },
+  { "GeForce GTX 1080",                                { 1, 8, 1 } },
+  { "GeForce GTX 480",                                 { 1, 16, 1 } },
+  { "GeForce GTX 670",                                 { 1, 16, 1 } },
+  { "GeForce GTX 680",                                 { 1, 32, 1 } },
+  { "GeForce GTX 750",                                 { 1, 16, 1 } },
+  { "GeForce GTX 750 Ti",                              { 1, 8, 2 } },
+  { "GeForce GTX 980",                                 { 0, 16, 1 } },
+  { "GeForce GTX TITAN",                               { 1, 16, 1 } },
+  { "GeForce GTX TITAN Black",                         { 0, 16, 1 } },
+  { "GeForce GTX TITAN X",                             { 1, 32, 1 } },
+  { "TITAN X (Pascal)",                                { 1, 8, 1 } },
+  { "Tesla K20m",                                      { 1, 16, 1 } },
+  { "Tesla K40m",                                      { 1, 16, 1 } },
+  { "default",                                         { 1, 16, 1 } },
+  // Default
+  { "default",                                         { 0, 8, 2 } },
+};
+constexpr Database::StaticVendor PadtransposeComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeAccelerator, "Intel", 17, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 19, 16 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t PadtransposeComplexDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 30, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 25, 15, 0, 0, 0, 34, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 7, 0, 0, 1, 20, 29,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 9, 2,
+  5, 11, 14, 17, 19, 21, 24, 35, 36, 6, 0, 0, 0, 0, 8, 0, 4, 16, 0, 10, 13, 0, 33, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+};
+constexpr Database::StaticEntry PadtransposeComplexDouble = {
+  "Padtranspose", Precision::kComplexDouble, PadtransposeParameters, 3,
+  PadtransposeComplexDoubleDevices, PadtransposeComplexDoubleVendors, 6, PadtransposeComplexDoubleIndex, 128
 };
 
 // =================================================================================================
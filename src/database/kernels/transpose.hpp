@@ -15,311 +15,327 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry TransposeHalf = {
-  "Transpose", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-      }
-    },
-  }
+constexpr const char* TransposeParameters[] = {
+  "TRA_DIM", "TRA_PAD", "TRA_SHUFFLE", "TRA_WPT"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry TransposeSingle = {
-  "Transpose", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "ATI Radeon HD 6750M",                             { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Ellesmere",                                       { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Fiji",                                            { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Hawaii",                                          { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Oland",                                           { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Pitcairn",                                        { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tahiti",                                          { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Tonga",                                           { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Turks",                                           { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",16} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",16} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Iris",                                            { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Iris Pro",                                        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 1070",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "GeForce GTX 1080",                                { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "GeForce GTX 480",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 670",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 750",                                 { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "GeForce GTX TITAN Black",                         { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "TITAN X (Pascal)",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice TransposeHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 4, 0, 1, 8 } },
+  { "default",                                         { 4, 0, 1, 8 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 8, 1, 1, 8 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 16, 0, 0, 4 } },
+  { "default",                                         { 8, 1, 0, 8 } },
+  // Default
+  { "default",                                         { 16, 0, 1, 4 } },
+};
+constexpr Database::StaticVendor TransposeHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 3 },
+  { kDeviceTypeAll, "default", 5, 1 },
+};
+constexpr uint16_t TransposeHalfIndex[] = {
+  3, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry TransposeHalf = {
+  "Transpose", Precision::kHalf, TransposeParameters, 4,
+  TransposeHalfDevices, TransposeHalfVendors, 3, TransposeHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice TransposeBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 8, 0, 1, 4 } },
+};
+constexpr Database::StaticVendor TransposeBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t TransposeBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry TransposeBFloat16 = {
+  "Transpose", Precision::kBFloat16, TransposeParameters, 4,
+  TransposeBFloat16Devices, TransposeBFloat16Vendors, 1, TransposeBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice TransposeSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 4, 0, 1, 8 } },
+  { "ATI Radeon HD 6750M",                             { 8, 0, 1, 2 } },
+  { "Ellesmere",                                       { 16, 0, 1, 4 } },
+  { "Fiji",                                            { 16, 0, 1, 2 } },
+  { "Hawaii",                                          { 4, 0, 1, 8 } },
+  { "Oland",                                           { 8, 0, 1, 4 } },
+  { "Pitcairn",                                        { 16, 0, 1, 1 } },
+  { "Tahiti",                                          { 4, 0, 1, 4 } },
+  { "Tonga",                                           { 8, 1, 1, 2 } },
+  { "Turks",                                           { 8, 0, 1, 2 } },
+  { "default",                                         { 8, 0, 1, 2 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 8, 0, 1, 4 } },
+  { "default",                                         { 8, 0, 1, 4 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 1, 0, 16 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 4, 0, 0, 8 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 4, 0, 0, 8 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 4, 1, 0, 16 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 4, 0, 0, 8 } },
+  { "default",                                         { 4, 0, 0, 8 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 16, 0, 1, 4 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 16, 0, 0, 4 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 16, 0, 0, 4 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 8, 0, 1, 4 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 16, 0, 1, 2 } },
+  { "Iris",                                            { 8, 1, 0, 4 } },
+  { "Iris Pro",                                        { 16, 1, 0, 4 } },
+  { "default",                                         { 16, 0, 0, 4 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 16, 1, 1, 1 } },
+  { "default",                                         { 16, 1, 1, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 32, 1, 1, 2 } },
+  { "GeForce GTX 1070",                                { 8, 0, 1, 4 } },
+  { "GeForce GTX 1080",                                { 4, 0, 0, 4 } },
+  { "GeForce GTX 480",                                 { 16, 1, 0, 2 } },
+  { "GeForce GTX 670",                                 { 16, 1, 1, 2 } },
+  { "GeForce GTX 680",                                 { 16, 1, 1, 2 } },
+  { "GeForce GTX 750",                                 { 4, 0, 0, 8 } },
+  { "GeForce GTX 750 Ti",                              { 32, 1, 0, 2 } },
+  { "GeForce GTX 980",                                 { 16, 0, 0, 1 } },
+  { "GeForce GTX TITAN",                               { 8, 1, 0, 4 } },
+  { "GeForce GTX TITAN Black",                         { 8, 1, 0, 4 } },
+  { "GeForce GTX TITAN X",                             { 16, 0, 0, 4 } },
+  { "TITAN X (Pascal)",                                { 8, 0, 0, 4 } },
+  { "Tesla K20m",                                      { 8, 0, 0, 4 } },
+  { "Tesla K40m",                                      { 8, 1, 0, 4 } },
+  { "default",                                         { 8, 1, 0, 4 } },
+  // Default
+  { "default",                                         { 8, 0, 1, 4 } },
+};
+constexpr Database::StaticVendor TransposeSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 6 },
+  { kDeviceTypeGPU, "Intel", 19, 8 },
+  { kDeviceTypeAccelerator, "Intel", 27, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 29, 16 },
+  { kDeviceTypeAll, "default", 45, 1 },
+};
+constexpr uint16_t TransposeSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 24, 40, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 35, 17, 0, 0, 0, 44, 33, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 42, 0, 8, 0, 0, 1, 30, 39,
+  0, 0, 32, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 38, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 36, 0, 0, 0, 0, 11, 3,
+  6, 13, 16, 19, 27, 22, 29, 31, 34, 7, 23, 26, 45, 46, 9, 0, 5, 18, 0, 2, 12, 15, 43, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+};
+constexpr Database::StaticEntry TransposeSingle = {
+  "Transpose", Precision::kSingle, TransposeParameters, 4,
+  TransposeSingleDevices, TransposeSingleVendors, 7, TransposeSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry TransposeComplexSingle = {
-  "Transpose", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "ATI Radeon HD 6750M",                             { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Ellesmere",                                       { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Fiji",                                            { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Hawaii",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Oland",                                           { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Pitcairn",                                        { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tahiti",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tonga",                                           { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Turks",                                           { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Iris",                                            { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Iris Pro",                                        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice TransposeComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 4, 1, 1, 4 } },
+  { "ATI Radeon HD 6750M",                             { 16, 1, 1, 1 } },
+  { "Ellesmere",                                       { 4, 0, 1, 4 } },
+  { "Fiji",                                            { 8, 1, 1, 2 } },
+  { "Hawaii",                                          { 16, 0, 1, 1 } },
+  { "Oland",                                           { 4, 0, 1, 2 } },
+  { "Pitcairn",                                        { 8, 0, 1, 1 } },
+  { "Tahiti",                                          { 16, 0, 1, 1 } },
+  { "Tonga",                                           { 16, 0, 1, 1 } },
+  { "Turks",                                           { 8, 1, 1, 4 } },
+  { "default",                                         { 8, 0, 1, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 16, 0, 0, 2 } },
+  { "default",                                         { 16, 0, 0, 2 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 0, 1, 8 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 8, 0, 0, 2 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 4, 1, 0, 8 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 4, 1, 0, 8 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 16, 0, 0, 4 } },
+  { "default",                                         { 4, 1, 0, 8 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 16, 1, 1, 2 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 8, 0, 0, 2 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 8, 0, 0, 2 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 16, 1, 1, 2 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 16, 1, 0, 2 } },
+  { "Iris",                                            { 8, 0, 0, 2 } },
+  { "Iris Pro",                                        { 16, 1, 0, 2 } },
+  { "default",                                         { 16, 1, 0, 2 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 16, 1, 1, 1 } },
+  { "GeForce GTX 1070",                                { 16, 1, 1, 1 } },
+  { "GeForce GTX 1080",                                { 16, 1, 0, 1 } },
+  { "GeForce GTX 480",                                 { 16, 1, 0, 1 } },
+  { "GeForce GTX 670",                                 { 16, 1, 1, 1 } },
+  { "GeForce GTX 680",                                 { 16, 1, 1, 1 } },
+  { "GeForce GTX 750",                                 { 16, 1, 0, 1 } },
+  { "GeForce GTX 750 Ti",                              { 16, 1, 0, 1 } },
+  { "GeForce GTX 980",                                 { 16, 1, 0, 1 } },
+  { "GeForce GTX TITAN",                               { 16, 0, 0, 1 } },
+  { "GeForce GTX TITAN Black",                         { 16, 1, 0, 1 } },
+  { "GeForce GTX TITAN X",                             { 32, 1, 0, 1 } },
+  { "TITAN X (Pascal)",                                { 8, 1, 0, 2 } },
+  { "Tesla K20m",                                      { 16, 0, 0, 1 } },
+  { "Tesla K40m",                                      { 16, 1, 0, 1 } },
+  { "default",                                         { 16, 1, 0, 1 } },
+  // Default
+  { "default",                                         { 8, 1, 1, 2 } },
+};
+constexpr Database::StaticVendor TransposeComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 6 },
+  { kDeviceTypeGPU, "Intel", 19, 8 },
+  { kDeviceTypeGPU, "NVIDIA", 27, 16 },
+  { kDeviceTypeAll, "default", 43, 1 },
+};
+constexpr uint16_t TransposeComplexSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 38, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 33, 17, 0, 0, 0, 42, 31, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 40, 0, 8, 0, 0, 1, 28, 37,
+  0, 0, 30, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 36, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 34, 0, 0, 0, 0, 11, 3,
+  6, 13, 16, 19, 27, 22, 29, 32, 43, 7, 23, 26, 44, 0, 9, 0, 5, 18, 0, 2, 12, 15, 41, 0, 0, 0, 0, 0, 35, 0, 0, 0,
+};
+constexpr Database::StaticEntry TransposeComplexSingle = {
+  "Transpose", Precision::kComplexSingle, TransposeParameters, 4,
+  TransposeComplexSingleDevices, TransposeComplexSingleVendors, 6, TransposeComplexSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry TransposeDouble = {
-  "Transpose", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Ellesmere",                                       { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Fiji",                                            { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Hawaii",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Oland",                                           { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Pitcairn",                                        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Tahiti",                                          { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "Tonga",                                           { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",4} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",16} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 1070",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 1080",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 480",                                 { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 670",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "GeForce GTX 750",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice TransposeDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 4, 0, 1, 4 } },
+  { "Ellesmere",                                       { 4, 0, 1, 4 } },
+  { "Fiji",                                            { 8, 1, 1, 2 } },
+  { "Hawaii",                                          { 16, 0, 1, 1 } },
+  { "Oland",                                           { 8, 1, 1, 2 } },
+  { "Pitcairn",                                        { 4, 0, 1, 2 } },
+  { "Tahiti",                                          { 4, 1, 1, 4 } },
+  { "Tonga",                                           { 4, 0, 1, 4 } },
+  { "default",                                         { 4, 0, 1, 4 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 8, 0, 0, 1 } },
+  { "default",                                         { 8, 0, 0, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 1, 0, 8 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 4, 0, 0, 4 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 4, 1, 0, 8 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 4, 0, 0, 16 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 4, 0, 0, 8 } },
+  { "default",                                         { 4, 1, 0, 8 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 32, 1, 0, 1 } },
+  { "default",                                         { 32, 1, 0, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 16, 1, 1, 2 } },
+  { "GeForce GTX 1070",                                { 8, 0, 1, 2 } },
+  { "GeForce GTX 1080",                                { 8, 0, 0, 2 } },
+  { "GeForce GTX 480",                                 { 8, 1, 0, 2 } },
+  { "GeForce GTX 670",                                 { 16, 1, 1, 2 } },
+  { "GeForce GTX 680",                                 { 16, 1, 1, 2 } },
+  { "GeForce GTX 750",                                 { 16, 1, 0, 1 } },
+  { "GeForce GTX 750 Ti",                              { 32, 1, 0, 2 } },
+  { "GeForce GTX 980",                                 { 16, 0, 0, 2 } },
+  { "GeForce GTX TITAN",                               { 8, 0, 0, 2 } },
+  { "GeForce GTX TITAN Black",                         { 16, 1, 0, 2 } },
+  { "GeForce GTX TITAN X",                             { 32, 1, 0, 1 } },
+  { "TITAN X (Pascal)",                                { 16, 1, 0, 2 } },
+  { "Tesla K20m",                                      { 16, 1, 0, 2 } },
+  { "Tesla K40m",                                      { 16, 1, 1, 2 } },
+  { "default",                                         { 16, 1, 1, 2 } },
+  // Default
+  { "default",                                         { 16, 1, 1, 2 } },
+};
+constexpr Database::StaticVendor TransposeDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeAccelerator, "Intel", 17, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 19, 16 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t TransposeDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 30, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 25, 15, 0, 0, 0, 34, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 7, 0, 0, 1, 20, 29,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 9, 2,
+  5, 11, 14, 17, 19, 21, 24, 35, 36, 6, 0, 0, 0, 0, 8, 0, 4, 16, 0, 10, 13, 0, 33, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+};
+constexpr Database::StaticEntry TransposeDouble = {
+  "Transpose", Precision::kDouble, TransposeParameters, 4,
+  TransposeDoubleDevices, TransposeDoubleVendors, 6, TransposeDoubleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry TransposeComplexDouble = {
-  "Transpose", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Ellesmere",                                       { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Fiji",                                            { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Hawaii",                                          { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "Oland",                                           { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Pitcairn",                                        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tahiti",                                          { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "Tonga",                                           { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"TRA_DIM",4}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",1}, {"TRA_WPT",8} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",2} } },
-        { "default",                                         { {"TRA_DIM",4}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",8} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 1070",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 1080",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 480",                                 { {"TRA_DIM",8}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 670",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 680",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750",                                 { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX 980",                                 { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"TRA_DIM",16}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"TRA_DIM",32}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"TRA_DIM",8}, {"TRA_PAD",0}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K20m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "Tesla K40m",                                      { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",0}, {"TRA_WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRA_DIM",16}, {"TRA_PAD",1}, {"TRA_SHUFFLE",1}, {"TRA_WPT",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice TransposeComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 4, 1, 1, 2 } },
+  { "Ellesmere",                                       { 16, 0, 1, 1 } },
+  { "Fiji",                                            { 16, 0, 1, 1 } },
+  { "Hawaii",                                          { 4, 0, 1, 2 } },
+  { "Oland",                                           { 16, 0, 1, 1 } },
+  { "Pitcairn",                                        { 4, 0, 1, 1 } },
+  { "Tahiti",                                          { 16, 0, 1, 1 } },
+  { "Tonga",                                           { 8, 1, 1, 2 } },
+  { "default",                                         { 16, 0, 1, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 8, 0, 0, 1 } },
+  { "default",                                         { 8, 0, 0, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 0, 1, 8 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 4, 0, 0, 4 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 4, 1, 0, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 4, 0, 1, 8 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 16, 1, 0, 2 } },
+  { "default",                                         { 4, 0, 0, 8 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 16, 1, 1, 1 } },
+  { "GeForce GTX 1070",                                { 8, 0, 0, 1 } },
+  { "GeForce GTX 1080",                                { 8, 0, 0, 1 } },
+  { "GeForce GTX 480",                                 { 8, 1, 0, 1 } },
+  { "GeForce GTX 670",                                 { 16, 1, 1, 1 } },
+  { "GeForce GTX 680",                                 { 16, 1, 1, 1 } },
+  { "GeForce GTX 750",                                 { 16, 1, 0, 1 } },
+  { "GeForce GTX 750 Ti",                              { 16, 1, 0, 1 } },
+  { "GeForce GTX 980",                                 { 32, 1, 0, 1 } },
+  { "GeForce GTX TITAN",                               { 16, 1, 0, 1 } },
+  { "GeForce GTX TITAN Black",                         { 16, 0, 0, 1 } },
+  { "GeForce GTX TITAN X",                             { 32, 1, 0, 1 } },
+  { "TITAN X (Pascal)",                                { 8, 0, 0, 1 } },
+  { "Tesla K20m",                                      { 16, 1, 0, 1 } },
+  { "Tesla K40m",                                      { 16, 1, 0, 1 } },
+  { "default",                                         { 16, 1, 0, 1 } },
+  // Default
+  { "default",                                         { 16, 1, 1, 1 } },
+};
+constexpr Database::StaticVendor TransposeComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeGPU, "NVIDIA", 17, 16 },
+  { kDeviceTypeAll, "default", 33, 1 },
+};
+constexpr uint16_t TransposeComplexDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 23, 15, 0, 0, 0, 32, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 7, 0, 0, 1, 18, 27,
+  0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0, 0, 9, 2,
+  5, 11, 14, 17, 22, 19, 33, 34, 0, 6, 0, 0, 0, 0, 8, 0, 4, 16, 0, 10, 13, 0, 31, 0, 0, 0, 0, 0, 25, 0, 0, 0,
+};
+constexpr Database::StaticEntry TransposeComplexDouble = {
+  "Transpose", Precision::kComplexDouble, TransposeParameters, 4,
+  TransposeComplexDoubleDevices, TransposeComplexDoubleVendors, 5, TransposeComplexDoubleIndex, 128
 };
 
 // =================================================================================================
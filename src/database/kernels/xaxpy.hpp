@@ -15,323 +15,335 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry XaxpyHalf = {
-  "Xaxpy", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"VW",4}, {"WGS",128}, {"WPT",4} } },
-        { "default",                                         { {"VW",4}, {"WGS",128}, {"WPT",4} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW",8}, {"WGS",64}, {"WPT",1} } },
-        { "default",                                         { {"VW",8}, {"WGS",64}, {"WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",8}, {"WGS",256}, {"WPT",4} } },
-      }
-    },
-  }
+constexpr const char* XaxpyParameters[] = {
+  "VW", "WGS", "WPT"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XaxpySingle = {
-  "Xaxpy", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "ATI Radeon HD 6750M",                             { {"VW",1}, {"WGS",256}, {"WPT",2} } },
-        { "Ellesmere",                                       { {"VW",1}, {"WGS",64}, {"WPT",4} } },
-        { "Fiji",                                            { {"VW",4}, {"WGS",64}, {"WPT",1} } },
-        { "Hawaii",                                          { {"VW",2}, {"WGS",64}, {"WPT",2} } },
-        { "Oland",                                           { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "Tonga",                                           { {"VW",1}, {"WGS",256}, {"WPT",8} } },
-        { "Turks",                                           { {"VW",2}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",2}, {"WGS",256}, {"WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW",8}, {"WGS",512}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW",2}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",8}, {"WGS",512}, {"WPT",1} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW",8}, {"WGS",512}, {"WPT",1} } },
-        { "Iris",                                            { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Iris Pro",                                        { {"VW",1}, {"WGS",128}, {"WPT",2} } },
-        { "default",                                         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",2}, {"WGS",1024}, {"WPT",2} } },
-        { "default",                                         { {"VW",2}, {"WGS",1024}, {"WPT",2} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 1070",                                { {"VW",1}, {"WGS",64}, {"WPT",4} } },
-        { "GeForce GTX 1080",                                { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 670",                                 { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 750",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"VW",4}, {"WGS",128}, {"WPT",4} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"VW",4}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K20m",                                      { {"VW",4}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",4}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XaxpyHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 4, 128, 4 } },
+  { "default",                                         { 4, 128, 4 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 1, 64, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 8, 64, 1 } },
+  { "default",                                         { 8, 64, 1 } },
+  // Default
+  { "default",                                         { 8, 256, 4 } },
+};
+constexpr Database::StaticVendor XaxpyHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 3 },
+  { kDeviceTypeAll, "default", 5, 1 },
+};
+constexpr uint16_t XaxpyHalfIndex[] = {
+  3, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry XaxpyHalf = {
+  "Xaxpy", Precision::kHalf, XaxpyParameters, 3,
+  XaxpyHalfDevices, XaxpyHalfVendors, 3, XaxpyHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XaxpyBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 4, 256, 1 } },
+};
+constexpr Database::StaticVendor XaxpyBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XaxpyBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XaxpyBFloat16 = {
+  "Xaxpy", Precision::kBFloat16, XaxpyParameters, 3,
+  XaxpyBFloat16Devices, XaxpyBFloat16Vendors, 1, XaxpyBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XaxpySingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 1, 128, 1 } },
+  { "ATI Radeon HD 6750M",                             { 1, 256, 2 } },
+  { "Ellesmere",                                       { 1, 64, 4 } },
+  { "Fiji",                                            { 4, 64, 1 } },
+  { "Hawaii",                                          { 2, 64, 2 } },
+  { "Oland",                                           { 1, 128, 1 } },
+  { "Pitcairn",                                        { 2, 128, 1 } },
+  { "Tahiti",                                          { 2, 64, 1 } },
+  { "Tonga",                                           { 1, 256, 8 } },
+  { "Turks",                                           { 2, 256, 1 } },
+  { "default",                                         { 2, 256, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 4, 256, 1 } },
+  { "default",                                         { 4, 256, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 8, 512, 1 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 1, 512, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 4, 256, 1 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 2, 1024, 1 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 1, 128, 1 } },
+  { "default",                                         { 8, 512, 1 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 1, 128, 1 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 1, 256, 1 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 1, 64, 1 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 1, 64, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 8, 512, 1 } },
+  { "Iris",                                            { 1, 64, 1 } },
+  { "Iris Pro",                                        { 1, 128, 2 } },
+  { "default",                                         { 4, 256, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 2, 1024, 2 } },
+  { "default",                                         { 2, 1024, 2 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 2, 64, 1 } },
+  { "GeForce GTX 1070",                                { 1, 64, 4 } },
+  { "GeForce GTX 1080",                                { 1, 256, 1 } },
+  { "GeForce GTX 480",                                 { 2, 128, 1 } },
+  { "GeForce GTX 670",                                 { 2, 64, 1 } },
+  { "GeForce GTX 680",                                 { 1, 128, 1 } },
+  { "GeForce GTX 750",                                 { 1, 64, 1 } },
+  { "GeForce GTX 750 Ti",                              { 2, 64, 1 } },
+  { "GeForce GTX 980",                                 { 1, 1024, 1 } },
+  { "GeForce GTX TITAN",                               { 4, 256, 1 } },
+  { "GeForce GTX TITAN Black",                         { 4, 128, 4 } },
+  { "GeForce GTX TITAN X",                             { 1, 64, 1 } },
+  { "TITAN X (Pascal)",                                { 4, 128, 1 } },
+  { "Tesla K20m",                                      { 4, 128, 1 } },
+  { "Tesla K40m",                                      { 4, 128, 1 } },
+  { "default",                                         { 4, 256, 1 } },
+  // Default
+  { "default",                                         { 4, 256, 1 } },
+};
+constexpr Database::StaticVendor XaxpySingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 6 },
+  { kDeviceTypeGPU, "Intel", 19, 8 },
+  { kDeviceTypeAccelerator, "Intel", 27, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 29, 16 },
+  { kDeviceTypeAll, "default", 45, 1 },
+};
+constexpr uint16_t XaxpySingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 24, 40, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 35, 17, 0, 0, 0, 44, 33, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 42, 0, 8, 0, 0, 1, 30, 39,
+  0, 0, 32, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 38, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 36, 0, 0, 0, 0, 11, 3,
+  6, 13, 16, 19, 27, 22, 29, 31, 34, 7, 23, 26, 45, 46, 9, 0, 5, 18, 0, 2, 12, 15, 43, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+};
+constexpr Database::StaticEntry XaxpySingle = {
+  "Xaxpy", Precision::kSingle, XaxpyParameters, 3,
+  XaxpySingleDevices, XaxpySingleVendors, 7, XaxpySingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XaxpyComplexSingle = {
-  "Xaxpy", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",2}, {"WGS",64}, {"WPT",8} } },
-        { "ATI Radeon HD 6750M",                             { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"VW",2}, {"WGS",256}, {"WPT",1} } },
-        { "Fiji",                                            { {"VW",1}, {"WGS",128}, {"WPT",2} } },
-        { "Hawaii",                                          { {"VW",1}, {"WGS",128}, {"WPT",2} } },
-        { "Oland",                                           { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tonga",                                           { {"VW",1}, {"WGS",256}, {"WPT",8} } },
-        { "Turks",                                           { {"VW",2}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW",4}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",4}, {"WGS",256}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",1}, {"WGS",1024}, {"WPT",2} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW",4}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",2}, {"WGS",1024}, {"WPT",1} } },
-        { "default",                                         { {"VW",8}, {"WGS",1024}, {"WPT",1} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"VW",4}, {"WGS",64}, {"WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW",4}, {"WGS",64}, {"WPT",1} } },
-        { "Iris",                                            { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "Iris Pro",                                        { {"VW",1}, {"WGS",256}, {"WPT",8} } },
-        { "default",                                         { {"VW",4}, {"WGS",64}, {"WPT",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "GeForce GTX 1070",                                { {"VW",1}, {"WGS",64}, {"WPT",2} } },
-        { "GeForce GTX 1080",                                { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 670",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 750",                                 { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"VW",1}, {"WGS",128}, {"WPT",2} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"VW",2}, {"WGS",512}, {"WPT",1} } },
-        { "Tesla K20m",                                      { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XaxpyComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 2, 64, 8 } },
+  { "ATI Radeon HD 6750M",                             { 1, 64, 1 } },
+  { "Ellesmere",                                       { 2, 256, 1 } },
+  { "Fiji",                                            { 1, 128, 2 } },
+  { "Hawaii",                                          { 1, 128, 2 } },
+  { "Oland",                                           { 1, 128, 1 } },
+  { "Pitcairn",                                        { 1, 64, 1 } },
+  { "Tahiti",                                          { 1, 64, 1 } },
+  { "Tonga",                                           { 1, 256, 8 } },
+  { "Turks",                                           { 2, 256, 1 } },
+  { "default",                                         { 1, 128, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 1, 256, 1 } },
+  { "default",                                         { 1, 256, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 1024, 1 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 4, 256, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 1, 1024, 2 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 4, 1024, 1 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 2, 1024, 1 } },
+  { "default",                                         { 8, 1024, 1 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 4, 64, 2 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 1, 64, 1 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 1, 64, 1 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 1, 64, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 4, 64, 1 } },
+  { "Iris",                                            { 2, 128, 1 } },
+  { "Iris Pro",                                        { 1, 256, 8 } },
+  { "default",                                         { 4, 64, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 1, 1024, 1 } },
+  { "default",                                         { 1, 1024, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 1, 512, 1 } },
+  { "GeForce GTX 1070",                                { 1, 64, 2 } },
+  { "GeForce GTX 1080",                                { 2, 64, 1 } },
+  { "GeForce GTX 480",                                 { 1, 256, 1 } },
+  { "GeForce GTX 670",                                 { 1, 256, 1 } },
+  { "GeForce GTX 680",                                 { 1, 256, 1 } },
+  { "GeForce GTX 750",                                 { 1, 512, 1 } },
+  { "GeForce GTX 750 Ti",                              { 1, 512, 1 } },
+  { "GeForce GTX 980",                                 { 1, 64, 1 } },
+  { "GeForce GTX TITAN",                               { 1, 256, 1 } },
+  { "GeForce GTX TITAN Black",                         { 1, 128, 2 } },
+  { "GeForce GTX TITAN X",                             { 1, 512, 1 } },
+  { "TITAN X (Pascal)",                                { 2, 512, 1 } },
+  { "Tesla K20m",                                      { 1, 128, 1 } },
+  { "Tesla K40m",                                      { 1, 128, 1 } },
+  { "default",                                         { 1, 256, 1 } },
+  // Default
+  { "default",                                         { 1, 128, 1 } },
+};
+constexpr Database::StaticVendor XaxpyComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 6 },
+  { kDeviceTypeGPU, "Intel", 19, 8 },
+  { kDeviceTypeAccelerator, "Intel", 27, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 29, 16 },
+  { kDeviceTypeAll, "default", 45, 1 },
+};
+constexpr uint16_t XaxpyComplexSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 24, 40, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 35, 17, 0, 0, 0, 44, 33, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 42, 0, 8, 0, 0, 1, 30, 39,
+  0, 0, 32, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 38, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 36, 0, 0, 0, 0, 11, 3,
+  6, 13, 16, 19, 27, 22, 29, 31, 34, 7, 23, 26, 45, 46, 9, 0, 5, 18, 0, 2, 12, 15, 43, 0, 0, 0, 0, 0, 37, 0, 0, 0,
+};
+constexpr Database::StaticEntry XaxpyComplexSingle = {
+  "Xaxpy", Precision::kComplexSingle, XaxpyParameters, 3,
+  XaxpyComplexSingleDevices, XaxpyComplexSingleVendors, 7, XaxpyComplexSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XaxpyDouble = {
-  "Xaxpy", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"VW",2}, {"WGS",64}, {"WPT",4} } },
-        { "Fiji",                                            { {"VW",2}, {"WGS",64}, {"WPT",4} } },
-        { "Hawaii",                                          { {"VW",1}, {"WGS",64}, {"WPT",2} } },
-        { "Oland",                                           { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tonga",                                           { {"VW",1}, {"WGS",128}, {"WPT",4} } },
-        { "default",                                         { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",2}, {"WGS",128}, {"WPT",2} } },
-        { "default",                                         { {"VW",2}, {"WGS",128}, {"WPT",2} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW",4}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",8}, {"WGS",64}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW",8}, {"WGS",256}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",8}, {"WGS",2048}, {"WPT",1} } },
-        { "default",                                         { {"VW",8}, {"WGS",64}, {"WPT",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",2}, {"WGS",512}, {"WPT",1} } },
-        { "default",                                         { {"VW",2}, {"WGS",512}, {"WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 1070",                                { {"VW",1}, {"WGS",64}, {"WPT",8} } },
-        { "GeForce GTX 1080",                                { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 670",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 750",                                 { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",1}, {"WGS",256}, {"WPT",2} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",2}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX TITAN Black",                         { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",512}, {"WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"VW",2}, {"WGS",512}, {"WPT",1} } },
-        { "Tesla K20m",                                      { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",2}, {"WGS",128}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",2}, {"WGS",256}, {"WPT",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XaxpyDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 1, 256, 1 } },
+  { "Ellesmere",                                       { 2, 64, 4 } },
+  { "Fiji",                                            { 2, 64, 4 } },
+  { "Hawaii",                                          { 1, 64, 2 } },
+  { "Oland",                                           { 1, 64, 1 } },
+  { "Pitcairn",                                        { 1, 128, 1 } },
+  { "Tahiti",                                          { 1, 64, 1 } },
+  { "Tonga",                                           { 1, 128, 4 } },
+  { "default",                                         { 2, 64, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 2, 128, 2 } },
+  { "default",                                         { 2, 128, 2 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 64, 1 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 1, 1024, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 8, 64, 1 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 8, 256, 1 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 8, 2048, 1 } },
+  { "default",                                         { 8, 64, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 2, 512, 1 } },
+  { "default",                                         { 2, 512, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 1, 64, 1 } },
+  { "GeForce GTX 1070",                                { 1, 64, 8 } },
+  { "GeForce GTX 1080",                                { 1, 128, 1 } },
+  { "GeForce GTX 480",                                 { 1, 128, 1 } },
+  { "GeForce GTX 670",                                 { 1, 64, 1 } },
+  { "GeForce GTX 680",                                 { 1, 64, 1 } },
+  { "GeForce GTX 750",                                 { 1, 128, 1 } },
+  { "GeForce GTX 750 Ti",                              { 1, 256, 2 } },
+  { "GeForce GTX 980",                                 { 1, 256, 1 } },
+  { "GeForce GTX TITAN",                               { 2, 1024, 1 } },
+  { "GeForce GTX TITAN Black",                         { 2, 128, 1 } },
+  { "GeForce GTX TITAN X",                             { 1, 512, 1 } },
+  { "TITAN X (Pascal)",                                { 2, 512, 1 } },
+  { "Tesla K20m",                                      { 2, 128, 1 } },
+  { "Tesla K40m",                                      { 2, 128, 1 } },
+  { "default",                                         { 1, 128, 1 } },
+  // Default
+  { "default",                                         { 2, 256, 1 } },
+};
+constexpr Database::StaticVendor XaxpyDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeAccelerator, "Intel", 17, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 19, 16 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t XaxpyDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 30, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 25, 15, 0, 0, 0, 34, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 7, 0, 0, 1, 20, 29,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 9, 2,
+  5, 11, 14, 17, 19, 21, 24, 35, 36, 6, 0, 0, 0, 0, 8, 0, 4, 16, 0, 10, 13, 0, 33, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+};
+constexpr Database::StaticEntry XaxpyDouble = {
+  "Xaxpy", Precision::kDouble, XaxpyParameters, 3,
+  XaxpyDoubleDevices, XaxpyDoubleVendors, 6, XaxpyDoubleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XaxpyComplexDouble = {
-  "Xaxpy", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Fiji",                                            { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Hawaii",                                          { {"VW",2}, {"WGS",64}, {"WPT",1} } },
-        { "Oland",                                           { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tahiti",                                          { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "Tonga",                                           { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"VW",1}, {"WGS",64}, {"WPT",8} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",8} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW",4}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW",8}, {"WGS",128}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW",8}, {"WGS",512}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW",8}, {"WGS",1024}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "default",                                         { {"VW",4}, {"WGS",1024}, {"WPT",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 1070",                                { {"VW",1}, {"WGS",64}, {"WPT",2} } },
-        { "GeForce GTX 1080",                                { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"VW",1}, {"WGS",128}, {"WPT",1} } },
-        { "GeForce GTX 670",                                 { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-        { "GeForce GTX 680",                                 { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "GeForce GTX 750",                                 { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW",1}, {"WGS",64}, {"WPT",2} } },
-        { "GeForce GTX 980",                                 { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"VW",1}, {"WGS",64}, {"WPT",4} } },
-        { "GeForce GTX TITAN Black",                         { {"VW",1}, {"WGS",128}, {"WPT",4} } },
-        { "GeForce GTX TITAN X",                             { {"VW",1}, {"WGS",1024}, {"WPT",1} } },
-        { "TITAN X (Pascal)",                                { {"VW",1}, {"WGS",256}, {"WPT",2} } },
-        { "Tesla K20m",                                      { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "Tesla K40m",                                      { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-        { "default",                                         { {"VW",1}, {"WGS",64}, {"WPT",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW",1}, {"WGS",256}, {"WPT",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XaxpyComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 1, 128, 1 } },
+  { "Ellesmere",                                       { 1, 128, 1 } },
+  { "Fiji",                                            { 1, 64, 1 } },
+  { "Hawaii",                                          { 2, 64, 1 } },
+  { "Oland",                                           { 1, 256, 1 } },
+  { "Pitcairn",                                        { 1, 128, 1 } },
+  { "Tahiti",                                          { 1, 128, 1 } },
+  { "Tonga",                                           { 1, 64, 1 } },
+  { "default",                                         { 1, 128, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 1, 64, 8 } },
+  { "default",                                         { 1, 64, 8 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 1024, 1 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 8, 128, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 8, 512, 1 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 8, 1024, 1 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 1, 256, 1 } },
+  { "default",                                         { 4, 1024, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 1, 1024, 1 } },
+  { "default",                                         { 1, 1024, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 1, 64, 1 } },
+  { "GeForce GTX 1070",                                { 1, 64, 2 } },
+  { "GeForce GTX 1080",                                { 1, 256, 1 } },
+  { "GeForce GTX 480",                                 { 1, 128, 1 } },
+  { "GeForce GTX 670",                                 { 1, 256, 1 } },
+  { "GeForce GTX 680",                                 { 1, 64, 1 } },
+  { "GeForce GTX 750",                                 { 1, 1024, 1 } },
+  { "GeForce GTX 750 Ti",                              { 1, 64, 2 } },
+  { "GeForce GTX 980",                                 { 1, 1024, 1 } },
+  { "GeForce GTX TITAN",                               { 1, 64, 4 } },
+  { "GeForce GTX TITAN Black",                         { 1, 128, 4 } },
+  { "GeForce GTX TITAN X",                             { 1, 1024, 1 } },
+  { "TITAN X (Pascal)",                                { 1, 256, 2 } },
+  { "Tesla K20m",                                      { 1, 64, 1 } },
+  { "Tesla K40m",                                      { 1, 64, 1 } },
+  { "default",                                         { 1, 64, 1 } },
+  // Default
+  { "default",                                         { 1, 256, 1 } },
+};
+constexpr Database::StaticVendor XaxpyComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 6 },
+  { kDeviceTypeAccelerator, "Intel", 17, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 19, 16 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t XaxpyComplexDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 30, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 25, 15, 0, 0, 0, 34, 23, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 7, 0, 0, 1, 20, 29,
+  0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 9, 2,
+  5, 11, 14, 17, 19, 21, 24, 35, 36, 6, 0, 0, 0, 0, 8, 0, 4, 16, 0, 10, 13, 0, 33, 0, 0, 0, 0, 0, 27, 0, 0, 0,
+};
+constexpr Database::StaticEntry XaxpyComplexDouble = {
+  "Xaxpy", Precision::kComplexDouble, XaxpyParameters, 3,
+  XaxpyComplexDoubleDevices, XaxpyComplexDoubleVendors, 6, XaxpyComplexDoubleIndex, 128
 };
 
 // =================================================================================================
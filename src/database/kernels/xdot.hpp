@@ -15,253 +15,277 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry XdotHalf = {
-  "Xdot", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"WGS1",256}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",64} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",256}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",128}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
-      }
-    },
-  }
+constexpr const char* XdotParameters[] = {
+  "WGS1", "WGS2"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XdotSingle = {
-  "Xdot", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",128}, {"WGS2",32} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "Ellesmere",                                       { {"WGS1",128}, {"WGS2",32} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",32} } },
-        { "Oland",                                           { {"WGS1",256}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",128}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",128}, {"WGS2",32} } },
-        { "Tonga",                                           { {"WGS1",64}, {"WGS2",32} } },
-        { "Turks",                                           { {"WGS1",128}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",32}, {"WGS2",32} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",1024}, {"WGS2",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",64}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",32} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",64}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",256}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",64}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",512}, {"WGS2",128} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",32}, {"WGS2",32} } },
-        { "Iris Pro",                                        { {"WGS1",512}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",32} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX 1070",                                { {"WGS1",128}, {"WGS2",1024} } },
-        { "GeForce GTX 1080",                                { {"WGS1",512}, {"WGS2",64} } },
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 670",                                 { {"WGS1",512}, {"WGS2",1024} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",128} } },
-        { "GeForce GTX 750",                                 { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 980",                                 { {"WGS1",256}, {"WGS2",32} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",512}, {"WGS2",64} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",1024}, {"WGS2",32} } },
-        { "Tesla K20m",                                      { {"WGS1",1024}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",64} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XdotHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 256, 64 } },
+  { "default",                                         { 256, 64 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 256, 32 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 128, 32 } },
+  { "default",                                         { 128, 32 } },
+  // Default
+  { "default",                                         { 128, 32 } },
+};
+constexpr Database::StaticVendor XdotHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 3 },
+  { kDeviceTypeAll, "default", 5, 1 },
+};
+constexpr uint16_t XdotHalfIndex[] = {
+  3, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry XdotHalf = {
+  "Xdot", Precision::kHalf, XdotParameters, 2,
+  XdotHalfDevices, XdotHalfVendors, 3, XdotHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XdotBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 128, 32 } },
+};
+constexpr Database::StaticVendor XdotBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XdotBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XdotBFloat16 = {
+  "Xdot", Precision::kBFloat16, XdotParameters, 2,
+  XdotBFloat16Devices, XdotBFloat16Vendors, 1, XdotBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XdotSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 128, 32 } },
+  { "ATI Radeon HD 6750M",                             { 256, 32 } },
+  { "Ellesmere",                                       { 128, 32 } },
+  { "Fiji",                                            { 256, 32 } },
+  { "Oland",                                           { 256, 32 } },
+  { "Pitcairn",                                        { 128, 32 } },
+  { "Tahiti",                                          { 128, 32 } },
+  { "Tonga",                                           { 64, 32 } },
+  { "Turks",                                           { 128, 64 } },
+  { "default",                                         { 256, 32 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 32, 32 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 1024, 32 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 64, 32 } },
+  { "default",                                         { 64, 32 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 64, 32 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 256, 32 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 64, 32 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 512, 128 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 32, 32 } },
+  { "Iris Pro",                                        { 512, 64 } },
+  { "default",                                         { 64, 32 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 128, 32 } },
+  { "GeForce GTX 1070",                                { 128, 1024 } },
+  { "GeForce GTX 1080",                                { 512, 64 } },
+  { "GeForce GTX 480",                                 { 512, 32 } },
+  { "GeForce GTX 670",                                 { 512, 1024 } },
+  { "GeForce GTX 680",                                 { 128, 128 } },
+  { "GeForce GTX 750",                                 { 128, 32 } },
+  { "GeForce GTX 750 Ti",                              { 64, 32 } },
+  { "GeForce GTX 980",                                 { 256, 32 } },
+  { "GeForce GTX TITAN Black",                         { 512, 64 } },
+  { "GeForce GTX TITAN X",                             { 256, 32 } },
+  { "TITAN X (Pascal)",                                { 1024, 32 } },
+  { "Tesla K20m",                                      { 1024, 32 } },
+  { "default",                                         { 256, 64 } },
+  // Default
+  { "default",                                         { 128, 32 } },
+};
+constexpr Database::StaticVendor XdotSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 10 },
+  { kDeviceTypeCPU, "Intel", 10, 4 },
+  { kDeviceTypeGPU, "Intel", 14, 7 },
+  { kDeviceTypeGPU, "NVIDIA", 21, 14 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t XdotSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 31, 15, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 27, 13, 0, 0, 0, 0, 25, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 33, 0, 7, 0, 0, 1, 22, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 11, 0, 0, 0, 0, 0, 9, 0, 0, 28, 0, 0, 0, 0, 10, 3,
+  5, 14, 21, 26, 35, 17, 23, 36, 0, 6, 18, 20, 0, 0, 8, 0, 0, 0, 0, 2, 12, 0, 34, 0, 0, 0, 0, 0, 29, 0, 0, 0,
+};
+constexpr Database::StaticEntry XdotSingle = {
+  "Xdot", Precision::kSingle, XdotParameters, 2,
+  XdotSingleDevices, XdotSingleVendors, 5, XdotSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XdotComplexSingle = {
-  "Xdot", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",32} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",256}, {"WGS2",256} } },
-        { "Ellesmere",                                       { {"WGS1",256}, {"WGS2",32} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",64} } },
-        { "Oland",                                           { {"WGS1",128}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WGS2",32} } },
-        { "Tonga",                                           { {"WGS1",256}, {"WGS2",64} } },
-        { "Turks",                                           { {"WGS1",128}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",128}, {"WGS2",64} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",1024}, {"WGS2",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",256}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",256}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",256}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",32}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",512}, {"WGS2",32} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",32}, {"WGS2",256} } },
-        { "Iris Pro",                                        { {"WGS1",32}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",32}, {"WGS2",32} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 1070",                                { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX 1080",                                { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 670",                                 { {"WGS1",256}, {"WGS2",32} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 750",                                 { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 980",                                 { {"WGS1",256}, {"WGS2",64} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",256}, {"WGS2",32} } },
-        { "Tesla K20m",                                      { {"WGS1",512}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",512}, {"WGS2",64} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XdotComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 64, 32 } },
+  { "ATI Radeon HD 6750M",                             { 256, 256 } },
+  { "Ellesmere",                                       { 256, 32 } },
+  { "Fiji",                                            { 256, 64 } },
+  { "Oland",                                           { 128, 32 } },
+  { "Pitcairn",                                        { 256, 32 } },
+  { "Tahiti",                                          { 64, 32 } },
+  { "Tonga",                                           { 256, 64 } },
+  { "Turks",                                           { 128, 32 } },
+  { "default",                                         { 256, 32 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 128, 64 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 1024, 32 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 256, 32 } },
+  { "default",                                         { 256, 32 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 256, 32 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 256, 32 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 32, 32 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 512, 32 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 32, 256 } },
+  { "Iris Pro",                                        { 32, 32 } },
+  { "default",                                         { 32, 32 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 64, 32 } },
+  { "GeForce GTX 1070",                                { 128, 32 } },
+  { "GeForce GTX 1080",                                { 128, 64 } },
+  { "GeForce GTX 480",                                 { 512, 32 } },
+  { "GeForce GTX 670",                                 { 256, 32 } },
+  { "GeForce GTX 680",                                 { 128, 64 } },
+  { "GeForce GTX 750",                                 { 64, 32 } },
+  { "GeForce GTX 750 Ti",                              { 64, 32 } },
+  { "GeForce GTX 980",                                 { 256, 64 } },
+  { "GeForce GTX TITAN Black",                         { 128, 64 } },
+  { "GeForce GTX TITAN X",                             { 256, 32 } },
+  { "TITAN X (Pascal)",                                { 256, 32 } },
+  { "Tesla K20m",                                      { 512, 32 } },
+  { "default",                                         { 512, 64 } },
+  // Default
+  { "default",                                         { 256, 32 } },
+};
+constexpr Database::StaticVendor XdotComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 10 },
+  { kDeviceTypeCPU, "Intel", 10, 4 },
+  { kDeviceTypeGPU, "Intel", 14, 7 },
+  { kDeviceTypeGPU, "NVIDIA", 21, 14 },
+  { kDeviceTypeAll, "default", 35, 1 },
+};
+constexpr uint16_t XdotComplexSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 31, 15, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 27, 13, 0, 0, 0, 0, 25, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 33, 0, 7, 0, 0, 1, 22, 0,
+  0, 0, 24, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 11, 0, 0, 0, 0, 0, 9, 0, 0, 28, 0, 0, 0, 0, 10, 3,
+  5, 14, 21, 26, 35, 17, 23, 36, 0, 6, 18, 20, 0, 0, 8, 0, 0, 0, 0, 2, 12, 0, 34, 0, 0, 0, 0, 0, 29, 0, 0, 0,
+};
+constexpr Database::StaticEntry XdotComplexSingle = {
+  "Xdot", Precision::kComplexSingle, XdotParameters, 2,
+  XdotComplexSingleDevices, XdotComplexSingleVendors, 5, XdotComplexSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XdotDouble = {
-  "Xdot", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",128} } },
-        { "Ellesmere",                                       { {"WGS1",128}, {"WGS2",64} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",32} } },
-        { "Oland",                                           { {"WGS1",256}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",128}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WGS2",32} } },
-        { "Tonga",                                           { {"WGS1",128}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",64} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",64}, {"WGS2",128} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",512}, {"WGS2",64} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",256}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",64} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX 1070",                                { {"WGS1",128}, {"WGS2",512} } },
-        { "GeForce GTX 1080",                                { {"WGS1",128}, {"WGS2",128} } },
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 670",                                 { {"WGS1",256}, {"WGS2",32} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 750",                                 { {"WGS1",64}, {"WGS2",256} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 980",                                 { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WGS2",32} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",128}, {"WGS2",32} } },
-        { "Tesla K20m",                                      { {"WGS1",512}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",128} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",256}, {"WGS2",64} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XdotDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 64, 128 } },
+  { "Ellesmere",                                       { 128, 64 } },
+  { "Fiji",                                            { 256, 32 } },
+  { "Oland",                                           { 256, 32 } },
+  { "Pitcairn",                                        { 128, 32 } },
+  { "Tahiti",                                          { 256, 32 } },
+  { "Tonga",                                           { 128, 64 } },
+  { "default",                                         { 128, 64 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 64, 128 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 512, 64 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 256, 32 } },
+  { "default",                                         { 256, 64 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 128, 32 } },
+  { "GeForce GTX 1070",                                { 128, 512 } },
+  { "GeForce GTX 1080",                                { 128, 128 } },
+  { "GeForce GTX 480",                                 { 512, 32 } },
+  { "GeForce GTX 670",                                 { 256, 32 } },
+  { "GeForce GTX 680",                                 { 128, 64 } },
+  { "GeForce GTX 750",                                 { 64, 256 } },
+  { "GeForce GTX 750 Ti",                              { 128, 64 } },
+  { "GeForce GTX 980",                                 { 128, 32 } },
+  { "GeForce GTX TITAN Black",                         { 128, 64 } },
+  { "GeForce GTX TITAN X",                             { 256, 32 } },
+  { "TITAN X (Pascal)",                                { 128, 32 } },
+  { "Tesla K20m",                                      { 512, 32 } },
+  { "default",                                         { 128, 128 } },
+  // Default
+  { "default",                                         { 256, 64 } },
+};
+constexpr Database::StaticVendor XdotDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 8 },
+  { kDeviceTypeCPU, "Intel", 8, 4 },
+  { kDeviceTypeGPU, "NVIDIA", 12, 14 },
+  { kDeviceTypeAll, "default", 26, 1 },
+};
+constexpr uint16_t XdotDoubleIndex[] = {
+  0, 0, 15, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 21, 23, 9, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 22, 0, 8, 2,
+  4, 12, 17, 26, 27, 14, 0, 18, 11, 5, 0, 0, 0, 16, 7, 0, 0, 0, 0, 10, 0, 0, 25, 0, 24, 0, 6, 0, 20, 1, 13, 0,
+};
+constexpr Database::StaticEntry XdotDouble = {
+  "Xdot", Precision::kDouble, XdotParameters, 2,
+  XdotDoubleDevices, XdotDoubleVendors, 4, XdotDoubleIndex, 64
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XdotComplexDouble = {
-  "Xdot", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",32} } },
-        { "Ellesmere",                                       { {"WGS1",256}, {"WGS2",32} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",32} } },
-        { "Oland",                                           { {"WGS1",256}, {"WGS2",32} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WGS2",32} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WGS2",32} } },
-        { "Tonga",                                           { {"WGS1",128}, {"WGS2",64} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",32}, {"WGS2",128} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",1024}, {"WGS2",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",32}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",32} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 1070",                                { {"WGS1",128}, {"WGS2",64} } },
-        { "GeForce GTX 1080",                                { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX 480",                                 { {"WGS1",512}, {"WGS2",32} } },
-        { "GeForce GTX 670",                                 { {"WGS1",512}, {"WGS2",128} } },
-        { "GeForce GTX 680",                                 { {"WGS1",256}, {"WGS2",64} } },
-        { "GeForce GTX 750",                                 { {"WGS1",256}, {"WGS2",32} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX 980",                                 { {"WGS1",64}, {"WGS2",32} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",128}, {"WGS2",32} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",128}, {"WGS2",32} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",128}, {"WGS2",64} } },
-        { "Tesla K20m",                                      { {"WGS1",128}, {"WGS2",32} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",64} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",256}, {"WGS2",32} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XdotComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 64, 32 } },
+  { "Ellesmere",                                       { 256, 32 } },
+  { "Fiji",                                            { 256, 32 } },
+  { "Oland",                                           { 256, 32 } },
+  { "Pitcairn",                                        { 256, 32 } },
+  { "Tahiti",                                          { 256, 32 } },
+  { "Tonga",                                           { 128, 64 } },
+  { "default",                                         { 256, 32 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 32, 128 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 1024, 32 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 32, 32 } },
+  { "default",                                         { 128, 32 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 64, 32 } },
+  { "GeForce GTX 1070",                                { 128, 64 } },
+  { "GeForce GTX 1080",                                { 128, 32 } },
+  { "GeForce GTX 480",                                 { 512, 32 } },
+  { "GeForce GTX 670",                                 { 512, 128 } },
+  { "GeForce GTX 680",                                 { 256, 64 } },
+  { "GeForce GTX 750",                                 { 256, 32 } },
+  { "GeForce GTX 750 Ti",                              { 64, 32 } },
+  { "GeForce GTX 980",                                 { 64, 32 } },
+  { "GeForce GTX TITAN Black",                         { 128, 32 } },
+  { "GeForce GTX TITAN X",                             { 128, 32 } },
+  { "TITAN X (Pascal)",                                { 128, 64 } },
+  { "Tesla K20m",                                      { 128, 32 } },
+  { "default",                                         { 128, 64 } },
+  // Default
+  { "default",                                         { 256, 32 } },
+};
+constexpr Database::StaticVendor XdotComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 8 },
+  { kDeviceTypeCPU, "Intel", 8, 4 },
+  { kDeviceTypeGPU, "NVIDIA", 12, 14 },
+  { kDeviceTypeAll, "default", 26, 1 },
+};
+constexpr uint16_t XdotComplexDoubleIndex[] = {
+  0, 0, 15, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 21, 23, 9, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 22, 0, 8, 2,
+  4, 12, 17, 26, 27, 14, 0, 18, 11, 5, 0, 0, 0, 16, 7, 0, 0, 0, 0, 10, 0, 0, 25, 0, 24, 0, 6, 0, 20, 1, 13, 0,
+};
+constexpr Database::StaticEntry XdotComplexDouble = {
+  "Xdot", Precision::kComplexDouble, XdotParameters, 2,
+  XdotComplexDoubleDevices, XdotComplexDoubleVendors, 4, XdotComplexDoubleIndex, 64
 };
 
 // =================================================================================================
@@ -15,191 +15,209 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry XgemmDirectHalf = {
-  "XgemmDirect", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"KWID",8}, {"MDIMAD",32}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",32}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "default",                                         { {"KWID",8}, {"MDIMAD",32}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",32}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-      }
-    },
-  }
+constexpr const char* XgemmDirectParameters[] = {
+  "KWID", "MDIMAD", "MDIMCD", "NDIMBD", "NDIMCD", "PADA", "PADB", "VWMD", "VWND", "WGD"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemmDirectSingle = {
-  "XgemmDirect", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "ATI Radeon HD 6750M",                             { {"KWID",8}, {"MDIMAD",8}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",0}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "Ellesmere",                                       { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",32}, {"NDIMCD",32}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",1}, {"WGD",32} } },
-        { "Fiji",                                            { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Tonga",                                           { {"KWID",16}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",32}, {"NDIMCD",8}, {"PADA",0}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "Turks",                                           { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",1}, {"VWND",8}, {"WGD",64} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",2}, {"VWND",2}, {"WGD",64} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",4}, {"WGD",32} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
-        { "Iris Pro",                                        { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",4}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 1080",                                { {"KWID",16}, {"MDIMAD",16}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "GeForce GTX 750 Ti",                              { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",2}, {"WGD",32} } },
-        { "GeForce GTX TITAN Black",                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",2}, {"WGD",32} } },
-        { "TITAN X (Pascal)",                                { {"KWID",8}, {"MDIMAD",32}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",2}, {"WGD",32} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",2}, {"WGD",32} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemmDirectHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 8, 32, 8, 8, 32, 1, 1, 1, 1, 32 } },
+  { "default",                                         { 8, 32, 8, 8, 32, 1, 1, 1, 1, 32 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 2, 8, 8, 8, 8, 1, 1, 1, 1, 8 } },
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 1, 1, 8 } },
+  // Default
+  { "default",                                         { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+};
+constexpr Database::StaticVendor XgemmDirectHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 2 },
+  { kDeviceTypeAll, "default", 4, 1 },
+};
+constexpr uint16_t XgemmDirectHalfIndex[] = {
+  4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry XgemmDirectHalf = {
+  "XgemmDirect", Precision::kHalf, XgemmDirectParameters, 10,
+  XgemmDirectHalfDevices, XgemmDirectHalfVendors, 3, XgemmDirectHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemmDirectBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 4, 2, 32 } },
+};
+constexpr Database::StaticVendor XgemmDirectBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgemmDirectBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgemmDirectBFloat16 = {
+  "XgemmDirect", Precision::kBFloat16, XgemmDirectParameters, 10,
+  XgemmDirectBFloat16Devices, XgemmDirectBFloat16Vendors, 1, XgemmDirectBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemmDirectSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 2, 8, 8, 8, 8, 1, 1, 2, 2, 32 } },
+  { "ATI Radeon HD 6750M",                             { 8, 8, 16, 8, 8, 1, 0, 2, 2, 32 } },
+  { "Ellesmere",                                       { 2, 8, 8, 32, 32, 1, 1, 2, 1, 32 } },
+  { "Fiji",                                            { 2, 16, 16, 8, 8, 1, 1, 1, 1, 16 } },
+  { "Tonga",                                           { 16, 16, 16, 32, 8, 0, 1, 1, 1, 32 } },
+  { "Turks",                                           { 2, 8, 8, 8, 8, 1, 1, 1, 1, 16 } },
+  { "default",                                         { 2, 16, 16, 8, 8, 1, 1, 1, 1, 16 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 2, 8, 8, 8, 8, 0, 0, 1, 8, 64 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 2, 8, 8, 8, 8, 0, 0, 2, 2, 64 } },
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 2, 4, 32 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 2, 8, 8, 8, 8, 1, 1, 1, 1, 8 } },
+  { "Iris Pro",                                        { 2, 16, 16, 8, 8, 1, 1, 2, 4, 32 } },
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 1, 1, 8 } },
+  // NVIDIA GPUs
+  { "GeForce GTX 1080",                                { 16, 16, 8, 16, 8, 1, 1, 1, 1, 32 } },
+  { "GeForce GTX 750 Ti",                              { 2, 8, 8, 8, 8, 1, 1, 4, 2, 32 } },
+  { "GeForce GTX TITAN Black",                         { 2, 8, 8, 16, 16, 1, 1, 4, 2, 32 } },
+  { "TITAN X (Pascal)",                                { 8, 32, 8, 8, 16, 1, 1, 1, 1, 32 } },
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 4, 2, 32 } },
+  // Default
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 4, 2, 32 } },
+};
+constexpr Database::StaticVendor XgemmDirectSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 7 },
+  { kDeviceTypeCPU, "Intel", 7, 3 },
+  { kDeviceTypeGPU, "Intel", 10, 3 },
+  { kDeviceTypeGPU, "NVIDIA", 13, 5 },
+  { kDeviceTypeAll, "default", 18, 1 },
+};
+constexpr uint16_t XgemmDirectSingleIndex[] = {
+  0, 0, 14, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 11, 16, 0, 7, 3,
+  10, 13, 18, 19, 0, 0, 0, 0, 9, 12, 0, 0, 0, 0, 5, 0, 0, 0, 0, 2, 0, 0, 0, 0, 17, 0, 0, 0, 15, 1, 0, 0,
+};
+constexpr Database::StaticEntry XgemmDirectSingle = {
+  "XgemmDirect", Precision::kSingle, XgemmDirectParameters, 10,
+  XgemmDirectSingleDevices, XgemmDirectSingleVendors, 5, XgemmDirectSingleIndex, 64
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemmDirectComplexSingle = {
-  "XgemmDirect", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "ATI Radeon HD 6750M",                             { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
-        { "Fiji",                                            { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Tonga",                                           { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "Turks",                                           { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",4}, {"VWND",4}, {"WGD",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",1}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",4}, {"WGD",32} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Iris Pro",                                        { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 1080",                                { {"KWID",8}, {"MDIMAD",8}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "GeForce GTX 750 Ti",                              { {"KWID",16}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",1}, {"WGD",16} } },
-        { "GeForce GTX TITAN Black",                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "TITAN X (Pascal)",                                { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemmDirectComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+  { "ATI Radeon HD 6750M",                             { 2, 8, 8, 8, 8, 1, 1, 1, 1, 8 } },
+  { "Fiji",                                            { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+  { "Tonga",                                           { 2, 16, 16, 16, 16, 1, 1, 2, 2, 32 } },
+  { "Turks",                                           { 2, 8, 8, 8, 8, 1, 1, 2, 2, 16 } },
+  { "default",                                         { 2, 16, 16, 16, 16, 1, 1, 2, 2, 32 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 2, 8, 8, 8, 8, 0, 0, 4, 4, 32 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 2, 8, 8, 16, 8, 1, 1, 2, 1, 32 } },
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 4, 4, 32 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+  { "Iris Pro",                                        { 2, 16, 16, 8, 8, 1, 1, 2, 2, 32 } },
+  { "default",                                         { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+  // NVIDIA GPUs
+  { "GeForce GTX 1080",                                { 8, 8, 16, 16, 8, 1, 1, 2, 2, 32 } },
+  { "GeForce GTX 750 Ti",                              { 16, 8, 8, 16, 8, 1, 1, 2, 1, 16 } },
+  { "GeForce GTX TITAN Black",                         { 2, 8, 8, 16, 16, 1, 1, 1, 1, 16 } },
+  { "TITAN X (Pascal)",                                { 2, 16, 16, 8, 8, 1, 1, 1, 1, 16 } },
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 1, 2, 16 } },
+  // Default
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 1, 2, 16 } },
+};
+constexpr Database::StaticVendor XgemmDirectComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 6 },
+  { kDeviceTypeCPU, "Intel", 6, 3 },
+  { kDeviceTypeGPU, "Intel", 9, 3 },
+  { kDeviceTypeGPU, "NVIDIA", 12, 5 },
+  { kDeviceTypeAll, "default", 17, 1 },
+};
+constexpr uint16_t XgemmDirectComplexSingleIndex[] = {
+  0, 0, 13, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 10, 15, 0, 6, 9,
+  12, 17, 18, 0, 0, 0, 0, 0, 8, 11, 0, 0, 0, 0, 4, 0, 0, 0, 0, 2, 0, 0, 0, 0, 16, 0, 0, 0, 14, 1, 0, 0,
+};
+constexpr Database::StaticEntry XgemmDirectComplexSingle = {
+  "XgemmDirect", Precision::kComplexSingle, XgemmDirectParameters, 10,
+  XgemmDirectComplexSingleDevices, XgemmDirectComplexSingleVendors, 5, XgemmDirectComplexSingleIndex, 64
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemmDirectDouble = {
-  "XgemmDirect", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Ellesmere",                                       { {"KWID",8}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",1}, {"WGD",32} } },
-        { "Fiji",                                            { {"KWID",16}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Tonga",                                           { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",4}, {"WGD",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",4}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",4}, {"VWND",4}, {"WGD",32} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 1080",                                { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
-        { "GeForce GTX 750 Ti",                              { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",4}, {"WGD",32} } },
-        { "GeForce GTX TITAN Black",                         { {"KWID",8}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",1}, {"PADB",0}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "TITAN X (Pascal)",                                { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",16} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemmDirectDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 2, 16, 16, 8, 8, 1, 1, 1, 1, 16 } },
+  { "Ellesmere",                                       { 8, 16, 16, 8, 16, 1, 1, 2, 1, 32 } },
+  { "Fiji",                                            { 16, 8, 8, 8, 16, 1, 1, 1, 1, 16 } },
+  { "Tonga",                                           { 2, 16, 16, 16, 16, 1, 1, 1, 1, 32 } },
+  { "default",                                         { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 2, 8, 8, 8, 8, 1, 1, 4, 4, 32 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 2, 8, 8, 8, 8, 1, 1, 4, 4, 32 } },
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 4, 4, 32 } },
+  // NVIDIA GPUs
+  { "GeForce GTX 1080",                                { 2, 16, 16, 8, 8, 1, 1, 1, 2, 16 } },
+  { "GeForce GTX 750 Ti",                              { 2, 8, 8, 8, 8, 1, 1, 2, 4, 32 } },
+  { "GeForce GTX TITAN Black",                         { 8, 16, 16, 16, 8, 1, 0, 1, 1, 16 } },
+  { "TITAN X (Pascal)",                                { 2, 8, 8, 8, 8, 1, 1, 1, 1, 16 } },
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 1, 2, 16 } },
+  // Default
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 2, 2, 16 } },
+};
+constexpr Database::StaticVendor XgemmDirectDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 5 },
+  { kDeviceTypeCPU, "Intel", 5, 3 },
+  { kDeviceTypeGPU, "NVIDIA", 8, 5 },
+  { kDeviceTypeAll, "default", 13, 1 },
+};
+constexpr uint16_t XgemmDirectDoubleIndex[] = {
+  8, 11, 9, 13, 14, 3, 0, 0, 7, 0, 0, 0, 0, 0, 4, 0, 6, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 10, 1, 5, 2,
+};
+constexpr Database::StaticEntry XgemmDirectDouble = {
+  "XgemmDirect", Precision::kDouble, XgemmDirectParameters, 10,
+  XgemmDirectDoubleDevices, XgemmDirectDoubleVendors, 4, XgemmDirectDoubleIndex, 32
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemmDirectComplexDouble = {
-  "XgemmDirect", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Ellesmere",                                       { {"KWID",16}, {"MDIMAD",32}, {"MDIMCD",32}, {"NDIMBD",16}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "Fiji",                                            { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "Tonga",                                           { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",16}, {"NDIMCD",16}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",32}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"KWID",8}, {"MDIMAD",16}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",0}, {"PADB",0}, {"VWMD",2}, {"VWND",2}, {"WGD",32} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",2}, {"VWND",2}, {"WGD",16} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 1080",                                { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-        { "GeForce GTX 750 Ti",                              { {"KWID",2}, {"MDIMAD",32}, {"MDIMCD",32}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",32} } },
-        { "GeForce GTX TITAN Black",                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",8} } },
-        { "TITAN X (Pascal)",                                { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
-        { "default",                                         { {"KWID",2}, {"MDIMAD",16}, {"MDIMCD",16}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",1}, {"WGD",16} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"KWID",2}, {"MDIMAD",8}, {"MDIMCD",8}, {"NDIMBD",8}, {"NDIMCD",8}, {"PADA",1}, {"PADB",1}, {"VWMD",1}, {"VWND",2}, {"WGD",16} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemmDirectComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+  { "Ellesmere",                                       { 16, 32, 32, 16, 8, 0, 0, 1, 1, 32 } },
+  { "Fiji",                                            { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+  { "Tonga",                                           { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+  { "default",                                         { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 2, 8, 8, 32, 8, 0, 0, 1, 1, 32 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 8, 16, 8, 8, 8, 0, 0, 2, 2, 32 } },
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 2, 2, 16 } },
+  // NVIDIA GPUs
+  { "GeForce GTX 1080",                                { 2, 16, 16, 8, 8, 1, 1, 1, 1, 16 } },
+  { "GeForce GTX 750 Ti",                              { 2, 32, 32, 8, 8, 1, 1, 1, 1, 32 } },
+  { "GeForce GTX TITAN Black",                         { 2, 8, 8, 8, 8, 1, 1, 1, 1, 8 } },
+  { "TITAN X (Pascal)",                                { 2, 16, 16, 8, 8, 1, 1, 1, 2, 16 } },
+  { "default",                                         { 2, 16, 16, 8, 8, 1, 1, 1, 1, 16 } },
+  // Default
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 1, 2, 16 } },
+};
+constexpr Database::StaticVendor XgemmDirectComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 5 },
+  { kDeviceTypeCPU, "Intel", 5, 3 },
+  { kDeviceTypeGPU, "NVIDIA", 8, 5 },
+  { kDeviceTypeAll, "default", 13, 1 },
+};
+constexpr uint16_t XgemmDirectComplexDoubleIndex[] = {
+  8, 11, 9, 13, 14, 3, 0, 0, 7, 0, 0, 0, 0, 0, 4, 0, 6, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 10, 1, 5, 2,
+};
+constexpr Database::StaticEntry XgemmDirectComplexDouble = {
+  "XgemmDirect", Precision::kComplexDouble, XgemmDirectParameters, 10,
+  XgemmDirectComplexDoubleDevices, XgemmDirectComplexDoubleVendors, 4, XgemmDirectComplexDoubleIndex, 32
 };
 
 // =================================================================================================
@@ -0,0 +1,126 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Database generator <database.py>
+//
+// This file populates the database with best-found tuning parameters for the 'XgemmQuantized' kernels.
+//
+// =================================================================================================
+
+namespace clblast {
+namespace database {
+// =================================================================================================
+
+constexpr const char* XgemmQuantizedParameters[] = {
+  "KWID", "MDIMAD", "MDIMCD", "NDIMBD", "NDIMCD", "PADA", "PADB", "VWMD", "VWND", "WGD"
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemmQuantizedHalfDevices[] = {
+  // Default
+  { "default",                                         { 2, 16, 16, 16, 16, 1, 1, 1, 1, 16 } },
+};
+constexpr Database::StaticVendor XgemmQuantizedHalfVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgemmQuantizedHalfIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgemmQuantizedHalf = {
+  "XgemmQuantized", Precision::kHalf, XgemmQuantizedParameters, 10,
+  XgemmQuantizedHalfDevices, XgemmQuantizedHalfVendors, 1, XgemmQuantizedHalfIndex, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemmQuantizedBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 4, 1, 32 } },
+};
+constexpr Database::StaticVendor XgemmQuantizedBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgemmQuantizedBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgemmQuantizedBFloat16 = {
+  "XgemmQuantized", Precision::kBFloat16, XgemmQuantizedParameters, 10,
+  XgemmQuantizedBFloat16Devices, XgemmQuantizedBFloat16Vendors, 1, XgemmQuantizedBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemmQuantizedSingleDevices[] = {
+  // Default
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 4, 1, 32 } },
+};
+constexpr Database::StaticVendor XgemmQuantizedSingleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgemmQuantizedSingleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgemmQuantizedSingle = {
+  "XgemmQuantized", Precision::kSingle, XgemmQuantizedParameters, 10,
+  XgemmQuantizedSingleDevices, XgemmQuantizedSingleVendors, 1, XgemmQuantizedSingleIndex, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemmQuantizedComplexSingleDevices[] = {
+  // Default
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 1, 1, 16 } },
+};
+constexpr Database::StaticVendor XgemmQuantizedComplexSingleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgemmQuantizedComplexSingleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgemmQuantizedComplexSingle = {
+  "XgemmQuantized", Precision::kComplexSingle, XgemmQuantizedParameters, 10,
+  XgemmQuantizedComplexSingleDevices, XgemmQuantizedComplexSingleVendors, 1, XgemmQuantizedComplexSingleIndex, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemmQuantizedDoubleDevices[] = {
+  // Default
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 2, 1, 16 } },
+};
+constexpr Database::StaticVendor XgemmQuantizedDoubleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgemmQuantizedDoubleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgemmQuantizedDouble = {
+  "XgemmQuantized", Precision::kDouble, XgemmQuantizedParameters, 10,
+  XgemmQuantizedDoubleDevices, XgemmQuantizedDoubleVendors, 1, XgemmQuantizedDoubleIndex, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemmQuantizedComplexDoubleDevices[] = {
+  // Default
+  { "default",                                         { 2, 8, 8, 8, 8, 1, 1, 1, 1, 16 } },
+};
+constexpr Database::StaticVendor XgemmQuantizedComplexDoubleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgemmQuantizedComplexDoubleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgemmQuantizedComplexDouble = {
+  "XgemmQuantized", Precision::kComplexDouble, XgemmQuantizedParameters, 10,
+  XgemmQuantizedComplexDoubleDevices, XgemmQuantizedComplexDoubleVendors, 1, XgemmQuantizedComplexDoubleIndex, 2
+};
+
+// =================================================================================================
+} // namespace database
+} // namespace clblast
@@ -15,279 +15,297 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvHalf = {
-  "Xgemv", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"WGS1",256}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",256}, {"WPT1",1} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",256}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-  }
+constexpr const char* XgemvParameters[] = {
+  "WGS1", "WPT1"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvSingle = {
-  "Xgemv", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",128}, {"WPT1",1} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",32}, {"WPT1",1} } },
-        { "Ellesmere",                                       { {"WGS1",256}, {"WPT1",1} } },
-        { "Fiji",                                            { {"WGS1",128}, {"WPT1",1} } },
-        { "Hawaii",                                          { {"WGS1",128}, {"WPT1",1} } },
-        { "Oland",                                           { {"WGS1",128}, {"WPT1",1} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WPT1",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WPT1",1} } },
-        { "Tonga",                                           { {"WGS1",128}, {"WPT1",2} } },
-        { "Turks",                                           { {"WGS1",32}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",128}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",64}, {"WPT1",4} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",4} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",256}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",256}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",32}, {"WPT1",1} } },
-        { "Iris",                                            { {"WGS1",64}, {"WPT1",2} } },
-        { "Iris Pro",                                        { {"WGS1",128}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX 1070",                                { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 670",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 680",                                 { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX 750",                                 { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX 980",                                 { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",256}, {"WPT1",1} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "Tesla K20m",                                      { {"WGS1",128}, {"WPT1",1} } },
-        { "Tesla K40m",                                      { {"WGS1",256}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",256}, {"WPT1",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 256, 1 } },
+  { "default",                                         { 256, 1 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 64, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 256, 1 } },
+  { "default",                                         { 64, 1 } },
+  // Default
+  { "default",                                         { 64, 1 } },
+};
+constexpr Database::StaticVendor XgemvHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 3 },
+  { kDeviceTypeAll, "default", 5, 1 },
+};
+constexpr uint16_t XgemvHalfIndex[] = {
+  3, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry XgemvHalf = {
+  "Xgemv", Precision::kHalf, XgemvParameters, 2,
+  XgemvHalfDevices, XgemvHalfVendors, 3, XgemvHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemvBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 128, 1 } },
+};
+constexpr Database::StaticVendor XgemvBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgemvBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgemvBFloat16 = {
+  "Xgemv", Precision::kBFloat16, XgemvParameters, 2,
+  XgemvBFloat16Devices, XgemvBFloat16Vendors, 1, XgemvBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemvSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 128, 1 } },
+  { "ATI Radeon HD 6750M",                             { 32, 1 } },
+  { "Ellesmere",                                       { 256, 1 } },
+  { "Fiji",                                            { 128, 1 } },
+  { "Hawaii",                                          { 128, 1 } },
+  { "Oland",                                           { 128, 1 } },
+  { "Pitcairn",                                        { 256, 1 } },
+  { "Tahiti",                                          { 256, 1 } },
+  { "Tonga",                                           { 128, 2 } },
+  { "Turks",                                           { 32, 1 } },
+  { "default",                                         { 128, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 128, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 64, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 64, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 64, 4 } },
+  { "default",                                         { 64, 4 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 256, 1 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 64, 1 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 64, 1 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 256, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 32, 1 } },
+  { "Iris",                                            { 64, 2 } },
+  { "Iris Pro",                                        { 128, 1 } },
+  { "default",                                         { 128, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 64, 1 } },
+  { "default",                                         { 64, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 256, 1 } },
+  { "GeForce GTX 1070",                                { 128, 1 } },
+  { "GeForce GTX 1080",                                { 32, 1 } },
+  { "GeForce GTX 480",                                 { 64, 1 } },
+  { "GeForce GTX 670",                                 { 64, 1 } },
+  { "GeForce GTX 680",                                 { 256, 1 } },
+  { "GeForce GTX 750",                                 { 256, 1 } },
+  { "GeForce GTX 750 Ti",                              { 32, 1 } },
+  { "GeForce GTX 980",                                 { 128, 1 } },
+  { "GeForce GTX TITAN",                               { 256, 1 } },
+  { "GeForce GTX TITAN Black",                         { 256, 1 } },
+  { "GeForce GTX TITAN X",                             { 256, 1 } },
+  { "TITAN X (Pascal)",                                { 32, 1 } },
+  { "Tesla K20m",                                      { 128, 1 } },
+  { "Tesla K40m",                                      { 256, 1 } },
+  { "default",                                         { 256, 1 } },
+  // Default
+  { "default",                                         { 128, 1 } },
+};
+constexpr Database::StaticVendor XgemvSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeCPU, "Intel", 11, 5 },
+  { kDeviceTypeGPU, "Intel", 16, 8 },
+  { kDeviceTypeAccelerator, "Intel", 24, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 26, 16 },
+  { kDeviceTypeAll, "default", 42, 1 },
+};
+constexpr uint16_t XgemvSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 21, 37, 17, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 32, 15, 0, 0, 0, 41, 30, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 39, 0, 8, 0, 0, 1, 27, 36,
+  0, 0, 29, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 35, 0, 12, 0, 0, 0, 0, 0, 10, 0, 0, 33, 0, 0, 0, 0, 11, 3,
+  6, 14, 16, 24, 26, 19, 28, 31, 42, 7, 20, 23, 43, 0, 9, 0, 5, 0, 0, 2, 13, 0, 40, 0, 0, 0, 0, 0, 34, 0, 0, 0,
+};
+constexpr Database::StaticEntry XgemvSingle = {
+  "Xgemv", Precision::kSingle, XgemvParameters, 2,
+  XgemvSingleDevices, XgemvSingleVendors, 6, XgemvSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvComplexSingle = {
-  "Xgemv", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WPT1",1} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",64}, {"WPT1",1} } },
-        { "Ellesmere",                                       { {"WGS1",32}, {"WPT1",1} } },
-        { "Fiji",                                            { {"WGS1",32}, {"WPT1",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WPT1",1} } },
-        { "Oland",                                           { {"WGS1",64}, {"WPT1",1} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WPT1",1} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WPT1",1} } },
-        { "Tonga",                                           { {"WGS1",32}, {"WPT1",1} } },
-        { "Turks",                                           { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",32}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",128}, {"WPT1",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",64}, {"WPT1",4} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",2} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",128}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",256}, {"WPT1",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",64}, {"WPT1",1} } },
-        { "Iris",                                            { {"WGS1",256}, {"WPT1",1} } },
-        { "Iris Pro",                                        { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX 1070",                                { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 670",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 680",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 750",                                 { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",32}, {"WPT1",1} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 64, 1 } },
+  { "ATI Radeon HD 6750M",                             { 64, 1 } },
+  { "Ellesmere",                                       { 32, 1 } },
+  { "Fiji",                                            { 32, 1 } },
+  { "Hawaii",                                          { 64, 1 } },
+  { "Oland",                                           { 64, 1 } },
+  { "Pitcairn",                                        { 64, 1 } },
+  { "Tahiti",                                          { 64, 1 } },
+  { "Tonga",                                           { 32, 1 } },
+  { "Turks",                                           { 64, 1 } },
+  { "default",                                         { 64, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 32, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 128, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 64, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 64, 4 } },
+  { "default",                                         { 64, 2 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 64, 1 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 64, 1 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 128, 1 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 256, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 64, 1 } },
+  { "Iris",                                            { 256, 1 } },
+  { "Iris Pro",                                        { 64, 1 } },
+  { "default",                                         { 64, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 64, 1 } },
+  { "default",                                         { 64, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 256, 1 } },
+  { "GeForce GTX 1070",                                { 64, 1 } },
+  { "GeForce GTX 1080",                                { 32, 1 } },
+  { "GeForce GTX 480",                                 { 64, 1 } },
+  { "GeForce GTX 670",                                 { 64, 1 } },
+  { "GeForce GTX 680",                                 { 64, 1 } },
+  { "GeForce GTX 750",                                 { 128, 1 } },
+  { "GeForce GTX 750 Ti",                              { 32, 1 } },
+  { "GeForce GTX TITAN",                               { 256, 1 } },
+  { "GeForce GTX TITAN Black",                         { 32, 1 } },
+  { "TITAN X (Pascal)",                                { 32, 1 } },
+  { "default",                                         { 64, 1 } },
+  // Default
+  { "default",                                         { 64, 1 } },
+};
+constexpr Database::StaticVendor XgemvComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeCPU, "Intel", 11, 5 },
+  { kDeviceTypeGPU, "Intel", 16, 8 },
+  { kDeviceTypeAccelerator, "Intel", 24, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 26, 12 },
+  { kDeviceTypeAll, "default", 38, 1 },
+};
+constexpr uint16_t XgemvComplexSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 21, 36, 17, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 32, 15, 0, 0, 0, 0, 30, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 37, 0, 8, 0, 0, 1, 27, 35,
+  0, 0, 29, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 10, 0, 0, 33, 0, 0, 0, 0, 11, 3,
+  6, 14, 16, 24, 26, 19, 28, 31, 38, 7, 20, 23, 39, 0, 9, 0, 5, 0, 0, 2, 13, 0, 0, 0, 0, 0, 0, 0, 34, 0, 0, 0,
+};
+constexpr Database::StaticEntry XgemvComplexSingle = {
+  "Xgemv", Precision::kComplexSingle, XgemvParameters, 2,
+  XgemvComplexSingleDevices, XgemvComplexSingleVendors, 6, XgemvComplexSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvDouble = {
-  "Xgemv", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WPT1",1} } },
-        { "Ellesmere",                                       { {"WGS1",32}, {"WPT1",1} } },
-        { "Fiji",                                            { {"WGS1",32}, {"WPT1",1} } },
-        { "Hawaii",                                          { {"WGS1",128}, {"WPT1",1} } },
-        { "Oland",                                           { {"WGS1",256}, {"WPT1",1} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WPT1",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WPT1",1} } },
-        { "Tonga",                                           { {"WGS1",32}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",256}, {"WPT1",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",64}, {"WPT1",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",64}, {"WPT1",4} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",4} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 1070",                                { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX 670",                                 { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 750",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX 980",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",256}, {"WPT1",1} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",32}, {"WPT1",1} } },
-        { "GeForce GTX TITAN X",                             { {"WGS1",64}, {"WPT1",1} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",32}, {"WPT1",1} } },
-        { "Tesla K20m",                                      { {"WGS1",256}, {"WPT1",1} } },
-        { "Tesla K40m",                                      { {"WGS1",256}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 64, 1 } },
+  { "Ellesmere",                                       { 32, 1 } },
+  { "Fiji",                                            { 32, 1 } },
+  { "Hawaii",                                          { 128, 1 } },
+  { "Oland",                                           { 256, 1 } },
+  { "Pitcairn",                                        { 256, 1 } },
+  { "Tahiti",                                          { 256, 1 } },
+  { "Tonga",                                           { 32, 1 } },
+  { "default",                                         { 256, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 64, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 64, 2 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 64, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 64, 4 } },
+  { "default",                                         { 64, 4 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 64, 1 } },
+  { "default",                                         { 64, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 128, 1 } },
+  { "GeForce GTX 1070",                                { 64, 1 } },
+  { "GeForce GTX 1080",                                { 32, 1 } },
+  { "GeForce GTX 480",                                 { 256, 1 } },
+  { "GeForce GTX 670",                                 { 128, 1 } },
+  { "GeForce GTX 680",                                 { 128, 1 } },
+  { "GeForce GTX 750",                                 { 64, 1 } },
+  { "GeForce GTX 750 Ti",                              { 32, 1 } },
+  { "GeForce GTX 980",                                 { 64, 1 } },
+  { "GeForce GTX TITAN",                               { 256, 1 } },
+  { "GeForce GTX TITAN Black",                         { 32, 1 } },
+  { "GeForce GTX TITAN X",                             { 64, 1 } },
+  { "TITAN X (Pascal)",                                { 32, 1 } },
+  { "Tesla K20m",                                      { 256, 1 } },
+  { "Tesla K40m",                                      { 256, 1 } },
+  { "default",                                         { 128, 1 } },
+  // Default
+  { "default",                                         { 128, 1 } },
+};
+constexpr Database::StaticVendor XgemvDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeCPU, "Intel", 9, 5 },
+  { kDeviceTypeAccelerator, "Intel", 14, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 16, 16 },
+  { kDeviceTypeAll, "default", 32, 1 },
+};
+constexpr uint16_t XgemvDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 27, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 22, 13, 0, 0, 0, 31, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 7, 0, 0, 1, 17, 26,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 9, 2,
+  5, 12, 14, 16, 21, 18, 32, 33, 0, 6, 0, 0, 0, 0, 8, 0, 4, 0, 0, 11, 0, 0, 30, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+};
+constexpr Database::StaticEntry XgemvDouble = {
+  "Xgemv", Precision::kDouble, XgemvParameters, 2,
+  XgemvDoubleDevices, XgemvDoubleVendors, 5, XgemvDoubleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvComplexDouble = {
-  "Xgemv", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WPT1",1} } },
-        { "Ellesmere",                                       { {"WGS1",32}, {"WPT1",1} } },
-        { "Fiji",                                            { {"WGS1",64}, {"WPT1",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WPT1",1} } },
-        { "Oland",                                           { {"WGS1",256}, {"WPT1",1} } },
-        { "Pitcairn",                                        { {"WGS1",256}, {"WPT1",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WPT1",1} } },
-        { "Tonga",                                           { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",64}, {"WPT1",1} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"WGS1",64}, {"WPT1",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",32}, {"WPT1",4} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",4} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"WGS1",64}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WPT1",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WPT1",1} } },
-        { "GeForce GTX 670",                                 { {"WGS1",128}, {"WPT1",1} } },
-        { "default",                                         { {"WGS1",128}, {"WPT1",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WPT1",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 64, 1 } },
+  { "Ellesmere",                                       { 32, 1 } },
+  { "Fiji",                                            { 64, 1 } },
+  { "Hawaii",                                          { 64, 1 } },
+  { "Oland",                                           { 256, 1 } },
+  { "Pitcairn",                                        { 256, 1 } },
+  { "Tahiti",                                          { 256, 1 } },
+  { "Tonga",                                           { 64, 1 } },
+  { "default",                                         { 64, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 64, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 64, 1 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 64, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 32, 4 } },
+  { "default",                                         { 64, 4 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 64, 1 } },
+  { "default",                                         { 64, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 128, 1 } },
+  { "GeForce GTX 480",                                 { 64, 1 } },
+  { "GeForce GTX 670",                                 { 128, 1 } },
+  { "default",                                         { 128, 1 } },
+  // Default
+  { "default",                                         { 64, 1 } },
+};
+constexpr Database::StaticVendor XgemvComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeCPU, "Intel", 9, 5 },
+  { kDeviceTypeAccelerator, "Intel", 14, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 16, 4 },
+  { kDeviceTypeAll, "default", 20, 1 },
+};
+constexpr uint16_t XgemvComplexDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 9, 2,
+  5, 12, 14, 16, 19, 20, 21, 0, 13, 6, 0, 0, 0, 18, 8, 0, 4, 0, 0, 11, 0, 0, 0, 0, 0, 0, 7, 0, 0, 1, 17, 0,
+};
+constexpr Database::StaticEntry XgemvComplexDouble = {
+  "Xgemv", Precision::kComplexDouble, XgemvParameters, 2,
+  XgemvComplexDoubleDevices, XgemvComplexDoubleVendors, 5, XgemvComplexDoubleIndex, 64
 };
 
 // =================================================================================================
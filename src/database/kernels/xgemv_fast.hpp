@@ -15,273 +15,291 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvFastHalf = {
-  "XgemvFast", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW2",4}, {"WGS2",64}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-      }
-    },
-  }
+constexpr const char* XgemvFastParameters[] = {
+  "VW2", "WGS2", "WPT2"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvFastSingle = {
-  "XgemvFast", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "ATI Radeon HD 6750M",                             { {"VW2",2}, {"WGS2",64}, {"WPT2",2} } },
-        { "Ellesmere",                                       { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Fiji",                                            { {"VW2",1}, {"WGS2",64}, {"WPT2",2} } },
-        { "Hawaii",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Oland",                                           { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Pitcairn",                                        { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tahiti",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tonga",                                           { {"VW2",1}, {"WGS2",16}, {"WPT2",4} } },
-        { "Turks",                                           { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW2",1}, {"WGS2",32}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW2",4}, {"WGS2",128}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW2",1}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW2",2}, {"WGS2",16}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",4} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW2",4}, {"WGS2",128}, {"WPT2",4} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW2",1}, {"WGS2",64}, {"WPT2",2} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "Iris",                                            { {"VW2",1}, {"WGS2",128}, {"WPT2",2} } },
-        { "Iris Pro",                                        { {"VW2",4}, {"WGS2",64}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",2}, {"WGS2",256}, {"WPT2",2} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW2",2}, {"WGS2",256}, {"WPT2",2} } },
-        { "GeForce GTX 1070",                                { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX 1080",                                { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 480",                                 { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 670",                                 { {"VW2",2}, {"WGS2",256}, {"WPT2",2} } },
-        { "GeForce GTX 680",                                 { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 750",                                 { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX 750 Ti",                              { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "GeForce GTX 980",                                 { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX TITAN",                               { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX TITAN Black",                         { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX TITAN X",                             { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "TITAN X (Pascal)",                                { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tesla K20m",                                      { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "Tesla K40m",                                      { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvFastHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 1, 32, 1 } },
+  { "default",                                         { 1, 32, 1 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 1, 16, 1 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 4, 64, 4 } },
+  { "default",                                         { 1, 16, 1 } },
+  // Default
+  { "default",                                         { 1, 16, 1 } },
+};
+constexpr Database::StaticVendor XgemvFastHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 3 },
+  { kDeviceTypeAll, "default", 5, 1 },
+};
+constexpr uint16_t XgemvFastHalfIndex[] = {
+  3, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry XgemvFastHalf = {
+  "XgemvFast", Precision::kHalf, XgemvFastParameters, 3,
+  XgemvFastHalfDevices, XgemvFastHalfVendors, 3, XgemvFastHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemvFastBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 1, 64, 1 } },
+};
+constexpr Database::StaticVendor XgemvFastBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgemvFastBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgemvFastBFloat16 = {
+  "XgemvFast", Precision::kBFloat16, XgemvFastParameters, 3,
+  XgemvFastBFloat16Devices, XgemvFastBFloat16Vendors, 1, XgemvFastBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemvFastSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 1, 128, 1 } },
+  { "ATI Radeon HD 6750M",                             { 2, 64, 2 } },
+  { "Ellesmere",                                       { 1, 64, 1 } },
+  { "Fiji",                                            { 1, 64, 2 } },
+  { "Hawaii",                                          { 1, 64, 1 } },
+  { "Oland",                                           { 1, 64, 1 } },
+  { "Pitcairn",                                        { 1, 64, 1 } },
+  { "Tahiti",                                          { 1, 64, 1 } },
+  { "Tonga",                                           { 1, 16, 4 } },
+  { "Turks",                                           { 1, 256, 1 } },
+  { "default",                                         { 1, 64, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 1, 32, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 4, 128, 4 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 1, 64, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 2, 16, 4 } },
+  { "default",                                         { 1, 64, 4 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 1, 256, 1 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 2, 32, 2 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 4, 128, 4 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 1, 64, 2 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 2, 32, 2 } },
+  { "Iris",                                            { 1, 128, 2 } },
+  { "Iris Pro",                                        { 4, 64, 4 } },
+  { "default",                                         { 2, 256, 2 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 1, 64, 1 } },
+  { "default",                                         { 1, 64, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 2, 256, 2 } },
+  { "GeForce GTX 1070",                                { 1, 256, 1 } },
+  { "GeForce GTX 1080",                                { 1, 128, 1 } },
+  { "GeForce GTX 480",                                 { 1, 128, 1 } },
+  { "GeForce GTX 670",                                 { 2, 256, 2 } },
+  { "GeForce GTX 680",                                 { 1, 128, 1 } },
+  { "GeForce GTX 750",                                 { 1, 256, 1 } },
+  { "GeForce GTX 750 Ti",                              { 2, 32, 2 } },
+  { "GeForce GTX 980",                                 { 1, 256, 1 } },
+  { "GeForce GTX TITAN",                               { 1, 256, 1 } },
+  { "GeForce GTX TITAN Black",                         { 1, 256, 1 } },
+  { "GeForce GTX TITAN X",                             { 1, 64, 1 } },
+  { "TITAN X (Pascal)",                                { 1, 64, 1 } },
+  { "Tesla K20m",                                      { 1, 256, 1 } },
+  { "Tesla K40m",                                      { 1, 256, 1 } },
+  { "default",                                         { 1, 256, 1 } },
+  // Default
+  { "default",                                         { 1, 64, 1 } },
+};
+constexpr Database::StaticVendor XgemvFastSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeCPU, "Intel", 11, 5 },
+  { kDeviceTypeGPU, "Intel", 16, 8 },
+  { kDeviceTypeAccelerator, "Intel", 24, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 26, 16 },
+  { kDeviceTypeAll, "default", 42, 1 },
+};
+constexpr uint16_t XgemvFastSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 21, 37, 17, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 32, 15, 0, 0, 0, 41, 30, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 39, 0, 8, 0, 0, 1, 27, 36,
+  0, 0, 29, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 35, 0, 12, 0, 0, 0, 0, 0, 10, 0, 0, 33, 0, 0, 0, 0, 11, 3,
+  6, 14, 16, 24, 26, 19, 28, 31, 42, 7, 20, 23, 43, 0, 9, 0, 5, 0, 0, 2, 13, 0, 40, 0, 0, 0, 0, 0, 34, 0, 0, 0,
+};
+constexpr Database::StaticEntry XgemvFastSingle = {
+  "XgemvFast", Precision::kSingle, XgemvFastParameters, 3,
+  XgemvFastSingleDevices, XgemvFastSingleVendors, 6, XgemvFastSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvFastComplexSingle = {
-  "XgemvFast", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW2",2}, {"WGS2",256}, {"WPT2",2} } },
-        { "ATI Radeon HD 6750M",                             { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "Ellesmere",                                       { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Fiji",                                            { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-        { "Hawaii",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Oland",                                           { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Pitcairn",                                        { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tahiti",                                          { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "Tonga",                                           { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "Turks",                                           { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW2",2}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW2",1}, {"WGS2",128}, {"WPT2",2} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW2",4}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW2",4}, {"WGS2",16}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",2} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"VW2",2}, {"WGS2",128}, {"WPT2",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW2",1}, {"WGS2",32}, {"WPT2",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW2",2}, {"WGS2",128}, {"WPT2",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW2",1}, {"WGS2",32}, {"WPT2",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-        { "Iris",                                            { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Iris Pro",                                        { {"VW2",4}, {"WGS2",128}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX 1070",                                { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX 480",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX 670",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX 680",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvFastComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 2, 256, 2 } },
+  { "ATI Radeon HD 6750M",                             { 1, 128, 1 } },
+  { "Ellesmere",                                       { 1, 64, 1 } },
+  { "Fiji",                                            { 1, 16, 1 } },
+  { "Hawaii",                                          { 1, 64, 1 } },
+  { "Oland",                                           { 1, 64, 1 } },
+  { "Pitcairn",                                        { 1, 64, 1 } },
+  { "Tahiti",                                          { 1, 128, 1 } },
+  { "Tonga",                                           { 2, 32, 2 } },
+  { "Turks",                                           { 1, 16, 1 } },
+  { "default",                                         { 1, 64, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 2, 64, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 1, 128, 2 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 4, 64, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 4, 16, 4 } },
+  { "default",                                         { 1, 64, 2 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 2, 128, 2 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 1, 32, 2 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 2, 128, 2 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 1, 32, 4 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 1, 32, 1 } },
+  { "Iris",                                            { 1, 64, 1 } },
+  { "Iris Pro",                                        { 4, 128, 4 } },
+  { "default",                                         { 1, 64, 1 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 1, 64, 1 } },
+  { "default",                                         { 1, 64, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 1, 256, 1 } },
+  { "GeForce GTX 1070",                                { 1, 64, 1 } },
+  { "GeForce GTX 480",                                 { 1, 64, 1 } },
+  { "GeForce GTX 670",                                 { 1, 64, 1 } },
+  { "GeForce GTX 680",                                 { 1, 64, 1 } },
+  { "default",                                         { 1, 64, 1 } },
+  // Default
+  { "default",                                         { 1, 64, 1 } },
+};
+constexpr Database::StaticVendor XgemvFastComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeCPU, "Intel", 11, 5 },
+  { kDeviceTypeGPU, "Intel", 16, 8 },
+  { kDeviceTypeAccelerator, "Intel", 24, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 26, 6 },
+  { kDeviceTypeAll, "default", 32, 1 },
+};
+constexpr uint16_t XgemvFastComplexSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 21, 0, 17, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 31, 15, 0, 0, 0, 0, 29, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 1, 27, 0,
+  0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 11, 3,
+  6, 14, 16, 24, 26, 19, 28, 30, 32, 7, 20, 23, 33, 0, 9, 0, 5, 0, 0, 2, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+constexpr Database::StaticEntry XgemvFastComplexSingle = {
+  "XgemvFast", Precision::kComplexSingle, XgemvFastParameters, 3,
+  XgemvFastComplexSingleDevices, XgemvFastComplexSingleVendors, 6, XgemvFastComplexSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvFastDouble = {
-  "XgemvFast", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "Ellesmere",                                       { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "Fiji",                                            { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-        { "Hawaii",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Oland",                                           { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Pitcairn",                                        { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tahiti",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tonga",                                           { {"VW2",2}, {"WGS2",32}, {"WPT2",2} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW2",1}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW2",4}, {"WGS2",128}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW2",1}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW2",1}, {"WGS2",16}, {"WPT2",4} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",4} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX 1070",                                { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX 1080",                                { {"VW2",1}, {"WGS2",32}, {"WPT2",2} } },
-        { "GeForce GTX 480",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX 670",                                 { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 680",                                 { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 750",                                 { {"VW2",2}, {"WGS2",256}, {"WPT2",2} } },
-        { "GeForce GTX 750 Ti",                              { {"VW2",1}, {"WGS2",32}, {"WPT2",2} } },
-        { "GeForce GTX 980",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX TITAN",                               { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX TITAN Black",                         { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "GeForce GTX TITAN X",                             { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "TITAN X (Pascal)",                                { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-        { "Tesla K20m",                                      { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "Tesla K40m",                                      { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvFastDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 1, 256, 1 } },
+  { "Ellesmere",                                       { 1, 128, 1 } },
+  { "Fiji",                                            { 1, 32, 1 } },
+  { "Hawaii",                                          { 1, 64, 1 } },
+  { "Oland",                                           { 1, 64, 1 } },
+  { "Pitcairn",                                        { 1, 64, 1 } },
+  { "Tahiti",                                          { 1, 64, 1 } },
+  { "Tonga",                                           { 2, 32, 2 } },
+  { "default",                                         { 1, 64, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 1, 64, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 4, 128, 4 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 1, 64, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 1, 16, 4 } },
+  { "default",                                         { 1, 64, 4 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 1, 64, 1 } },
+  { "default",                                         { 1, 64, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 1, 256, 1 } },
+  { "GeForce GTX 1070",                                { 1, 256, 1 } },
+  { "GeForce GTX 1080",                                { 1, 32, 2 } },
+  { "GeForce GTX 480",                                 { 1, 64, 1 } },
+  { "GeForce GTX 670",                                 { 1, 128, 1 } },
+  { "GeForce GTX 680",                                 { 1, 128, 1 } },
+  { "GeForce GTX 750",                                 { 2, 256, 2 } },
+  { "GeForce GTX 750 Ti",                              { 1, 32, 2 } },
+  { "GeForce GTX 980",                                 { 1, 64, 1 } },
+  { "GeForce GTX TITAN",                               { 1, 256, 1 } },
+  { "GeForce GTX TITAN Black",                         { 1, 256, 1 } },
+  { "GeForce GTX TITAN X",                             { 1, 128, 1 } },
+  { "TITAN X (Pascal)",                                { 1, 32, 1 } },
+  { "Tesla K20m",                                      { 1, 128, 1 } },
+  { "Tesla K40m",                                      { 1, 256, 1 } },
+  { "default",                                         { 1, 256, 1 } },
+  // Default
+  { "default",                                         { 1, 64, 1 } },
+};
+constexpr Database::StaticVendor XgemvFastDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeCPU, "Intel", 9, 5 },
+  { kDeviceTypeAccelerator, "Intel", 14, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 16, 16 },
+  { kDeviceTypeAll, "default", 32, 1 },
+};
+constexpr uint16_t XgemvFastDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 27, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 22, 13, 0, 0, 0, 31, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 7, 0, 0, 1, 17, 26,
+  0, 0, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 9, 2,
+  5, 12, 14, 16, 21, 18, 32, 33, 0, 6, 0, 0, 0, 0, 8, 0, 4, 0, 0, 11, 0, 0, 30, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+};
+constexpr Database::StaticEntry XgemvFastDouble = {
+  "XgemvFast", Precision::kDouble, XgemvFastParameters, 3,
+  XgemvFastDoubleDevices, XgemvFastDoubleVendors, 5, XgemvFastDoubleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvFastComplexDouble = {
-  "XgemvFast", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "Ellesmere",                                       { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-        { "Fiji",                                            { {"VW2",1}, {"WGS2",16}, {"WPT2",1} } },
-        { "Hawaii",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Oland",                                           { {"VW2",1}, {"WGS2",256}, {"WPT2",1} } },
-        { "Pitcairn",                                        { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tahiti",                                          { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "Tonga",                                           { {"VW2",1}, {"WGS2",32}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW2",4}, {"WGS2",32}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"VW2",2}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { {"VW2",4}, {"WGS2",64}, {"WPT2",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW2",1}, {"WGS2",16}, {"WPT2",2} } },
-        { "default",                                         { {"VW2",4}, {"WGS2",64}, {"WPT2",4} } },
-      }
-    },
-    { // Intel accelerators
-      kDeviceTypeAccelerator, "Intel", {
-        { "Intel(R) Many Integrated Core Acceleration Card", { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"VW2",1}, {"WGS2",128}, {"WPT2",1} } },
-        { "GeForce GTX 480",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "GeForce GTX 670",                                 { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW2",1}, {"WGS2",64}, {"WPT2",1} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvFastComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 1, 256, 1 } },
+  { "Ellesmere",                                       { 1, 16, 1 } },
+  { "Fiji",                                            { 1, 16, 1 } },
+  { "Hawaii",                                          { 1, 64, 1 } },
+  { "Oland",                                           { 1, 256, 1 } },
+  { "Pitcairn",                                        { 1, 64, 1 } },
+  { "Tahiti",                                          { 1, 64, 1 } },
+  { "Tonga",                                           { 1, 32, 1 } },
+  { "default",                                         { 1, 64, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 32, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 2, 64, 4 } },
+  { "Intel(R) Core(TM) i7-3770 CPU @ 3.40GHz",         { 4, 64, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 1, 16, 2 } },
+  { "default",                                         { 4, 64, 4 } },
+  // Intel accelerators
+  { "Intel(R) Many Integrated Core Acceleration Card", { 1, 64, 1 } },
+  { "default",                                         { 1, 64, 1 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 1, 128, 1 } },
+  { "GeForce GTX 480",                                 { 1, 64, 1 } },
+  { "GeForce GTX 670",                                 { 1, 64, 1 } },
+  { "default",                                         { 1, 64, 1 } },
+  // Default
+  { "default",                                         { 1, 64, 1 } },
+};
+constexpr Database::StaticVendor XgemvFastComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeCPU, "Intel", 9, 5 },
+  { kDeviceTypeAccelerator, "Intel", 14, 2 },
+  { kDeviceTypeGPU, "NVIDIA", 16, 4 },
+  { kDeviceTypeAll, "default", 20, 1 },
+};
+constexpr uint16_t XgemvFastComplexDoubleIndex[] = {
+  0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 9, 2,
+  5, 12, 14, 16, 19, 20, 21, 0, 13, 6, 0, 0, 0, 18, 8, 0, 4, 0, 0, 11, 0, 0, 0, 0, 0, 0, 7, 0, 0, 1, 17, 0,
+};
+constexpr Database::StaticEntry XgemvFastComplexDouble = {
+  "XgemvFast", Precision::kComplexDouble, XgemvFastParameters, 3,
+  XgemvFastComplexDoubleDevices, XgemvFastComplexDoubleVendors, 5, XgemvFastComplexDoubleIndex, 64
 };
 
 // =================================================================================================
@@ -15,186 +15,208 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvFastRotHalf = {
-  "XgemvFastRot", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW3",8}, {"WGS3",128}, {"WPT3",32} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",128}, {"WPT3",32} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW3",8}, {"WGS3",128}, {"WPT3",32} } },
-      }
-    },
-  }
+constexpr const char* XgemvFastRotParameters[] = {
+  "VW3", "WGS3", "WPT3"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvFastRotSingle = {
-  "XgemvFastRot", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW3",8}, {"WGS3",64}, {"WPT3",32} } },
-        { "ATI Radeon HD 6750M",                             { {"VW3",8}, {"WGS3",128}, {"WPT3",16} } },
-        { "Ellesmere",                                       { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "Fiji",                                            { {"VW3",4}, {"WGS3",32}, {"WPT3",16} } },
-        { "Tonga",                                           { {"VW3",8}, {"WGS3",128}, {"WPT3",32} } },
-        { "Turks",                                           { {"VW3",8}, {"WGS3",128}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW3",8}, {"WGS3",16}, {"WPT3",8} } },
-        { "default",                                         { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW3",8}, {"WGS3",64}, {"WPT3",32} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW3",4}, {"WGS3",64}, {"WPT3",16} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW3",2}, {"WGS3",32}, {"WPT3",16} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW3",4}, {"WGS3",64}, {"WPT3",16} } },
-        { "Iris Pro",                                        { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",4}, {"WGS3",64}, {"WPT3",16} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 1080",                                { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "GeForce GTX 750 Ti",                              { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "GeForce GTX TITAN",                               { {"VW3",1}, {"WGS3",16}, {"WPT3",16} } },
-        { "GeForce GTX TITAN Black",                         { {"VW3",4}, {"WGS3",128}, {"WPT3",16} } },
-        { "TITAN X (Pascal)",                                { {"VW3",8}, {"WGS3",64}, {"WPT3",32} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvFastRotHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 8, 32, 32 } },
+  { "default",                                         { 8, 32, 32 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 8, 128, 32 } },
+  { "default",                                         { 8, 128, 32 } },
+  // Default
+  { "default",                                         { 8, 128, 32 } },
+};
+constexpr Database::StaticVendor XgemvFastRotHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 2 },
+  { kDeviceTypeAll, "default", 4, 1 },
+};
+constexpr uint16_t XgemvFastRotHalfIndex[] = {
+  4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry XgemvFastRotHalf = {
+  "XgemvFastRot", Precision::kHalf, XgemvFastRotParameters, 3,
+  XgemvFastRotHalfDevices, XgemvFastRotHalfVendors, 3, XgemvFastRotHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemvFastRotBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 8, 32, 32 } },
+};
+constexpr Database::StaticVendor XgemvFastRotBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgemvFastRotBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgemvFastRotBFloat16 = {
+  "XgemvFastRot", Precision::kBFloat16, XgemvFastRotParameters, 3,
+  XgemvFastRotBFloat16Devices, XgemvFastRotBFloat16Vendors, 1, XgemvFastRotBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgemvFastRotSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 8, 64, 32 } },
+  { "ATI Radeon HD 6750M",                             { 8, 128, 16 } },
+  { "Ellesmere",                                       { 8, 32, 32 } },
+  { "Fiji",                                            { 4, 32, 16 } },
+  { "Tonga",                                           { 8, 128, 32 } },
+  { "Turks",                                           { 8, 128, 16 } },
+  { "default",                                         { 8, 32, 32 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 32, 32 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 4, 32, 32 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 8, 16, 8 } },
+  { "default",                                         { 4, 32, 32 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 8, 64, 32 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 4, 64, 16 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 2, 32, 16 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 4, 64, 16 } },
+  { "Iris Pro",                                        { 4, 16, 16 } },
+  { "default",                                         { 4, 64, 16 } },
+  // NVIDIA GPUs
+  { "GeForce GTX 1080",                                { 8, 32, 32 } },
+  { "GeForce GTX 750 Ti",                              { 8, 32, 32 } },
+  { "GeForce GTX TITAN",                               { 1, 16, 16 } },
+  { "GeForce GTX TITAN Black",                         { 4, 128, 16 } },
+  { "TITAN X (Pascal)",                                { 8, 64, 32 } },
+  { "default",                                         { 8, 32, 32 } },
+  // Default
+  { "default",                                         { 8, 32, 32 } },
+};
+constexpr Database::StaticVendor XgemvFastRotSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 7 },
+  { kDeviceTypeCPU, "Intel", 7, 4 },
+  { kDeviceTypeGPU, "Intel", 11, 6 },
+  { kDeviceTypeGPU, "NVIDIA", 17, 6 },
+  { kDeviceTypeAll, "default", 23, 1 },
+};
+constexpr uint16_t XgemvFastRotSingleIndex[] = {
+  0, 0, 18, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 15, 21, 0, 7, 3,
+  11, 17, 23, 24, 0, 13, 0, 0, 9, 16, 14, 0, 0, 0, 5, 0, 12, 10, 0, 2, 0, 0, 0, 0, 22, 0, 0, 0, 19, 1, 0, 20,
+};
+constexpr Database::StaticEntry XgemvFastRotSingle = {
+  "XgemvFastRot", Precision::kSingle, XgemvFastRotParameters, 3,
+  XgemvFastRotSingleDevices, XgemvFastRotSingleVendors, 5, XgemvFastRotSingleIndex, 64
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvFastRotComplexSingle = {
-  "XgemvFastRot", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW3",8}, {"WGS3",16}, {"WPT3",16} } },
-        { "ATI Radeon HD 6750M",                             { {"VW3",8}, {"WGS3",32}, {"WPT3",8} } },
-        { "Ellesmere",                                       { {"VW3",2}, {"WGS3",32}, {"WPT3",16} } },
-        { "Fiji",                                            { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Tonga",                                           { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Turks",                                           { {"VW3",4}, {"WGS3",32}, {"WPT3",8} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",16}, {"WPT3",16} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"VW3",2}, {"WGS3",16}, {"WPT3",16} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"VW3",4}, {"WGS3",128}, {"WPT3",8} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"VW3",4}, {"WGS3",32}, {"WPT3",8} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"VW3",4}, {"WGS3",64}, {"WPT3",16} } },
-        { "Iris Pro",                                        { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",2}, {"WGS3",32}, {"WPT3",8} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvFastRotComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 8, 16, 16 } },
+  { "ATI Radeon HD 6750M",                             { 8, 32, 8 } },
+  { "Ellesmere",                                       { 2, 32, 16 } },
+  { "Fiji",                                            { 4, 32, 32 } },
+  { "Tonga",                                           { 4, 32, 32 } },
+  { "Turks",                                           { 4, 32, 8 } },
+  { "default",                                         { 8, 16, 16 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 32, 32 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 4, 32, 32 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 4, 16, 16 } },
+  { "default",                                         { 4, 32, 32 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 2, 16, 16 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 4, 128, 8 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 4, 32, 8 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 4, 64, 16 } },
+  { "Iris Pro",                                        { 4, 16, 16 } },
+  { "default",                                         { 2, 32, 8 } },
+  // Default
+  { "default",                                         { 4, 16, 16 } },
+};
+constexpr Database::StaticVendor XgemvFastRotComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 7 },
+  { kDeviceTypeCPU, "Intel", 7, 4 },
+  { kDeviceTypeGPU, "Intel", 11, 6 },
+  { kDeviceTypeAll, "default", 17, 1 },
+};
+constexpr uint16_t XgemvFastRotComplexSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 15, 0, 0, 7, 3,
+  11, 17, 18, 0, 0, 13, 0, 0, 9, 16, 14, 0, 0, 0, 5, 0, 12, 10, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+};
+constexpr Database::StaticEntry XgemvFastRotComplexSingle = {
+  "XgemvFastRot", Precision::kComplexSingle, XgemvFastRotParameters, 3,
+  XgemvFastRotComplexSingleDevices, XgemvFastRotComplexSingleVendors, 4, XgemvFastRotComplexSingleIndex, 64
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvFastRotDouble = {
-  "XgemvFastRot", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "Ellesmere",                                       { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "Fiji",                                            { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Tonga",                                           { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW3",4}, {"WGS3",32}, {"WPT3",32} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW3",8}, {"WGS3",16}, {"WPT3",8} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GeForce GTX 1080",                                { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "GeForce GTX 750 Ti",                              { {"VW3",4}, {"WGS3",32}, {"WPT3",16} } },
-        { "GeForce GTX TITAN",                               { {"VW3",1}, {"WGS3",16}, {"WPT3",16} } },
-        { "GeForce GTX TITAN Black",                         { {"VW3",1}, {"WGS3",16}, {"WPT3",16} } },
-        { "TITAN X (Pascal)",                                { {"VW3",8}, {"WGS3",32}, {"WPT3",32} } },
-        { "default",                                         { {"VW3",4}, {"WGS3",32}, {"WPT3",16} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvFastRotDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 4, 16, 16 } },
+  { "Ellesmere",                                       { 4, 16, 16 } },
+  { "Fiji",                                            { 4, 32, 32 } },
+  { "Tonga",                                           { 4, 16, 16 } },
+  { "default",                                         { 4, 16, 16 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 4, 32, 32 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 4, 32, 32 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 8, 16, 8 } },
+  { "default",                                         { 8, 32, 32 } },
+  // NVIDIA GPUs
+  { "GeForce GTX 1080",                                { 8, 32, 32 } },
+  { "GeForce GTX 750 Ti",                              { 4, 32, 16 } },
+  { "GeForce GTX TITAN",                               { 1, 16, 16 } },
+  { "GeForce GTX TITAN Black",                         { 1, 16, 16 } },
+  { "TITAN X (Pascal)",                                { 8, 32, 32 } },
+  { "default",                                         { 4, 32, 16 } },
+  // Default
+  { "default",                                         { 4, 16, 16 } },
+};
+constexpr Database::StaticVendor XgemvFastRotDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 5 },
+  { kDeviceTypeCPU, "Intel", 5, 4 },
+  { kDeviceTypeGPU, "NVIDIA", 9, 6 },
+  { kDeviceTypeAll, "default", 15, 1 },
+};
+constexpr uint16_t XgemvFastRotDoubleIndex[] = {
+  9, 12, 10, 13, 15, 3, 16, 0, 7, 0, 0, 0, 0, 0, 4, 0, 6, 8, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 11, 1, 5, 2,
+};
+constexpr Database::StaticEntry XgemvFastRotDouble = {
+  "XgemvFastRot", Precision::kDouble, XgemvFastRotParameters, 3,
+  XgemvFastRotDoubleDevices, XgemvFastRotDoubleVendors, 4, XgemvFastRotDoubleIndex, 32
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgemvFastRotComplexDouble = {
-  "XgemvFastRot", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"VW3",4}, {"WGS3",32}, {"WPT3",16} } },
-        { "Ellesmere",                                       { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-        { "Fiji",                                            { {"VW3",4}, {"WGS3",32}, {"WPT3",8} } },
-        { "Tonga",                                           { {"VW3",4}, {"WGS3",16}, {"WPT3",8} } },
-        { "default",                                         { {"VW3",8}, {"WGS3",32}, {"WPT3",16} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"VW3",2}, {"WGS3",16}, {"WPT3",16} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"VW3",2}, {"WGS3",16}, {"WPT3",16} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"VW3",8}, {"WGS3",16}, {"WPT3",16} } },
-        { "default",                                         { {"VW3",2}, {"WGS3",16}, {"WPT3",16} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"VW3",4}, {"WGS3",16}, {"WPT3",16} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgemvFastRotComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 4, 32, 16 } },
+  { "Ellesmere",                                       { 4, 16, 16 } },
+  { "Fiji",                                            { 4, 32, 8 } },
+  { "Tonga",                                           { 4, 16, 8 } },
+  { "default",                                         { 8, 32, 16 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 2, 16, 16 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 2, 16, 16 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 8, 16, 16 } },
+  { "default",                                         { 2, 16, 16 } },
+  // Default
+  { "default",                                         { 4, 16, 16 } },
+};
+constexpr Database::StaticVendor XgemvFastRotComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 5 },
+  { kDeviceTypeCPU, "Intel", 5, 4 },
+  { kDeviceTypeAll, "default", 9, 1 },
+};
+constexpr uint16_t XgemvFastRotComplexDoubleIndex[] = {
+  9, 10, 0, 0, 0, 3, 0, 0, 7, 0, 0, 0, 0, 0, 4, 0, 6, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 2,
+};
+constexpr Database::StaticEntry XgemvFastRotComplexDouble = {
+  "XgemvFastRot", Precision::kComplexDouble, XgemvFastRotParameters, 3,
+  XgemvFastRotComplexDoubleDevices, XgemvFastRotComplexDoubleVendors, 3, XgemvFastRotComplexDoubleIndex, 32
 };
 
 // =================================================================================================
@@ -15,277 +15,293 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry XgerHalf = {
-  "Xger", Precision::kHalf, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "Ellesmere",                                       { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",64}, {"WGS2",1}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",4}, {"WGS2",8}, {"WPT",2} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
-      }
-    },
-  }
+constexpr const char* XgerParameters[] = {
+  "WGS1", "WGS2", "WPT"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgerSingle = {
-  "Xger", Precision::kSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",256}, {"WGS2",1}, {"WPT",1} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",16}, {"WGS2",16}, {"WPT",4} } },
-        { "Ellesmere",                                       { {"WGS1",64}, {"WGS2",4}, {"WPT",2} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",1}, {"WPT",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WGS2",2}, {"WPT",1} } },
-        { "Oland",                                           { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",256}, {"WGS2",1}, {"WPT",1} } },
-        { "Tonga",                                           { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "Turks",                                           { {"WGS1",64}, {"WGS2",4}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",16}, {"WGS2",16}, {"WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",64}, {"WGS2",4}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",4}, {"WPT",4} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",32}, {"WGS2",4}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",128}, {"WGS2",2}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",256}, {"WGS2",4}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",128}, {"WGS2",1}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",8}, {"WPT",4} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",32}, {"WGS2",1}, {"WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",256}, {"WGS2",2}, {"WPT",2} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",64}, {"WGS2",1}, {"WPT",4} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",32}, {"WGS2",4}, {"WPT",4} } },
-        { "Iris Pro",                                        { {"WGS1",64}, {"WGS2",1}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
-        { "GeForce GTX 1070",                                { {"WGS1",512}, {"WGS2",1}, {"WPT",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",16}, {"WGS2",4}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",256}, {"WGS2",1}, {"WPT",4} } },
-        { "GeForce GTX 670",                                 { {"WGS1",32}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",1}, {"WPT",4} } },
-        { "GeForce GTX 750",                                 { {"WGS1",64}, {"WGS2",16}, {"WPT",4} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",512}, {"WGS2",2}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgerHalfDevices[] = {
+  // AMD GPUs
+  { "Ellesmere",                                       { 64, 1, 2 } },
+  { "default",                                         { 64, 1, 2 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 256, 1, 2 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 64, 1, 4 } },
+  { "default",                                         { 4, 8, 2 } },
+  // Default
+  { "default",                                         { 64, 1, 2 } },
+};
+constexpr Database::StaticVendor XgerHalfVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 2 },
+  { kDeviceTypeGPU, "Intel", 2, 3 },
+  { kDeviceTypeAll, "default", 5, 1 },
+};
+constexpr uint16_t XgerHalfIndex[] = {
+  3, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 2, 1,
+};
+constexpr Database::StaticEntry XgerHalf = {
+  "Xger", Precision::kHalf, XgerParameters, 3,
+  XgerHalfDevices, XgerHalfVendors, 3, XgerHalfIndex, 16
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgerBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 32, 4, 2 } },
+};
+constexpr Database::StaticVendor XgerBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XgerBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XgerBFloat16 = {
+  "Xger", Precision::kBFloat16, XgerParameters, 3,
+  XgerBFloat16Devices, XgerBFloat16Vendors, 1, XgerBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XgerSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 256, 1, 1 } },
+  { "ATI Radeon HD 6750M",                             { 16, 16, 4 } },
+  { "Ellesmere",                                       { 64, 4, 2 } },
+  { "Fiji",                                            { 256, 1, 1 } },
+  { "Hawaii",                                          { 64, 2, 1 } },
+  { "Oland",                                           { 32, 4, 2 } },
+  { "Pitcairn",                                        { 64, 1, 1 } },
+  { "Tahiti",                                          { 256, 1, 1 } },
+  { "Tonga",                                           { 256, 1, 2 } },
+  { "Turks",                                           { 64, 4, 2 } },
+  { "default",                                         { 16, 16, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 64, 4, 4 } },
+  { "default",                                         { 64, 4, 4 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 32, 4, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 128, 2, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 256, 4, 4 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 128, 1, 4 } },
+  { "default",                                         { 128, 8, 4 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 32, 1, 2 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 256, 2, 2 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 128, 1, 2 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 64, 1, 4 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 32, 4, 4 } },
+  { "Iris Pro",                                        { 64, 1, 4 } },
+  { "default",                                         { 32, 4, 2 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 128, 1, 2 } },
+  { "GeForce GTX 1070",                                { 512, 1, 1 } },
+  { "GeForce GTX 1080",                                { 16, 4, 1 } },
+  { "GeForce GTX 480",                                 { 256, 1, 4 } },
+  { "GeForce GTX 670",                                 { 32, 8, 2 } },
+  { "GeForce GTX 680",                                 { 128, 1, 4 } },
+  { "GeForce GTX 750",                                 { 64, 16, 4 } },
+  { "GeForce GTX 750 Ti",                              { 64, 1, 2 } },
+  { "GeForce GTX TITAN",                               { 32, 4, 2 } },
+  { "GeForce GTX TITAN Black",                         { 32, 4, 2 } },
+  { "TITAN X (Pascal)",                                { 512, 2, 1 } },
+  { "default",                                         { 128, 1, 2 } },
+  // Default
+  { "default",                                         { 32, 4, 2 } },
+};
+constexpr Database::StaticVendor XgerSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 5 },
+  { kDeviceTypeGPU, "Intel", 18, 7 },
+  { kDeviceTypeGPU, "NVIDIA", 25, 12 },
+  { kDeviceTypeAll, "default", 37, 1 },
+};
+constexpr uint16_t XgerSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 35, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 31, 16, 0, 0, 0, 0, 29, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 36, 0, 8, 0, 0, 1, 26, 34,
+  0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 32, 0, 0, 0, 0, 11, 3,
+  6, 13, 18, 25, 30, 21, 27, 37, 38, 7, 22, 24, 0, 0, 9, 0, 5, 17, 0, 2, 12, 15, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0,
+};
+constexpr Database::StaticEntry XgerSingle = {
+  "Xger", Precision::kSingle, XgerParameters, 3,
+  XgerSingleDevices, XgerSingleVendors, 6, XgerSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgerComplexSingle = {
-  "Xger", Precision::kComplexSingle, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
-        { "ATI Radeon HD 6750M",                             { {"WGS1",16}, {"WGS2",16}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"WGS1",16}, {"WGS2",8}, {"WPT",2} } },
-        { "Fiji",                                            { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-        { "Hawaii",                                          { {"WGS1",64}, {"WGS2",1}, {"WPT",2} } },
-        { "Oland",                                           { {"WGS1",4}, {"WGS2",8}, {"WPT",1} } },
-        { "Pitcairn",                                        { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WGS2",2}, {"WPT",1} } },
-        { "Tonga",                                           { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Turks",                                           { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",128}, {"WGS2",1}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",1}, {"WPT",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",128}, {"WGS2",2}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",256}, {"WGS2",1}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",256}, {"WGS2",2}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",512}, {"WGS2",4}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",2}, {"WPT",4} } },
-      }
-    },
-    { // Intel GPUs
-      kDeviceTypeGPU, "Intel", {
-        { "Intel(R) HD Graphics 530",                        { {"WGS1",32}, {"WGS2",1}, {"WPT",2} } },
-        { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-        { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { {"WGS1",512}, {"WGS2",1}, {"WPT",1} } },
-        { "Intel(R) HD Graphics IvyBridge M GT2",            { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "Intel(R) HD Graphics Skylake ULT GT2",            { {"WGS1",16}, {"WGS2",1}, {"WPT",1} } },
-        { "Iris Pro",                                        { {"WGS1",16}, {"WGS2",2}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",2}, {"WPT",2} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",64}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX 1070",                                { {"WGS1",16}, {"WGS2",64}, {"WPT",2} } },
-        { "GeForce GTX 1080",                                { {"WGS1",32}, {"WGS2",2}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",128}, {"WGS2",2}, {"WPT",2} } },
-        { "GeForce GTX 670",                                 { {"WGS1",16}, {"WGS2",32}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX 750",                                 { {"WGS1",32}, {"WGS2",16}, {"WPT",4} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",16}, {"WGS2",16}, {"WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",16}, {"WGS2",16}, {"WPT",2} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",32}, {"WGS2",2}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",2}, {"WPT",2} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WGS2",2}, {"WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgerComplexSingleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 64, 4, 1 } },
+  { "ATI Radeon HD 6750M",                             { 16, 16, 1 } },
+  { "Ellesmere",                                       { 16, 8, 2 } },
+  { "Fiji",                                            { 128, 2, 1 } },
+  { "Hawaii",                                          { 64, 1, 2 } },
+  { "Oland",                                           { 4, 8, 1 } },
+  { "Pitcairn",                                        { 128, 2, 1 } },
+  { "Tahiti",                                          { 64, 2, 1 } },
+  { "Tonga",                                           { 64, 1, 1 } },
+  { "Turks",                                           { 128, 2, 1 } },
+  { "default",                                         { 128, 2, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 128, 1, 1 } },
+  { "default",                                         { 128, 1, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 128, 2, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 256, 1, 4 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 256, 2, 4 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 512, 4, 2 } },
+  { "default",                                         { 256, 2, 4 } },
+  // Intel GPUs
+  { "Intel(R) HD Graphics 530",                        { 32, 1, 2 } },
+  { "Intel(R) HD Graphics 5500 BroadWell U-Processor GT2", { 128, 2, 1 } },
+  { "Intel(R) HD Graphics Haswell Ultrabook GT2 Mobile", { 512, 1, 1 } },
+  { "Intel(R) HD Graphics IvyBridge M GT2",            { 256, 1, 2 } },
+  { "Intel(R) HD Graphics Skylake ULT GT2",            { 16, 1, 1 } },
+  { "Iris Pro",                                        { 16, 2, 4 } },
+  { "default",                                         { 128, 2, 2 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 64, 4, 2 } },
+  { "GeForce GTX 1070",                                { 16, 64, 2 } },
+  { "GeForce GTX 1080",                                { 32, 2, 1 } },
+  { "GeForce GTX 480",                                 { 128, 2, 2 } },
+  { "GeForce GTX 670",                                 { 16, 32, 2 } },
+  { "GeForce GTX 680",                                 { 32, 4, 2 } },
+  { "GeForce GTX 750",                                 { 32, 16, 4 } },
+  { "GeForce GTX 750 Ti",                              { 32, 8, 2 } },
+  { "GeForce GTX TITAN",                               { 16, 16, 2 } },
+  { "GeForce GTX TITAN Black",                         { 16, 16, 2 } },
+  { "TITAN X (Pascal)",                                { 32, 2, 1 } },
+  { "default",                                         { 128, 2, 2 } },
+  // Default
+  { "default",                                         { 64, 2, 2 } },
+};
+constexpr Database::StaticVendor XgerComplexSingleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 11 },
+  { kDeviceTypeGPU, "ARM", 11, 2 },
+  { kDeviceTypeCPU, "Intel", 13, 5 },
+  { kDeviceTypeGPU, "Intel", 18, 7 },
+  { kDeviceTypeGPU, "NVIDIA", 25, 12 },
+  { kDeviceTypeAll, "default", 37, 1 },
+};
+constexpr uint16_t XgerComplexSingleIndex[] = {
+  0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 35, 19, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 31, 16, 0, 0, 0, 0, 29, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 36, 0, 8, 0, 0, 1, 26, 34,
+  0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 10, 0, 0, 32, 0, 0, 0, 0, 11, 3,
+  6, 13, 18, 25, 30, 21, 27, 37, 38, 7, 22, 24, 0, 0, 9, 0, 5, 17, 0, 2, 12, 15, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0,
+};
+constexpr Database::StaticEntry XgerComplexSingle = {
+  "Xger", Precision::kComplexSingle, XgerParameters, 3,
+  XgerComplexSingleDevices, XgerComplexSingleVendors, 6, XgerComplexSingleIndex, 128
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgerDouble = {
-  "Xger", Precision::kDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",32}, {"WGS2",4}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"WGS1",64}, {"WGS2",1}, {"WPT",4} } },
-        { "Fiji",                                            { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "Hawaii",                                          { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "Oland",                                           { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",64}, {"WGS2",2}, {"WPT",1} } },
-        { "Tonga",                                           { {"WGS1",8}, {"WGS2",16}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",2}, {"WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",256}, {"WGS2",1}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",512}, {"WGS2",16}, {"WPT",1} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",256}, {"WGS2",4}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",512}, {"WGS2",8}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",1}, {"WPT",4} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",128}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX 1070",                                { {"WGS1",32}, {"WGS2",8}, {"WPT",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",32}, {"WGS2",2}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX 670",                                 { {"WGS1",32}, {"WGS2",32}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",128}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX 750",                                 { {"WGS1",256}, {"WGS2",2}, {"WPT",2} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WGS2",16}, {"WPT",1} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",16}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",32}, {"WGS2",2}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",128}, {"WGS2",1}, {"WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgerDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 32, 4, 1 } },
+  { "Ellesmere",                                       { 64, 1, 4 } },
+  { "Fiji",                                            { 256, 1, 2 } },
+  { "Hawaii",                                          { 32, 4, 2 } },
+  { "Oland",                                           { 128, 1, 2 } },
+  { "Pitcairn",                                        { 64, 1, 1 } },
+  { "Tahiti",                                          { 64, 2, 1 } },
+  { "Tonga",                                           { 8, 16, 2 } },
+  { "default",                                         { 128, 2, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 64, 4, 1 } },
+  { "default",                                         { 64, 4, 1 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 256, 1, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 512, 16, 1 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 256, 4, 4 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 512, 8, 2 } },
+  { "default",                                         { 256, 1, 4 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 128, 8, 2 } },
+  { "GeForce GTX 1070",                                { 32, 8, 1 } },
+  { "GeForce GTX 1080",                                { 32, 2, 1 } },
+  { "GeForce GTX 480",                                 { 32, 4, 2 } },
+  { "GeForce GTX 670",                                 { 32, 32, 2 } },
+  { "GeForce GTX 680",                                 { 128, 4, 2 } },
+  { "GeForce GTX 750",                                 { 256, 2, 2 } },
+  { "GeForce GTX 750 Ti",                              { 32, 16, 1 } },
+  { "GeForce GTX TITAN",                               { 16, 8, 2 } },
+  { "GeForce GTX TITAN Black",                         { 32, 4, 2 } },
+  { "TITAN X (Pascal)",                                { 32, 2, 1 } },
+  { "default",                                         { 128, 1, 2 } },
+  // Default
+  { "default",                                         { 128, 1, 2 } },
+};
+constexpr Database::StaticVendor XgerDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 5 },
+  { kDeviceTypeGPU, "NVIDIA", 16, 12 },
+  { kDeviceTypeAll, "default", 28, 1 },
+};
+constexpr uint16_t XgerDoubleIndex[] = {
+  0, 0, 19, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 26, 0, 9, 2,
+  5, 11, 16, 21, 28, 18, 29, 22, 14, 6, 0, 0, 0, 20, 8, 0, 4, 15, 0, 10, 13, 0, 0, 0, 27, 0, 7, 0, 24, 1, 17, 25,
+};
+constexpr Database::StaticEntry XgerDouble = {
+  "Xger", Precision::kDouble, XgerParameters, 3,
+  XgerDoubleDevices, XgerDoubleVendors, 5, XgerDoubleIndex, 64
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XgerComplexDouble = {
-  "Xger", Precision::kComplexDouble, {
-    { // AMD GPUs
-      kDeviceTypeGPU, "AMD", {
-        { "AMD Radeon R9 M370X Compute Engine",              { {"WGS1",64}, {"WGS2",1}, {"WPT",1} } },
-        { "Ellesmere",                                       { {"WGS1",8}, {"WGS2",16}, {"WPT",1} } },
-        { "Fiji",                                            { {"WGS1",64}, {"WGS2",4}, {"WPT",2} } },
-        { "Hawaii",                                          { {"WGS1",128}, {"WGS2",1}, {"WPT",1} } },
-        { "Oland",                                           { {"WGS1",16}, {"WGS2",16}, {"WPT",2} } },
-        { "Pitcairn",                                        { {"WGS1",64}, {"WGS2",4}, {"WPT",1} } },
-        { "Tahiti",                                          { {"WGS1",32}, {"WGS2",4}, {"WPT",1} } },
-        { "Tonga",                                           { {"WGS1",16}, {"WGS2",4}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",32}, {"WGS2",4}, {"WPT",1} } },
-      }
-    },
-    { // ARM GPUs
-      kDeviceTypeGPU, "ARM", {
-        { "Mali-T628",                                       { {"WGS1",64}, {"WGS2",2}, {"WPT",4} } },
-        { "default",                                         { {"WGS1",64}, {"WGS2",2}, {"WPT",4} } },
-      }
-    },
-    { // Intel CPUs
-      kDeviceTypeCPU, "Intel", {
-        { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { {"WGS1",128}, {"WGS2",4}, {"WPT",4} } },
-        { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { {"WGS1",512}, {"WGS2",4}, {"WPT",2} } },
-        { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { {"WGS1",512}, {"WGS2",2}, {"WPT",2} } },
-        { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-        { "default",                                         { {"WGS1",256}, {"WGS2",1}, {"WPT",2} } },
-      }
-    },
-    { // NVIDIA GPUs
-      kDeviceTypeGPU, "NVIDIA", {
-        { "GRID K520",                                       { {"WGS1",16}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX 1070",                                { {"WGS1",8}, {"WGS2",128}, {"WPT",1} } },
-        { "GeForce GTX 1080",                                { {"WGS1",8}, {"WGS2",4}, {"WPT",1} } },
-        { "GeForce GTX 480",                                 { {"WGS1",64}, {"WGS2",2}, {"WPT",2} } },
-        { "GeForce GTX 670",                                 { {"WGS1",8}, {"WGS2",16}, {"WPT",2} } },
-        { "GeForce GTX 680",                                 { {"WGS1",8}, {"WGS2",16}, {"WPT",1} } },
-        { "GeForce GTX 750",                                 { {"WGS1",8}, {"WGS2",32}, {"WPT",4} } },
-        { "GeForce GTX 750 Ti",                              { {"WGS1",32}, {"WGS2",8}, {"WPT",2} } },
-        { "GeForce GTX TITAN",                               { {"WGS1",32}, {"WGS2",4}, {"WPT",2} } },
-        { "GeForce GTX TITAN Black",                         { {"WGS1",16}, {"WGS2",16}, {"WPT",2} } },
-        { "TITAN X (Pascal)",                                { {"WGS1",4}, {"WGS2",8}, {"WPT",1} } },
-        { "default",                                         { {"WGS1",16}, {"WGS2",8}, {"WPT",2} } },
-      }
-    },
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"WGS1",64}, {"WGS2",2}, {"WPT",2} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XgerComplexDoubleDevices[] = {
+  // AMD GPUs
+  { "AMD Radeon R9 M370X Compute Engine",              { 64, 1, 1 } },
+  { "Ellesmere",                                       { 8, 16, 1 } },
+  { "Fiji",                                            { 64, 4, 2 } },
+  { "Hawaii",                                          { 128, 1, 1 } },
+  { "Oland",                                           { 16, 16, 2 } },
+  { "Pitcairn",                                        { 64, 4, 1 } },
+  { "Tahiti",                                          { 32, 4, 1 } },
+  { "Tonga",                                           { 16, 4, 1 } },
+  { "default",                                         { 32, 4, 1 } },
+  // ARM GPUs
+  { "Mali-T628",                                       { 64, 2, 4 } },
+  { "default",                                         { 64, 2, 4 } },
+  // Intel CPUs
+  { "Intel(R) Core(TM) i7-2670QM CPU @ 2.20GHz",       { 128, 4, 4 } },
+  { "Intel(R) Core(TM) i5-6200U CPU @ 2.30GHz",        { 512, 4, 2 } },
+  { "Intel(R) Core(TM) i7-4790K CPU @ 4.00GHz",        { 512, 2, 2 } },
+  { "Intel(R) Core(TM) i7-5930K CPU @ 3.50GHz",        { 256, 1, 2 } },
+  { "default",                                         { 256, 1, 2 } },
+  // NVIDIA GPUs
+  { "GRID K520",                                       { 16, 8, 2 } },
+  { "GeForce GTX 1070",                                { 8, 128, 1 } },
+  { "GeForce GTX 1080",                                { 8, 4, 1 } },
+  { "GeForce GTX 480",                                 { 64, 2, 2 } },
+  { "GeForce GTX 670",                                 { 8, 16, 2 } },
+  { "GeForce GTX 680",                                 { 8, 16, 1 } },
+  { "GeForce GTX 750",                                 { 8, 32, 4 } },
+  { "GeForce GTX 750 Ti",                              { 32, 8, 2 } },
+  { "GeForce GTX TITAN",                               { 32, 4, 2 } },
+  { "GeForce GTX TITAN Black",                         { 16, 16, 2 } },
+  { "TITAN X (Pascal)",                                { 4, 8, 1 } },
+  { "default",                                         { 16, 8, 2 } },
+  // Default
+  { "default",                                         { 64, 2, 2 } },
+};
+constexpr Database::StaticVendor XgerComplexDoubleVendors[] = {
+  { kDeviceTypeGPU, "AMD", 0, 9 },
+  { kDeviceTypeGPU, "ARM", 9, 2 },
+  { kDeviceTypeCPU, "Intel", 11, 5 },
+  { kDeviceTypeGPU, "NVIDIA", 16, 12 },
+  { kDeviceTypeAll, "default", 28, 1 },
+};
+constexpr uint16_t XgerComplexDoubleIndex[] = {
+  0, 0, 19, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 26, 0, 9, 2,
+  5, 11, 16, 21, 28, 18, 29, 22, 14, 6, 0, 0, 0, 20, 8, 0, 4, 15, 0, 10, 13, 0, 0, 0, 27, 0, 7, 0, 24, 1, 17, 25,
+};
+constexpr Database::StaticEntry XgerComplexDouble = {
+  "Xger", Precision::kComplexDouble, XgerParameters, 3,
+  XgerComplexDoubleDevices, XgerComplexDoubleVendors, 5, XgerComplexDoubleIndex, 64
 };
 
 // =================================================================================================
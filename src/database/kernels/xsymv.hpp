@@ -0,0 +1,126 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Database generator <database.py>
+//
+// This file populates the database with best-found tuning parameters for the 'Xsymv' kernels.
+//
+// =================================================================================================
+
+namespace clblast {
+namespace database {
+// =================================================================================================
+
+constexpr const char* XsymvParameters[] = {
+  "WGS1", "WGS2", "WPT1"
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XsymvHalfDevices[] = {
+  // Default
+  { "default",                                         { 32, 64, 1 } },
+};
+constexpr Database::StaticVendor XsymvHalfVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XsymvHalfIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XsymvHalf = {
+  "Xsymv", Precision::kHalf, XsymvParameters, 3,
+  XsymvHalfDevices, XsymvHalfVendors, 1, XsymvHalfIndex, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XsymvBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 32, 64, 1 } },
+};
+constexpr Database::StaticVendor XsymvBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XsymvBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XsymvBFloat16 = {
+  "Xsymv", Precision::kBFloat16, XsymvParameters, 3,
+  XsymvBFloat16Devices, XsymvBFloat16Vendors, 1, XsymvBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XsymvSingleDevices[] = {
+  // Default
+  { "default",                                         { 32, 64, 1 } },
+};
+constexpr Database::StaticVendor XsymvSingleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XsymvSingleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XsymvSingle = {
+  "Xsymv", Precision::kSingle, XsymvParameters, 3,
+  XsymvSingleDevices, XsymvSingleVendors, 1, XsymvSingleIndex, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XsymvComplexSingleDevices[] = {
+  // Default
+  { "default",                                         { 32, 64, 1 } },
+};
+constexpr Database::StaticVendor XsymvComplexSingleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XsymvComplexSingleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XsymvComplexSingle = {
+  "Xsymv", Precision::kComplexSingle, XsymvParameters, 3,
+  XsymvComplexSingleDevices, XsymvComplexSingleVendors, 1, XsymvComplexSingleIndex, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XsymvDoubleDevices[] = {
+  // Default
+  { "default",                                         { 32, 64, 1 } },
+};
+constexpr Database::StaticVendor XsymvDoubleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XsymvDoubleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XsymvDouble = {
+  "Xsymv", Precision::kDouble, XsymvParameters, 3,
+  XsymvDoubleDevices, XsymvDoubleVendors, 1, XsymvDoubleIndex, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XsymvComplexDoubleDevices[] = {
+  // Default
+  { "default",                                         { 32, 64, 1 } },
+};
+constexpr Database::StaticVendor XsymvComplexDoubleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XsymvComplexDoubleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XsymvComplexDouble = {
+  "Xsymv", Precision::kComplexDouble, XsymvParameters, 3,
+  XsymvComplexDoubleDevices, XsymvComplexDoubleVendors, 1, XsymvComplexDoubleIndex, 2
+};
+
+// =================================================================================================
+} // namespace database
+} // namespace clblast
@@ -5,7 +5,7 @@
 // width of 100 characters per line.
 //
 // Author(s):
-//   Cedric Nugteren <www.cedricnugteren.nl>
+//   Database generator <database.py>
 //
 // This file populates the database with best-found tuning parameters for the 'Xtrsv' kernels.
 //
@@ -15,62 +15,110 @@ namespace clblast {
 namespace database {
 // =================================================================================================
 
-const Database::DatabaseEntry XtrsvHalf = {
-  "Xtrsv", Precision::kHalf, {
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
-      }
-    },
-  }
+constexpr const char* XtrsvParameters[] = {
+  "TRSV_BLOCK_SIZE"
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XtrsvSingle = {
-  "Xtrsv", Precision::kSingle, {
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XtrsvHalfDevices[] = {
+  // Default
+  { "default",                                         { 32 } },
+};
+constexpr Database::StaticVendor XtrsvHalfVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XtrsvHalfIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XtrsvHalf = {
+  "Xtrsv", Precision::kHalf, XtrsvParameters, 1,
+  XtrsvHalfDevices, XtrsvHalfVendors, 1, XtrsvHalfIndex, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XtrsvBFloat16Devices[] = {
+  // Default
+  { "default",                                         { 32 } },
+};
+constexpr Database::StaticVendor XtrsvBFloat16Vendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XtrsvBFloat16Index[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XtrsvBFloat16 = {
+  "Xtrsv", Precision::kBFloat16, XtrsvParameters, 1,
+  XtrsvBFloat16Devices, XtrsvBFloat16Vendors, 1, XtrsvBFloat16Index, 2
+};
+
+// =================================================================================================
+
+constexpr Database::StaticDevice XtrsvSingleDevices[] = {
+  // Default
+  { "default",                                         { 32 } },
+};
+constexpr Database::StaticVendor XtrsvSingleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XtrsvSingleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XtrsvSingle = {
+  "Xtrsv", Precision::kSingle, XtrsvParameters, 1,
+  XtrsvSingleDevices, XtrsvSingleVendors, 1, XtrsvSingleIndex, 2
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XtrsvComplexSingle = {
-  "Xtrsv", Precision::kComplexSingle, {
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XtrsvComplexSingleDevices[] = {
+  // Default
+  { "default",                                         { 32 } },
+};
+constexpr Database::StaticVendor XtrsvComplexSingleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XtrsvComplexSingleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XtrsvComplexSingle = {
+  "Xtrsv", Precision::kComplexSingle, XtrsvParameters, 1,
+  XtrsvComplexSingleDevices, XtrsvComplexSingleVendors, 1, XtrsvComplexSingleIndex, 2
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XtrsvDouble = {
-  "Xtrsv", Precision::kDouble, {
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XtrsvDoubleDevices[] = {
+  // Default
+  { "default",                                         { 32 } },
+};
+constexpr Database::StaticVendor XtrsvDoubleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XtrsvDoubleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XtrsvDouble = {
+  "Xtrsv", Precision::kDouble, XtrsvParameters, 1,
+  XtrsvDoubleDevices, XtrsvDoubleVendors, 1, XtrsvDoubleIndex, 2
 };
 
 // =================================================================================================
 
-const Database::DatabaseEntry XtrsvComplexDouble = {
-  "Xtrsv", Precision::kComplexDouble, {
-    { // Default
-      kDeviceTypeAll, "default", {
-        { "default",                                         { {"TRSV_BLOCK_SIZE",32} } },
-      }
-    },
-  }
+constexpr Database::StaticDevice XtrsvComplexDoubleDevices[] = {
+  // Default
+  { "default",                                         { 32 } },
+};
+constexpr Database::StaticVendor XtrsvComplexDoubleVendors[] = {
+  { kDeviceTypeAll, "default", 0, 1 },
+};
+constexpr uint16_t XtrsvComplexDoubleIndex[] = {
+  1, 0,
+};
+constexpr Database::StaticEntry XtrsvComplexDouble = {
+  "Xtrsv", Precision::kComplexDouble, XtrsvParameters, 1,
+  XtrsvComplexDoubleDevices, XtrsvComplexDoubleVendors, 1, XtrsvComplexDoubleIndex, 2
 };
 
 // =================================================================================================
@@ -0,0 +1,207 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the multi-queue dispatchers (see the header for more information).
+//
+// =================================================================================================
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <atomic>
+
+#include "dispatcher.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+// A call dispatched to one of the queues with its estimated cost (only tracked for the least-loaded
+// policy). The marker is recorded right after the call (when the next call is dispatched or when
+// joining) and completes with the call.
+struct DispatchedCall {
+  size_t cost;
+  bool has_marker;
+  Event marker;
+};
+
+// The queues of a dispatcher and the calls which might still be running on them
+struct Dispatcher {
+  Dispatch policy;
+  std::vector<Queue> queues;
+  std::vector<std::deque<DispatchedCall>> calls;
+  size_t next_queue;
+  size_t last_queue;
+};
+
+struct Dispatchers {
+  std::mutex mutex;
+  std::map<cl_command_queue, Dispatcher> dispatchers;
+  std::atomic<bool> any{false}; // to skip locking the mutex when there are no dispatchers
+};
+
+Dispatchers& AllDispatchers() {
+  static Dispatchers dispatchers;
+  return dispatchers;
+}
+
+// Value of 'last_queue' when no call has been dispatched since the last join
+constexpr auto kNoQueue = static_cast<size_t>(-1);
+
+// Enqueues a marker: an event which completes once all earlier commands on the queue are completed
+void EnqueueMarker(const cl_command_queue queue, cl_event* marker) {
+  #ifdef CL_VERSION_1_2
+    CheckError(clEnqueueMarkerWithWaitList(queue, 0, nullptr, marker));
+  #else
+    CheckError(clEnqueueMarker(queue, marker));
+  #endif
+}
+
+// Makes all further commands on the queue wait for the given events
+void EnqueueWait(const cl_command_queue queue, const std::vector<cl_event> &events) {
+  #ifdef CL_VERSION_1_2
+    CheckError(clEnqueueBarrierWithWaitList(queue, static_cast<cl_uint>(events.size()),
+                                            events.data(), nullptr));
+  #else
+    CheckError(clEnqueueWaitForEvents(queue, static_cast<cl_uint>(events.size()), events.data()));
+  #endif
+}
+
+bool IsCompleted(const Event &event) {
+  auto status = cl_int{CL_COMPLETE};
+  CheckError(clGetEventInfo(event(), CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(cl_int),
+                            &status, nullptr));
+  return status <= CL_COMPLETE; // negative values denote an error, which ends the command as well
+}
+
+// Records the marker of the most recent call and submits it to the device
+void FinishLastCall(Dispatcher &dispatcher) {
+  if (dispatcher.last_queue == kNoQueue) { return; }
+  const auto &queue = dispatcher.queues[dispatcher.last_queue];
+  if (dispatcher.policy == Dispatch::kLeastLoaded) {
+    auto &call = dispatcher.calls[dispatcher.last_queue].back();
+    EnqueueMarker(queue(), call.marker.pointer());
+    call.has_marker = true;
+  }
+  CheckError(clFlush(queue()));
+  dispatcher.last_queue = kNoQueue;
+}
+
+// Returns the estimated cost of the calls which are still running on the queue with the given index
+size_t QueueLoad(Dispatcher &dispatcher, const size_t index) {
+  auto &calls = dispatcher.calls[index];
+  while (!calls.empty() && calls.front().has_marker && IsCompleted(calls.front().marker)) {
+    calls.pop_front();
+  }
+  auto load = size_t{0};
+  for (const auto &call : calls) { load += call.cost; }
+  return load;
+}
+
+// Makes all further commands on the user's queue wait for the calls dispatched so far
+void Join(const cl_command_queue queue, Dispatcher &dispatcher) {
+  FinishLastCall(dispatcher);
+  auto markers = std::vector<Event>();
+  auto marker_events = std::vector<cl_event>();
+  for (const auto &dispatcher_queue : dispatcher.queues) {
+    markers.emplace_back();
+    EnqueueMarker(dispatcher_queue(), markers.back().pointer());
+    CheckError(clFlush(dispatcher_queue()));
+    marker_events.push_back(markers.back()());
+  }
+  EnqueueWait(queue, marker_events);
+  for (auto &calls : dispatcher.calls) { calls.clear(); }
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
+void CreateDispatcher(const cl_command_queue queue, const size_t num_queues,
+                      const Dispatch policy) {
+  auto &all = AllDispatchers();
+  std::lock_guard<std::mutex> lock(all.mutex);
+  const auto existing = all.dispatchers.find(queue);
+  if (existing != all.dispatchers.end()) {
+    Join(queue, existing->second);
+    all.dispatchers.erase(existing);
+  }
+
+  // Creates the new queues on the device and context of the user's queue
+  const auto queue_cpp = Queue(queue);
+  const auto context = queue_cpp.GetContext();
+  const auto device = queue_cpp.GetDevice();
+  auto dispatcher = Dispatcher{policy, {}, {}, 0, kNoQueue};
+  for (auto index = size_t{0}; index < num_queues; ++index) {
+    dispatcher.queues.push_back(Queue(context, device));
+    dispatcher.calls.emplace_back();
+  }
+  all.dispatchers.emplace(queue, std::move(dispatcher));
+  all.any = true;
+}
+
+void JoinDispatcher(const cl_command_queue queue, cl_event* event) {
+  auto &all = AllDispatchers();
+  std::lock_guard<std::mutex> lock(all.mutex);
+  const auto dispatcher = all.dispatchers.find(queue);
+  if (dispatcher != all.dispatchers.end()) { Join(queue, dispatcher->second); }
+  if (event != nullptr) { EnqueueMarker(queue, event); }
+}
+
+void ReleaseDispatcher(const cl_command_queue queue) {
+  auto &all = AllDispatchers();
+  std::lock_guard<std::mutex> lock(all.mutex);
+  const auto dispatcher = all.dispatchers.find(queue);
+  if (dispatcher == all.dispatchers.end()) { return; }
+  Join(queue, dispatcher->second);
+  all.dispatchers.erase(dispatcher); // the queues are released once their commands are completed
+  all.any = !all.dispatchers.empty();
+}
+
+// =================================================================================================
+
+cl_command_queue DispatchQueue(const cl_command_queue queue, const size_t cost) {
+  auto &all = AllDispatchers();
+  if (!all.any) { return queue; }
+  std::lock_guard<std::mutex> lock(all.mutex);
+  const auto dispatcher_entry = all.dispatchers.find(queue);
+  if (dispatcher_entry == all.dispatchers.end()) { return queue; }
+  auto &dispatcher = dispatcher_entry->second;
+  FinishLastCall(dispatcher);
+
+  // Selects the next queue in turn, or the one with the least work still running (in case of a tie
+  // the first one in turn)
+  const auto num_queues = dispatcher.queues.size();
+  auto selected = dispatcher.next_queue;
+  if (dispatcher.policy == Dispatch::kLeastLoaded) {
+    auto selected_load = QueueLoad(dispatcher, selected);
+    for (auto offset = size_t{1}; offset < num_queues; ++offset) {
+      const auto index = (dispatcher.next_queue + offset) % num_queues;
+      const auto load = QueueLoad(dispatcher, index);
+      if (load < selected_load) { selected = index; selected_load = load; }
+    }
+  }
+  dispatcher.next_queue = (selected + 1) % num_queues;
+  dispatcher.last_queue = selected;
+  if (dispatcher.policy == Dispatch::kLeastLoaded) {
+    dispatcher.calls[selected].push_back(DispatchedCall{cost, false, Event()});
+  }
+
+  // The call waits for the commands enqueued on the user's queue so far (e.g. writing its inputs)
+  auto ready = Event();
+  EnqueueMarker(queue, ready.pointer());
+  CheckError(clFlush(queue));
+  EnqueueWait(dispatcher.queues[selected](), {ready()});
+  return dispatcher.queues[selected]();
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,45 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the multi-queue dispatchers: a user's queue can be turned into a dispatcher
+// which owns a number of extra queues on the same device, over which the routine calls made with
+// the user's queue are distributed (see the EnableDispatch, DispatchJoin and DisableDispatch
+// functions). Each dispatched call first waits for the commands enqueued on the user's queue so
+// far, such that data written to the device before the call is always visible to it.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_DISPATCHER_H_
+#define CLBLAST_DISPATCHER_H_
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Turns a queue into a dispatcher with 'num_queues' queues (or changes an existing dispatcher)
+void CreateDispatcher(const cl_command_queue queue, const size_t num_queues,
+                      const Dispatch policy);
+
+// Makes all further commands on the queue wait for the calls dispatched so far. The optional event
+// completes when these calls are completed.
+void JoinDispatcher(const cl_command_queue queue, cl_event* event);
+
+// Joins and removes the dispatcher of the queue (if any)
+void ReleaseDispatcher(const cl_command_queue queue);
+
+// Returns the queue to run a routine call with the given estimated cost on: one of the dispatcher's
+// queues in case 'queue' is a dispatcher, or 'queue' itself otherwise
+cl_command_queue DispatchQueue(const cl_command_queue queue, const size_t cost);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_DISPATCHER_H_
+#endif
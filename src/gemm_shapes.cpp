@@ -0,0 +1,162 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the registry of hot GEMM shapes (see the header for more information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <sstream>
+
+#include "gemm_shapes.hpp"
+#include "routine.hpp"
+#include "cache.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+struct GemmShapes {
+  std::mutex mutex;
+  std::vector<GemmShape> shapes;
+  std::atomic<size_t> num_shapes{0}; // to skip the look-up without locking when empty
+};
+
+GemmShapes& Shapes() {
+  static GemmShapes shapes;
+  return shapes;
+}
+
+// Single-character names of the layout and the transpose options
+char LayoutName(const Layout layout) { return (layout == Layout::kRowMajor) ? 'R' : 'C'; }
+char TransposeName(const Transpose transpose) {
+  switch (transpose) {
+    case Transpose::kNo: return 'N';
+    case Transpose::kYes: return 'T';
+    default: return 'C';
+  }
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
+bool operator==(const GemmShape &lhs, const GemmShape &rhs) {
+  return lhs.layout == rhs.layout && lhs.a_transpose == rhs.a_transpose &&
+         lhs.b_transpose == rhs.b_transpose && lhs.m == rhs.m && lhs.n == rhs.n &&
+         lhs.k == rhs.k && lhs.a_ld == rhs.a_ld && lhs.b_ld == rhs.b_ld && lhs.c_ld == rhs.c_ld;
+}
+
+void RegisterGemmShapeEntry(const GemmShape &shape) {
+  auto &shapes = Shapes();
+  std::lock_guard<std::mutex> lock(shapes.mutex);
+  if (std::find(shapes.shapes.begin(), shapes.shapes.end(), shape) == shapes.shapes.end()) {
+    shapes.shapes.push_back(shape);
+    shapes.num_shapes = shapes.shapes.size();
+  }
+}
+
+void ClearGemmShapeEntries() {
+  auto &shapes = Shapes();
+  {
+    std::lock_guard<std::mutex> lock(shapes.mutex);
+    shapes.shapes.clear();
+    shapes.num_shapes = 0;
+  }
+
+  // Evicts the compiled variants of all routines using the GEMM kernels
+  for (const auto &kernel_name : {"Xgemm", "XgemmDirect"}) {
+    for (const auto &routine_name : Routine::routines_by_kernel.at(kernel_name)) {
+      const auto variant_prefix = Routine::ProgramName(routine_name, "SHAPE_");
+      ProgramCache::Instance().RemoveByPrefix<3>(ProgramKey{nullptr, Precision::kSingle,
+                                                            Numerics::kDefault, variant_prefix});
+      BinaryCache::Instance().RemoveByPrefix<2>(BinaryKey{Precision::kSingle, Numerics::kDefault,
+                                                          variant_prefix, ""});
+    }
+  }
+}
+
+bool IsGemmShapeRegistered(const GemmShape &shape) {
+  auto &shapes = Shapes();
+  if (shapes.num_shapes == 0) { return false; }
+  std::lock_guard<std::mutex> lock(shapes.mutex);
+  return std::find(shapes.shapes.begin(), shapes.shapes.end(), shape) != shapes.shapes.end();
+}
+
+std::vector<GemmShape> RegisteredGemmShapes() {
+  auto &shapes = Shapes();
+  std::lock_guard<std::mutex> lock(shapes.mutex);
+  return shapes.shapes;
+}
+
+// =================================================================================================
+
+std::string GemmShapeName(const GemmShape &shape) {
+  if (shape.m == 0) { return ""; }
+  return std::string{"SHAPE_"} + LayoutName(shape.layout) + "_" +
+         TransposeName(shape.a_transpose) + TransposeName(shape.b_transpose) + "_" +
+         ToString(shape.m) + "_" + ToString(shape.n) + "_" + ToString(shape.k) + "_" +
+         ToString(shape.a_ld) + "_" + ToString(shape.b_ld) + "_" + ToString(shape.c_ld);
+}
+
+bool GemmShapeFromName(const std::string &name, GemmShape &shape) {
+  auto parts = std::vector<std::string>();
+  std::istringstream stream(name);
+  auto part = std::string{};
+  while (std::getline(stream, part, '_')) { parts.push_back(part); }
+  if (parts.size() != 9 || parts[0] != "SHAPE" || parts[1].size() != 1 || parts[2].size() != 2) {
+    return false;
+  }
+  const auto layout_of = [](const char c, Layout &layout) {
+    if (c == 'R') { layout = Layout::kRowMajor; return true; }
+    if (c == 'C') { layout = Layout::kColMajor; return true; }
+    return false;
+  };
+  const auto transpose_of = [](const char c, Transpose &transpose) {
+    if (c == 'N') { transpose = Transpose::kNo; return true; }
+    if (c == 'T') { transpose = Transpose::kYes; return true; }
+    if (c == 'C') { transpose = Transpose::kConjugate; return true; }
+    return false;
+  };
+  auto result = GemmShape{};
+  if (!layout_of(parts[1][0], result.layout) || !transpose_of(parts[2][0], result.a_transpose) ||
+      !transpose_of(parts[2][1], result.b_transpose)) { return false; }
+  auto sizes = std::vector<size_t>();
+  for (auto i = size_t{3}; i < parts.size(); ++i) {
+    if (parts[i].empty() || parts[i].find_first_not_of("0123456789") != std::string::npos) {
+      return false;
+    }
+    sizes.push_back(static_cast<size_t>(std::stoull(parts[i])));
+  }
+  result.m = sizes[0]; result.n = sizes[1]; result.k = sizes[2];
+  result.a_ld = sizes[3]; result.b_ld = sizes[4]; result.c_ld = sizes[5];
+  if (result.m == 0) { return false; }
+  shape = result;
+  return true;
+}
+
+// The kernels receive the sizes and leading dimensions as given to the routine: the layout and the
+// transpose options only select which kernels are used and are thus not needed as defines
+std::string GemmShapeDefines(const GemmShape &shape) {
+  if (shape.m == 0) { return ""; }
+  return "#define GEMM_SHAPE_M " + ToString(shape.m) + "\n" +
+         "#define GEMM_SHAPE_N " + ToString(shape.n) + "\n" +
+         "#define GEMM_SHAPE_K " + ToString(shape.k) + "\n" +
+         "#define GEMM_SHAPE_A_LD " + ToString(shape.a_ld) + "\n" +
+         "#define GEMM_SHAPE_B_LD " + ToString(shape.b_ld) + "\n" +
+         "#define GEMM_SHAPE_C_LD " + ToString(shape.c_ld) + "\n";
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,65 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the registry of hot GEMM shapes (see the RegisterGemmShape function). For a
+// GEMM call of exactly a registered shape, the GEMM kernels are taken from a variant of the routine
+// which is compiled with the sizes and leading dimensions as constants instead of as arguments.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_GEMM_SHAPES_H_
+#define CLBLAST_GEMM_SHAPES_H_
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// The arguments of a GEMM call which define its shape. A shape with 'm' equal to zero is empty.
+struct GemmShape {
+  Layout layout;
+  Transpose a_transpose;
+  Transpose b_transpose;
+  size_t m;
+  size_t n;
+  size_t k;
+  size_t a_ld;
+  size_t b_ld;
+  size_t c_ld;
+};
+bool operator==(const GemmShape &lhs, const GemmShape &rhs);
+
+// Adds a shape to the registry (if not already there) and removes all shapes from the registry,
+// evicting the compiled variants of the removed shapes from the program and binary caches
+void RegisterGemmShapeEntry(const GemmShape &shape);
+void ClearGemmShapeEntries();
+
+// Returns whether or not a shape is registered. This is cheap in case no shapes are registered.
+bool IsGemmShapeRegistered(const GemmShape &shape);
+
+// Returns all registered shapes
+std::vector<GemmShape> RegisteredGemmShapes();
+
+// Returns the name of the routine variant of a shape (e.g. "SHAPE_C_NT_512_256_64_512_256_512") and
+// the extra defines with which it is compiled. Both are empty in case of an empty shape.
+std::string GemmShapeName(const GemmShape &shape);
+std::string GemmShapeDefines(const GemmShape &shape);
+
+// Reconstructs a shape from its variant name (e.g. as recorded in a manifest). Returns false if the
+// name isn't a valid variant name.
+bool GemmShapeFromName(const std::string &name, GemmShape &shape);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_GEMM_SHAPES_H_
+#endif
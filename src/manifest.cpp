@@ -0,0 +1,137 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the manifest of used routines (see the header for more information). Each
+// line of the file holds a single entry in the form of
+// "<routine> <precision> <numerics> <variant|-> <device name>", e.g. "GEMM 32 151 - Tahiti" for a
+// regular routine or "GEMM 32 153 SHAPE_R_NN_64_64_64_64_64_64 Tahiti" for a GEMM shape variant.
+// Lines starting with '#' are comments.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <set>
+#include <mutex>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+
+#include "manifest.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+// The state of the manifest currently being recorded (if any)
+struct ManifestRecorder {
+  std::mutex mutex;
+  bool initialized = false;
+  std::string filename;
+  std::set<std::string> entries; // entries already in the file, as written to the file
+};
+
+ManifestRecorder& Recorder() {
+  static ManifestRecorder recorder;
+  return recorder;
+}
+
+// Per-thread switch to disable recording, e.g. for the warm-up thread
+thread_local bool recording_enabled_for_thread = true;
+
+// Placeholder for an empty variant name in the manifest file
+const auto kNoVariant = std::string{"-"};
+
+// Converts an entry to a line of the manifest file (without newline)
+std::string ManifestLine(const ManifestEntry &entry) {
+  return entry.routine_name + " " + ToString(static_cast<int>(entry.precision)) + " " +
+         ToString(static_cast<int>(entry.numerics)) + " " +
+         (entry.variant_name.empty() ? kNoVariant : entry.variant_name) + " " + entry.device_name;
+}
+
+// Starts recording to the given file (assumes the recorder's mutex is held)
+void OpenManifest(ManifestRecorder &recorder, const std::string &filename) {
+  recorder.initialized = true;
+  recorder.filename = filename;
+  recorder.entries.clear();
+  for (const auto &entry : ReadManifest(filename)) {
+    recorder.entries.insert(ManifestLine(entry));
+  }
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
+std::vector<ManifestEntry> ReadManifest(const std::string &filename) {
+  auto entries = std::vector<ManifestEntry>();
+  std::ifstream file(filename);
+  auto line = std::string{};
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') { continue; }
+    std::istringstream stream(line);
+    auto routine_name = std::string{};
+    auto precision = int{0};
+    auto numerics = int{0};
+    auto variant_name = std::string{};
+    if (!(stream >> routine_name >> precision >> numerics >> variant_name)) {
+      continue; // e.g. a partially written line
+    }
+    if (numerics != static_cast<int>(Numerics::kDefault) &&
+        numerics != static_cast<int>(Numerics::kStrict) &&
+        numerics != static_cast<int>(Numerics::kFast)) { continue; }
+    if (variant_name == kNoVariant) { variant_name = ""; }
+    auto device_name = std::string{};
+    std::getline(stream >> std::ws, device_name);
+    if (device_name.empty()) { continue; }
+    entries.push_back({routine_name, static_cast<Precision>(precision),
+                       static_cast<Numerics>(numerics), variant_name, device_name});
+  }
+  return entries;
+}
+
+void SetManifestFile(const std::string &filename) {
+  auto &recorder = Recorder();
+  std::lock_guard<std::mutex> lock(recorder.mutex);
+  OpenManifest(recorder, filename);
+}
+
+void RecordManifestEntry(const ManifestEntry &entry) {
+  if (!recording_enabled_for_thread) { return; }
+  auto &recorder = Recorder();
+  std::lock_guard<std::mutex> lock(recorder.mutex);
+
+  // Recording is enabled through the environmental variable unless set explicitly before
+  if (!recorder.initialized) {
+    const auto environment_variable = std::getenv("CLBLAST_MANIFEST");
+    OpenManifest(recorder, (environment_variable != nullptr) ? environment_variable : "");
+  }
+  if (recorder.filename.empty()) { return; }
+
+  // Appends the entry to the file if it isn't there already
+  const auto line = ManifestLine(entry);
+  if (recorder.entries.count(line) != 0) { return; }
+  const auto exists = std::ifstream(recorder.filename).good();
+  std::ofstream file(recorder.filename, std::ios::app);
+  if (!file.is_open()) { return; } // recording is best effort, it should never make a routine fail
+  if (!exists) {
+    file << "# CLBlast manifest: <routine> <precision> <numerics> <variant> <device name>" <<
+            std::endl;
+  }
+  file << line << std::endl;
+  recorder.entries.insert(line);
+}
+
+void SetManifestRecordingForThread(const bool enabled) {
+  recording_enabled_for_thread = enabled;
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,56 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the manifest of used routines: a small text file listing the combinations
+// of routine, precision and device used by an application. It can be recorded during a run and
+// used at a next start-up to pre-compile exactly those routines (see the WarmUp function).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_MANIFEST_H_
+#define CLBLAST_MANIFEST_H_
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// A single line of the manifest. The numerics mode and the variant name (e.g. of a GEMM shape,
+// empty for the regular routine) are needed to compile exactly the same program again.
+struct ManifestEntry {
+  std::string routine_name;
+  Precision precision;
+  Numerics numerics;
+  std::string variant_name;
+  std::string device_name;
+};
+
+// Reads all entries from a manifest file
+std::vector<ManifestEntry> ReadManifest(const std::string &filename);
+
+// Starts recording the used routines to a manifest file, or stops recording if the filename is
+// empty. Recording can also be enabled through the CLBLAST_MANIFEST environmental variable.
+void SetManifestFile(const std::string &filename);
+
+// Adds a routine to the manifest file currently being recorded (if any). Routines which are already
+// listed in the file are not added again.
+void RecordManifestEntry(const ManifestEntry &entry);
+
+// Disables (or re-enables) recording for the calling thread, used to make sure that pre-compiling
+// the routines of a manifest doesn't count as using them
+void SetManifestRecordingForThread(const bool enabled);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_MANIFEST_H_
+#endif
@@ -0,0 +1,138 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the per-context memory budget (see the header for more information).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <cstdlib>
+#include <cstdio>
+
+#include "memory_budget.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+namespace {
+
+// Only the most recent fallbacks of a context are kept in case they are never retrieved
+constexpr auto kMaxFallbacksPerContext = size_t{1024};
+
+// The budget and the recorded fallbacks of a context. Contexts without either have no entry.
+struct ContextMemoryState {
+  size_t budget = 0;
+  std::vector<std::string> fallbacks;
+  bool release_callback_checked = false;
+};
+
+struct MemoryBudgets {
+  std::mutex mutex;
+  std::map<cl_context, ContextMemoryState> contexts;
+};
+
+MemoryBudgets& Budgets() {
+  static MemoryBudgets budgets;
+  return budgets;
+}
+
+// Removes the entry of a context which is released, such that a new context which happens to get
+// the same handle doesn't inherit its budget and fallbacks
+void CL_CALLBACK ReleaseContextState(cl_context context, void*) {
+  auto &budgets = Budgets();
+  std::lock_guard<std::mutex> lock(budgets.mutex);
+  budgets.contexts.erase(context);
+}
+
+// Returns the entry of a context, creating it if needed. On OpenCL 3.0 devices the entry is removed
+// automatically once the context is released, otherwise it is removed as soon as it is empty again
+// (see 'EraseIfEmpty'). Must be called with the lock held.
+ContextMemoryState& ContextState(MemoryBudgets &budgets, const cl_context context) {
+  auto &state = budgets.contexts[context];
+  #ifdef CL_VERSION_3_0
+    if (!state.release_callback_checked) {
+      state.release_callback_checked = true;
+      auto bytes = size_t{0};
+      clGetContextInfo(context, CL_CONTEXT_DEVICES, 0, nullptr, &bytes);
+      auto devices = std::vector<cl_device_id>(bytes / sizeof(cl_device_id));
+      if (!devices.empty() &&
+          clGetContextInfo(context, CL_CONTEXT_DEVICES, bytes, devices.data(),
+                           nullptr) == CL_SUCCESS && Device(devices[0]).VersionNumber() >= 300) {
+        clSetContextDestructorCallback(context, ReleaseContextState, nullptr);
+      }
+    }
+  #endif
+  return state;
+}
+
+// Removes the entry of a context in case it has neither a budget nor fallbacks left. Must be called
+// with the lock held.
+void EraseIfEmpty(MemoryBudgets &budgets, const cl_context context) {
+  const auto state = budgets.contexts.find(context);
+  if (state != budgets.contexts.end() && state->second.budget == 0 &&
+      state->second.fallbacks.empty()) {
+    budgets.contexts.erase(state);
+  }
+}
+
+// The default budget as set through the environmental variable (zero if not set or invalid)
+size_t DefaultMemoryBudget() {
+  static const auto budget = []() {
+    const auto environment_variable = std::getenv("CLBLAST_MEMORY_BUDGET");
+    if (environment_variable == nullptr) { return size_t{0}; }
+    return static_cast<size_t>(std::strtoull(environment_variable, nullptr, 10));
+  }();
+  return budget;
+}
+
+} // anonymous namespace
+
+// =================================================================================================
+
+void SetContextMemoryBudget(const cl_context context, const size_t budget) {
+  auto &budgets = Budgets();
+  std::lock_guard<std::mutex> lock(budgets.mutex);
+  ContextState(budgets, context).budget = budget;
+  EraseIfEmpty(budgets, context);
+}
+
+size_t ContextMemoryBudget(const cl_context context) {
+  auto &budgets = Budgets();
+  std::lock_guard<std::mutex> lock(budgets.mutex);
+  const auto state = budgets.contexts.find(context);
+  if (state != budgets.contexts.end() && state->second.budget != 0) { return state->second.budget; }
+  return DefaultMemoryBudget();
+}
+
+void RecordMemoryFallback(const cl_context context, const std::string &description) {
+  #ifdef VERBOSE
+    printf("[DEBUG] Memory budget fallback: %s\n", description.c_str());
+  #endif
+  auto &budgets = Budgets();
+  std::lock_guard<std::mutex> lock(budgets.mutex);
+  auto &fallbacks = ContextState(budgets, context).fallbacks;
+  if (fallbacks.size() == kMaxFallbacksPerContext) { fallbacks.erase(fallbacks.begin()); }
+  fallbacks.push_back(description);
+}
+
+std::vector<std::string> TakeMemoryFallbacks(const cl_context context) {
+  auto &budgets = Budgets();
+  std::lock_guard<std::mutex> lock(budgets.mutex);
+  auto fallbacks = std::vector<std::string>();
+  const auto state = budgets.contexts.find(context);
+  if (state != budgets.contexts.end()) { fallbacks.swap(state->second.fallbacks); }
+  EraseIfEmpty(budgets, context);
+  return fallbacks;
+}
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,45 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the per-context memory budget: the maximum amount of device memory which a
+// single routine call may allocate for its temporary buffers. Routines whose regular temporary
+// buffers would exceed the budget switch to a lower-memory algorithm and record this as a fallback,
+// which can be retrieved afterwards (see the SetMemoryBudget and RetrieveMemoryFallbacks functions).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_MEMORY_BUDGET_H_
+#define CLBLAST_MEMORY_BUDGET_H_
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Sets the memory budget (in bytes) of a context, with zero removing the budget of the context
+void SetContextMemoryBudget(const cl_context context, const size_t budget);
+
+// Returns the memory budget of a context. Contexts without a budget use the value of the
+// CLBLAST_MEMORY_BUDGET environmental variable (if set) or are otherwise unlimited (zero).
+size_t ContextMemoryBudget(const cl_context context);
+
+// Records that a routine used a lower-memory algorithm because of the budget of its context
+void RecordMemoryFallback(const cl_context context, const std::string &description);
+
+// Returns the descriptions of the fallbacks recorded for a context and clears them
+std::vector<std::string> TakeMemoryFallbacks(const cl_context context);
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_MEMORY_BUDGET_H_
+#endif
@@ -15,20 +15,32 @@
 #include <vector>
 #include <chrono>
 #include <cstdlib>
+#include <set>
+#include <mutex>
+#include <condition_variable>
+#include <limits>
 
 #include "routine.hpp"
+#include "manifest.hpp"
+#include "memory_budget.hpp"
 
 namespace clblast {
 // =================================================================================================
 
 // For each kernel this map contains a list of routines it is used in
-const std::vector<std::string> Routine::routines_axpy = {"AXPY", "COPY", "SCAL", "SWAP"};
-const std::vector<std::string> Routine::routines_dot = {"AMAX", "ASUM", "DOT", "DOTC", "DOTU", "MAX", "MIN", "NRM2", "SUM"};
+const std::vector<std::string> Routine::routines_axpy = {"AXPBYPLANAR", "AXPY", "CONVERT16", "CONVERT1632", "CONVERT32", "CONVERT3232", "CONVERT64", "CONVERT6464", "COPY", "GEMMPLANAR", "GEMVPLANAR", "SCAL", "SWAP"};
+const std::vector<std::string> Routine::routines_dot = {"AMAX", "ASUM", "DOT", "DOTC", "DOTU", "GEQRF", "MAX", "MIN", "NRM2", "STATS", "SUM"};
 const std::vector<std::string> Routine::routines_ger = {"GER", "GERC", "GERU", "HER", "HER2", "HPR", "HPR2", "SPR", "SPR2", "SYR", "SYR2"};
-const std::vector<std::string> Routine::routines_gemv = {"GBMV", "GEMV", "HBMV", "HEMV", "HPMV", "SBMV", "SPMV", "SYMV", "TMBV", "TPMV", "TRMV", "TRSV"};
+const std::vector<std::string> Routine::routines_gemv = {"GBMV", "GEMV", "HBMV", "HPMV", "REDUCE", "SBMV", "SPMV", "TBSV", "TMBV", "TPMV", "TPSV", "TRMV", "TRSV"};
+const std::vector<std::string> Routine::routines_symv = {"HEMV", "SYMV"};
 const std::vector<std::string> Routine::routines_gemm = {"GEMM", "HEMM", "SYMM", "TRMM"};
+const std::vector<std::string> Routine::routines_gemm_direct = {"ATTENTION", "GEMM", "GEMMBLOCKSPARSE", "HEMM", "SYMM", "TRMM"};
 const std::vector<std::string> Routine::routines_gemm_syrk = {"GEMM", "HEMM", "HER2K", "HERK", "SYMM", "SYR2K", "SYRK", "TRMM", "TRSM"};
-const std::vector<std::string> Routine::routines_trsm = {"TRSM"};
+const std::vector<std::string> Routine::routines_pad = {"DGMM", "GEMM", "HEMM", "HER2K", "HERK", "SYMM", "SYR2K", "SYRK", "TRMM", "TRSM"};
+const std::vector<std::string> Routine::routines_padtranspose = {"GEAM", "GEMM", "HEMM", "HER2K", "HERK", "SYMM", "SYR2K", "SYRK", "TRMM", "TRSM"};
+const std::vector<std::string> Routine::routines_transpose = {"GEMM", "HEMM", "HER2K", "HERK", "PERMUTE", "SYMM", "SYR2K", "SYRK", "TRMM", "TRSM"};
+const std::vector<std::string> Routine::routines_trsm = {"TRSM", "TRTRI"};
+const std::vector<std::string> Routine::routines_gemm_quantized = {"GEMMQUANTIZED"};
 const std::unordered_map<std::string, const std::vector<std::string>> Routine::routines_by_kernel = {
   {"Xaxpy", routines_axpy},
   {"Xdot", routines_dot},
@@ -36,35 +48,83 @@ const std::unordered_map<std::string, const std::vector<std::string>> Routine::r
   {"XgemvFast", routines_gemv},
   {"XgemvFastRot", routines_gemv},
   {"Xtrsv", routines_gemv},
+  {"Xsymv", routines_symv},
   {"Xger", routines_ger},
   {"Copy", routines_gemm_syrk},
-  {"Pad", routines_gemm_syrk},
-  {"Transpose", routines_gemm_syrk},
-  {"Padtranspose", routines_gemm_syrk},
+  {"Pad", routines_pad},
+  {"Transpose", routines_transpose},
+  {"Padtranspose", routines_padtranspose},
   {"Xgemm", routines_gemm_syrk},
-  {"XgemmDirect", routines_gemm},
+  {"XgemmDirect", routines_gemm_direct},
   {"KernelSelection", routines_gemm},
   {"Invert", routines_trsm},
+  {"XgemmQuantized", routines_gemm_quantized},
 };
 // =================================================================================================
 
+namespace {
+
+// The numerics mode per thread, such that it can be set per call without affecting other threads
+thread_local Numerics thread_numerics = Numerics::kDefault;
+
+// Binaries which are currently being compiled. A routine requiring one of these (e.g. while it is
+// being pre-compiled in the background by the WarmUp function) waits for it instead of compiling
+// it a second time.
+std::mutex compilation_mutex;
+std::condition_variable compilation_finished;
+std::set<BinaryKey> compilations_in_flight;
+
+// Marks a binary as no longer being compiled when going out of scope, also in case of errors
+class CompilationInFlight {
+ public:
+  explicit CompilationInFlight(const BinaryKey &key): key_(key) { }
+  ~CompilationInFlight() {
+    std::lock_guard<std::mutex> lock(compilation_mutex);
+    compilations_in_flight.erase(key_);
+    compilation_finished.notify_all();
+  }
+ private:
+  const BinaryKey key_;
+};
+
+} // anonymous namespace
+
+// =================================================================================================
+
+Numerics Routine::ThreadNumerics() { return thread_numerics; }
+void Routine::SetThreadNumerics(const Numerics numerics) { thread_numerics = numerics; }
+
+std::string Routine::ProgramName(const std::string &routine_name, const std::string &variant_name) {
+  return (variant_name.empty()) ? routine_name : routine_name + "_" + variant_name;
+}
+
 // The constructor does all heavy work, errors are returned as exceptions
 Routine::Routine(Queue &queue, EventPointer event, const std::string &name,
                  const std::vector<std::string> &kernel_names, const Precision precision,
                  const std::vector<Database::DatabaseEntry> &userDatabase,
-                 std::initializer_list<const char *> source):
+                 std::initializer_list<const char *> source,
+                 const std::string &variant_name, const std::string &variant_defines):
     precision_(precision),
     routine_name_(name),
     kernel_names_(kernel_names),
+    program_name_(ProgramName(name, variant_name)),
+    variant_defines_(variant_defines),
     queue_(queue),
     event_(event),
     context_(queue_.GetContext()),
     device_(queue_.GetDevice()),
+    numerics_(ThreadNumerics()),
     device_name_(device_.Name()),
+    non_uniform_work_groups_(false),
+    temp_memory_in_use_(0),
     db_(kernel_names) {
 
   InitDatabase(userDatabase);
   InitProgram(source);
+
+  // Records the routine as used in case a manifest is being recorded
+  RecordManifestEntry(ManifestEntry{routine_name_, precision_, numerics_, variant_name,
+                                    device_name_});
 }
 
 void Routine::InitDatabase(const std::vector<Database::DatabaseEntry> &userDatabase) {
@@ -85,12 +145,6 @@ void Routine::InitDatabase(const std::vector<Database::DatabaseEntry> &userDatab
 
 void Routine::InitProgram(std::initializer_list<const char *> source) {
 
-  // Queries the cache to see whether or not the program (context-specific) is already there
-  bool has_program;
-  program_ = ProgramCache::Instance().Get(ProgramKeyRef{ context_(), precision_, routine_name_ },
-                                          &has_program);
-  if (has_program) { return; }
-
   // Sets the build options from an environmental variable (if set)
   auto options = std::vector<std::string>();
   const auto environment_variable = std::getenv("CLBLAST_BUILD_OPTIONS");
@@ -98,21 +152,59 @@ void Routine::InitProgram(std::initializer_list<const char *> source) {
     options.push_back(std::string(environment_variable));
   }
 
-  // Queries the cache to see whether or not the binary (device-specific) is already there. If it
-  // is, a program is created and stored in the cache
-  bool has_binary;
-  auto binary = BinaryCache::Instance().Get(BinaryKeyRef{ precision_, routine_name_, device_name_ },
-                                            &has_binary);
+  // Compiles for the newest OpenCL C version supported by the device, unless a version is set
+  // explicitly through the build options. This enables e.g. the work-group collective functions.
+  // Non-uniform work-groups are only used when compiling as OpenCL C 2.0 or newer.
+  const auto has_standard = (environment_variable != nullptr) &&
+                            (std::string(environment_variable).find("-cl-std=") !=
+                             std::string::npos);
+  if (!has_standard) {
+    const auto standard = CompilerStandard(device_);
+    options.push_back("-cl-std=" + standard);
+    non_uniform_work_groups_ = (standard != "CL1.1") && device_.SupportsNonUniformWorkGroups();
+  }
+
+  // Relaxes the floating-point accuracy requirements in case of the fast numerics mode. The program
+  // variants of the different modes are stored separately in the caches.
+  if (numerics_ == Numerics::kFast) {
+    options.push_back("-cl-fast-relaxed-math");
+    options.push_back("-cl-mad-enable");
+  }
+
+  // Queries the cache to see whether or not the program (context-specific) is already there
+  bool has_program;
+  program_ = ProgramCache::Instance().Get(ProgramKeyRef{ context_(), precision_, numerics_,
+                                                         program_name_ },
+                                          &has_program);
+  if (has_program) { return; }
+
+  // Queries the cache to see whether or not the binary (device-specific) is already there, waiting
+  // for it in case it is currently being compiled by another thread. If it is, a program is created
+  // and stored in the cache
+  const auto binary_key = BinaryKey{ precision_, numerics_, program_name_, device_name_ };
+  auto has_binary = false;
+  auto binary = std::string{};
+  {
+    std::unique_lock<std::mutex> lock(compilation_mutex);
+    compilation_finished.wait(lock, [&binary_key] {
+      return compilations_in_flight.count(binary_key) == 0;
+    });
+    binary = BinaryCache::Instance().Get(BinaryKeyRef{ precision_, numerics_, program_name_,
+                                                       device_name_ },
+                                         &has_binary);
+    if (!has_binary) { compilations_in_flight.insert(binary_key); }
+  }
   if (has_binary) {
     program_ = Program(device_, context_, binary);
     program_.Build(device_, options);
-    ProgramCache::Instance().Store(ProgramKey{ context_(), precision_, routine_name_ },
+    ProgramCache::Instance().Store(ProgramKey{ context_(), precision_, numerics_, program_name_ },
                                    Program{ program_ });
     return;
   }
 
   // Otherwise, the kernel will be compiled and program will be built. Both the binary and the
   // program will be added to the cache.
+  const CompilationInFlight in_flight(binary_key);
 
   // Inspects whether or not cl_khr_fp64 is supported in case of double precision
   if ((precision_ == Precision::kDouble && !PrecisionSupported<double>(device_)) ||
@@ -135,9 +227,14 @@ void Routine::InitProgram(std::initializer_list<const char *> source) {
   // Adds the name of the routine as a define
   source_string += "#define ROUTINE_"+routine_name_+"\n";
 
+  // Adds the extra defines of the variant (if any)
+  source_string += variant_defines_;
+
   // For specific devices, use the non-IEE754 compilant OpenCL mad() instruction. This can improve
-  // performance, but might result in a reduced accuracy.
-  if (device_.IsAMD() && device_.IsGPU()) {
+  // performance, but might result in a reduced accuracy. It is always used in the fast numerics
+  // mode and never in the strict mode.
+  if ((numerics_ == Numerics::kFast) ||
+      (numerics_ == Numerics::kDefault && device_.IsAMD() && device_.IsGPU())) {
     source_string += "#define USE_CL_MAD 1\n";
   }
 
@@ -165,7 +262,7 @@ void Routine::InitProgram(std::initializer_list<const char *> source) {
   // Prints details of the routine to compile in case of debugging in verbose mode
   #ifdef VERBOSE
     printf("[DEBUG] Compiling routine '%s-%s' for device '%s'\n",
-           routine_name_.c_str(), ToString(precision_).c_str(), device_name_.c_str());
+           program_name_.c_str(), ToString(precision_).c_str(), device_name_.c_str());
     const auto start_time = std::chrono::steady_clock::now();
   #endif
 
@@ -182,10 +279,10 @@ void Routine::InitProgram(std::initializer_list<const char *> source) {
   }
 
   // Store the compiled binary and program in the cache
-  BinaryCache::Instance().Store(BinaryKey{ precision_, routine_name_, device_name_ },
+  BinaryCache::Instance().Store(BinaryKey{ precision_, numerics_, program_name_, device_name_ },
                                 program_.GetIR());
 
-  ProgramCache::Instance().Store(ProgramKey{ context_(), precision_, routine_name_ },
+  ProgramCache::Instance().Store(ProgramKey{ context_(), precision_, numerics_, program_name_ },
                                  Program{ program_ });
 
   // Prints the elapsed compilation time in case of debugging in verbose mode
@@ -196,5 +293,18 @@ void Routine::InitProgram(std::initializer_list<const char *> source) {
   #endif
 }
 
+// =================================================================================================
+
+size_t Routine::MemoryBudgetLeft() const {
+  const auto budget = ContextMemoryBudget(context_());
+  if (budget == 0) { return std::numeric_limits<size_t>::max(); }
+  return (budget > temp_memory_in_use_) ? budget - temp_memory_in_use_ : 0;
+}
+
+void Routine::ReportMemoryFallback(const std::string &description) const {
+  RecordMemoryFallback(context_(), routine_name_ + "-" + ToString(static_cast<int>(precision_)) +
+                                   ": " + description);
+}
+
 // =================================================================================================
 } // namespace clblast
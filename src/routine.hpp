@@ -38,21 +38,37 @@ class Routine {
   // All heavy preparation work is done inside this constructor.
   // NOTE: the caller must provide the same userDatabase for each combination of device, precision
   // and routine list, otherwise the caching logic will break.
+  // The optional variant name and defines compile a variant of the routine's kernels, e.g. one
+  // specialised for a certain shape. Variants are cached separately from the regular routine.
   explicit Routine(Queue &queue, EventPointer event, const std::string &name,
                    const std::vector<std::string> &routines, const Precision precision,
                    const std::vector<Database::DatabaseEntry> &userDatabase,
-                   std::initializer_list<const char *> source);
+                   std::initializer_list<const char *> source,
+                   const std::string &variant_name = "", const std::string &variant_defines = "");
+
+  // The name of the program of a routine (variant) as used in the binary and program caches
+  static std::string ProgramName(const std::string &routine_name, const std::string &variant_name);
 
   // List of kernel-routine look-ups
   static const std::vector<std::string> routines_axpy;
   static const std::vector<std::string> routines_dot;
   static const std::vector<std::string> routines_ger;
   static const std::vector<std::string> routines_gemv;
+  static const std::vector<std::string> routines_symv;
   static const std::vector<std::string> routines_gemm;
+  static const std::vector<std::string> routines_gemm_direct;
   static const std::vector<std::string> routines_gemm_syrk;
+  static const std::vector<std::string> routines_pad;
+  static const std::vector<std::string> routines_padtranspose;
+  static const std::vector<std::string> routines_transpose;
   static const std::vector<std::string> routines_trsm;
+  static const std::vector<std::string> routines_gemm_quantized;
   static const std::unordered_map<std::string, const std::vector<std::string>> routines_by_kernel;
 
+  // The numerics mode for the routines constructed from the calling thread (see SetNumerics)
+  static Numerics ThreadNumerics();
+  static void SetThreadNumerics(const Numerics numerics);
+
  private:
 
   // Initializes program_, fetching cached program or building one
@@ -63,6 +79,13 @@ class Routine {
 
  protected:
 
+  // Returns the amount of device memory (in bytes) which this routine can still use for temporary
+  // buffers within the memory budget of the context, or the maximum value in case of no budget
+  size_t MemoryBudgetLeft() const;
+
+  // Records that this routine switched to a lower-memory algorithm because of the memory budget
+  void ReportMemoryFallback(const std::string &description) const;
+
   // Non-static variable for the precision
   const Precision precision_;
 
@@ -70,15 +93,29 @@ class Routine {
   const std::string routine_name_;
   const std::vector<std::string> kernel_names_;
 
+  // The name of the compiled program and the extra defines of the variant (if any)
+  const std::string program_name_;
+  const std::string variant_defines_;
+
   // The OpenCL objects, accessible only from derived classes
   Queue queue_;
   EventPointer event_;
   const Context context_;
   const Device device_;
 
+  // The numerics mode this routine is compiled for
+  const Numerics numerics_;
+
   // OpenCL device properties
   const std::string device_name_;
 
+  // Whether kernels can be launched with a global size which isn't a multiple of the local size
+  bool non_uniform_work_groups_;
+
+  // Device memory (in bytes) of the temporary buffers currently allocated by this routine, counted
+  // against the memory budget while it calls other parts of itself (e.g. TRMM calling GEMM)
+  size_t temp_memory_in_use_;
+
   // Compiled program (either retrieved from cache or compiled in slow path)
   Program program_;
 
@@ -92,10 +92,12 @@ void PadCopyTransposeMatrix(Queue &queue, const Device &device,
                             const bool upper = false, const bool lower = false,
                             const bool diagonal_imag_zero = false) {
 
-  // Determines whether or not the fast-version could potentially be used
+  // Determines whether or not the fast-version could potentially be used. The fast kernels don't
+  // support bfloat16 storage, as they have no conversions from and to single-precision.
   auto use_fast_kernel = (src_offset == 0) && (dest_offset == 0) && (do_conjugate == false) &&
                          (src_one == dest_one) && (src_two == dest_two) && (src_ld == dest_ld) &&
-                         (upper == false) && (lower == false) && (diagonal_imag_zero == false);
+                         (upper == false) && (lower == false) && (diagonal_imag_zero == false) &&
+                         (PrecisionValue<T>() != Precision::kBFloat16);
 
   // Determines the right kernel
   auto kernel_name = std::string{};
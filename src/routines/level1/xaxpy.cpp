@@ -47,8 +47,11 @@ void Xaxpy<T>::DoAxpy(const size_t n, const T alpha,
   const auto use_faster_kernel = (x_offset == 0) && (x_inc == 1) &&
                                  (y_offset == 0) && (y_inc == 1) &&
                                  IsMultiple(n, db_["WPT"]*db_["VW"]);
-  const auto use_fastest_kernel = use_faster_kernel &&
-                                  IsMultiple(n, db_["WGS"]*db_["WPT"]*db_["VW"]);
+  // With non-uniform work-groups the fastest version (without the bounds check) can be used for
+  // vector sizes that aren't a multiple of the work-group size as well
+  const auto work_per_group = db_["WGS"]*db_["WPT"]*db_["VW"];
+  const auto use_fastest_kernel = use_faster_kernel && n >= work_per_group &&
+                                  (non_uniform_work_groups_ || IsMultiple(n, work_per_group));
 
   // If possible, run the fast-version of the kernel
   const auto kernel_name = (use_fastest_kernel) ? "XaxpyFastest" :
@@ -102,6 +105,7 @@ template class Xaxpy<float>;
 template class Xaxpy<double>;
 template class Xaxpy<float2>;
 template class Xaxpy<double2>;
+template class Xaxpy<bfloat16>;
 
 // =================================================================================================
 } // namespace clblast
@@ -49,9 +49,9 @@ void Xdot<T>::DoDot(const size_t n,
   auto kernel1 = Kernel(program_, "Xdot");
   auto kernel2 = Kernel(program_, "XdotEpilogue");
 
-  // Creates the buffer for intermediate values
+  // Creates the buffer for intermediate values (in single-precision in case of bfloat16)
   auto temp_size = 2*db_["WGS2"];
-  auto temp_buffer = Buffer<T>(context_, temp_size);
+  auto temp_buffer = Buffer<typename ComputeType<T>::Type>(context_, temp_size);
 
   // Sets the kernel arguments
   kernel1.SetArgument(0, static_cast<int>(n));
@@ -93,6 +93,7 @@ template class Xdot<float>;
 template class Xdot<double>;
 template class Xdot<float2>;
 template class Xdot<double2>;
+template class Xdot<bfloat16>;
 
 // =================================================================================================
 } // namespace clblast
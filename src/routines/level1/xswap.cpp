@@ -43,10 +43,13 @@ void Xswap<T>::DoSwap(const size_t n,
   TestVectorX(n, x_buffer, x_offset, x_inc);
   TestVectorY(n, y_buffer, y_offset, y_inc);
 
-  // Determines whether or not the fast-version can be used
+  // Determines whether or not the fast-version can be used. With non-uniform work-groups the
+  // vector size doesn't have to be a multiple of the work-group size.
+  const auto work_per_group = db_["WGS"]*db_["WPT"]*db_["VW"];
+  const auto fast_multiple = (non_uniform_work_groups_) ? db_["WPT"]*db_["VW"] : work_per_group;
   bool use_fast_kernel = (x_offset == 0) && (x_inc == 1) &&
                          (y_offset == 0) && (y_inc == 1) &&
-                         IsMultiple(n, db_["WGS"]*db_["WPT"]*db_["VW"]);
+                         IsMultiple(n, fast_multiple) && n >= work_per_group;
 
   // If possible, run the fast-version of the kernel
   auto kernel_name = (use_fast_kernel) ? "XswapFast" : "Xswap";
@@ -22,7 +22,9 @@ namespace clblast {
 // Constructor: forwards to base class constructor
 template <typename T>
 Xsymv<T>::Xsymv(Queue &queue, EventPointer event, const std::string &name):
-    Xgemv<T>(queue, event, name) {
+    Routine(queue, event, name, {"Xsymv"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level2/xsymv.opencl"
+    }) {
 }
 
 // =================================================================================================
@@ -37,21 +39,86 @@ void Xsymv<T>::DoSymv(const Layout layout, const Triangle triangle,
                       const T beta,
                       const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
 
-  // The data is either in the upper or lower triangle
-  size_t is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
-                     (triangle == Triangle::kLower && layout == Layout::kRowMajor));
-
-  // Runs the generic matrix-vector multiplication, disabling the use of fast vectorized kernels.
-  // The specific symmetric matrix-accesses are implemented in the kernel guarded by the
-  // ROUTINE_SYMV define.
-  bool fast_kernels = false;
-  MatVec(layout, Transpose::kNo,
-         n, n, alpha,
-         a_buffer, a_offset, a_ld,
-         x_buffer, x_offset, x_inc, beta,
-         y_buffer, y_offset, y_inc,
-         fast_kernels, fast_kernels,
-         is_upper, false, 0, 0);
+  // Runs the symmetric matrix-vector multiplication
+  SymMatVec(layout, triangle,
+            n, alpha,
+            a_buffer, a_offset, a_ld,
+            x_buffer, x_offset, x_inc, beta,
+            y_buffer, y_offset, y_inc,
+            false);
+}
+
+// =================================================================================================
+
+// The generic implementation, also suited for hermitian matrices
+template <typename T>
+void Xsymv<T>::SymMatVec(const Layout layout, const Triangle triangle,
+                         const size_t n,
+                         const T alpha,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                         const T beta,
+                         const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                         const bool a_conjugate) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // The data is either in the upper or lower triangle of the column-major view of the matrix
+  const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+
+  // Tests the matrix and the vectors for validity
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+
+  // Retrieves the Xsymv kernels from the compiled binary
+  auto kernel1 = Kernel(program_, "Xsymv");
+  auto kernel2 = Kernel(program_, "XsymvSum");
+
+  // Creates the buffer for the partial results: one slot of 'n_ceiled' values per tile-column
+  const auto block_size = db_["WGS1"] * db_["WPT1"];
+  const auto num_tiles = CeilDiv(n, block_size);
+  const auto n_ceiled = num_tiles * block_size;
+  auto work_buffer = Buffer<T>(context_, num_tiles * n_ceiled);
+
+  // Sets the kernel arguments
+  kernel1.SetArgument(0, static_cast<int>(n));
+  kernel1.SetArgument(1, static_cast<int>(is_upper));
+  kernel1.SetArgument(2, static_cast<int>(a_conjugate));
+  kernel1.SetArgument(3, a_buffer());
+  kernel1.SetArgument(4, static_cast<int>(a_offset));
+  kernel1.SetArgument(5, static_cast<int>(a_ld));
+  kernel1.SetArgument(6, x_buffer());
+  kernel1.SetArgument(7, static_cast<int>(x_offset));
+  kernel1.SetArgument(8, static_cast<int>(x_inc));
+  kernel1.SetArgument(9, work_buffer());
+
+  // Event waiting list
+  auto eventWaitList = std::vector<Event>();
+
+  // Launches the main kernel: a work-group per tile, of which only those of the stored triangle
+  // perform any work
+  auto global1 = std::vector<size_t>{num_tiles * num_tiles * db_["WGS1"]};
+  auto local1 = std::vector<size_t>{db_["WGS1"]};
+  auto kernelEvent = Event();
+  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  eventWaitList.push_back(kernelEvent);
+
+  // Sets the arguments for the summation kernel
+  kernel2.SetArgument(0, static_cast<int>(n));
+  kernel2.SetArgument(1, GetRealArg(alpha));
+  kernel2.SetArgument(2, GetRealArg(beta));
+  kernel2.SetArgument(3, work_buffer());
+  kernel2.SetArgument(4, y_buffer());
+  kernel2.SetArgument(5, static_cast<int>(y_offset));
+  kernel2.SetArgument(6, static_cast<int>(y_inc));
+
+  // Launches the summation kernel
+  auto global2 = std::vector<size_t>{Ceil(n, db_["WGS2"])};
+  auto local2 = std::vector<size_t>{db_["WGS2"]};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
 }
 
 // =================================================================================================
@@ -60,6 +127,8 @@ void Xsymv<T>::DoSymv(const Layout layout, const Triangle triangle,
 template class Xsymv<half>;
 template class Xsymv<float>;
 template class Xsymv<double>;
+template class Xsymv<float2>;
+template class Xsymv<double2>;
 
 // =================================================================================================
 } // namespace clblast
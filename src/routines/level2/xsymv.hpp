@@ -7,28 +7,25 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the Xsymv routine. It is based on the generalized mat-vec multiplication
-// routine (Xgemv). The Xsymv class inherits from the templated class Xgemv, allowing it to call the
-// "MatVec" function directly.
+// This file implements the Xsymv routine. It uses a dedicated blocked kernel which reads only the
+// stored triangle of the matrix, each tile only once. The Xhemv class inherits from this class,
+// allowing it to call the "SymMatVec" function directly.
 //
 // =================================================================================================
 
 #ifndef CLBLAST_ROUTINES_XSYMV_H_
 #define CLBLAST_ROUTINES_XSYMV_H_
 
-#include "routines/level2/xgemv.hpp"
+#include "routine.hpp"
 
 namespace clblast {
 // =================================================================================================
 
 // See comment at top of file for a description of the class
 template <typename T>
-class Xsymv: public Xgemv<T> {
+class Xsymv: public Routine {
  public:
 
-  // Uses the generic matrix-vector routine
-  using Xgemv<T>::MatVec;
-
   // Constructor
   Xsymv(Queue &queue, EventPointer event, const std::string &name = "SYMV");
 
@@ -40,6 +37,17 @@ class Xsymv: public Xgemv<T> {
               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
               const T beta,
               const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
+
+  // Generic symmetric/hermitian matrix-vector multiplication, the specific hermitian accesses are
+  // implemented in the kernel guarded by the ROUTINE_HEMV define
+  void SymMatVec(const Layout layout, const Triangle triangle,
+                 const size_t n,
+                 const T alpha,
+                 const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                 const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                 const T beta,
+                 const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc,
+                 const bool a_conjugate);
 };
 
 // =================================================================================================
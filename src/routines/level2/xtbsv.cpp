@@ -0,0 +1,145 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtbsv class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/level2/xtbsv.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xtbsv<T>::Xtbsv(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xtrsv"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level2/xtbsv.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xtbsv<T>::DoTbsv(const Layout layout, const Triangle triangle,
+                      const Transpose a_transpose, const Diagonal diagonal,
+                      const size_t n, const size_t k,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and vector: the band is stored as a (k+1) by n matrix
+  TestMatrixA(k + 1, n, a_buffer, a_offset, a_ld);
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+
+  BlockedSolve(layout, triangle, a_transpose, diagonal, n, k,
+               a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc);
+}
+
+// =================================================================================================
+
+// The blocked solver: the diagonal blocks of TRSV_BLOCK_SIZE are solved one after the other, each
+// followed by an update of the rows which depend on the solved block. For a band matrix only the
+// next 'k' rows depend on a block. Only the last substitution reports to the user's event.
+template <typename T>
+void Xtbsv<T>::BlockedSolve(const Layout layout, const Triangle triangle,
+                            const Transpose a_transpose, const Diagonal diagonal,
+                            const size_t n, const size_t k,
+                            const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                            const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // The kernels see the matrix as column-major: the stored triangle of a row-major matrix is the
+  // other triangle of its transpose, which is then also (un)rotated by the transpose option.
+  const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  const auto is_rotated = ((layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                           (layout == Layout::kRowMajor && a_transpose == Transpose::kNo));
+  const auto do_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto is_unit_diagonal = (diagonal == Diagonal::kUnit);
+
+  // An upper-triangular system is solved backwards, a lower-triangular one forwards
+  const auto is_backward = (is_upper != is_rotated);
+
+  // Retrieves the kernels from the compiled binary
+  auto substitution_kernel = Kernel(program_, "TriangularSubstitution");
+  auto update_kernel = Kernel(program_, "TriangularUpdate");
+
+  // Sets the arguments which are the same for all blocks
+  substitution_kernel.SetArgument(0, static_cast<int>(n));
+  substitution_kernel.SetArgument(1, static_cast<int>(k));
+  substitution_kernel.SetArgument(4, a_buffer());
+  substitution_kernel.SetArgument(5, static_cast<int>(a_offset));
+  substitution_kernel.SetArgument(6, static_cast<int>(a_ld));
+  substitution_kernel.SetArgument(7, x_buffer());
+  substitution_kernel.SetArgument(8, static_cast<int>(x_offset));
+  substitution_kernel.SetArgument(9, static_cast<int>(x_inc));
+  substitution_kernel.SetArgument(10, static_cast<int>(is_upper));
+  substitution_kernel.SetArgument(11, static_cast<int>(is_rotated));
+  substitution_kernel.SetArgument(12, static_cast<int>(do_conjugate));
+  substitution_kernel.SetArgument(13, static_cast<int>(is_unit_diagonal));
+  substitution_kernel.SetArgument(14, static_cast<int>(is_backward));
+  update_kernel.SetArgument(0, static_cast<int>(n));
+  update_kernel.SetArgument(1, static_cast<int>(k));
+  update_kernel.SetArgument(6, a_buffer());
+  update_kernel.SetArgument(7, static_cast<int>(a_offset));
+  update_kernel.SetArgument(8, static_cast<int>(a_ld));
+  update_kernel.SetArgument(9, x_buffer());
+  update_kernel.SetArgument(10, static_cast<int>(x_offset));
+  update_kernel.SetArgument(11, static_cast<int>(x_inc));
+  update_kernel.SetArgument(12, static_cast<int>(is_upper));
+  update_kernel.SetArgument(13, static_cast<int>(is_rotated));
+  update_kernel.SetArgument(14, static_cast<int>(do_conjugate));
+
+  // Loops over the blocks, all kernels are chained through the in-order queue
+  const auto block_size_max = db_["TRSV_BLOCK_SIZE"];
+  const auto local = std::vector<size_t>{block_size_max};
+  for (auto i = size_t{0}; i < n; i += block_size_max) {
+    const auto block_size = std::min(block_size_max, n - i);
+    const auto block_start = (is_backward) ? n - i - block_size : i;
+    const auto block_end = block_start + block_size;
+    const auto is_last_block = (i + block_size == n);
+
+    // Solves the diagonal block
+    substitution_kernel.SetArgument(2, static_cast<int>(block_start));
+    substitution_kernel.SetArgument(3, static_cast<int>(block_size));
+    RunKernel(substitution_kernel, queue_, device_, local, local,
+              (is_last_block) ? event_ : nullptr);
+    if (is_last_block) { break; }
+
+    // Updates the rows within the band of the solved block which are not solved yet
+    const auto row_start = (is_backward) ? block_start - std::min(k, block_start) : block_end;
+    const auto row_end = (is_backward) ? block_start : std::min(n, block_end + k);
+    if (row_end <= row_start) { continue; }
+    update_kernel.SetArgument(2, static_cast<int>(block_start));
+    update_kernel.SetArgument(3, static_cast<int>(block_size));
+    update_kernel.SetArgument(4, static_cast<int>(row_start));
+    update_kernel.SetArgument(5, static_cast<int>(row_end - row_start));
+    const auto global = std::vector<size_t>{Ceil(row_end - row_start, block_size_max)};
+    RunKernel(update_kernel, queue_, device_, global, local, nullptr);
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtbsv<half>;
+template class Xtbsv<float>;
+template class Xtbsv<double>;
+template class Xtbsv<float2>;
+template class Xtbsv<double2>;
+
+// =================================================================================================
+} // namespace clblast
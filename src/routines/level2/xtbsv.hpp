@@ -0,0 +1,54 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtbsv routine. Similar to Xtrsv, it uses a block-algorithm: small
+// triangular forward or backward substitutions on the diagonal blocks of the matrix alternate with
+// matrix-vector updates of the remaining rows, which are limited to the band of the matrix. All
+// kernels work in-place on the vector x and are chained on the queue without waiting on the host.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTBSV_H_
+#define CLBLAST_ROUTINES_XTBSV_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xtbsv: public Routine {
+ public:
+
+  // Constructor
+  Xtbsv(Queue &queue, EventPointer event, const std::string &name = "TBSV");
+
+  // Templated-precision implementation of the routine
+  void DoTbsv(const Layout layout, const Triangle triangle,
+              const Transpose a_transpose, const Diagonal diagonal,
+              const size_t n, const size_t k,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
+
+ protected:
+
+  // Solves the system block-by-block, also used for packed matrices (see the Xtpsv routine)
+  void BlockedSolve(const Layout layout, const Triangle triangle,
+                    const Transpose a_transpose, const Diagonal diagonal,
+                    const size_t n, const size_t k,
+                    const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                    const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTBSV_H_
+#endif
@@ -15,13 +15,16 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <memory>
 
 namespace clblast {
 // =================================================================================================
 
 // Constructor: forwards to base class constructor
 template <typename T>
-Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name):
+Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name,
+                const GemmShape &shape):
     Routine(queue, event, name,
             {"Copy","Pad","Transpose","Padtranspose","Xgemm","XgemmDirect","KernelSelection"},
             PrecisionValue<T>(), {}, {
@@ -41,7 +44,7 @@ Xgemm<T>::Xgemm(Queue &queue, EventPointer event, const std::string &name):
     #include "../../kernels/level3/xgemm_part1.opencl"
     #include "../../kernels/level3/xgemm_part2.opencl"
     #include "../../kernels/level3/xgemm_part3.opencl"
-    }) {
+    }, GemmShapeName(shape), GemmShapeDefines(shape)) {
 }
 
 // =================================================================================================
@@ -101,23 +104,205 @@ void Xgemm<T>::DoGemm(const Layout layout,
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
   TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
 
-  // Selects which version of GEMM to run
-  const auto do_gemm_direct = (m * n * k < db_["XGEMM_MIN_INDIRECT_SIZE"]);
+  // In case this exact shape is registered (see RegisterGemmShape), the GEMM kernels are run from a
+  // variant of this routine compiled for the shape. This doesn't apply to the sub-GEMMs of the
+  // chunked version below, as these are of a different shape.
+  const auto shape = GemmShape{layout, a_transpose, b_transpose, m, n, k, a_ld, b_ld, c_ld};
+  auto variant = std::unique_ptr<Xgemm<T>>();
+  const auto target = [&]() -> Xgemm<T>& {
+    if (!IsGemmShapeRegistered(shape)) { return *this; }
+    variant.reset(new Xgemm<T>(queue_, event_, routine_name_, shape));
+    return *variant;
+  };
+
+  // Selects which version of GEMM to run. The direct kernel doesn't support bfloat16 storage.
+  const auto do_gemm_direct = (m * n * k < db_["XGEMM_MIN_INDIRECT_SIZE"]) &&
+                              (precision_ != Precision::kBFloat16);
   if (do_gemm_direct) { // for small sizes (single kernel)
-    GemmDirect(m, n, k, alpha,
-               a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
-               c_buffer, c_offset, c_ld,
-               a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
+    target().GemmDirect(m, n, k, alpha,
+                        a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+                        c_buffer, c_offset, c_ld,
+                        a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
   }
   else { // for larger sizes (pre/post-processing plus a very fast kernel)
-    GemmIndirect(m, n, k, alpha,
-                 a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
-                 c_buffer, c_offset, c_ld,
-                 a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
-                 a_one, a_two, a_want_rotated,
-                 b_one, b_two, b_want_rotated,
-                 c_one, c_two, c_want_rotated);
+
+    // Falls back to the direct version (without temporary buffers) in case the temporary buffers of
+    // the indirect version would exceed the memory budget
+    const auto memory_budget = MemoryBudgetLeft();
+    const auto temp_size = GemmIndirectTempSize(m, n, k, a_offset, a_ld, b_offset, b_ld,
+                                                c_offset, c_ld,
+                                                a_do_transpose, b_do_transpose, c_do_transpose,
+                                                a_conjugate, b_conjugate,
+                                                a_one, a_two, a_want_rotated,
+                                                b_one, b_two, b_want_rotated,
+                                                c_one, c_two, c_want_rotated);
+    const auto exceeds_budget = temp_size > memory_budget;
+    if (exceeds_budget && precision_ != Precision::kBFloat16) {
+      ReportMemoryFallback("direct kernel instead of " + ToString(temp_size) +
+                           " bytes of temporary buffers");
+      target().GemmDirect(m, n, k, alpha,
+                          a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+                          c_buffer, c_offset, c_ld,
+                          a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate);
+      return;
+    }
+
+    // Splits the problem in case the temporary buffers would not fit in the device's memory (or
+    // in the memory budget in case the direct version can't be used)
+    auto m_chunk = m;
+    auto n_chunk = n;
+    auto k_chunk = k;
+    const auto memory_in_use = a_buffer.GetSize() + b_buffer.GetSize() + c_buffer.GetSize();
+    if (GemmChunkSizes(m, n, k, memory_in_use, memory_budget, m_chunk, n_chunk, k_chunk)) {
+      if (exceeds_budget) {
+        ReportMemoryFallback("split into sub-GEMMs of " + ToString(m_chunk) + "x" +
+                             ToString(n_chunk) + "x" + ToString(k_chunk));
+      }
+      GemmChunked(layout, a_transpose, b_transpose, m, n, k, alpha,
+                  a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+                  c_buffer, c_offset, c_ld, m_chunk, n_chunk, k_chunk);
+      return;
+    }
+    target().GemmIndirect(m, n, k, alpha,
+                          a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta,
+                          c_buffer, c_offset, c_ld,
+                          a_do_transpose, b_do_transpose, c_do_transpose, a_conjugate, b_conjugate,
+                          a_one, a_two, a_want_rotated,
+                          b_one, b_two, b_want_rotated,
+                          c_one, c_two, c_want_rotated);
+  }
+}
+
+// =================================================================================================
+
+namespace {
+
+// Computes the offset of element (row, col) of op(X) within the buffer of matrix X
+size_t SubMatrixOffset(const Layout layout, const Transpose transpose,
+                       const size_t offset, const size_t ld, const size_t row, const size_t col) {
+  const auto one = (transpose == Transpose::kNo) ? row : col;
+  const auto two = (transpose == Transpose::kNo) ? col : row;
+  return (layout == Layout::kColMajor) ? offset + one + two * ld : offset + one * ld + two;
+}
+
+} // anonymous namespace
+
+// Halves the sizes of the sub-GEMMs (keeping them multiples of the work-group tile sizes) until
+// each temporary buffer of the indirect version fits in a single allocation and all together fit
+// in the device memory which is not already used by the input/output matrices, as well as in the
+// memory budget.
+template <typename T>
+bool Xgemm<T>::GemmChunkSizes(const size_t m, const size_t n, const size_t k,
+                              const size_t memory_in_use, const size_t memory_budget,
+                              size_t &m_chunk, size_t &n_chunk, size_t &k_chunk) const {
+  const auto max_alloc_size = static_cast<size_t>(device_.MaxAllocSize());
+  const auto memory_size = static_cast<size_t>(device_.MemorySize());
+  const auto memory_free = (memory_size > memory_in_use) ? memory_size - memory_in_use : 0;
+  const auto memory_available = std::min(memory_free, memory_budget);
+  const auto fits = [&](const size_t mc, const size_t nc, const size_t kc) {
+    const auto a_size = Ceil(mc, db_["MWG"]) * Ceil(kc, db_["KWG"]) * sizeof(T);
+    const auto b_size = Ceil(kc, db_["KWG"]) * Ceil(nc, db_["NWG"]) * sizeof(T);
+    const auto c_size = Ceil(mc, db_["MWG"]) * Ceil(nc, db_["NWG"]) * sizeof(T);
+    return a_size <= max_alloc_size && b_size <= max_alloc_size && c_size <= max_alloc_size &&
+           a_size + b_size + c_size <= memory_available;
+  };
+  m_chunk = m;
+  n_chunk = n;
+  k_chunk = k;
+  if (fits(m_chunk, n_chunk, k_chunk)) { return false; }
+  while (!fits(m_chunk, n_chunk, k_chunk)) {
+
+    // Halves the largest of the dimensions that can still be split
+    const auto m_half = Ceil(CeilDiv(m_chunk, 2), db_["MWG"]);
+    const auto n_half = Ceil(CeilDiv(n_chunk, 2), db_["NWG"]);
+    const auto k_half = Ceil(CeilDiv(k_chunk, 2), db_["KWG"]);
+    const auto m_can_split = m_half < m_chunk;
+    const auto n_can_split = n_half < n_chunk;
+    const auto k_can_split = k_half < k_chunk;
+    if (m_can_split && m_chunk >= n_chunk && m_chunk >= k_chunk) { m_chunk = m_half; }
+    else if (n_can_split && n_chunk >= k_chunk) { n_chunk = n_half; }
+    else if (k_can_split) { k_chunk = k_half; }
+    else if (m_can_split) { m_chunk = m_half; }
+    else if (n_can_split) { n_chunk = n_half; }
+    else { break; } // can't be split any further, the allocation will report the error
+  }
+  return (m_chunk < m) || (n_chunk < n) || (k_chunk < k);
+}
+
+// Computes the GEMM as a series of smaller GEMMs. Consecutive sub-GEMMs along the k-dimension
+// accumulate into the same part of C: only the first one applies the user-supplied beta. All
+// kernels are launched in the same in-order queue, only the final one reports to the user event.
+template <typename T>
+void Xgemm<T>::GemmChunked(const Layout layout,
+                           const Transpose a_transpose, const Transpose b_transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const T alpha,
+                           const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                           const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                           const T beta,
+                           const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                           const size_t m_chunk, const size_t n_chunk, const size_t k_chunk) {
+  const auto user_event = event_;
+  for (auto m_start = size_t{0}; m_start < m; m_start += m_chunk) {
+    for (auto n_start = size_t{0}; n_start < n; n_start += n_chunk) {
+      for (auto k_start = size_t{0}; k_start < k; k_start += k_chunk) {
+        const auto m_size = std::min(m_chunk, m - m_start);
+        const auto n_size = std::min(n_chunk, n - n_start);
+        const auto k_size = std::min(k_chunk, k - k_start);
+        const auto is_last = (m_start + m_chunk >= m) && (n_start + n_chunk >= n) &&
+                             (k_start + k_chunk >= k);
+        const auto sub_beta = (k_start == 0) ? beta : ConstantOne<T>();
+
+        // Launches the sub-GEMM, all but the last one with an event which is released afterwards
+        auto sub_event = Event();
+        event_ = (is_last) ? user_event : sub_event.pointer();
+        const auto a_sub_offset = SubMatrixOffset(layout, a_transpose, a_offset, a_ld,
+                                                  m_start, k_start);
+        const auto b_sub_offset = SubMatrixOffset(layout, b_transpose, b_offset, b_ld,
+                                                  k_start, n_start);
+        const auto c_sub_offset = SubMatrixOffset(layout, Transpose::kNo, c_offset, c_ld,
+                                                  m_start, n_start);
+        DoGemm(layout, a_transpose, b_transpose, m_size, n_size, k_size, alpha,
+               a_buffer, a_sub_offset, a_ld, b_buffer, b_sub_offset, b_ld, sub_beta,
+               c_buffer, c_sub_offset, c_ld);
+      }
+    }
   }
+  event_ = user_event;
+}
+
+// Computes the size of the temporary buffers of the indirect version of GEMM, following the same
+// logic as the GemmIndirect function below
+template <typename T>
+size_t Xgemm<T>::GemmIndirectTempSize(const size_t m, const size_t n, const size_t k,
+                                      const size_t a_offset, const size_t a_ld,
+                                      const size_t b_offset, const size_t b_ld,
+                                      const size_t c_offset, const size_t c_ld,
+                                      const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                                      const bool a_conjugate, const bool b_conjugate,
+                                      const size_t a_one, const size_t a_two, const bool a_want_rotated,
+                                      const size_t b_one, const size_t b_two, const bool b_want_rotated,
+                                      const size_t c_one, const size_t c_two, const bool c_want_rotated) const {
+  const auto m_ceiled = Ceil(m, db_["MWG"]);
+  const auto n_ceiled = Ceil(n, db_["NWG"]);
+  const auto k_ceiled = Ceil(k, db_["KWG"]);
+  const auto a_one_i = (a_want_rotated) ? k_ceiled : m_ceiled;
+  const auto a_two_i = (a_want_rotated) ? m_ceiled : k_ceiled;
+  const auto b_one_i = (b_want_rotated) ? n_ceiled : k_ceiled;
+  const auto b_two_i = (b_want_rotated) ? k_ceiled : n_ceiled;
+  const auto c_one_i = (c_want_rotated) ? n_ceiled : m_ceiled;
+  const auto c_two_i = (c_want_rotated) ? m_ceiled : n_ceiled;
+  const auto a_no_temp = a_one == a_one_i && a_two == a_two_i && a_ld == a_one && a_offset == 0 &&
+                         a_do_transpose == false && a_conjugate == false;
+  const auto b_no_temp = b_one == b_one_i && b_two == b_two_i && b_ld == b_one && b_offset == 0 &&
+                         b_do_transpose == false && b_conjugate == false;
+  const auto c_no_temp = c_one == c_one_i && c_two == c_two_i && c_ld == c_one && c_offset == 0 &&
+                         c_do_transpose == false;
+  auto temp_size = size_t{0};
+  if (!a_no_temp) { temp_size += a_one_i*a_two_i*sizeof(T); }
+  if (!b_no_temp) { temp_size += b_one_i*b_two_i*sizeof(T); }
+  if (!c_no_temp) { temp_size += c_one_i*c_two_i*sizeof(T); }
+  return temp_size;
 }
 
 // =================================================================================================
@@ -193,7 +378,7 @@ void Xgemm<T>::GemmIndirect(const size_t m, const size_t n, const size_t k,
   }
 
   // As above, but now for matrix C. This is only necessary if C is used both as input and output.
-  if (!c_no_temp && beta != static_cast<T>(0)) {
+  if (!c_no_temp && beta != ConstantZero<T>()) {
     auto eventProcessC = Event();
     PadCopyTransposeMatrix(queue_, device_, db_, eventProcessC.pointer(), emptyEventList,
                            c_one, c_two, c_ld, c_offset, c_buffer,
@@ -298,6 +483,7 @@ template class Xgemm<float>;
 template class Xgemm<double>;
 template class Xgemm<float2>;
 template class Xgemm<double2>;
+template class Xgemm<bfloat16>;
 
 // =================================================================================================
 } // namespace clblast
@@ -15,6 +15,7 @@
 #define CLBLAST_ROUTINES_XGEMM_H_
 
 #include "routine.hpp"
+#include "gemm_shapes.hpp"
 
 namespace clblast {
 // =================================================================================================
@@ -24,8 +25,10 @@ template <typename T>
 class Xgemm: public Routine {
  public:
 
-  // Constructor
-  Xgemm(Queue &queue, EventPointer event, const std::string &name = "GEMM");
+  // Constructor. In case a (registered) shape is given, this constructs the variant of the routine
+  // with GEMM kernels specialised for that shape: these may then only be run for that exact shape.
+  Xgemm(Queue &queue, EventPointer event, const std::string &name = "GEMM",
+        const GemmShape &shape = GemmShape{});
 
   // Templated-precision implementation of the routine
   void DoGemm(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
@@ -36,6 +39,33 @@ class Xgemm: public Routine {
               const T beta,
               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
 
+  // Splits a GEMM into sub-GEMMs of at most the given sizes, e.g. to limit the temporary buffers
+  void GemmChunked(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                   const size_t m, const size_t n, const size_t k,
+                   const T alpha,
+                   const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                   const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                   const T beta,
+                   const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                   const size_t m_chunk, const size_t n_chunk, const size_t k_chunk);
+
+  // Computes the sizes of the sub-GEMMs such that the temporary buffers of the indirect version
+  // fit in the device's memory and in the memory budget. Returns false if no splitting is needed.
+  bool GemmChunkSizes(const size_t m, const size_t n, const size_t k,
+                      const size_t memory_in_use, const size_t memory_budget,
+                      size_t &m_chunk, size_t &n_chunk, size_t &k_chunk) const;
+
+  // Computes the size (in bytes) of the temporary buffers allocated by the indirect version
+  size_t GemmIndirectTempSize(const size_t m, const size_t n, const size_t k,
+                              const size_t a_offset, const size_t a_ld,
+                              const size_t b_offset, const size_t b_ld,
+                              const size_t c_offset, const size_t c_ld,
+                              const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
+                              const bool a_conjugate, const bool b_conjugate,
+                              const size_t a_one, const size_t a_two, const bool a_want_rotated,
+                              const size_t b_one, const size_t b_two, const bool b_want_rotated,
+                              const size_t c_one, const size_t c_two, const bool c_want_rotated) const;
+
   // Indirect version of GEMM (with pre and post-processing kernels)
   void GemmIndirect(const size_t m, const size_t n, const size_t k,
                     const T alpha,
@@ -81,6 +81,10 @@ void Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle trian
   // Synchronize now: 'DoGemm' does not accept a list of events to wait for
   kernelEvent.WaitForCompletion();
 
+  // The temporary buffer counts against the memory budget of the nested GEMM call
+  const auto temp_memory_in_use = temp_memory_in_use_;
+  temp_memory_in_use_ += k*k*sizeof(T);
+
   // Runs the regular Xgemm code with either "C := AB+C" or ...
   if (side == Side::kLeft) {
     DoGemm(layout, Transpose::kNo, Transpose::kNo,
@@ -115,6 +119,7 @@ void Xhemm<T>::DoHemm(const Layout layout, const Side side, const Triangle trian
       }
     }
   }
+  temp_memory_in_use_ = temp_memory_in_use;
 }
 
 // =================================================================================================
@@ -15,6 +15,7 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 
 namespace clblast {
 // =================================================================================================
@@ -51,11 +52,6 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
   const auto b_two = (layout == Layout::kRowMajor) ? m : n;
   TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
 
-  // Creates a copy of B to avoid overwriting input in GEMM while computing output
-  const auto b_size = (b_ld * (b_two - 1) + b_one + b_offset);
-  auto b_buffer_copy = Buffer<T>(context_, b_size);
-  b_buffer.CopyTo(queue_, b_size, b_buffer_copy);
-
   // Determines which kernel to run based on the layout (the Xgemm kernel assumes column-major as
   // default) and on whether we are dealing with an upper or lower triangle of the triangular matrix
   bool is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
@@ -65,6 +61,12 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
   // Determines whether or not the triangular matrix is unit-diagonal
   auto unit_diagonal = (diagonal == Diagonal::kUnit) ? true : false;
 
+  // In case a copy of B would exceed the memory budget, B is processed in blocks instead. This is
+  // decided before any temporary buffer is allocated.
+  const auto b_size = (b_ld * (b_two - 1) + b_one + b_offset);
+  const auto triangular_size = k*k*sizeof(T);
+  const auto use_blocks = (triangular_size + b_size*sizeof(T) > MemoryBudgetLeft());
+
   // Temporary buffer for a copy of the triangular matrix
   auto temp_triangular = Buffer<T>(context_, k*k);
 
@@ -94,6 +96,20 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
   // Synchronize now: 'DoGemm' does not accept a list of events to wait for
   kernelEvent.WaitForCompletion();
 
+  if (use_blocks) {
+    TrmmBlocked(layout, side, a_transpose, m, n, k, alpha, temp_triangular,
+                b_buffer, b_offset, b_ld, b_one, b_two);
+    return;
+  }
+
+  // Creates a copy of B to avoid overwriting input in GEMM while computing output
+  auto b_buffer_copy = Buffer<T>(context_, b_size);
+  b_buffer.CopyTo(queue_, b_size, b_buffer_copy);
+
+  // The temporary buffers count against the memory budget of the nested GEMM call
+  const auto temp_memory_in_use = temp_memory_in_use_;
+  temp_memory_in_use_ += triangular_size + b_size*sizeof(T);
+
   // Runs the regular Xgemm code with either "B := alpha*A*B" or ...
   if (side == Side::kLeft) {
     DoGemm(layout, a_transpose, Transpose::kNo,
@@ -128,6 +144,76 @@ void Xtrmm<T>::DoTrmm(const Layout layout, const Side side, const Triangle trian
       }
     }
   }
+  temp_memory_in_use_ = temp_memory_in_use;
+}
+
+// =================================================================================================
+
+// Low-memory version of TRMM: the columns (side left) or rows (side right) of B are independent of
+// each other, so B can be processed in blocks of them. Each block is copied to a temporary buffer
+// of its own size, which is as large as possible within the memory budget.
+template <typename T>
+void Xtrmm<T>::TrmmBlocked(const Layout layout, const Side side, const Transpose a_transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const T alpha, const Buffer<T> &temp_triangular,
+                           const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                           const size_t b_one, const size_t b_two) {
+
+  // Determines whether the blocks are taken along the first or the second dimension in memory
+  const auto along_one = (side == Side::kLeft) == (layout == Layout::kRowMajor);
+  const auto num_lines = (side == Side::kLeft) ? n : m;
+  const auto line_size = ((along_one) ? b_two : b_one) * sizeof(T);
+
+  // Computes the block size given the memory left after the triangular matrix
+  const auto triangular_size = k*k*sizeof(T);
+  const auto memory_budget = MemoryBudgetLeft();
+  const auto memory_left = (memory_budget > triangular_size) ? memory_budget - triangular_size : 0;
+  const auto block_size = std::max(size_t{1}, std::min(num_lines, memory_left / line_size));
+  ReportMemoryFallback("blocks of " + ToString(block_size) + " instead of a copy of B");
+
+  auto b_block = Buffer<T>(context_, block_size * line_size / sizeof(T));
+  const auto temp_memory_in_use = temp_memory_in_use_;
+  temp_memory_in_use_ += triangular_size + block_size * line_size;
+  const auto user_event = event_;
+  for (auto start = size_t{0}; start < num_lines; start += block_size) {
+    const auto size = std::min(block_size, num_lines - start);
+    const auto is_last = (start + block_size >= num_lines);
+
+    // Copies the block of B into the temporary buffer
+    const auto block_one = (along_one) ? size : b_one;
+    const auto block_two = (along_one) ? b_two : size;
+    const auto block_offset = b_offset + ((along_one) ? start : start * b_ld);
+    auto copy_event = Event();
+    PadCopyTransposeMatrix(queue_, device_, db_, copy_event.pointer(), std::vector<Event>(),
+                           block_one, block_two, b_ld, block_offset, b_buffer,
+                           block_one, block_two, block_one, 0, b_block,
+                           ConstantOne<T>(), program_, true, false, false);
+    copy_event.WaitForCompletion();
+
+    // Runs the regular Xgemm code on the block, only the last one reports to the user event
+    auto sub_event = Event();
+    event_ = (is_last) ? user_event : sub_event.pointer();
+    if (side == Side::kLeft) {
+      DoGemm(layout, a_transpose, Transpose::kNo,
+             m, size, k,
+             alpha,
+             temp_triangular, 0, k,
+             b_block, 0, block_one,
+             ConstantZero<T>(),
+             b_buffer, block_offset, b_ld);
+    }
+    else {
+      DoGemm(layout, Transpose::kNo, a_transpose,
+             size, n, k,
+             alpha,
+             b_block, 0, block_one,
+             temp_triangular, 0, k,
+             ConstantZero<T>(),
+             b_buffer, block_offset, b_ld);
+    }
+  }
+  event_ = user_event;
+  temp_memory_in_use_ = temp_memory_in_use;
 }
 
 // =================================================================================================
@@ -33,7 +33,11 @@ class Xtrmm: public Xgemm<T> {
   using Xgemm<T>::device_;
   using Xgemm<T>::program_;
   using Xgemm<T>::db_;
+  using Xgemm<T>::event_;
+  using Xgemm<T>::temp_memory_in_use_;
   using Xgemm<T>::DoGemm;
+  using Xgemm<T>::MemoryBudgetLeft;
+  using Xgemm<T>::ReportMemoryFallback;
 
   // Constructor
   Xtrmm(Queue &queue, EventPointer event, const std::string &name = "TRMM");
@@ -45,6 +49,14 @@ class Xtrmm: public Xgemm<T> {
               const T alpha,
               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
               const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld);
+
+ private:
+  // Low-memory version processing B in blocks, used in case of a limited memory budget
+  void TrmmBlocked(const Layout layout, const Side side, const Transpose a_transpose,
+                   const size_t m, const size_t n, const size_t k,
+                   const T alpha, const Buffer<T> &temp_triangular,
+                   const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                   const size_t b_one, const size_t b_two);
 };
 
 // =================================================================================================
@@ -116,6 +116,10 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
                                       k, block_size, a_buffer, a_offset, a_ld, a_inv_buffer);
   diagonal_invert_event.WaitForCompletion();
 
+  // The temporary buffers count against the memory budget of the nested GEMM calls
+  const auto temp_memory_in_use = temp_memory_in_use_;
+  temp_memory_in_use_ += (x_size + a_inv_size) * sizeof(T);
+
   // Derives properties based on the arguments
   const auto condition = ((triangle == Triangle::kUpper && a_transpose != Transpose::kNo) ||
                           (triangle == Triangle::kLower && a_transpose == Transpose::kNo));
@@ -212,6 +216,8 @@ void Xtrsm<T>::TrsmColMajor(const Side side, const Triangle triangle,
     }
   }
 
+  temp_memory_in_use_ = temp_memory_in_use;
+
   // Retrieves the results
   x_buffer.CopyTo(queue_, b_size, b_buffer);
 }
@@ -0,0 +1,130 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xattention class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xattention.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xattention<T>::Xattention(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemmDirect"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/xgemm_direct_part1.opencl"
+    #include "../../kernels/level3/xattention.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xattention<T>::DoAttention(const Layout layout, const bool causal,
+                                const size_t m, const size_t n, const size_t d, const T scale,
+                                const Buffer<T> &q_buffer, const std::vector<size_t> &q_offsets, const size_t q_ld,
+                                const Buffer<T> &k_buffer, const std::vector<size_t> &k_offsets, const size_t k_ld,
+                                const Buffer<T> &v_buffer, const std::vector<size_t> &v_offsets, const size_t v_ld,
+                                const Buffer<T> &o_buffer, const std::vector<size_t> &o_offsets, const size_t o_ld,
+                                const size_t batch_count) {
+
+  // Tests for a valid batch count
+  if ((batch_count < 1) || (q_offsets.size() != batch_count) || (k_offsets.size() != batch_count) ||
+      (v_offsets.size() != batch_count) || (o_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+
+  // Makes sure all dimensions are larger than zero. With a causal mask the queries are the last 'm'
+  // positions of the sequence of 'n' keys, so there can't be more queries than keys.
+  if ((m == 0) || (n == 0) || (d == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+  if (causal && (m > n)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes the first and second dimensions of the matrices: Q and O are m-by-d, K and V n-by-d
+  const auto rotated = (layout == Layout::kRowMajor);
+  const auto m_one = (rotated) ? d : m;
+  const auto m_two = (rotated) ? m : d;
+  const auto n_one = (rotated) ? d : n;
+  const auto n_two = (rotated) ? n : d;
+
+  // Tests the matrices for validity. The output is written while the inputs are still read by
+  // other work-items, so it can't overlap with the inputs of its head.
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(m_one, m_two, q_buffer, q_offsets[batch], q_ld);
+    TestMatrixB(n_one, n_two, k_buffer, k_offsets[batch], k_ld);
+    TestMatrixB(n_one, n_two, v_buffer, v_offsets[batch], v_ld);
+    TestMatrixC(m_one, m_two, o_buffer, o_offsets[batch], o_ld);
+    TestMatrixAliasing(m_one, m_two, q_buffer, q_offsets[batch], q_ld, false,
+                       m_one, m_two, o_buffer, o_offsets[batch], o_ld);
+    TestMatrixAliasing(n_one, n_two, k_buffer, k_offsets[batch], k_ld, false,
+                       m_one, m_two, o_buffer, o_offsets[batch], o_ld);
+    TestMatrixAliasing(n_one, n_two, v_buffer, v_offsets[batch], v_ld, false,
+                       m_one, m_two, o_buffer, o_offsets[batch], o_ld);
+  }
+
+  // Uploads the offsets to the device
+  const auto q_offsets_int = std::vector<int>(q_offsets.begin(), q_offsets.end());
+  const auto k_offsets_int = std::vector<int>(k_offsets.begin(), k_offsets.end());
+  const auto v_offsets_int = std::vector<int>(v_offsets.begin(), v_offsets.end());
+  const auto o_offsets_int = std::vector<int>(o_offsets.begin(), o_offsets.end());
+  auto q_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  auto k_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  auto v_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  auto o_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  q_offsets_device.Write(queue_, batch_count, q_offsets_int);
+  k_offsets_device.Write(queue_, batch_count, k_offsets_int);
+  v_offsets_device.Write(queue_, batch_count, v_offsets_int);
+  o_offsets_device.Write(queue_, batch_count, o_offsets_int);
+
+  // Retrieves the kernel from the compiled binary and sets the arguments
+  auto kernel = Kernel(program_, "XattentionBatched");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(d));
+  kernel.SetArgument(3, GetRealArg(scale));
+  kernel.SetArgument(4, static_cast<int>(causal));
+  kernel.SetArgument(5, static_cast<int>(rotated));
+  kernel.SetArgument(6, q_buffer());
+  kernel.SetArgument(7, q_offsets_device());
+  kernel.SetArgument(8, static_cast<int>(q_ld));
+  kernel.SetArgument(9, k_buffer());
+  kernel.SetArgument(10, k_offsets_device());
+  kernel.SetArgument(11, static_cast<int>(k_ld));
+  kernel.SetArgument(12, v_buffer());
+  kernel.SetArgument(13, v_offsets_device());
+  kernel.SetArgument(14, static_cast<int>(v_ld));
+  kernel.SetArgument(15, o_buffer());
+  kernel.SetArgument(16, o_offsets_device());
+  kernel.SetArgument(17, static_cast<int>(o_ld));
+
+  // Launches the kernel: a work-group per tile of WGD queries per head
+  const auto m_ceiled = Ceil(m, db_["WGD"]);
+  const auto global = std::vector<size_t>{
+    (m_ceiled * db_["MDIMCD"]) / db_["WGD"],
+    db_["NDIMCD"],
+    batch_count
+  };
+  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xattention<half>;
+template class Xattention<float>;
+template class Xattention<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,48 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xattention routine, computing a batch of fused scaled-dot-product
+// attentions O = softmax(scale * Q * K^T) * V without storing the scores. The precision is
+// implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XATTENTION_H_
+#define CLBLAST_ROUTINES_XATTENTION_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xattention: public Routine {
+ public:
+
+  // Constructor
+  Xattention(Queue &queue, EventPointer event, const std::string &name = "ATTENTION");
+
+  // Templated-precision implementation of the routine
+  void DoAttention(const Layout layout, const bool causal,
+                   const size_t m, const size_t n, const size_t d, const T scale,
+                   const Buffer<T> &q_buffer, const std::vector<size_t> &q_offsets, const size_t q_ld,
+                   const Buffer<T> &k_buffer, const std::vector<size_t> &k_offsets, const size_t k_ld,
+                   const Buffer<T> &v_buffer, const std::vector<size_t> &v_offsets, const size_t v_ld,
+                   const Buffer<T> &o_buffer, const std::vector<size_t> &o_offsets, const size_t o_ld,
+                   const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XATTENTION_H_
+#endif
@@ -0,0 +1,155 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XaxpbyPlanar class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xaxpbyplanar.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The kernels operate on the real and imaginary
+// parts separately and are thus compiled for (and tuned as) the real precision.
+template <typename T>
+XaxpbyPlanar<T>::XaxpbyPlanar(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xaxpy"}, PrecisionValue<R>(), {}, {
+    #include "../../kernels/level1/level1.opencl"
+    #include "../../kernels/level1/xplanar.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The AXPY routine: y = alpha * x + y
+template <typename T>
+void XaxpbyPlanar<T>::DoAxpyPlanar(const size_t n, const T alpha,
+                                   const Buffer<R> &x_real_buffer, const Buffer<R> &x_imag_buffer,
+                                   const size_t x_offset, const size_t x_inc,
+                                   const Buffer<R> &y_real_buffer, const Buffer<R> &y_imag_buffer,
+                                   const size_t y_offset, const size_t y_inc) {
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+  TestVectorX(n, x_real_buffer, x_offset, x_inc);
+  TestVectorX(n, x_imag_buffer, x_offset, x_inc);
+  TestVectorY(n, y_real_buffer, y_offset, y_inc);
+  TestVectorY(n, y_imag_buffer, y_offset, y_inc);
+  AxpbyPlanar(n, 1, alpha, false,
+              x_real_buffer, x_imag_buffer, x_offset, x_inc, 0, ConstantOne<T>(),
+              y_real_buffer, y_imag_buffer, y_offset, y_inc, 0, event_);
+}
+
+// The SCAL routine: x = alpha * x
+template <typename T>
+void XaxpbyPlanar<T>::DoScalPlanar(const size_t n, const T alpha,
+                                   const Buffer<R> &x_real_buffer, const Buffer<R> &x_imag_buffer,
+                                   const size_t x_offset, const size_t x_inc) {
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+  TestVectorX(n, x_real_buffer, x_offset, x_inc);
+  TestVectorX(n, x_imag_buffer, x_offset, x_inc);
+  AxpbyPlanar(n, 1, alpha, false,
+              x_real_buffer, x_imag_buffer, x_offset, x_inc, 0, ConstantZero<T>(),
+              x_real_buffer, x_imag_buffer, x_offset, x_inc, 0, event_);
+}
+
+// The COPY routine: y = x
+template <typename T>
+void XaxpbyPlanar<T>::DoCopyPlanar(const size_t n,
+                                   const Buffer<R> &x_real_buffer, const Buffer<R> &x_imag_buffer,
+                                   const size_t x_offset, const size_t x_inc,
+                                   const Buffer<R> &y_real_buffer, const Buffer<R> &y_imag_buffer,
+                                   const size_t y_offset, const size_t y_inc) {
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+  TestVectorX(n, x_real_buffer, x_offset, x_inc);
+  TestVectorX(n, x_imag_buffer, x_offset, x_inc);
+  TestVectorY(n, y_real_buffer, y_offset, y_inc);
+  TestVectorY(n, y_imag_buffer, y_offset, y_inc);
+  AxpbyPlanar(n, 1, ConstantOne<T>(), false,
+              x_real_buffer, x_imag_buffer, x_offset, x_inc, 0, ConstantZero<T>(),
+              y_real_buffer, y_imag_buffer, y_offset, y_inc, 0, event_);
+}
+
+// =================================================================================================
+
+// The generic element-wise implementation, also used by the planar GEMV and GEMM routines
+template <typename T>
+void XaxpbyPlanar<T>::AxpbyPlanar(const size_t one, const size_t two,
+                                  const T alpha, const bool x_conjugate,
+                                  const Buffer<R> &x_real_buffer, const Buffer<R> &x_imag_buffer,
+                                  const size_t x_offset, const size_t x_inc, const size_t x_ld,
+                                  const T beta,
+                                  const Buffer<R> &y_real_buffer, const Buffer<R> &y_imag_buffer,
+                                  const size_t y_offset, const size_t y_inc, const size_t y_ld,
+                                  EventPointer event) {
+
+  // Determines whether or not the fast-version can be used: this requires the data to be stored
+  // contiguously from the start of the buffers
+  const auto size = one * two;
+  const auto x_contiguous = (x_offset == 0) && (x_inc == 1) && (two == 1 || x_ld == one);
+  const auto y_contiguous = (y_offset == 0) && (y_inc == 1) && (two == 1 || y_ld == one);
+  const auto use_fast_kernel = x_contiguous && y_contiguous && IsMultiple(size, db_["VW"]);
+
+  // Retrieves the kernel from the compiled binary and sets the arguments
+  auto kernel = Kernel(program_, (use_fast_kernel) ? "XaxpbyPlanarFast" : "XaxpbyPlanar");
+  if (use_fast_kernel) {
+    kernel.SetArgument(0, static_cast<int>(size));
+    kernel.SetArgument(1, GetRealArg(alpha.real()));
+    kernel.SetArgument(2, GetRealArg(alpha.imag()));
+    kernel.SetArgument(3, static_cast<int>(x_conjugate));
+    kernel.SetArgument(4, x_real_buffer());
+    kernel.SetArgument(5, x_imag_buffer());
+    kernel.SetArgument(6, GetRealArg(beta.real()));
+    kernel.SetArgument(7, GetRealArg(beta.imag()));
+    kernel.SetArgument(8, y_real_buffer());
+    kernel.SetArgument(9, y_imag_buffer());
+  }
+  else {
+    kernel.SetArgument(0, static_cast<int>(one));
+    kernel.SetArgument(1, static_cast<int>(two));
+    kernel.SetArgument(2, GetRealArg(alpha.real()));
+    kernel.SetArgument(3, GetRealArg(alpha.imag()));
+    kernel.SetArgument(4, static_cast<int>(x_conjugate));
+    kernel.SetArgument(5, x_real_buffer());
+    kernel.SetArgument(6, x_imag_buffer());
+    kernel.SetArgument(7, static_cast<int>(x_offset));
+    kernel.SetArgument(8, static_cast<int>(x_inc));
+    kernel.SetArgument(9, static_cast<int>(x_ld));
+    kernel.SetArgument(10, GetRealArg(beta.real()));
+    kernel.SetArgument(11, GetRealArg(beta.imag()));
+    kernel.SetArgument(12, y_real_buffer());
+    kernel.SetArgument(13, y_imag_buffer());
+    kernel.SetArgument(14, static_cast<int>(y_offset));
+    kernel.SetArgument(15, static_cast<int>(y_inc));
+    kernel.SetArgument(16, static_cast<int>(y_ld));
+  }
+
+  // Launches the kernel
+  if (use_fast_kernel) {
+    auto global = std::vector<size_t>{Ceil(CeilDiv(size, db_["WPT"]*db_["VW"]), db_["WGS"])};
+    auto local = std::vector<size_t>{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event);
+  }
+  else {
+    auto global = std::vector<size_t>{Ceil(CeilDiv(one, db_["WPT"]), db_["WGS"]), two};
+    auto local = std::vector<size_t>{db_["WGS"], 1};
+    RunKernel(kernel, queue_, device_, global, local, event);
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XaxpbyPlanar<float2>;
+template class XaxpbyPlanar<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,64 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XaxpbyPlanar routine: the planar-complex level-1 routines (AXPY, SCAL
+// and COPY) for complex data of which the real and imaginary parts are stored in separate buffers.
+// The template argument is the complex data-type, the buffers are of the corresponding real type.
+// The planar GEMV and GEMM routines inherit from this class to scale their inputs and outputs.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XAXPBYPLANAR_H_
+#define CLBLAST_ROUTINES_XAXPBYPLANAR_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XaxpbyPlanar: public Routine {
+ public:
+  using R = typename BaseType<T>::Type;
+
+  // Constructor
+  XaxpbyPlanar(Queue &queue, EventPointer event, const std::string &name = "AXPBYPLANAR");
+
+  // Templated-precision implementations of the routines
+  void DoAxpyPlanar(const size_t n, const T alpha,
+                    const Buffer<R> &x_real_buffer, const Buffer<R> &x_imag_buffer,
+                    const size_t x_offset, const size_t x_inc,
+                    const Buffer<R> &y_real_buffer, const Buffer<R> &y_imag_buffer,
+                    const size_t y_offset, const size_t y_inc);
+  void DoScalPlanar(const size_t n, const T alpha,
+                    const Buffer<R> &x_real_buffer, const Buffer<R> &x_imag_buffer,
+                    const size_t x_offset, const size_t x_inc);
+  void DoCopyPlanar(const size_t n,
+                    const Buffer<R> &x_real_buffer, const Buffer<R> &x_imag_buffer,
+                    const size_t x_offset, const size_t x_inc,
+                    const Buffer<R> &y_real_buffer, const Buffer<R> &y_imag_buffer,
+                    const size_t y_offset, const size_t y_inc);
+
+  // Generic element-wise version: computes y = alpha * x + beta * y (or with x conjugated) for a
+  // 'one' by 'two' matrix, of which element (i,j) is stored at 'offset + i*inc + j*ld'
+  void AxpbyPlanar(const size_t one, const size_t two, const T alpha, const bool x_conjugate,
+                   const Buffer<R> &x_real_buffer, const Buffer<R> &x_imag_buffer,
+                   const size_t x_offset, const size_t x_inc, const size_t x_ld,
+                   const T beta,
+                   const Buffer<R> &y_real_buffer, const Buffer<R> &y_imag_buffer,
+                   const size_t y_offset, const size_t y_inc, const size_t y_ld,
+                   EventPointer event);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XAXPBYPLANAR_H_
+#endif
@@ -0,0 +1,140 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xconvert class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xconvert.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor. The kernels use the tuning parameters of the
+// Xaxpy kernels of the destination precision.
+template <typename Ti, typename To>
+Xconvert<Ti,To>::Xconvert(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, RoutineName(queue, name), {"Xaxpy"}, PrecisionValue<To>(), {}, {
+    #include "../../kernels/level1/level1.opencl"
+    #include "../../kernels/level1/xconvert.opencl"
+    }) {
+}
+
+template <typename Ti, typename To>
+std::string Xconvert<Ti,To>::RoutineName(Queue &queue, const std::string &name) {
+  const auto device = queue.GetDevice();
+  if (!PrecisionSupported<Ti>(device)) {
+    if (PrecisionValue<Ti>() == Precision::kHalf) {
+      throw RuntimeErrorCode(StatusCode::kNoHalfPrecision);
+    }
+    throw RuntimeErrorCode(StatusCode::kNoDoublePrecision);
+  }
+  return name + ToString(static_cast<int>(PrecisionValue<Ti>()));
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename Ti, typename To>
+void Xconvert<Ti,To>::DoConvert(const size_t n, const double scale,
+                                const Buffer<Ti> &x_buffer, const size_t x_offset, const size_t x_inc,
+                                const Buffer<To> &y_buffer, const size_t y_offset, const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the vectors for validity
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorY(n, y_buffer, y_offset, y_inc);
+
+  // The kernels process real values: complex data consists of two of them per element. The
+  // computation is done in double-precision if either of the precisions is double-precision.
+  const auto is_complex = (precision_ == Precision::kComplexSingle ||
+                           precision_ == Precision::kComplexDouble);
+  const auto components = (is_complex) ? size_t{2} : size_t{1};
+  const auto is_double = [](const Precision precision) {
+    return precision == Precision::kDouble || precision == Precision::kComplexDouble;
+  };
+  const auto compute_double = is_double(PrecisionValue<Ti>()) || is_double(precision_);
+
+  // Determines whether or not the fast-version can be used, as for the Xcopy routine
+  const auto size = n * components;
+  const auto work_per_group = db_["WGS"]*db_["WPT"]*db_["VW"];
+  const auto fast_multiple = (non_uniform_work_groups_) ? db_["WPT"]*db_["VW"] : work_per_group;
+  bool use_fast_kernel = (x_offset == 0) && (x_inc == 1) &&
+                         (y_offset == 0) && (y_inc == 1) &&
+                         IsMultiple(size, fast_multiple) && size >= work_per_group;
+
+  // If possible, run the fast-version of the kernel
+  auto kernel_name = (use_fast_kernel) ? "XconvertFast" : "Xconvert";
+
+  // Retrieves the Xconvert kernel from the compiled binary
+  auto kernel = Kernel(program_, kernel_name);
+
+  // Sets the kernel arguments
+  auto arg = 0;
+  kernel.SetArgument(arg++, static_cast<int>((use_fast_kernel) ? size : n));
+  if (!use_fast_kernel) { kernel.SetArgument(arg++, static_cast<int>(components)); }
+  if (compute_double) { kernel.SetArgument(arg++, scale); }
+  else { kernel.SetArgument(arg++, static_cast<float>(scale)); }
+  kernel.SetArgument(arg++, x_buffer());
+  if (!use_fast_kernel) {
+    kernel.SetArgument(arg++, static_cast<int>(x_offset));
+    kernel.SetArgument(arg++, static_cast<int>(x_inc));
+  }
+  kernel.SetArgument(arg++, y_buffer());
+  if (!use_fast_kernel) {
+    kernel.SetArgument(arg++, static_cast<int>(y_offset));
+    kernel.SetArgument(arg++, static_cast<int>(y_inc));
+  }
+
+  // Launches the kernel
+  if (use_fast_kernel) {
+    auto global = std::vector<size_t>{CeilDiv(size, db_["WPT"]*db_["VW"])};
+    auto local = std::vector<size_t>{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+  else {
+    auto size_ceiled = Ceil(size, db_["WGS"]*db_["WPT"]);
+    auto global = std::vector<size_t>{size_ceiled/db_["WPT"]};
+    auto local = std::vector<size_t>{db_["WGS"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class: conversions between all real precisions and between the complex
+// precisions
+template class Xconvert<half, half>;
+template class Xconvert<half, float>;
+template class Xconvert<half, double>;
+template class Xconvert<half, bfloat16>;
+template class Xconvert<float, half>;
+template class Xconvert<float, float>;
+template class Xconvert<float, double>;
+template class Xconvert<float, bfloat16>;
+template class Xconvert<double, half>;
+template class Xconvert<double, float>;
+template class Xconvert<double, double>;
+template class Xconvert<double, bfloat16>;
+template class Xconvert<bfloat16, half>;
+template class Xconvert<bfloat16, float>;
+template class Xconvert<bfloat16, double>;
+template class Xconvert<bfloat16, bfloat16>;
+template class Xconvert<float2, float2>;
+template class Xconvert<float2, double2>;
+template class Xconvert<double2, float2>;
+template class Xconvert<double2, double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,48 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xconvert routine, which converts a vector from one precision to another
+// on the device. The source and destination precisions are implemented using template arguments:
+// the kernels are compiled for the destination precision, the source precision is part of the name
+// of the routine (e.g. "CONVERT16" to convert from half-precision).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XCONVERT_H_
+#define CLBLAST_ROUTINES_XCONVERT_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename Ti, typename To>
+class Xconvert: public Routine {
+ public:
+
+  // Constructor
+  Xconvert(Queue &queue, EventPointer event, const std::string &name = "CONVERT");
+
+  // Templated-precision implementation of the routine
+  void DoConvert(const size_t n, const double scale,
+                 const Buffer<Ti> &x_buffer, const size_t x_offset, const size_t x_inc,
+                 const Buffer<To> &y_buffer, const size_t y_offset, const size_t y_inc);
+
+ private:
+  // Returns the name of the routine including the source precision. This also verifies that the
+  // source precision is supported by the device, before the kernels are compiled.
+  static std::string RoutineName(Queue &queue, const std::string &name);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XCONVERT_H_
+#endif
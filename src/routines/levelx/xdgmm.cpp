@@ -0,0 +1,98 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xdgmm class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xdgmm.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xdgmm<T>::Xdgmm(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Pad"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/level3.opencl"
+    #include "../../kernels/level3/copy_pad.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xdgmm<T>::DoDgmm(const Layout layout, const Side side,
+                      const size_t m, const size_t n,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc,
+                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes the dimensions of the matrices. The rows are scaled in case of a left-side diagonal
+  // matrix, the columns otherwise: this corresponds to the first dimension (one) of the matrices in
+  // case of column-major and a left-side diagonal, or in case of row-major and a right-side one.
+  const auto rotated = (layout == Layout::kRowMajor);
+  const auto one = (rotated) ? n : m;
+  const auto two = (rotated) ? m : n;
+  const auto scale_one = (side == Side::kLeft) != rotated;
+  const auto x_size = (side == Side::kLeft) ? m : n;
+
+  // Tests the matrices and the vector for validity
+  TestMatrixA(one, two, a_buffer, a_offset, a_ld);
+  TestVectorX(x_size, x_buffer, x_offset, x_inc);
+  TestMatrixC(one, two, c_buffer, c_offset, c_ld);
+
+  // Tests whether matrix C can be computed in-place from matrix A
+  TestMatrixAliasing(one, two, a_buffer, a_offset, a_ld, true,
+                     one, two, c_buffer, c_offset, c_ld);
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, "DgmmMatrix");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(one));
+  kernel.SetArgument(1, static_cast<int>(two));
+  kernel.SetArgument(2, static_cast<int>(a_ld));
+  kernel.SetArgument(3, static_cast<int>(a_offset));
+  kernel.SetArgument(4, a_buffer());
+  kernel.SetArgument(5, static_cast<int>(x_offset));
+  kernel.SetArgument(6, static_cast<int>(x_inc));
+  kernel.SetArgument(7, x_buffer());
+  kernel.SetArgument(8, static_cast<int>(c_ld));
+  kernel.SetArgument(9, static_cast<int>(c_offset));
+  kernel.SetArgument(10, c_buffer());
+  kernel.SetArgument(11, static_cast<int>(scale_one));
+
+  // Launches the kernel
+  const auto global = std::vector<size_t>{
+    Ceil(CeilDiv(one, db_["PAD_WPTX"]), db_["PAD_DIMX"]),
+    Ceil(CeilDiv(two, db_["PAD_WPTY"]), db_["PAD_DIMY"])
+  };
+  const auto local = std::vector<size_t>{db_["PAD_DIMX"], db_["PAD_DIMY"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xdgmm<half>;
+template class Xdgmm<float>;
+template class Xdgmm<double>;
+template class Xdgmm<float2>;
+template class Xdgmm<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,121 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgeam class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgeam.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xgeam<T>::Xgeam(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Padtranspose"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/level3.opencl"
+    #include "../../kernels/level3/transpose_pad.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xgeam<T>::DoGeam(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                      const size_t m, const size_t n, const T alpha,
+                      const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                      const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                      const T beta,
+                      const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Determines whether to transpose the input matrices
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto b_transposed = (b_transpose != Transpose::kNo);
+
+  // In case of complex data-types, the transpose can also become a conjugate transpose
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto b_conjugate = (b_transpose == Transpose::kConjugate);
+
+  // Computes the dimensions of the three matrices
+  const auto rotated = (layout == Layout::kRowMajor);
+  const auto c_one = (rotated) ? n : m;
+  const auto c_two = (rotated) ? m : n;
+  const auto a_one = (a_transposed) ? c_two : c_one;
+  const auto a_two = (a_transposed) ? c_one : c_two;
+  const auto b_one = (b_transposed) ? c_two : c_one;
+  const auto b_two = (b_transposed) ? c_one : c_two;
+
+  // Tests the matrices for validity, first from a perspective of the OpenCL buffers and their
+  // sizes, and then from a perspective of parameter values (e.g. m, n). Tests whether the OpenCL
+  // buffers are valid and non-zero and whether the OpenCL buffers have sufficient storage space.
+  // Also tests that the leading dimensions of:
+  //    matrix A cannot be less than N when rotated, or less than M when not-rotated
+  //    matrix B cannot be less than N when rotated, or less than M when not-rotated
+  //    matrix C cannot be less than N when rotated, or less than M when not-rotated
+  // These are swapped for matrices A and B in case they are transposed.
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+
+  // Tests whether matrix C can be computed in-place from matrix A and/or matrix B
+  TestMatrixAliasing(a_one, a_two, a_buffer, a_offset, a_ld, !a_transposed,
+                     c_one, c_two, c_buffer, c_offset, c_ld);
+  TestMatrixAliasing(b_one, b_two, b_buffer, b_offset, b_ld, !b_transposed,
+                     c_one, c_two, c_buffer, c_offset, c_ld);
+
+  // Retrieves the kernel from the compiled binary
+  auto kernel = Kernel(program_, "TransposeGeamMatrix");
+
+  // Sets the kernel arguments
+  kernel.SetArgument(0, static_cast<int>(c_one));
+  kernel.SetArgument(1, static_cast<int>(c_two));
+  kernel.SetArgument(2, static_cast<int>(a_ld));
+  kernel.SetArgument(3, static_cast<int>(a_offset));
+  kernel.SetArgument(4, a_buffer());
+  kernel.SetArgument(5, static_cast<int>(a_transposed));
+  kernel.SetArgument(6, static_cast<int>(a_conjugate));
+  kernel.SetArgument(7, static_cast<int>(b_ld));
+  kernel.SetArgument(8, static_cast<int>(b_offset));
+  kernel.SetArgument(9, b_buffer());
+  kernel.SetArgument(10, static_cast<int>(b_transposed));
+  kernel.SetArgument(11, static_cast<int>(b_conjugate));
+  kernel.SetArgument(12, static_cast<int>(c_ld));
+  kernel.SetArgument(13, static_cast<int>(c_offset));
+  kernel.SetArgument(14, c_buffer());
+  kernel.SetArgument(15, GetRealArg(alpha));
+  kernel.SetArgument(16, GetRealArg(beta));
+
+  // Launches the kernel: each thread computes a block of the output matrix C
+  const auto global = std::vector<size_t>{
+    Ceil(CeilDiv(c_one, db_["PADTRA_WPT"]), db_["PADTRA_TILE"]),
+    Ceil(CeilDiv(c_two, db_["PADTRA_WPT"]), db_["PADTRA_TILE"])
+  };
+  const auto local = std::vector<size_t>{db_["PADTRA_TILE"], db_["PADTRA_TILE"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgeam<half>;
+template class Xgeam<float>;
+template class Xgeam<double>;
+template class Xgeam<float2>;
+template class Xgeam<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -99,19 +99,19 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
     TestMatrixC(c_one, c_two, c_buffer, c_offsets[batch], c_ld);
   }
 
-  // Upload the scalar arguments to the device
-  auto alphas_device = Buffer<T>(context_, BufferAccess::kReadOnly, batch_count);
-  auto betas_device = Buffer<T>(context_, BufferAccess::kReadOnly, batch_count);
-  alphas_device.Write(queue_, batch_count, alphas);
-  betas_device.Write(queue_, batch_count, betas);
+  // Upload the scalar arguments to the device (as floats in case of bfloat16 storage)
+  auto alphas_device = Buffer<Scalar>(context_, BufferAccess::kReadOnly, batch_count);
+  auto betas_device = Buffer<Scalar>(context_, BufferAccess::kReadOnly, batch_count);
+  alphas_device.Write(queue_, batch_count, ToComputeType(alphas));
+  betas_device.Write(queue_, batch_count, ToComputeType(betas));
 
   // Converts the offset to integers
   std::vector<int> a_offsets_int(a_offsets.begin(), a_offsets.end());
   std::vector<int> b_offsets_int(b_offsets.begin(), b_offsets.end());
   std::vector<int> c_offsets_int(c_offsets.begin(), c_offsets.end());
 
-  // Selects which version of the batched GEMM to run
-  const auto do_gemm_direct = true;
+  // Selects which version of the batched GEMM to run. The direct kernel doesn't support bfloat16.
+  const auto do_gemm_direct = (precision_ != Precision::kBFloat16);
   if (do_gemm_direct) { // single generic kernel
     BatchedGemmDirect(m, n, k, alphas_device,
                       a_buffer, a_offsets_int, a_ld, b_buffer, b_offsets_int, b_ld,
@@ -139,10 +139,10 @@ void XgemmBatched<T>::DoGemmBatched(const Layout layout, const Transpose a_trans
 // overhead of these extra kernels might not be ideal for certain devices/arguments.
 template <typename T>
 void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const size_t k,
-                                          const Buffer<T> &alphas,
+                                          const Buffer<Scalar> &alphas,
                                           const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
                                           const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
-                                          const Buffer<T> &betas,
+                                          const Buffer<Scalar> &betas,
                                           const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
                                           const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                                           const bool a_conjugate, const bool b_conjugate,
@@ -282,10 +282,10 @@ void XgemmBatched<T>::BatchedGemmIndirect(const size_t m, const size_t n, const
 // The direct version of batched GEMM, requiring just one kernel, no pre or post-processing kernels.
 template <typename T>
 void XgemmBatched<T>::BatchedGemmDirect(const size_t m, const size_t n, const size_t k,
-                                        const Buffer<T> &alphas,
+                                        const Buffer<Scalar> &alphas,
                                         const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
                                         const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
-                                        const Buffer<T> &betas,
+                                        const Buffer<Scalar> &betas,
                                         const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
                                         const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                                         const bool a_conjugate, const bool b_conjugate,
@@ -345,6 +345,7 @@ template class XgemmBatched<float>;
 template class XgemmBatched<double>;
 template class XgemmBatched<float2>;
 template class XgemmBatched<double2>;
+template class XgemmBatched<bfloat16>;
 
 // =================================================================================================
 } // namespace clblast
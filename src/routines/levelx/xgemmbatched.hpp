@@ -26,6 +26,9 @@ template <typename T>
 class XgemmBatched: public Routine {
  public:
 
+  // Data-type of the scalars on the device: these are stored as floats in case of bfloat16
+  using Scalar = typename ComputeType<T>::Type;
+
   // Constructor
   XgemmBatched(Queue &queue, EventPointer event, const std::string &name = "GEMMBATCHED");
 
@@ -41,10 +44,10 @@ class XgemmBatched: public Routine {
 
   // Indirect version of batched GEMM (with pre and post-processing kernels)
   void BatchedGemmIndirect(const size_t m, const size_t n, const size_t k,
-                           const Buffer<T> &alphas,
+                           const Buffer<Scalar> &alphas,
                            const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
                            const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
-                           const Buffer<T> &betas,
+                           const Buffer<Scalar> &betas,
                            const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
                            const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                            const bool a_conjugate, const bool b_conjugate,
@@ -55,10 +58,10 @@ class XgemmBatched: public Routine {
 
   // Direct version of batched GEMM (no pre and post-processing kernels)
   void BatchedGemmDirect(const size_t m, const size_t n, const size_t k,
-                         const Buffer<T> &alphas,
+                         const Buffer<Scalar> &alphas,
                          const Buffer<T> &a_buffer, const std::vector<int> &a_offsets, const size_t a_ld,
                          const Buffer<T> &b_buffer, const std::vector<int> &b_offsets, const size_t b_ld,
-                         const Buffer<T> &betas,
+                         const Buffer<Scalar> &betas,
                          const Buffer<T> &c_buffer, const std::vector<int> &c_offsets, const size_t c_ld,
                          const bool a_do_transpose, const bool b_do_transpose, const bool c_do_transpose,
                          const bool a_conjugate, const bool b_conjugate,
@@ -0,0 +1,142 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmBlockSparse class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmblocksparse.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmBlockSparse<T>::XgemmBlockSparse(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemmDirect"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/xgemm_direct_part1.opencl"
+    #include "../../kernels/level3/xgemm_direct_part2.opencl"
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_block_sparse.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmBlockSparse<T>::DoGemmBlockSparse(const Layout layout, const Transpose a_transpose,
+                                            const Transpose b_transpose, const Side sparse_side,
+                                            const size_t block_size,
+                                            const size_t m, const size_t n, const size_t k,
+                                            const T alpha,
+                                            const Buffer<T> &a_buffer, const size_t a_offset,
+                                            const size_t a_ld,
+                                            const Buffer<T> &b_buffer, const size_t b_offset,
+                                            const size_t b_ld,
+                                            const Buffer<unsigned char> &occupancy_buffer,
+                                            const size_t occupancy_offset,
+                                            const T beta,
+                                            const Buffer<T> &c_buffer, const size_t c_offset,
+                                            const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0) || (block_size == 0)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+  const auto sparse_b = (sparse_side == Side::kRight);
+
+  // Computes whether or not the matrices are transposed in memory, as in the direct version of
+  // Xgemm (see there for more details)
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  const auto a_do_transpose = a_rotated;
+  const auto b_do_transpose = !b_rotated;
+  const auto c_do_transpose = c_rotated;
+  const auto a_conjugate = (a_transpose == Transpose::kConjugate);
+  const auto b_conjugate = (b_transpose == Transpose::kConjugate);
+
+  // Tests the three matrices for validity
+  const auto a_one = (a_rotated) ? k : m;
+  const auto a_two = (a_rotated) ? m : k;
+  const auto b_one = (b_rotated) ? n : k;
+  const auto b_two = (b_rotated) ? k : n;
+  const auto c_one = (c_rotated) ? n : m;
+  const auto c_two = (c_rotated) ? m : n;
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, b_buffer, b_offset, b_ld);
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+
+  // Tests the occupancy map (one byte per block), reporting errors as errors of the sparse matrix
+  const auto num_blocks = (sparse_b) ? CeilDiv(k, block_size) * CeilDiv(n, block_size)
+                                     : CeilDiv(m, block_size) * CeilDiv(k, block_size);
+  try {
+    if (occupancy_buffer.GetSize() < num_blocks + occupancy_offset) {
+      throw BLASError((sparse_b) ? StatusCode::kInsufficientMemoryB
+                                 : StatusCode::kInsufficientMemoryA);
+    }
+  } catch (const Error<std::runtime_error> &e) {
+    throw BLASError((sparse_b) ? StatusCode::kInvalidMatrixB : StatusCode::kInvalidMatrixA,
+                    e.what());
+  }
+
+  // Retrieves the kernel from the compiled binary and sets its arguments
+  auto kernel = Kernel(program_, "XgemmBlockSparse");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, GetRealArg(alpha));
+  kernel.SetArgument(4, GetRealArg(beta));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, b_buffer());
+  kernel.SetArgument(9, static_cast<int>(b_offset));
+  kernel.SetArgument(10, static_cast<int>(b_ld));
+  kernel.SetArgument(11, c_buffer());
+  kernel.SetArgument(12, static_cast<int>(c_offset));
+  kernel.SetArgument(13, static_cast<int>(c_ld));
+  kernel.SetArgument(14, occupancy_buffer());
+  kernel.SetArgument(15, static_cast<int>(occupancy_offset));
+  kernel.SetArgument(16, static_cast<int>(block_size));
+  kernel.SetArgument(17, static_cast<int>(sparse_b));
+  kernel.SetArgument(18, static_cast<int>(a_do_transpose));
+  kernel.SetArgument(19, static_cast<int>(b_do_transpose));
+  kernel.SetArgument(20, static_cast<int>(c_do_transpose));
+  kernel.SetArgument(21, static_cast<int>(a_conjugate));
+  kernel.SetArgument(22, static_cast<int>(b_conjugate));
+
+  // Computes the global and local thread sizes and launches the kernel
+  const auto m_ceiled = Ceil(m, db_["WGD"]);
+  const auto n_ceiled = Ceil(n, db_["WGD"]);
+  const auto global = std::vector<size_t>{
+    (m_ceiled * db_["MDIMCD"]) / db_["WGD"],
+    (n_ceiled * db_["NDIMCD"]) / db_["WGD"]
+  };
+  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmBlockSparse<half>;
+template class XgemmBlockSparse<float>;
+template class XgemmBlockSparse<double>;
+template class XgemmBlockSparse<float2>;
+template class XgemmBlockSparse<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,53 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmBlockSparse routine: a matrix-multiplication in which either A or
+// B is block-sparse, described by an occupancy map of its blocks. It is based on the direct
+// version of Xgemm and uses its tuning parameters. The precision is implemented using a template
+// argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMBLOCKSPARSE_H_
+#define CLBLAST_ROUTINES_XGEMMBLOCKSPARSE_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmBlockSparse: public Routine {
+ public:
+
+  // Constructor
+  XgemmBlockSparse(Queue &queue, EventPointer event, const std::string &name = "GEMMBLOCKSPARSE");
+
+  // Templated-precision implementation of the routine. The sparse matrix is A for 'Side::kLeft'
+  // and B for 'Side::kRight'. The occupancy buffer holds a byte per 'block_size' by 'block_size'
+  // block of op(A) or op(B), row-major over the blocks.
+  void DoGemmBlockSparse(const Layout layout, const Transpose a_transpose,
+                         const Transpose b_transpose, const Side sparse_side,
+                         const size_t block_size,
+                         const size_t m, const size_t n, const size_t k,
+                         const T alpha,
+                         const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<T> &b_buffer, const size_t b_offset, const size_t b_ld,
+                         const Buffer<unsigned char> &occupancy_buffer,
+                         const size_t occupancy_offset,
+                         const T beta,
+                         const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMBLOCKSPARSE_H_
+#endif
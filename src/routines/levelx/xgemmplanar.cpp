@@ -0,0 +1,130 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmPlanar class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmplanar.hpp"
+#include "routines/level3/xgemm.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmPlanar<T>::XgemmPlanar(Queue &queue, EventPointer event, const std::string &name):
+    XaxpbyPlanar<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmPlanar<T>::DoGemmPlanar(const Layout layout,
+                                  const Transpose a_transpose, const Transpose b_transpose,
+                                  const size_t m, const size_t n, const size_t k,
+                                  const T alpha,
+                                  const Buffer<R> &a_real_buffer, const Buffer<R> &a_imag_buffer,
+                                  const size_t a_offset, const size_t a_ld,
+                                  const Buffer<R> &b_real_buffer, const Buffer<R> &b_imag_buffer,
+                                  const size_t b_offset, const size_t b_ld,
+                                  const T beta,
+                                  const Buffer<R> &c_real_buffer, const Buffer<R> &c_imag_buffer,
+                                  const size_t c_offset, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0) || (k == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Computes the first and second dimensions of the 3 matrices as stored in memory (see Xgemm)
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto b_rotated = (layout == Layout::kColMajor && b_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && b_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  const auto a_one = (a_rotated) ? k : m;
+  const auto a_two = (a_rotated) ? m : k;
+  const auto b_one = (b_rotated) ? n : k;
+  const auto b_two = (b_rotated) ? k : n;
+  const auto c_one = (c_rotated) ? n : m;
+  const auto c_two = (c_rotated) ? m : n;
+
+  // Tests the matrices for validity before anything is launched
+  TestMatrixA(a_one, a_two, a_real_buffer, a_offset, a_ld);
+  TestMatrixA(a_one, a_two, a_imag_buffer, a_offset, a_ld);
+  TestMatrixB(b_one, b_two, b_real_buffer, b_offset, b_ld);
+  TestMatrixB(b_one, b_two, b_imag_buffer, b_offset, b_ld);
+  TestMatrixC(c_one, c_two, c_real_buffer, c_offset, c_ld);
+  TestMatrixC(c_one, c_two, c_imag_buffer, c_offset, c_ld);
+
+  // A complex alpha is applied to a copy of B (also applying the conjugate if needed), a real alpha
+  // is passed on to the real routines. The copy of B is stored contiguously.
+  const auto scale_b = (alpha.imag() != R{0});
+  const auto b_scaled_real_buffer = (scale_b) ? Buffer<R>(context_, b_one * b_two) : b_real_buffer;
+  const auto b_scaled_imag_buffer = (scale_b) ? Buffer<R>(context_, b_one * b_two) : b_imag_buffer;
+  const auto b_scaled_offset = (scale_b) ? size_t{0} : b_offset;
+  const auto b_scaled_ld = (scale_b) ? b_one : b_ld;
+  const auto real_alpha = (scale_b) ? R{1} : alpha.real();
+  const auto b_conjugate = (b_transpose == Transpose::kConjugate);
+  if (scale_b) {
+    AxpbyPlanar(b_one, b_two, alpha, b_conjugate,
+                b_real_buffer, b_imag_buffer, b_offset, 1, b_ld, ConstantZero<T>(),
+                b_scaled_real_buffer, b_scaled_imag_buffer, 0, 1, b_one, nullptr);
+  }
+
+  // Similarly, a complex beta is applied to C in-place, a real beta is passed on
+  const auto scale_c = (beta.imag() != R{0});
+  const auto real_beta = (scale_c) ? R{1} : beta.real();
+  if (scale_c) {
+    AxpbyPlanar(c_one, c_two, beta, false,
+                c_real_buffer, c_imag_buffer, c_offset, 1, c_ld, ConstantZero<T>(),
+                c_real_buffer, c_imag_buffer, c_offset, 1, c_ld, nullptr);
+  }
+
+  // Computes the real and imaginary parts of the result with the real version of the routine:
+  //    C_real = A_real * B_real - A_imag * B_imag
+  //    C_imag = A_real * B_imag + A_imag * B_real
+  // In case of a conjugate transpose the imaginary part of A or B is negated. For B this is already
+  // done in case it was scaled above.
+  const auto a_real_transpose = (a_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+  const auto b_real_transpose = (b_transpose == Transpose::kNo) ? Transpose::kNo : Transpose::kYes;
+  const auto a_imag_sign = (a_transpose == Transpose::kConjugate) ? R{-1} : R{1};
+  const auto b_imag_sign = (b_conjugate && !scale_b) ? R{-1} : R{1};
+  auto gemm = Xgemm<R>(queue_, nullptr);
+  gemm.DoGemm(layout, a_real_transpose, b_real_transpose, m, n, k, real_alpha,
+              a_real_buffer, a_offset, a_ld,
+              b_scaled_real_buffer, b_scaled_offset, b_scaled_ld, real_beta,
+              c_real_buffer, c_offset, c_ld);
+  gemm.DoGemm(layout, a_real_transpose, b_real_transpose, m, n, k,
+              -a_imag_sign * b_imag_sign * real_alpha,
+              a_imag_buffer, a_offset, a_ld,
+              b_scaled_imag_buffer, b_scaled_offset, b_scaled_ld, R{1},
+              c_real_buffer, c_offset, c_ld);
+  gemm.DoGemm(layout, a_real_transpose, b_real_transpose, m, n, k, b_imag_sign * real_alpha,
+              a_real_buffer, a_offset, a_ld,
+              b_scaled_imag_buffer, b_scaled_offset, b_scaled_ld, real_beta,
+              c_imag_buffer, c_offset, c_ld);
+  auto gemm_last = Xgemm<R>(queue_, event_);
+  gemm_last.DoGemm(layout, a_real_transpose, b_real_transpose, m, n, k, a_imag_sign * real_alpha,
+                   a_imag_buffer, a_offset, a_ld,
+                   b_scaled_real_buffer, b_scaled_offset, b_scaled_ld, R{1},
+                   c_imag_buffer, c_offset, c_ld);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmPlanar<float2>;
+template class XgemmPlanar<double2>;
+
+// =================================================================================================
+} // namespace clblast
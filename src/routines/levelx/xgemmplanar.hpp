@@ -0,0 +1,58 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmPlanar routine: a complex matrix-multiplication with the real and
+// imaginary parts stored in separate buffers. It is computed by four real matrix-multiplications
+// (Xgemm) on the separate parts, such that it benefits from the tuned real GEMM kernels. The
+// XgemmPlanar class inherits from the class XaxpbyPlanar, which it uses to apply the complex-valued
+// scalars.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMPLANAR_H_
+#define CLBLAST_ROUTINES_XGEMMPLANAR_H_
+
+#include "routines/levelx/xaxpbyplanar.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmPlanar: public XaxpbyPlanar<T> {
+ public:
+  using R = typename BaseType<T>::Type;
+
+  // Uses methods and variables of the XaxpbyPlanar routine
+  using XaxpbyPlanar<T>::queue_;
+  using XaxpbyPlanar<T>::context_;
+  using XaxpbyPlanar<T>::event_;
+  using XaxpbyPlanar<T>::AxpbyPlanar;
+
+  // Constructor
+  XgemmPlanar(Queue &queue, EventPointer event, const std::string &name = "GEMMPLANAR");
+
+  // Templated-precision implementation of the routine
+  void DoGemmPlanar(const Layout layout, const Transpose a_transpose, const Transpose b_transpose,
+                    const size_t m, const size_t n, const size_t k,
+                    const T alpha,
+                    const Buffer<R> &a_real_buffer, const Buffer<R> &a_imag_buffer,
+                    const size_t a_offset, const size_t a_ld,
+                    const Buffer<R> &b_real_buffer, const Buffer<R> &b_imag_buffer,
+                    const size_t b_offset, const size_t b_ld,
+                    const T beta,
+                    const Buffer<R> &c_real_buffer, const Buffer<R> &c_imag_buffer,
+                    const size_t c_offset, const size_t c_ld);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMPLANAR_H_
+#endif
@@ -0,0 +1,130 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmQuantized class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemmquantized.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemmQuantized<T>::XgemmQuantized(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"XgemmQuantized"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/xgemm_direct_part1.opencl"
+    #include "../../kernels/level3/xgemm_direct_part2.opencl"
+    , // separated in multiple parts to prevent C1091 in MSVC 2013
+    #include "../../kernels/level3/xgemm_quantized.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemmQuantized<T>::DoGemmQuantized(const Layout layout, const Transpose a_transpose,
+                                        const size_t m, const size_t n, const size_t k,
+                                        const T alpha,
+                                        const Buffer<T> &a_buffer, const size_t a_offset,
+                                        const size_t a_ld,
+                                        const Buffer<unsigned char> &b_buffer,
+                                        const size_t b_offset, const size_t b_ld,
+                                        const Quantization b_quantization,
+                                        const size_t group_size,
+                                        const Buffer<T> &scales_buffer, const size_t scales_offset,
+                                        const bool has_zeros, const Buffer<T> &zeros_buffer,
+                                        const size_t zeros_offset,
+                                        const T beta,
+                                        const Buffer<T> &c_buffer, const size_t c_offset,
+                                        const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero and that the quantization is supported
+  if ((m == 0) || (n == 0) || (k == 0) || (group_size == 0)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+  if (b_quantization != Quantization::kInt8 && b_quantization != Quantization::kInt4) {
+    throw BLASError(StatusCode::kNotImplemented);
+  }
+  const auto bits = static_cast<size_t>(b_quantization);
+
+  // Computes the layout of A and C as in the direct version of Xgemm. Matrix B is stored in the
+  // same way for both layouts: the codes of a column are consecutive.
+  const auto a_rotated = (layout == Layout::kColMajor && a_transpose != Transpose::kNo) ||
+                         (layout == Layout::kRowMajor && a_transpose == Transpose::kNo);
+  const auto c_rotated = (layout == Layout::kRowMajor);
+  const auto a_one = (a_rotated) ? k : m;
+  const auto a_two = (a_rotated) ? m : k;
+  const auto c_one = (c_rotated) ? n : m;
+  const auto c_two = (c_rotated) ? m : n;
+  const auto num_groups = CeilDiv(k, group_size);
+
+  // Tests the matrices and the quantization parameters for validity
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestMatrixC(c_one, c_two, c_buffer, c_offset, c_ld);
+  if (b_ld < k) { throw BLASError(StatusCode::kInvalidLeadDimB); }
+  try {
+    const auto required_codes = b_ld * (n - 1) + k + b_offset;
+    if (b_buffer.GetSize() < CeilDiv(required_codes * bits, size_t{8})) {
+      throw BLASError(StatusCode::kInsufficientMemoryB);
+    }
+  } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixB, e.what()); }
+  TestMatrixB(num_groups, n, scales_buffer, scales_offset, num_groups);
+  if (has_zeros) { TestMatrixB(num_groups, n, zeros_buffer, zeros_offset, num_groups); }
+
+  // Retrieves the proper kernel from the compiled binary and sets its arguments
+  auto kernel = Kernel(program_, (bits == 4) ? "XgemmQuantizedInt4" : "XgemmQuantizedInt8");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, static_cast<int>(k));
+  kernel.SetArgument(3, GetRealArg(alpha));
+  kernel.SetArgument(4, GetRealArg(beta));
+  kernel.SetArgument(5, a_buffer());
+  kernel.SetArgument(6, static_cast<int>(a_offset));
+  kernel.SetArgument(7, static_cast<int>(a_ld));
+  kernel.SetArgument(8, b_buffer());
+  kernel.SetArgument(9, static_cast<int>(b_offset));
+  kernel.SetArgument(10, static_cast<int>(b_ld));
+  kernel.SetArgument(11, scales_buffer());
+  kernel.SetArgument(12, static_cast<int>(scales_offset));
+  kernel.SetArgument(13, (has_zeros) ? zeros_buffer() : scales_buffer());
+  kernel.SetArgument(14, static_cast<int>(zeros_offset));
+  kernel.SetArgument(15, static_cast<int>(group_size));
+  kernel.SetArgument(16, static_cast<int>(has_zeros));
+  kernel.SetArgument(17, c_buffer());
+  kernel.SetArgument(18, static_cast<int>(c_offset));
+  kernel.SetArgument(19, static_cast<int>(c_ld));
+  kernel.SetArgument(20, static_cast<int>(a_rotated));
+  kernel.SetArgument(21, static_cast<int>(c_rotated));
+
+  // Computes the global and local thread sizes and launches the kernel
+  const auto m_ceiled = Ceil(m, db_["WGD"]);
+  const auto n_ceiled = Ceil(n, db_["WGD"]);
+  const auto global = std::vector<size_t>{
+    (m_ceiled * db_["MDIMCD"]) / db_["WGD"],
+    (n_ceiled * db_["NDIMCD"]) / db_["WGD"]
+  };
+  const auto local = std::vector<size_t>{db_["MDIMCD"], db_["NDIMCD"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemmQuantized<half>;
+template class XgemmQuantized<float>;
+template class XgemmQuantized<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,52 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemmQuantized routine: a matrix-multiplication of a floating-point
+// matrix A with a weight-only quantized matrix B (8-bit or 4-bit codes with per-group scales and
+// zero-points). The precision of A, C, and the scales is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMMQUANTIZED_H_
+#define CLBLAST_ROUTINES_XGEMMQUANTIZED_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemmQuantized: public Routine {
+ public:
+
+  // Constructor
+  XgemmQuantized(Queue &queue, EventPointer event, const std::string &name = "GEMMQUANTIZED");
+
+  // Templated-precision implementation of the routine. If 'has_zeros' is false, the zeros buffer
+  // is not used and the middle of the range of the codes is taken as zero-point.
+  void DoGemmQuantized(const Layout layout, const Transpose a_transpose,
+                       const size_t m, const size_t n, const size_t k,
+                       const T alpha,
+                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                       const Buffer<unsigned char> &b_buffer, const size_t b_offset,
+                       const size_t b_ld, const Quantization b_quantization,
+                       const size_t group_size,
+                       const Buffer<T> &scales_buffer, const size_t scales_offset,
+                       const bool has_zeros, const Buffer<T> &zeros_buffer,
+                       const size_t zeros_offset,
+                       const T beta,
+                       const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMMQUANTIZED_H_
+#endif
@@ -0,0 +1,114 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvPlanar class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgemvplanar.hpp"
+#include "routines/level2/xgemv.hpp"
+
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+XgemvPlanar<T>::XgemvPlanar(Queue &queue, EventPointer event, const std::string &name):
+    XaxpbyPlanar<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void XgemvPlanar<T>::DoGemvPlanar(const Layout layout, const Transpose a_transpose,
+                                  const size_t m, const size_t n,
+                                  const T alpha,
+                                  const Buffer<R> &a_real_buffer, const Buffer<R> &a_imag_buffer,
+                                  const size_t a_offset, const size_t a_ld,
+                                  const Buffer<R> &x_real_buffer, const Buffer<R> &x_imag_buffer,
+                                  const size_t x_offset, const size_t x_inc,
+                                  const T beta,
+                                  const Buffer<R> &y_real_buffer, const Buffer<R> &y_imag_buffer,
+                                  const size_t y_offset, const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and the vectors for validity before anything is launched
+  const auto a_rotated = (layout == Layout::kRowMajor);
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto x_size = (a_transposed) ? m : n;
+  const auto y_size = (a_transposed) ? n : m;
+  TestMatrixA((a_rotated) ? n : m, (a_rotated) ? m : n, a_real_buffer, a_offset, a_ld);
+  TestMatrixA((a_rotated) ? n : m, (a_rotated) ? m : n, a_imag_buffer, a_offset, a_ld);
+  TestVectorX(x_size, x_real_buffer, x_offset, x_inc);
+  TestVectorX(x_size, x_imag_buffer, x_offset, x_inc);
+  TestVectorY(y_size, y_real_buffer, y_offset, y_inc);
+  TestVectorY(y_size, y_imag_buffer, y_offset, y_inc);
+
+  // A complex alpha is applied to a copy of x, a real alpha is passed on to the real routines
+  const auto scale_x = (alpha.imag() != R{0});
+  const auto x_scaled_real_buffer = (scale_x) ? Buffer<R>(context_, x_size) : x_real_buffer;
+  const auto x_scaled_imag_buffer = (scale_x) ? Buffer<R>(context_, x_size) : x_imag_buffer;
+  const auto x_scaled_offset = (scale_x) ? size_t{0} : x_offset;
+  const auto x_scaled_inc = (scale_x) ? size_t{1} : x_inc;
+  const auto real_alpha = (scale_x) ? R{1} : alpha.real();
+  if (scale_x) {
+    AxpbyPlanar(x_size, 1, alpha, false,
+                x_real_buffer, x_imag_buffer, x_offset, x_inc, 0, ConstantZero<T>(),
+                x_scaled_real_buffer, x_scaled_imag_buffer, 0, 1, 0, nullptr);
+  }
+
+  // Similarly, a complex beta is applied to y in-place, a real beta is passed on
+  const auto scale_y = (beta.imag() != R{0});
+  const auto real_beta = (scale_y) ? R{1} : beta.real();
+  if (scale_y) {
+    AxpbyPlanar(y_size, 1, beta, false,
+                y_real_buffer, y_imag_buffer, y_offset, y_inc, 0, ConstantZero<T>(),
+                y_real_buffer, y_imag_buffer, y_offset, y_inc, 0, nullptr);
+  }
+
+  // Computes the real and imaginary parts of the result with the real version of the routine:
+  //    y_real = A_real * x_real - A_imag * x_imag
+  //    y_imag = A_real * x_imag + A_imag * x_real
+  // In case of a conjugate transpose the imaginary part of A is negated.
+  const auto real_transpose = (a_transposed) ? Transpose::kYes : Transpose::kNo;
+  const auto a_imag_sign = (a_transpose == Transpose::kConjugate) ? R{-1} : R{1};
+  auto gemv = Xgemv<R>(queue_, nullptr);
+  gemv.DoGemv(layout, real_transpose, m, n, real_alpha,
+              a_real_buffer, a_offset, a_ld,
+              x_scaled_real_buffer, x_scaled_offset, x_scaled_inc, real_beta,
+              y_real_buffer, y_offset, y_inc);
+  gemv.DoGemv(layout, real_transpose, m, n, -a_imag_sign * real_alpha,
+              a_imag_buffer, a_offset, a_ld,
+              x_scaled_imag_buffer, x_scaled_offset, x_scaled_inc, R{1},
+              y_real_buffer, y_offset, y_inc);
+  gemv.DoGemv(layout, real_transpose, m, n, real_alpha,
+              a_real_buffer, a_offset, a_ld,
+              x_scaled_imag_buffer, x_scaled_offset, x_scaled_inc, real_beta,
+              y_imag_buffer, y_offset, y_inc);
+  auto gemv_last = Xgemv<R>(queue_, event_);
+  gemv_last.DoGemv(layout, real_transpose, m, n, a_imag_sign * real_alpha,
+                   a_imag_buffer, a_offset, a_ld,
+                   x_scaled_real_buffer, x_scaled_offset, x_scaled_inc, R{1},
+                   y_imag_buffer, y_offset, y_inc);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class XgemvPlanar<float2>;
+template class XgemvPlanar<double2>;
+
+// =================================================================================================
+} // namespace clblast
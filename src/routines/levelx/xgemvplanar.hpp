@@ -0,0 +1,57 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the XgemvPlanar routine: a complex matrix-vector multiplication with the
+// real and imaginary parts stored in separate buffers. It is computed by four real matrix-vector
+// multiplications (Xgemv) on the separate parts. The XgemvPlanar class inherits from the class
+// XaxpbyPlanar, which it uses to apply the complex-valued scalars.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEMVPLANAR_H_
+#define CLBLAST_ROUTINES_XGEMVPLANAR_H_
+
+#include "routines/levelx/xaxpbyplanar.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class XgemvPlanar: public XaxpbyPlanar<T> {
+ public:
+  using R = typename BaseType<T>::Type;
+
+  // Uses methods and variables of the XaxpbyPlanar routine
+  using XaxpbyPlanar<T>::queue_;
+  using XaxpbyPlanar<T>::context_;
+  using XaxpbyPlanar<T>::event_;
+  using XaxpbyPlanar<T>::AxpbyPlanar;
+
+  // Constructor
+  XgemvPlanar(Queue &queue, EventPointer event, const std::string &name = "GEMVPLANAR");
+
+  // Templated-precision implementation of the routine
+  void DoGemvPlanar(const Layout layout, const Transpose a_transpose,
+                    const size_t m, const size_t n,
+                    const T alpha,
+                    const Buffer<R> &a_real_buffer, const Buffer<R> &a_imag_buffer,
+                    const size_t a_offset, const size_t a_ld,
+                    const Buffer<R> &x_real_buffer, const Buffer<R> &x_imag_buffer,
+                    const size_t x_offset, const size_t x_inc,
+                    const T beta,
+                    const Buffer<R> &y_real_buffer, const Buffer<R> &y_imag_buffer,
+                    const size_t y_offset, const size_t y_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEMVPLANAR_H_
+#endif
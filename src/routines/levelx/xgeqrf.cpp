@@ -0,0 +1,375 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgeqrf class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xgeqrf.hpp"
+#include "routines/level3/xgemm.hpp"
+#include "routines/level3/xtrmm.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Settings: the width of the panels of the blocked factorization and the minimum number of rows of
+// a block of the TSQR tree
+constexpr auto kQrBlockSize = size_t{32}; // tuneable
+constexpr auto kTsqrBlockRows = size_t{256}; // tuneable
+
+// Computes the index of element (i,j) of a column-major matrix, or of a row-major one if 'rotated'
+inline size_t QrIndex(const size_t i, const size_t j, const size_t ld, const bool rotated) {
+  return (rotated) ? i*ld + j : j*ld + i;
+}
+
+// Constructor: forwards to base class constructor. The kernels use the work-group size of the
+// Xdot kernels, which are reductions as well.
+template <typename T>
+Xgeqrf<T>::Xgeqrf(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/xgeqrf.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The blocked QR factorization: each panel is factorized by a single work-group, after which the
+// trailing matrix is updated using its block reflector (as LAPACK's xGEQRF)
+template <typename T>
+void Xgeqrf<T>::DoGeqrf(const Layout layout, const size_t m, const size_t n,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer<T> &tau_buffer, const size_t tau_offset) {
+
+  // Makes sure all dimensions are larger than zero
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix and the vector with the scaling factors for validity
+  const auto a_rotated = (layout == Layout::kRowMajor);
+  const auto num_reflectors = std::min(m, n);
+  TestMatrixA((a_rotated) ? n : m, (a_rotated) ? m : n, a_buffer, a_offset, a_ld);
+  TestVectorX(num_reflectors, tau_buffer, tau_offset, 1);
+
+  auto kernel = Kernel(program_, "XgeqrfPanel");
+  const auto local = std::vector<size_t>{db_["WGS1"]};
+  for (auto j = size_t{0}; j < num_reflectors; j += kQrBlockSize) {
+    const auto jb = std::min(kQrBlockSize, num_reflectors - j);
+    const auto last_panel = (j + jb == num_reflectors);
+    const auto rows = m - j;
+    const auto trailing_columns = n - j - jb;
+
+    // Factorizes the current panel
+    kernel.SetArgument(0, static_cast<int>(rows));
+    kernel.SetArgument(1, static_cast<int>(jb));
+    kernel.SetArgument(2, a_buffer());
+    kernel.SetArgument(3, static_cast<int>(a_offset + QrIndex(j, j, a_ld, a_rotated)));
+    kernel.SetArgument(4, static_cast<int>(a_ld));
+    kernel.SetArgument(5, static_cast<int>(a_rotated));
+    kernel.SetArgument(6, tau_buffer());
+    kernel.SetArgument(7, static_cast<int>(tau_offset + j));
+    const auto panel_event = (last_panel && trailing_columns == 0) ? event_ : nullptr;
+    RunKernel(kernel, queue_, device_, local, local, panel_event);
+    if (trailing_columns == 0) { continue; }
+
+    // Updates the trailing matrix: C = (I - V*T*V^T)^T * C
+    const auto v_ld = (a_rotated) ? jb : rows;
+    auto v_buffer = Buffer<T>(context_, rows * jb);
+    QrCopy(rows, jb, 2, a_buffer, a_offset + QrIndex(j, j, a_ld, a_rotated), a_ld, a_rotated,
+           v_buffer, 0, v_ld, a_rotated, nullptr);
+    ApplyBlockReflector(layout, Side::kLeft, true, rows, trailing_columns, jb,
+                        v_buffer, v_ld, tau_buffer, tau_offset + j,
+                        a_buffer, a_offset + QrIndex(j, j + jb, a_ld, a_rotated), a_ld,
+                        (last_panel) ? event_ : nullptr);
+  }
+}
+
+// =================================================================================================
+
+// Applies Q (or Q^T) block by block, ordered such that the reflectors are applied to C in the
+// correct order (as LAPACK's xORMQR)
+template <typename T>
+void Xgeqrf<T>::DoOrmqr(const Layout layout, const Side side, const Transpose a_transpose,
+                        const size_t m, const size_t n, const size_t k,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                        const Buffer<T> &tau_buffer, const size_t tau_offset,
+                        const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld) {
+
+  // Makes sure all dimensions are larger than zero and that there are not too many reflectors
+  const auto q_order = (side == Side::kLeft) ? m : n;
+  if ((m == 0) || (n == 0) || (k == 0) || (k > q_order)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the matrices and the vector with the scaling factors for validity
+  const auto rotated = (layout == Layout::kRowMajor);
+  TestMatrixA((rotated) ? k : q_order, (rotated) ? q_order : k, a_buffer, a_offset, a_ld);
+  TestMatrixC((rotated) ? n : m, (rotated) ? m : n, c_buffer, c_offset, c_ld);
+  TestVectorX(k, tau_buffer, tau_offset, 1);
+
+  // Computes Q^T * C and C * Q starting with the first block, the others starting with the last
+  const auto transpose_q = (a_transpose != Transpose::kNo);
+  const auto forward = ((side == Side::kLeft) == transpose_q);
+  const auto num_blocks = CeilDiv(k, kQrBlockSize);
+  for (auto b = size_t{0}; b < num_blocks; ++b) {
+    const auto i = ((forward) ? b : num_blocks - 1 - b) * kQrBlockSize;
+    const auto ib = std::min(kQrBlockSize, k - i);
+    const auto v_rows = q_order - i;
+    const auto v_ld = (rotated) ? ib : v_rows;
+    auto v_buffer = Buffer<T>(context_, v_rows * ib);
+    QrCopy(v_rows, ib, 2, a_buffer, a_offset + QrIndex(i, i, a_ld, rotated), a_ld, rotated,
+           v_buffer, 0, v_ld, rotated, nullptr);
+    const auto this_c_offset = (side == Side::kLeft) ? QrIndex(i, 0, c_ld, rotated) :
+                                                       QrIndex(0, i, c_ld, rotated);
+    ApplyBlockReflector(layout, side, transpose_q,
+                        (side == Side::kLeft) ? m - i : m, (side == Side::kLeft) ? n : n - i, ib,
+                        v_buffer, v_ld, tau_buffer, tau_offset + i,
+                        c_buffer, c_offset + this_c_offset, c_ld,
+                        (b == num_blocks - 1) ? event_ : nullptr);
+  }
+}
+
+// =================================================================================================
+
+// The TSQR factorization: the matrix is split into blocks of rows which are factorized
+// independently, after which their stacked R factors are factorized recursively. Finally, the
+// explicit Q factor is formed by applying the reflectors of each level to the Q factor of the level
+// above it.
+template <typename T>
+void Xgeqrf<T>::DoTsqr(const Layout layout, const size_t m, const size_t n,
+                       const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                       const Buffer<T> &r_buffer, const size_t r_offset, const size_t r_ld) {
+
+  // Makes sure all dimensions are larger than zero and that the matrix is not wider than it is tall
+  if ((m == 0) || (n == 0) || (m < n)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices for validity
+  const auto rotated = (layout == Layout::kRowMajor);
+  TestMatrixA((rotated) ? n : m, (rotated) ? m : n, a_buffer, a_offset, a_ld);
+  TestMatrixC(n, n, r_buffer, r_offset, r_ld);
+
+  // Computes the factorization and copies the resulting Q factor into A
+  auto q_buffer = Buffer<T>(context_, m * n);
+  TsqrLevel(m, n, a_buffer, a_offset, a_ld, rotated, q_buffer, r_buffer, r_offset, r_ld, rotated);
+  QrCopy(m, n, 0, q_buffer, 0, m, false, a_buffer, a_offset, a_ld, rotated, event_);
+}
+
+template <typename T>
+void Xgeqrf<T>::TsqrLevel(const size_t m, const size_t n,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const bool a_rotated, const Buffer<T> &q_buffer,
+                          const Buffer<T> &r_buffer, const size_t r_offset, const size_t r_ld,
+                          const bool r_rotated) {
+  const auto block_rows = std::max(2 * n, kTsqrBlockRows);
+  const auto num_blocks = std::max(size_t{1}, m / block_rows);
+  const auto stacked_rows = num_blocks * n;
+  const auto local = std::vector<size_t>{db_["WGS1"]};
+  const auto global = std::vector<size_t>{num_blocks * db_["WGS1"]};
+
+  // Factorizes each of the blocks
+  auto tau_buffer = Buffer<T>(context_, num_blocks * n);
+  auto leaves_kernel = Kernel(program_, "XtsqrLeaves");
+  leaves_kernel.SetArgument(0, static_cast<int>(m));
+  leaves_kernel.SetArgument(1, static_cast<int>(n));
+  leaves_kernel.SetArgument(2, static_cast<int>(block_rows));
+  leaves_kernel.SetArgument(3, a_buffer());
+  leaves_kernel.SetArgument(4, static_cast<int>(a_offset));
+  leaves_kernel.SetArgument(5, static_cast<int>(a_ld));
+  leaves_kernel.SetArgument(6, static_cast<int>(a_rotated));
+  leaves_kernel.SetArgument(7, tau_buffer());
+  RunKernel(leaves_kernel, queue_, device_, global, local, nullptr);
+
+  // Stacks the R factors and factorizes them recursively, or extracts the final R factor. The
+  // explicit Q factor of the stacked R factors ends up in 'x_buffer'.
+  auto stack_kernel = Kernel(program_, "XtsqrStackR");
+  stack_kernel.SetArgument(0, static_cast<int>(n));
+  stack_kernel.SetArgument(1, static_cast<int>(num_blocks));
+  stack_kernel.SetArgument(2, static_cast<int>(block_rows));
+  stack_kernel.SetArgument(3, a_buffer());
+  stack_kernel.SetArgument(4, static_cast<int>(a_offset));
+  stack_kernel.SetArgument(5, static_cast<int>(a_ld));
+  stack_kernel.SetArgument(6, static_cast<int>(a_rotated));
+  const auto stack_global = std::vector<size_t>{Ceil(stacked_rows * n, db_["WGS1"])};
+  auto x_buffer = Buffer<T>(context_, stacked_rows * n);
+  if (num_blocks == 1) {
+    stack_kernel.SetArgument(7, r_buffer());
+    stack_kernel.SetArgument(8, static_cast<int>(r_offset));
+    stack_kernel.SetArgument(9, static_cast<int>(r_ld));
+    stack_kernel.SetArgument(10, static_cast<int>(r_rotated));
+    RunKernel(stack_kernel, queue_, device_, stack_global, local, nullptr);
+  }
+  else {
+    auto s_buffer = Buffer<T>(context_, stacked_rows * n);
+    stack_kernel.SetArgument(7, s_buffer());
+    stack_kernel.SetArgument(8, 0);
+    stack_kernel.SetArgument(9, static_cast<int>(stacked_rows));
+    stack_kernel.SetArgument(10, 0);
+    RunKernel(stack_kernel, queue_, device_, stack_global, local, nullptr);
+    TsqrLevel(stacked_rows, n, s_buffer, 0, stacked_rows, false, x_buffer,
+              r_buffer, r_offset, r_ld, r_rotated);
+  }
+
+  // Forms the explicit Q factor of this level
+  auto apply_kernel = Kernel(program_, "XtsqrApply");
+  apply_kernel.SetArgument(0, static_cast<int>(m));
+  apply_kernel.SetArgument(1, static_cast<int>(n));
+  apply_kernel.SetArgument(2, static_cast<int>(block_rows));
+  apply_kernel.SetArgument(3, a_buffer());
+  apply_kernel.SetArgument(4, static_cast<int>(a_offset));
+  apply_kernel.SetArgument(5, static_cast<int>(a_ld));
+  apply_kernel.SetArgument(6, static_cast<int>(a_rotated));
+  apply_kernel.SetArgument(7, tau_buffer());
+  apply_kernel.SetArgument(8, x_buffer());
+  apply_kernel.SetArgument(9, static_cast<int>(stacked_rows));
+  apply_kernel.SetArgument(10, static_cast<int>(num_blocks == 1));
+  apply_kernel.SetArgument(11, q_buffer());
+  apply_kernel.SetArgument(12, static_cast<int>(m));
+  RunKernel(apply_kernel, queue_, device_, global, local, nullptr);
+}
+
+// =================================================================================================
+
+// The batched QR factorization: a single kernel launch factorizes all matrices
+template <typename T>
+void Xgeqrf<T>::DoGeqrfBatched(const Layout layout, const size_t m, const size_t n,
+                               const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets,
+                               const size_t a_ld,
+                               const Buffer<T> &tau_buffer, const std::vector<size_t> &tau_offsets,
+                               const size_t batch_count) {
+
+  // Tests for a valid batch count and sizes
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+  if ((a_offsets.size() != batch_count) || (tau_offsets.size() != batch_count)) {
+    throw BLASError(StatusCode::kInvalidBatchCount);
+  }
+  if ((m == 0) || (n == 0)) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrices and the vectors with the scaling factors for validity
+  const auto a_rotated = (layout == Layout::kRowMajor);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA((a_rotated) ? n : m, (a_rotated) ? m : n, a_buffer, a_offsets[batch], a_ld);
+    TestVectorX(std::min(m, n), tau_buffer, tau_offsets[batch], 1);
+  }
+
+  // Uploads the offsets to the device
+  const auto a_offsets_int = std::vector<int>(a_offsets.begin(), a_offsets.end());
+  const auto tau_offsets_int = std::vector<int>(tau_offsets.begin(), tau_offsets.end());
+  auto a_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  auto tau_offsets_device = Buffer<int>(context_, BufferAccess::kReadOnly, batch_count);
+  a_offsets_device.Write(queue_, batch_count, a_offsets_int);
+  tau_offsets_device.Write(queue_, batch_count, tau_offsets_int);
+
+  // Launches the kernel with a work-group per matrix
+  auto kernel = Kernel(program_, "XgeqrfBatched");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, a_buffer());
+  kernel.SetArgument(3, a_offsets_device());
+  kernel.SetArgument(4, static_cast<int>(a_ld));
+  kernel.SetArgument(5, static_cast<int>(a_rotated));
+  kernel.SetArgument(6, tau_buffer());
+  kernel.SetArgument(7, tau_offsets_device());
+  const auto local = std::vector<size_t>{db_["WGS1"]};
+  const auto global = std::vector<size_t>{batch_count * db_["WGS1"]};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Copies (part of) a matrix
+template <typename T>
+void Xgeqrf<T>::QrCopy(const size_t m, const size_t n, const int mode,
+                       const Buffer<T> &src, const size_t src_offset, const size_t src_ld,
+                       const bool src_rotated,
+                       const Buffer<T> &dest, const size_t dest_offset, const size_t dest_ld,
+                       const bool dest_rotated, EventPointer event) {
+  auto kernel = Kernel(program_, "XqrCopy");
+  kernel.SetArgument(0, static_cast<int>(m));
+  kernel.SetArgument(1, static_cast<int>(n));
+  kernel.SetArgument(2, mode);
+  kernel.SetArgument(3, src());
+  kernel.SetArgument(4, static_cast<int>(src_offset));
+  kernel.SetArgument(5, static_cast<int>(src_ld));
+  kernel.SetArgument(6, static_cast<int>(src_rotated));
+  kernel.SetArgument(7, dest());
+  kernel.SetArgument(8, static_cast<int>(dest_offset));
+  kernel.SetArgument(9, static_cast<int>(dest_ld));
+  kernel.SetArgument(10, static_cast<int>(dest_rotated));
+  const auto local = std::vector<size_t>{db_["WGS1"]};
+  const auto global = std::vector<size_t>{Ceil(m * n, db_["WGS1"])};
+  RunKernel(kernel, queue_, device_, global, local, event);
+}
+
+// Applies a block reflector H = I - V*T*V^T (or its transpose) to C from the left or the right,
+// with T computed from V^T*V and tau (as LAPACK's xLARFT and xLARFB):
+//    H^T * C = C - V * (T^T * (V^T * C))    and    C * H = C - ((C * V) * T) * V^T
+template <typename T>
+void Xgeqrf<T>::ApplyBlockReflector(const Layout layout, const Side side, const bool transpose_q,
+                                    const size_t m, const size_t n, const size_t k,
+                                    const Buffer<T> &v_buffer, const size_t v_ld,
+                                    const Buffer<T> &tau_buffer, const size_t tau_offset,
+                                    const Buffer<T> &c_buffer, const size_t c_offset,
+                                    const size_t c_ld, EventPointer event) {
+  const auto rotated = (layout == Layout::kRowMajor);
+  const auto v_rows = (side == Side::kLeft) ? m : n;
+  auto gemm = Xgemm<T>(queue_, nullptr);
+  auto trmm = Xtrmm<T>(queue_, nullptr);
+  auto final_gemm = Xgemm<T>(queue_, event);
+
+  // Forms the triangular factor T
+  auto g_buffer = Buffer<T>(context_, k * k);
+  auto t_buffer = Buffer<T>(context_, k * k);
+  gemm.DoGemm(layout, Transpose::kYes, Transpose::kNo, k, k, v_rows, ConstantOne<T>(),
+              v_buffer, 0, v_ld, v_buffer, 0, v_ld, ConstantZero<T>(), g_buffer, 0, k);
+  auto kernel = Kernel(program_, "XqrFormT");
+  kernel.SetArgument(0, static_cast<int>(k));
+  kernel.SetArgument(1, g_buffer());
+  kernel.SetArgument(2, tau_buffer());
+  kernel.SetArgument(3, static_cast<int>(tau_offset));
+  kernel.SetArgument(4, t_buffer());
+  kernel.SetArgument(5, static_cast<int>(rotated));
+  const auto local = std::vector<size_t>{db_["WGS1"]};
+  RunKernel(kernel, queue_, device_, local, local, nullptr);
+
+  // Applies the block reflector through a k by n (left) or m by k (right) temporary matrix W
+  const auto t_transpose = (transpose_q) ? Transpose::kYes : Transpose::kNo;
+  if (side == Side::kLeft) {
+    const auto w_ld = (rotated) ? n : k;
+    auto w_buffer = Buffer<T>(context_, k * n);
+    gemm.DoGemm(layout, Transpose::kYes, Transpose::kNo, k, n, m, ConstantOne<T>(),
+                v_buffer, 0, v_ld, c_buffer, c_offset, c_ld, ConstantZero<T>(), w_buffer, 0, w_ld);
+    trmm.DoTrmm(layout, Side::kLeft, Triangle::kUpper, t_transpose, Diagonal::kNonUnit, k, n,
+                ConstantOne<T>(), t_buffer, 0, k, w_buffer, 0, w_ld);
+    final_gemm.DoGemm(layout, Transpose::kNo, Transpose::kNo, m, n, k, ConstantNegOne<T>(),
+                      v_buffer, 0, v_ld, w_buffer, 0, w_ld, ConstantOne<T>(),
+                      c_buffer, c_offset, c_ld);
+  }
+  else {
+    const auto w_ld = (rotated) ? k : m;
+    auto w_buffer = Buffer<T>(context_, m * k);
+    gemm.DoGemm(layout, Transpose::kNo, Transpose::kNo, m, k, n, ConstantOne<T>(),
+                c_buffer, c_offset, c_ld, v_buffer, 0, v_ld, ConstantZero<T>(), w_buffer, 0, w_ld);
+    trmm.DoTrmm(layout, Side::kRight, Triangle::kUpper, t_transpose, Diagonal::kNonUnit, m, k,
+                ConstantOne<T>(), t_buffer, 0, k, w_buffer, 0, w_ld);
+    final_gemm.DoGemm(layout, Transpose::kNo, Transpose::kYes, m, n, k, ConstantNegOne<T>(),
+                      w_buffer, 0, w_ld, v_buffer, 0, v_ld, ConstantOne<T>(),
+                      c_buffer, c_offset, c_ld);
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xgeqrf<float>;
+template class Xgeqrf<double>;
+
+// =================================================================================================
+} // namespace clblast
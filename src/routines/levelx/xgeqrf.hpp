@@ -0,0 +1,92 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xgeqrf routine: the Householder QR factorization (as LAPACK's xGEQRF)
+// and its companions: applying Q to a matrix (xORMQR), a communication-avoiding TSQR for tall and
+// skinny matrices, and a batched version for many small matrices. The blocked factorization uses
+// the compact WY representation (I - V*T*V^T) of a block of reflectors, such that the updates of
+// the trailing matrix are performed by Xgemm and Xtrmm. The precision is implemented using a
+// template argument (real precisions only).
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XGEQRF_H_
+#define CLBLAST_ROUTINES_XGEQRF_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xgeqrf: public Routine {
+ public:
+
+  // Constructor
+  Xgeqrf(Queue &queue, EventPointer event, const std::string &name = "GEQRF");
+
+  // Blocked QR factorization: R is stored in the upper triangle of A, the Householder vectors below
+  // the diagonal, and their scaling factors in tau
+  void DoGeqrf(const Layout layout, const size_t m, const size_t n,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<T> &tau_buffer, const size_t tau_offset);
+
+  // Multiplies the m by n matrix C with Q or Q^T from the left or the right, with Q given as the
+  // k reflectors of a QR factorization as computed by DoGeqrf
+  void DoOrmqr(const Layout layout, const Side side, const Transpose a_transpose,
+               const size_t m, const size_t n, const size_t k,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+               const Buffer<T> &tau_buffer, const size_t tau_offset,
+               const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld);
+
+  // TSQR factorization of a tall and skinny matrix: A is replaced by the explicit m by n matrix Q
+  // with orthonormal columns, the n by n upper-triangular R is stored separately
+  void DoTsqr(const Layout layout, const size_t m, const size_t n,
+              const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+              const Buffer<T> &r_buffer, const size_t r_offset, const size_t r_ld);
+
+  // Batched version of DoGeqrf for small matrices, factorizing one matrix per work-group
+  void DoGeqrfBatched(const Layout layout, const size_t m, const size_t n,
+                      const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets,
+                      const size_t a_ld,
+                      const Buffer<T> &tau_buffer, const std::vector<size_t> &tau_offsets,
+                      const size_t batch_count);
+
+ private:
+
+  // Copies (part of) a matrix with one of the modes of the 'XqrCopy' kernel
+  void QrCopy(const size_t m, const size_t n, const int mode,
+              const Buffer<T> &src, const size_t src_offset, const size_t src_ld,
+              const bool src_rotated,
+              const Buffer<T> &dest, const size_t dest_offset, const size_t dest_ld,
+              const bool dest_rotated, EventPointer event);
+
+  // Applies a block of k reflectors (with explicit unit lower-trapezoidal V) to the m by n matrix C
+  void ApplyBlockReflector(const Layout layout, const Side side, const bool transpose_q,
+                           const size_t m, const size_t n, const size_t k,
+                           const Buffer<T> &v_buffer, const size_t v_ld,
+                           const Buffer<T> &tau_buffer, const size_t tau_offset,
+                           const Buffer<T> &c_buffer, const size_t c_offset, const size_t c_ld,
+                           EventPointer event);
+
+  // A single level of the TSQR tree, recursing on the stacked R factors. The explicit Q factor of
+  // the level is stored column-major in 'q_buffer' (leading dimension m).
+  void TsqrLevel(const size_t m, const size_t n,
+                 const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                 const bool a_rotated, const Buffer<T> &q_buffer,
+                 const Buffer<T> &r_buffer, const size_t r_offset, const size_t r_ld,
+                 const bool r_rotated);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XGEQRF_H_
+#endif
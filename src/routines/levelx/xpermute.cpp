@@ -0,0 +1,180 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xpermute class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xpermute.hpp"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xpermute<T>::Xpermute(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Transpose"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level3/level3.opencl"
+    #include "../../kernels/level3/xpermute.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xpermute<T>::DoPermute(const std::vector<size_t> &shape,
+                            const std::vector<size_t> &permutation, const T alpha,
+                            const Buffer<T> &a_buffer, const size_t a_offset,
+                            const std::vector<size_t> &a_strides,
+                            const Buffer<T> &b_buffer, const size_t b_offset,
+                            const std::vector<size_t> &b_strides) {
+  const auto num_dims = shape.size();
+
+  // Makes sure all dimensions are larger than zero and that the permutation is valid
+  if (num_dims == 0 || permutation.size() != num_dims) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+  auto is_permuted = std::vector<bool>(num_dims, false);
+  for (auto i = size_t{0}; i < num_dims; ++i) {
+    if (shape[i] == 0 || permutation[i] >= num_dims || is_permuted[permutation[i]]) {
+      throw BLASError(StatusCode::kInvalidDimension);
+    }
+    is_permuted[permutation[i]] = true;
+  }
+  if ((!a_strides.empty() && a_strides.size() != num_dims) ||
+      (!b_strides.empty() && b_strides.size() != num_dims)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Collects the dimensions in the order of A, slowest-varying first. Packed strides are computed
+  // from the shapes, the strides of B are given in the order of B.
+  auto dims = std::vector<Dimension>(num_dims);
+  auto a_packed_stride = size_t{1};
+  auto b_packed_stride = size_t{1};
+  for (auto i = num_dims; i-- > 0; ) {
+    dims[i].size = shape[i];
+    dims[i].a_stride = (a_strides.empty()) ? a_packed_stride : a_strides[i];
+    dims[permutation[i]].b_stride = (b_strides.empty()) ? b_packed_stride : b_strides[i];
+    a_packed_stride *= shape[i];
+    b_packed_stride *= shape[permutation[i]];
+  }
+
+  // Tests the tensors for validity: the buffers have to be large enough for the largest index
+  auto a_extent = a_offset + 1;
+  auto b_extent = b_offset + 1;
+  for (const auto &dim: dims) {
+    a_extent += (dim.size - 1) * dim.a_stride;
+    b_extent += (dim.size - 1) * dim.b_stride;
+  }
+  try {
+    if (a_buffer.GetSize() < a_extent * sizeof(T)) {
+      throw BLASError(StatusCode::kInsufficientMemoryA);
+    }
+  } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixA, e.what()); }
+  try {
+    if (b_buffer.GetSize() < b_extent * sizeof(T)) {
+      throw BLASError(StatusCode::kInsufficientMemoryB);
+    }
+  } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixB, e.what()); }
+
+  // Simplifies the problem: removes dimensions of size one and merges neighbouring dimensions which
+  // are also neighbours in B (e.g. H and W in NCHW to NHWC, which is thus a batched 2D transpose)
+  auto merged = std::vector<Dimension>();
+  for (const auto &dim: dims) {
+    if (dim.size == 1) { continue; }
+    if (!merged.empty() && merged.back().a_stride == dim.a_stride * dim.size &&
+        merged.back().b_stride == dim.b_stride * dim.size) {
+      merged.back() = Dimension{merged.back().size * dim.size, dim.a_stride, dim.b_stride};
+    }
+    else {
+      merged.push_back(dim);
+    }
+  }
+  if (merged.empty()) { merged.push_back(Dimension{1, 1, 1}); }
+
+  // Selects the two dimensions to tile: the one with the smallest stride in A ('zero') and the one
+  // with the smallest stride in B ('one'). If these are the same, the tensor is permuted without a
+  // transpose and the second tile dimension is the next-smallest in B, for locality of the writes.
+  const auto smallest = [&merged](const bool in_a, const size_t exclude) {
+    auto best = merged.size();
+    for (auto i = size_t{0}; i < merged.size(); ++i) {
+      if (i == exclude) { continue; }
+      const auto stride = [&](const size_t d) {
+        return (in_a) ? merged[d].a_stride : merged[d].b_stride;
+      };
+      if (best == merged.size() || stride(i) < stride(best)) { best = i; }
+    }
+    return best;
+  };
+  const auto dim0 = smallest(true, merged.size());
+  auto dim1 = smallest(false, merged.size());
+  const auto transpose = (dim0 != dim1);
+  if (!transpose) { dim1 = smallest(false, dim0); }
+  const auto tile0 = merged[dim0];
+  const auto tile1 = (dim1 < merged.size()) ? merged[dim1] : Dimension{1, 0, 0};
+
+  // The remaining (outer) dimensions are passed to the kernel through a small buffer
+  auto outer = std::vector<int>();
+  auto num_outer = size_t{1};
+  for (auto i = size_t{0}; i < merged.size(); ++i) {
+    if (i == dim0 || i == dim1) { continue; }
+    outer.push_back(static_cast<int>(merged[i].size));
+    outer.push_back(static_cast<int>(merged[i].a_stride));
+    outer.push_back(static_cast<int>(merged[i].b_stride));
+    num_outer *= merged[i].size;
+  }
+  const auto num_outer_dims = outer.size() / 3;
+  if (outer.empty()) { outer.push_back(0); }
+  auto outer_device = Buffer<int>(context_, BufferAccess::kReadOnly, outer.size());
+  outer_device.Write(queue_, outer.size(), outer);
+
+  // Retrieves the kernel from the compiled binary and sets its arguments
+  auto kernel = Kernel(program_, (transpose) ? "Xpermute" : "XpermuteCopy");
+  kernel.SetArgument(0, static_cast<int>(tile0.size));
+  kernel.SetArgument(1, static_cast<int>(tile1.size));
+  kernel.SetArgument(2, static_cast<int>(tile0.a_stride));
+  kernel.SetArgument(3, static_cast<int>(tile1.a_stride));
+  kernel.SetArgument(4, static_cast<int>(tile0.b_stride));
+  kernel.SetArgument(5, static_cast<int>(tile1.b_stride));
+  kernel.SetArgument(6, static_cast<int>(num_outer_dims));
+  kernel.SetArgument(7, static_cast<int>(num_outer));
+  kernel.SetArgument(8, outer_device());
+  kernel.SetArgument(9, GetRealArg(alpha));
+  kernel.SetArgument(10, a_buffer());
+  kernel.SetArgument(11, static_cast<int>(a_offset));
+  kernel.SetArgument(12, b_buffer());
+  kernel.SetArgument(13, static_cast<int>(b_offset));
+
+  // Launches the kernel: each work-group processes a tile of both tiled dimensions, the outer
+  // dimensions are spread over at most 'kMaxOuterGroups' work-groups
+  constexpr auto kMaxOuterGroups = size_t{65535};
+  const auto tile_size = db_["TRA_DIM"] * db_["TRA_WPT"];
+  auto global = std::vector<size_t>{CeilDiv(tile0.size, tile_size) * db_["TRA_DIM"],
+                                    CeilDiv(tile1.size, tile_size) * db_["TRA_DIM"],
+                                    std::min(num_outer, kMaxOuterGroups)};
+  auto local = std::vector<size_t>{db_["TRA_DIM"], db_["TRA_DIM"], 1};
+  RunKernel(kernel, queue_, device_, global, local, event_);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xpermute<half>;
+template class Xpermute<float>;
+template class Xpermute<double>;
+template class Xpermute<float2>;
+template class Xpermute<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,55 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xpermute routine, permuting the dimensions of an N-dimensional tensor
+// (a generalized transpose). The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XPERMUTE_H_
+#define CLBLAST_ROUTINES_XPERMUTE_H_
+
+#include <vector>
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xpermute: public Routine {
+ public:
+
+  // Constructor
+  Xpermute(Queue &queue, EventPointer event, const std::string &name = "PERMUTE");
+
+  // Templated-precision implementation of the routine. Empty vectors of strides denote packed
+  // tensors.
+  void DoPermute(const std::vector<size_t> &shape, const std::vector<size_t> &permutation,
+                 const T alpha,
+                 const Buffer<T> &a_buffer, const size_t a_offset,
+                 const std::vector<size_t> &a_strides,
+                 const Buffer<T> &b_buffer, const size_t b_offset,
+                 const std::vector<size_t> &b_strides);
+
+ private:
+  // A dimension of the tensor: its size and its strides in A and B
+  struct Dimension {
+    size_t size;
+    size_t a_stride;
+    size_t b_stride;
+  };
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XPERMUTE_H_
+#endif
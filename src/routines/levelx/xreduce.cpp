@@ -0,0 +1,116 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xreduce class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xreduce.hpp"
+
+#include <string>
+#include <vector>
+#include <limits>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xreduce<T>::Xreduce(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xgemv", "XgemvFastRot"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level2/xreduce.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xreduce<T>::DoReduce(const Reduction reduction, const Layout layout,
+                          const Transpose a_transpose,
+                          const size_t m, const size_t n,
+                          const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                          const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (m == 0 || n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Makes sure the reduction operator is known
+  if (reduction != Reduction::kSum && reduction != Reduction::kAbsSum &&
+      reduction != Reduction::kNrm2 && reduction != Reduction::kMax &&
+      reduction != Reduction::kArgMax && reduction != Reduction::kMin &&
+      reduction != Reduction::kArgMin) {
+    throw BLASError(StatusCode::kInvalidArgValue);
+  }
+
+  // Computes whether or not the matrix has an alternative layout (row or column-major).
+  const auto a_altlayout = (layout == Layout::kRowMajor);
+  const auto a_one = (a_altlayout) ? n : m;
+  const auto a_two = (a_altlayout) ? m : n;
+
+  // Swap m and n if the matrix is transposed: the kernels reduce each of the 'm_real' rows
+  const auto a_transposed = (a_transpose != Transpose::kNo);
+  const auto m_real = (a_transposed) ? n : m;
+  const auto n_real = (a_transposed) ? m : n;
+
+  // Determines whether the kernel needs to perform rotated access ('^' is the XOR operator)
+  const auto a_rotated = a_transposed ^ a_altlayout;
+
+  // The indices are stored as values of type T, so they have to be represented exactly
+  const auto with_indices = (reduction == Reduction::kArgMax || reduction == Reduction::kArgMin);
+  const auto mantissa_bits = (precision_ == Precision::kHalf) ? 11 :
+                             static_cast<int>(std::numeric_limits<T>::digits);
+  if (with_indices && mantissa_bits < 64 && n_real - 1 > (size_t{1} << mantissa_bits)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the matrix and the vector for validity
+  TestMatrixA(a_one, a_two, a_buffer, a_offset, a_ld);
+  TestVectorY(m_real, y_buffer, y_offset, y_inc);
+
+  // Reductions along the contiguous dimension use a work-group per result, unless there is too
+  // little work per result
+  const auto use_rot_kernel = a_rotated && (n_real >= db_["WGS3"]);
+
+  // Retrieves the kernel from the compiled binary and sets the arguments
+  auto kernel = Kernel(program_, (use_rot_kernel) ? "XreduceRot" : "Xreduce");
+  kernel.SetArgument(0, static_cast<int>(m_real));
+  kernel.SetArgument(1, static_cast<int>(n_real));
+  kernel.SetArgument(2, static_cast<int>(reduction));
+  kernel.SetArgument(3, static_cast<int>(a_rotated));
+  kernel.SetArgument(4, a_buffer());
+  kernel.SetArgument(5, static_cast<int>(a_offset));
+  kernel.SetArgument(6, static_cast<int>(a_ld));
+  kernel.SetArgument(7, y_buffer());
+  kernel.SetArgument(8, static_cast<int>(y_offset));
+  kernel.SetArgument(9, static_cast<int>(y_inc));
+
+  // Launches the kernel
+  if (use_rot_kernel) {
+    auto global = std::vector<size_t>{m_real * db_["WGS3"]};
+    auto local = std::vector<size_t>{db_["WGS3"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+  else {
+    const auto m_ceiled = Ceil(m_real, db_["WGS1"]*db_["WPT1"]);
+    auto global = std::vector<size_t>{m_ceiled / db_["WPT1"]};
+    auto local = std::vector<size_t>{db_["WGS1"]};
+    RunKernel(kernel, queue_, device_, global, local, event_);
+  }
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xreduce<half>;
+template class Xreduce<float>;
+template class Xreduce<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,42 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xreduce routine, reducing each row or column of a matrix to a single
+// value. The precision is implemented using a template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XREDUCE_H_
+#define CLBLAST_ROUTINES_XREDUCE_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xreduce: public Routine {
+ public:
+
+  // Constructor
+  Xreduce(Queue &queue, EventPointer event, const std::string &name = "REDUCE");
+
+  // Templated-precision implementation of the routine
+  void DoReduce(const Reduction reduction, const Layout layout, const Transpose a_transpose,
+                const size_t m, const size_t n,
+                const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld,
+                const Buffer<T> &y_buffer, const size_t y_offset, const size_t y_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XREDUCE_H_
+#endif
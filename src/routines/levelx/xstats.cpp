@@ -0,0 +1,115 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xstats class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xstats.hpp"
+
+#include <string>
+#include <vector>
+#include <limits>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xstats<T>::Xstats(Queue &queue, EventPointer event, const std::string &name):
+    Routine(queue, event, name, {"Xdot"}, PrecisionValue<T>(), {}, {
+    #include "../../kernels/level1/xstats.opencl"
+    }) {
+}
+
+// =================================================================================================
+
+// The main routine
+template <typename T>
+void Xstats<T>::DoStats(const Statistic statistics, const size_t n,
+                        const Buffer<T> &stats_buffer, const size_t stats_offset,
+                        const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Makes sure at least one and only known statistics are requested
+  const auto flags = static_cast<int>(statistics);
+  const auto all_flags = static_cast<int>(Statistic::kSum | Statistic::kAbsSum |
+                                          Statistic::kSumSquares | Statistic::kMin |
+                                          Statistic::kArgMin | Statistic::kMax |
+                                          Statistic::kArgMax);
+  if (flags == 0 || (flags & ~all_flags) != 0) { throw BLASError(StatusCode::kInvalidArgValue); }
+
+  // The indices are stored as values of type T, so they have to be represented exactly
+  const auto with_indices = (flags & static_cast<int>(Statistic::kArgMin | Statistic::kArgMax));
+  const auto mantissa_bits = (precision_ == Precision::kHalf) ? 11 :
+                             static_cast<int>(std::numeric_limits<T>::digits);
+  if (with_indices != 0 && mantissa_bits < 64 && n - 1 > (size_t{1} << mantissa_bits)) {
+    throw BLASError(StatusCode::kInvalidDimension);
+  }
+
+  // Tests the vectors for validity
+  auto num_stats = size_t{0};
+  for (auto flag = flags; flag != 0; flag >>= 1) { num_stats += (flag & 1); }
+  TestVectorX(n, x_buffer, x_offset, x_inc);
+  TestVectorScalar(num_stats, stats_buffer, stats_offset);
+
+  // Retrieves the Xstats kernels from the compiled binary
+  auto kernel1 = Kernel(program_, "Xstats");
+  auto kernel2 = Kernel(program_, "XstatsEpilogue");
+
+  // Creates the buffers for the intermediate values: 3 sums and 2 extremes with their indices
+  const auto num_groups = 2*db_["WGS2"];
+  auto sums_buffer = Buffer<T>(context_, 3*num_groups);
+  auto extremes_buffer = Buffer<T>(context_, 2*num_groups);
+  auto indices_buffer = Buffer<unsigned int>(context_, 2*num_groups);
+
+  // Sets the kernel arguments
+  kernel1.SetArgument(0, static_cast<int>(n));
+  kernel1.SetArgument(1, x_buffer());
+  kernel1.SetArgument(2, static_cast<int>(x_offset));
+  kernel1.SetArgument(3, static_cast<int>(x_inc));
+  kernel1.SetArgument(4, sums_buffer());
+  kernel1.SetArgument(5, extremes_buffer());
+  kernel1.SetArgument(6, indices_buffer());
+
+  // Event waiting list
+  auto eventWaitList = std::vector<Event>();
+
+  // Launches the main kernel
+  auto global1 = std::vector<size_t>{db_["WGS1"]*num_groups};
+  auto local1 = std::vector<size_t>{db_["WGS1"]};
+  auto kernelEvent = Event();
+  RunKernel(kernel1, queue_, device_, global1, local1, kernelEvent.pointer());
+  eventWaitList.push_back(kernelEvent);
+
+  // Sets the arguments for the epilogue kernel
+  kernel2.SetArgument(0, sums_buffer());
+  kernel2.SetArgument(1, extremes_buffer());
+  kernel2.SetArgument(2, indices_buffer());
+  kernel2.SetArgument(3, flags);
+  kernel2.SetArgument(4, stats_buffer());
+  kernel2.SetArgument(5, static_cast<int>(stats_offset));
+
+  // Launches the epilogue kernel
+  auto global2 = std::vector<size_t>{db_["WGS2"]};
+  auto local2 = std::vector<size_t>{db_["WGS2"]};
+  RunKernel(kernel2, queue_, device_, global2, local2, event_, eventWaitList);
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xstats<half>;
+template class Xstats<float>;
+template class Xstats<double>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,42 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xstats routine, computing several statistics of a vector (e.g. its sum
+// and its maximum) in a single pass over the data. The precision is implemented using a template
+// argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XSTATS_H_
+#define CLBLAST_ROUTINES_XSTATS_H_
+
+#include "routine.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xstats: public Routine {
+ public:
+
+  // Constructor
+  Xstats(Queue &queue, EventPointer event, const std::string &name = "STATS");
+
+  // Templated-precision implementation of the routine
+  void DoStats(const Statistic statistics, const size_t n,
+               const Buffer<T> &stats_buffer, const size_t stats_offset,
+               const Buffer<T> &x_buffer, const size_t x_offset, const size_t x_inc);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XSTATS_H_
+#endif
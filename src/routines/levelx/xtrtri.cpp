@@ -0,0 +1,150 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtrtri class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include "routines/levelx/xtrtri.hpp"
+#include "routines/level3/xtrmm.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace clblast {
+// =================================================================================================
+
+// Constructor: forwards to base class constructor
+template <typename T>
+Xtrtri<T>::Xtrtri(Queue &queue, EventPointer event, const std::string &name):
+    Xinvert<T>(queue, event, name) {
+}
+
+// =================================================================================================
+
+// The triangular inverse: first all diagonal blocks of TRTRI_BLOCK_SIZE are inverted at once, after
+// which pairs of neighbouring inverted blocks are combined into inverted blocks of twice the size,
+// until the whole matrix is inverted. For a lower-triangular matrix the off-diagonal block of such
+// a pair becomes X21 = -X22 * A21 * X11, for an upper-triangular one X12 = -X11 * A12 * X22.
+template <typename T>
+void Xtrtri<T>::DoTrtri(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                        const size_t n,
+                        const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld) {
+
+  // Makes sure all dimensions are larger than zero
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests the matrix for validity
+  TestMatrixA(n, n, a_buffer, a_offset, a_ld);
+
+  // Everything is computed column-major: the upper triangle of a row-major matrix is the lower
+  // triangle of the same matrix seen as column-major
+  const auto is_upper = ((triangle == Triangle::kUpper && layout != Layout::kRowMajor) ||
+                         (triangle == Triangle::kLower && layout == Layout::kRowMajor));
+  const auto column_major_triangle = (is_upper) ? Triangle::kUpper : Triangle::kLower;
+  const auto unit_diagonal = (diagonal == Diagonal::kUnit) ? true : false;
+
+  // Inverts the diagonal blocks into a temporary buffer, without reporting to the user's event
+  const auto block_size = db_["TRTRI_BLOCK_SIZE"];
+  const auto num_blocks = CeilDiv(n, block_size);
+  auto inverted_blocks = Buffer<T>(context_, num_blocks * block_size * block_size);
+  const auto user_event = event_;
+  event_ = nullptr;
+  InvertMatrixDiagonalBlocks(Layout::kColMajor, column_major_triangle, diagonal, n, block_size,
+                             a_buffer, a_offset, a_ld, inverted_blocks);
+  event_ = user_event;
+
+  // Copies the inverted blocks back into the stored triangle of the matrix
+  auto kernel = Kernel(program_, "TrtriCopyDiagonalBlocks");
+  kernel.SetArgument(0, static_cast<int>(n));
+  kernel.SetArgument(1, inverted_blocks());
+  kernel.SetArgument(2, static_cast<int>(block_size));
+  kernel.SetArgument(3, a_buffer());
+  kernel.SetArgument(4, static_cast<int>(a_offset));
+  kernel.SetArgument(5, static_cast<int>(a_ld));
+  kernel.SetArgument(6, static_cast<int>(unit_diagonal));
+  kernel.SetArgument(7, static_cast<int>(is_upper));
+  const auto local = std::vector<size_t>{db_["INTERNAL_BLOCK_SIZE"]};
+  const auto global = std::vector<size_t>{Ceil(n * block_size, db_["INTERNAL_BLOCK_SIZE"])};
+  RunKernel(kernel, queue_, device_, global, local, (num_blocks == 1) ? event_ : nullptr);
+  if (num_blocks == 1) { return; }
+
+  // Combines the inverted blocks level by level. The last level consists of a single pair of
+  // blocks, its final multiplication reports to the user's event.
+  auto trmm = Xtrmm<T>(queue_, nullptr);
+  auto final_trmm = Xtrmm<T>(queue_, event_);
+  for (auto size = block_size; size < n; size *= 2) {
+    const auto is_last_level = (size * 2 >= n);
+    for (auto i = size_t{0}; i + size < n; i += 2 * size) {
+      const auto size2 = std::min(size, n - i - size); // the second block can be smaller
+      const auto x11_offset = a_offset + i * a_ld + i;
+      const auto x22_offset = a_offset + (i + size) * a_ld + (i + size);
+      auto &last_trmm = (is_last_level) ? final_trmm : trmm;
+      if (is_upper) {
+        const auto a12_offset = a_offset + (i + size) * a_ld + i;
+        trmm.DoTrmm(Layout::kColMajor, Side::kRight, Triangle::kUpper, Transpose::kNo, diagonal,
+                    size, size2, ConstantOne<T>(),
+                    a_buffer, x22_offset, a_ld, a_buffer, a12_offset, a_ld);
+        last_trmm.DoTrmm(Layout::kColMajor, Side::kLeft, Triangle::kUpper, Transpose::kNo, diagonal,
+                         size, size2, ConstantNegOne<T>(),
+                         a_buffer, x11_offset, a_ld, a_buffer, a12_offset, a_ld);
+      }
+      else {
+        const auto a21_offset = a_offset + i * a_ld + (i + size);
+        trmm.DoTrmm(Layout::kColMajor, Side::kRight, Triangle::kLower, Transpose::kNo, diagonal,
+                    size2, size, ConstantOne<T>(),
+                    a_buffer, x11_offset, a_ld, a_buffer, a21_offset, a_ld);
+        last_trmm.DoTrmm(Layout::kColMajor, Side::kLeft, Triangle::kLower, Transpose::kNo, diagonal,
+                         size2, size, ConstantNegOne<T>(),
+                         a_buffer, x22_offset, a_ld, a_buffer, a21_offset, a_ld);
+      }
+    }
+  }
+}
+
+// =================================================================================================
+
+// The batched triangular inverse: the matrices are inverted one after the other on the queue, only
+// the last one reports to the user's event
+template <typename T>
+void Xtrtri<T>::DoTrtriBatched(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                               const size_t n,
+                               const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets,
+                               const size_t a_ld, const size_t batch_count) {
+
+  // Tests for a valid batch count and sizes
+  if (batch_count < 1) { throw BLASError(StatusCode::kInvalidBatchCount); }
+  if (a_offsets.size() != batch_count) { throw BLASError(StatusCode::kInvalidBatchCount); }
+  if (n == 0) { throw BLASError(StatusCode::kInvalidDimension); }
+
+  // Tests all matrices for validity before computing anything
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    TestMatrixA(n, n, a_buffer, a_offsets[batch], a_ld);
+  }
+
+  const auto user_event = event_;
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    event_ = (batch == batch_count - 1) ? user_event : nullptr;
+    DoTrtri(layout, triangle, diagonal, n, a_buffer, a_offsets[batch], a_ld);
+  }
+  event_ = user_event;
+}
+
+// =================================================================================================
+
+// Compiles the templated class
+template class Xtrtri<half>;
+template class Xtrtri<float>;
+template class Xtrtri<double>;
+template class Xtrtri<float2>;
+template class Xtrtri<double2>;
+
+// =================================================================================================
+} // namespace clblast
@@ -0,0 +1,58 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the Xtrtri routine: the in-place inverse of a triangular matrix (as LAPACK's
+// xTRTRI). The diagonal blocks are inverted by the kernels of the Xinvert class, after which these
+// are combined into ever larger inverted blocks using Xtrmm. The precision is implemented using a
+// template argument.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_ROUTINES_XTRTRI_H_
+#define CLBLAST_ROUTINES_XTRTRI_H_
+
+#include "routines/levelx/xinvert.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class Xtrtri: public Xinvert<T> {
+ public:
+
+  // Members and methods from the base class
+  using Xinvert<T>::queue_;
+  using Xinvert<T>::context_;
+  using Xinvert<T>::device_;
+  using Xinvert<T>::program_;
+  using Xinvert<T>::db_;
+  using Xinvert<T>::event_;
+  using Xinvert<T>::InvertMatrixDiagonalBlocks;
+
+  // Constructor
+  Xtrtri(Queue &queue, EventPointer event, const std::string &name = "TRTRI");
+
+  // Inverts the upper or lower triangle of matrix A in-place, the other triangle is not referenced
+  void DoTrtri(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+               const size_t n,
+               const Buffer<T> &a_buffer, const size_t a_offset, const size_t a_ld);
+
+  // Batched version of DoTrtri, with the matrices given by offsets into a single buffer
+  void DoTrtriBatched(const Layout layout, const Triangle triangle, const Diagonal diagonal,
+                      const size_t n,
+                      const Buffer<T> &a_buffer, const std::vector<size_t> &a_offsets,
+                      const size_t a_ld, const size_t batch_count);
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_ROUTINES_XTRTRI_H_
+#endif
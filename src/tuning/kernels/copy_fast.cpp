@@ -7,7 +7,7 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file uses the CLTune auto-tuner to tune the copy OpenCL kernels.
+// This file uses the auto-tuner to tune the copy OpenCL kernels.
 //
 // =================================================================================================
 
@@ -59,7 +59,7 @@ class TuneCopy {
   static size_t GetSizeTemp(const Arguments<T> &) { return 1; } // N/A for this kernel
 
   // Sets the tuning parameters and their possible values
-  static void SetParameters(cltune::Tuner &tuner, const size_t id) {
+  static void SetParameters(TuningSession &tuner, const size_t id) {
     tuner.AddParameter(id, "COPY_DIMX", {8, 16, 32});
     tuner.AddParameter(id, "COPY_DIMY", {8, 16, 32});
     tuner.AddParameter(id, "COPY_WPT", {1, 2, 4, 8});
@@ -67,8 +67,8 @@ class TuneCopy {
   }
 
   // Sets the constraints and local memory size
-  static void SetConstraints(cltune::Tuner &, const size_t) { }
-  static void SetLocalMemorySize(cltune::Tuner &, const size_t, const Arguments<T> &) { }
+  static void SetConstraints(TuningSession &, const size_t) { }
+  static void SetLocalMemorySize(TuningSession &, const size_t, const Arguments<T> &) { }
 
   // Sets the base thread configuration
   static std::vector<size_t> GlobalSize(const Arguments<T> &args) { return {args.m, args.n}; }
@@ -84,7 +84,7 @@ class TuneCopy {
   static TransformVector DivGlobal() { return {{"COPY_VW", "COPY_WPT"}}; }
 
   // Sets the kernel's arguments
-  static void SetArguments(cltune::Tuner &tuner, const Arguments<T> &args,
+  static void SetArguments(TuningSession &tuner, const Arguments<T> &args,
                            std::vector<T> &, std::vector<T> &,
                            std::vector<T> &a_mat, std::vector<T> &b_mat, std::vector<T> &,
                            std::vector<T> &) {
@@ -7,7 +7,7 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file uses the CLTune auto-tuner to tune the pad OpenCL kernels.
+// This file uses the auto-tuner to tune the pad OpenCL kernels.
 //
 // =================================================================================================
 
@@ -59,7 +59,7 @@ class TunePad {
   static size_t GetSizeTemp(const Arguments<T> &) { return 1; } // N/A for this kernel
 
   // Sets the tuning parameters and their possible values
-  static void SetParameters(cltune::Tuner &tuner, const size_t id) {
+  static void SetParameters(TuningSession &tuner, const size_t id) {
     tuner.AddParameter(id, "PAD_DIMX", {8, 16, 32});
     tuner.AddParameter(id, "PAD_DIMY", {8, 16, 32});
     tuner.AddParameter(id, "PAD_WPTX", {1, 2, 4});
@@ -67,8 +67,8 @@ class TunePad {
   }
 
   // Sets the constraints and local memory size
-  static void SetConstraints(cltune::Tuner &, const size_t) { }
-  static void SetLocalMemorySize(cltune::Tuner &, const size_t, const Arguments<T> &) { }
+  static void SetConstraints(TuningSession &, const size_t) { }
+  static void SetLocalMemorySize(TuningSession &, const size_t, const Arguments<T> &) { }
 
   // Sets the base thread configuration
   static std::vector<size_t> GlobalSize(const Arguments<T> &args) { return {args.m, args.n}; }
@@ -84,7 +84,7 @@ class TunePad {
   static TransformVector DivGlobal() { return {{"PAD_WPTX", "PAD_WPTY"}}; }
 
   // Sets the kernel's arguments
-  static void SetArguments(cltune::Tuner &tuner, const Arguments<T> &args,
+  static void SetArguments(TuningSession &tuner, const Arguments<T> &args,
                            std::vector<T> &, std::vector<T> &,
                            std::vector<T> &a_mat, std::vector<T> &b_mat, std::vector<T> &,
                            std::vector<T> &) {
@@ -114,6 +114,7 @@ class TunePad {
 
 // Shortcuts to the clblast namespace
 using half = clblast::half;
+using bfloat16 = clblast::bfloat16;
 using float2 = clblast::float2;
 using double2 = clblast::double2;
 
@@ -122,6 +123,7 @@ int main(int argc, char *argv[]) {
   const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
   switch(clblast::GetPrecision(command_line_args)) {
     case clblast::Precision::kHalf: clblast::Tuner<clblast::TunePad<half>, half>(argc, argv); break;
+    case clblast::Precision::kBFloat16: clblast::Tuner<clblast::TunePad<bfloat16>, bfloat16>(argc, argv); break;
     case clblast::Precision::kSingle: clblast::Tuner<clblast::TunePad<float>, float>(argc, argv); break;
     case clblast::Precision::kDouble: clblast::Tuner<clblast::TunePad<double>, double>(argc, argv); break;
     case clblast::Precision::kComplexSingle: clblast::Tuner<clblast::TunePad<float2>, float2>(argc, argv); break;
@@ -7,7 +7,7 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file uses the CLTune auto-tuner to tune the transpose OpenCL kernels.
+// This file uses the auto-tuner to tune the transpose OpenCL kernels.
 //
 // =================================================================================================
 
@@ -59,7 +59,7 @@ class TuneTranspose {
   static size_t GetSizeTemp(const Arguments<T> &) { return 1; } // N/A for this kernel
 
   // Sets the tuning parameters and their possible values
-  static void SetParameters(cltune::Tuner &tuner, const size_t id) {
+  static void SetParameters(TuningSession &tuner, const size_t id) {
     tuner.AddParameter(id, "TRA_DIM", {4, 8, 16, 32, 64});
     tuner.AddParameter(id, "TRA_WPT", {1, 2, 4, 8, 16});
     tuner.AddParameter(id, "TRA_PAD", {0, 1});
@@ -67,8 +67,8 @@ class TuneTranspose {
   }
 
   // Sets the constraints and local memory size
-  static void SetConstraints(cltune::Tuner &, const size_t) { }
-  static void SetLocalMemorySize(cltune::Tuner &tuner, const size_t id, const Arguments<T> &args) {
+  static void SetConstraints(TuningSession &, const size_t) { }
+  static void SetLocalMemorySize(TuningSession &tuner, const size_t id, const Arguments<T> &args) {
     auto LocalMemorySize = [args] (std::vector<size_t> v) {
       return ((v[0]*v[1]*(v[0]*v[1]+v[2]))*GetBytes(args.precision));
     };
@@ -89,7 +89,7 @@ class TuneTranspose {
   static TransformVector DivGlobal() { return {{"TRA_WPT", "TRA_WPT"}}; }
 
   // Sets the kernel's arguments
-  static void SetArguments(cltune::Tuner &tuner, const Arguments<T> &args,
+  static void SetArguments(TuningSession &tuner, const Arguments<T> &args,
                            std::vector<T> &, std::vector<T> &,
                            std::vector<T> &a_mat, std::vector<T> &b_mat, std::vector<T> &,
                            std::vector<T> &) {
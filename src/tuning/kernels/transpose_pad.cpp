@@ -7,7 +7,7 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file uses the CLTune auto-tuner to tune the padtranspose OpenCL kernels.
+// This file uses the auto-tuner to tune the padtranspose OpenCL kernels.
 //
 // =================================================================================================
 
@@ -59,15 +59,15 @@ class TunePadTranspose {
   static size_t GetSizeTemp(const Arguments<T> &) { return 1; } // N/A for this kernel
 
   // Sets the tuning parameters and their possible values
-  static void SetParameters(cltune::Tuner &tuner, const size_t id) {
+  static void SetParameters(TuningSession &tuner, const size_t id) {
     tuner.AddParameter(id, "PADTRA_TILE", {8, 16, 32, 64});
     tuner.AddParameter(id, "PADTRA_WPT", {1, 2, 4, 8, 16});
     tuner.AddParameter(id, "PADTRA_PAD", {0, 1});
   }
 
   // Sets the constraints and local memory size
-  static void SetConstraints(cltune::Tuner &, const size_t) { }
-  static void SetLocalMemorySize(cltune::Tuner &tuner, const size_t id, const Arguments<T> &args) {
+  static void SetConstraints(TuningSession &, const size_t) { }
+  static void SetLocalMemorySize(TuningSession &tuner, const size_t id, const Arguments<T> &args) {
     auto LocalMemorySize = [args] (std::vector<size_t> v) {
       return ((v[0]*v[1]*(v[0]*v[1]+v[2]))*GetBytes(args.precision));
     };
@@ -88,7 +88,7 @@ class TunePadTranspose {
   static TransformVector DivGlobal() { return {{"PADTRA_WPT", "PADTRA_WPT"}}; }
 
   // Sets the kernel's arguments
-  static void SetArguments(cltune::Tuner &tuner, const Arguments<T> &args,
+  static void SetArguments(TuningSession &tuner, const Arguments<T> &args,
                            std::vector<T> &, std::vector<T> &,
                            std::vector<T> &a_mat, std::vector<T> &b_mat, std::vector<T> &,
                            std::vector<T> &) {
@@ -118,6 +118,7 @@ class TunePadTranspose {
 
 // Shortcuts to the clblast namespace
 using half = clblast::half;
+using bfloat16 = clblast::bfloat16;
 using float2 = clblast::float2;
 using double2 = clblast::double2;
 
@@ -126,6 +127,7 @@ int main(int argc, char *argv[]) {
   const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
   switch(clblast::GetPrecision(command_line_args)) {
     case clblast::Precision::kHalf: clblast::Tuner<clblast::TunePadTranspose<half>, half>(argc, argv); break;
+    case clblast::Precision::kBFloat16: clblast::Tuner<clblast::TunePadTranspose<bfloat16>, bfloat16>(argc, argv); break;
     case clblast::Precision::kSingle: clblast::Tuner<clblast::TunePadTranspose<float>, float>(argc, argv); break;
     case clblast::Precision::kDouble: clblast::Tuner<clblast::TunePadTranspose<double>, double>(argc, argv); break;
     case clblast::Precision::kComplexSingle: clblast::Tuner<clblast::TunePadTranspose<float2>, float2>(argc, argv); break;
@@ -7,7 +7,7 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file uses the CLTune auto-tuner to tune the xaxpy OpenCL kernels.
+// This file uses the auto-tuner to tune the xaxpy OpenCL kernels.
 //
 // =================================================================================================
 
@@ -63,15 +63,15 @@ class TuneXaxpy {
   static size_t GetSizeTemp(const Arguments<T> &) { return 1; } // N/A for this kernel
 
   // Sets the tuning parameters and their possible values
-  static void SetParameters(cltune::Tuner &tuner, const size_t id) {
+  static void SetParameters(TuningSession &tuner, const size_t id) {
     tuner.AddParameter(id, "WGS", {64, 128, 256, 512, 1024, 2048});
     tuner.AddParameter(id, "WPT", {1, 2, 4, 8});
     tuner.AddParameter(id, "VW", {1, 2, 4, 8});
   }
 
   // Sets the constraints and local memory size
-  static void SetConstraints(cltune::Tuner &, const size_t) { }
-  static void SetLocalMemorySize(cltune::Tuner &, const size_t, const Arguments<T> &) { }
+  static void SetConstraints(TuningSession &, const size_t) { }
+  static void SetLocalMemorySize(TuningSession &, const size_t, const Arguments<T> &) { }
 
   // Sets the base thread configuration
   static std::vector<size_t> GlobalSize(const Arguments<T> &args) { return {args.n}; }
@@ -87,7 +87,7 @@ class TuneXaxpy {
   static TransformVector DivGlobal() { return {{"WPT"},{"VW"}}; }
 
   // Sets the kernel's arguments
-  static void SetArguments(cltune::Tuner &tuner, const Arguments<T> &args,
+  static void SetArguments(TuningSession &tuner, const Arguments<T> &args,
                            std::vector<T> &x_vec, std::vector<T> &y_vec,
                            std::vector<T> &, std::vector<T> &, std::vector<T> &,
                            std::vector<T> &) {
@@ -109,6 +109,7 @@ class TuneXaxpy {
 
 // Shortcuts to the clblast namespace
 using half = clblast::half;
+using bfloat16 = clblast::bfloat16;
 using float2 = clblast::float2;
 using double2 = clblast::double2;
 
@@ -117,6 +118,7 @@ int main(int argc, char *argv[]) {
   const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
   switch(clblast::GetPrecision(command_line_args)) {
     case clblast::Precision::kHalf: clblast::Tuner<clblast::TuneXaxpy<half>, half>(argc, argv); break;
+    case clblast::Precision::kBFloat16: clblast::Tuner<clblast::TuneXaxpy<bfloat16>, bfloat16>(argc, argv); break;
     case clblast::Precision::kSingle: clblast::Tuner<clblast::TuneXaxpy<float>, float>(argc, argv); break;
     case clblast::Precision::kDouble: clblast::Tuner<clblast::TuneXaxpy<double>, double>(argc, argv); break;
     case clblast::Precision::kComplexSingle: clblast::Tuner<clblast::TuneXaxpy<float2>, float2>(argc, argv); break;
@@ -0,0 +1,163 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file uses the auto-tuner to tune the xsymv OpenCL kernels. Note that the results of the
+// first kernel are not verified, since they are partial results whose layout depends on the WGS1
+// and WPT1 parameters. The summation kernel is verified using the default tile size.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+
+#include "utilities/utilities.hpp"
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T, int V>
+class TuneXsymv {
+ public:
+
+  // The representative kernel and the source code
+  static std::string KernelFamily() { return "xsymv_"+std::to_string(V); }
+  static std::string KernelName() { return (V==1) ? "Xsymv" : "XsymvSum"; }
+  static std::string GetSources() {
+    return
+      #include "../src/kernels/common.opencl"
+      #include "../src/kernels/level2/xsymv.opencl"
+    ;
+  }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() { return {kArgN, kArgAlpha, kArgBeta}; }
+
+  // Tests for valid arguments
+  static void TestValidArguments(const Arguments<T> &) { }
+
+  // Sets the default values for the arguments
+  static size_t DefaultM() { return 1; } // N/A for this kernel
+  static size_t DefaultN() { return 2048; }
+  static size_t DefaultK() { return 1; } // N/A for this kernel
+  static size_t DefaultBatchCount() { return 1; } // N/A for this kernel
+  static double DefaultFraction() { return 1.0; } // N/A for this kernel
+  static size_t DefaultNumRuns() { return 10; } // run every kernel this many times for averaging
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T> &args) { return args.n; }
+  static size_t GetSizeY(const Arguments<T> &args) { return args.n; }
+  static size_t GetSizeA(const Arguments<T> &args) { return args.n * args.n; }
+  static size_t GetSizeB(const Arguments<T> &) { return 1; } // N/A for this kernel
+  static size_t GetSizeC(const Arguments<T> &) { return 1; } // N/A for this kernel
+  static size_t GetSizeTemp(const Arguments<T> &args) { return args.n * args.n; } // Worst case
+
+  // Sets the tuning parameters and their possible values
+  static void SetParameters(TuningSession &tuner, const size_t id) {
+    if (V==1) {
+      tuner.AddParameter(id, "WGS1", {16, 32, 64, 128});
+      tuner.AddParameter(id, "WPT1", {1, 2, 4});
+    }
+    else {
+      tuner.AddParameter(id, "WGS2", {32, 64, 128, 256, 512, 1024});
+    }
+  }
+
+  // Sets the constraints and local memory size
+  static void SetConstraints(TuningSession &, const size_t) { }
+  static void SetLocalMemorySize(TuningSession &tuner, const size_t id, const Arguments<T> &args) {
+    if (V==1) {
+      auto LocalMemorySize = [args] (std::vector<size_t> v) {
+        const auto block_size = v[0]*v[1];
+        return (block_size*(block_size + 1) + 2*block_size)*GetBytes(args.precision);
+      };
+      tuner.SetLocalMemoryUsage(id, LocalMemorySize, {"WGS1", "WPT1"});
+    }
+  }
+
+  // Sets the base thread configuration: for the main kernel a work-group per tile of the matrix
+  static std::vector<size_t> GlobalSize(const Arguments<T> &args) { return (V==1) ? std::vector<size_t>{args.n*args.n} : std::vector<size_t>{args.n}; }
+  static std::vector<size_t> GlobalSizeRef(const Arguments<T> &args) { return (V==1) ? std::vector<size_t>{args.n*args.n/32} : std::vector<size_t>{args.n}; }
+  static std::vector<size_t> LocalSize() { return {1}; }
+  static std::vector<size_t> LocalSizeRef() { return (V==1) ? std::vector<size_t>{32} : std::vector<size_t>{64}; }
+
+  // Transforms the thread configuration based on the parameters
+  using TransformVector = std::vector<std::vector<std::string>>;
+  static TransformVector MulLocal() { return (V==1) ? TransformVector{{"WGS1"}} : TransformVector{{"WGS2"}}; }
+  static TransformVector DivLocal() { return {}; }
+  static TransformVector MulGlobal() { return {}; }
+  static TransformVector DivGlobal() { return (V==1) ? TransformVector{{"WGS1"}, {"WPT1"}, {"WPT1"}} : TransformVector{}; }
+
+  // Sets the kernel's arguments
+  static void SetArguments(TuningSession &tuner, const Arguments<T> &args,
+                           std::vector<T> &x_vec, std::vector<T> &y_vec,
+                           std::vector<T> &a_mat, std::vector<T> &, std::vector<T> &,
+                           std::vector<T> &temp) {
+    if (V == 1) {
+      tuner.AddArgumentScalar(static_cast<int>(args.n));
+      tuner.AddArgumentScalar(1); // is_upper
+      tuner.AddArgumentScalar(0); // a_conjugate
+      tuner.AddArgumentInput(a_mat);
+      tuner.AddArgumentScalar(0);
+      tuner.AddArgumentScalar(static_cast<int>(args.n));
+      tuner.AddArgumentInput(x_vec);
+      tuner.AddArgumentScalar(0);
+      tuner.AddArgumentScalar(1);
+      tuner.AddArgumentInput(temp); // No output checking for the result - layout varies
+    }
+    else {
+      tuner.AddArgumentScalar(static_cast<int>(args.n));
+      tuner.AddArgumentScalar(GetRealArg(args.alpha));
+      tuner.AddArgumentScalar(GetRealArg(args.beta));
+      tuner.AddArgumentInput(temp);
+      tuner.AddArgumentOutput(y_vec);
+      tuner.AddArgumentScalar(0);
+      tuner.AddArgumentScalar(1);
+    }
+  }
+
+  // Describes how to compute the performance metrics: the main kernel reads the stored triangle
+  static size_t GetMetric(const Arguments<T> &args) {
+    return (V==1) ? ((args.n*(args.n + 1))/2 + 2*args.n) * GetBytes(args.precision) : 3 * args.n * GetBytes(args.precision);
+  }
+  static std::string PerformanceUnit() { return "GB/s"; }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// Shortcuts to the clblast namespace
+using half = clblast::half;
+using bfloat16 = clblast::bfloat16;
+using float2 = clblast::float2;
+using double2 = clblast::double2;
+
+// Function to tune a specific variation V (not within the clblast namespace)
+template <int V>
+void StartVariation(int argc, char *argv[]) {
+  const auto command_line_args = clblast::RetrieveCommandLineArguments(argc, argv);
+  switch(clblast::GetPrecision(command_line_args)) {
+    case clblast::Precision::kHalf: clblast::Tuner<clblast::TuneXsymv<half, V>, half>(argc, argv); break;
+    case clblast::Precision::kBFloat16: clblast::Tuner<clblast::TuneXsymv<bfloat16, V>, bfloat16>(argc, argv); break;
+    case clblast::Precision::kSingle: clblast::Tuner<clblast::TuneXsymv<float, V>, float>(argc, argv); break;
+    case clblast::Precision::kDouble: clblast::Tuner<clblast::TuneXsymv<double, V>, double>(argc, argv); break;
+    case clblast::Precision::kComplexSingle: clblast::Tuner<clblast::TuneXsymv<float2, V>, float2>(argc, argv); break;
+    case clblast::Precision::kComplexDouble: clblast::Tuner<clblast::TuneXsymv<double2, V>, double2>(argc, argv); break;
+  }
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  StartVariation<1>(argc, argv);
+  StartVariation<2>(argc, argv);
+  return 0;
+}
+
+// =================================================================================================
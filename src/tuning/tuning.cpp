@@ -0,0 +1,584 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the TuningSession class (see the header for information about the class).
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <mutex>
+#include <condition_variable>
+
+#include "tuning/tuning.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Compiles the programs of a list of configurations on a pool of worker threads, while the main
+// thread measures the ones compiled earlier. Workers run at most 'look_ahead' programs ahead of the
+// consumer to bound the amount of compiled programs held in memory.
+class ProgramCompiler {
+ public:
+  ProgramCompiler(const Context &context, const Device &device,
+                  const std::function<std::string(const size_t)> &source_of,
+                  const size_t num_programs, const size_t num_threads, const size_t look_ahead):
+      context_(context), device_(device), source_of_(source_of),
+      programs_(num_programs), done_(num_programs, false), errors_(num_programs),
+      look_ahead_(look_ahead) {
+    for (auto i = size_t{0}; i < num_threads; ++i) {
+      workers_.push_back(std::thread([this]() { Work(); }));
+    }
+  }
+
+  // Stops compilation of any programs which are not yet started
+  ~ProgramCompiler() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto &worker: workers_) { worker.join(); }
+  }
+
+  // Blocks until the program with the given index is compiled, which is handed over to the caller.
+  // Programs have to be retrieved in order. Compilation errors are re-thrown here.
+  Program Get(const size_t index) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    consumed_ = index + 1;
+    condition_.notify_all();
+    condition_.wait(lock, [this, index]() { return done_[index]; });
+    if (!errors_[index].empty()) { throw RuntimeError(errors_[index]); }
+    auto program = programs_[index];
+    programs_[index] = Program();
+    return program;
+  }
+
+ private:
+
+  // The worker's loop: takes the next program to compile as long as it is within the look-ahead
+  void Work() {
+    while (true) {
+      auto index = size_t{0};
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this]() {
+          return stop_ || next_ >= programs_.size() || next_ < consumed_ + look_ahead_;
+        });
+        if (stop_ || next_ >= programs_.size()) { return; }
+        index = next_;
+        ++next_;
+      }
+
+      // Compiles the program outside of the lock
+      auto program = Program();
+      auto error = std::string{};
+      try {
+        program = Program(context_, source_of_(index));
+        auto options = std::vector<std::string>{"-cl-std=" + CompilerStandard(device_)};
+        try {
+          program.Build(device_, options);
+        } catch (const CLError &e) {
+          if (e.status() == CL_BUILD_PROGRAM_FAILURE) {
+            error = "compilation failed: " + program.GetBuildInfo(device_);
+          }
+          else { throw; }
+        }
+      } catch (const std::exception &e) {
+        error = e.what();
+      }
+
+      // Stores the result and notifies the consumer
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        programs_[index] = program;
+        errors_[index] = error;
+        done_[index] = true;
+      }
+      condition_.notify_all();
+    }
+  }
+
+  const Context context_;
+  const Device device_;
+  const std::function<std::string(const size_t)> source_of_;
+  std::vector<Program> programs_;
+  std::vector<bool> done_;
+  std::vector<std::string> errors_;
+  const size_t look_ahead_;
+  size_t next_ = 0;
+  size_t consumed_ = 0;
+  bool stop_ = false;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::vector<std::thread> workers_;
+};
+
+// =================================================================================================
+
+// Definitions of the class constants, required as they are odr-used
+constexpr double TuningSession::kTolerance;
+constexpr double TuningSession::kToleranceHalf;
+
+// Constructor: initializes the OpenCL objects
+TuningSession::TuningSession(const size_t platform_id, const size_t device_id):
+    platform_(Platform(platform_id)),
+    device_(Device(platform_, device_id)),
+    context_(Context(device_)),
+    queue_(Queue(context_, device_)) {
+}
+
+// =================================================================================================
+
+// Sets the kernel and the reference kernel
+size_t TuningSession::AddKernelFromString(const std::string &source,
+                                          const std::string &kernel_name,
+                                          const std::vector<size_t> &global,
+                                          const std::vector<size_t> &local) {
+  kernel_ = KernelInfo{source, kernel_name, global, local};
+  return 0;
+}
+void TuningSession::SetReferenceFromString(const std::string &source,
+                                           const std::string &kernel_name,
+                                           const std::vector<size_t> &global,
+                                           const std::vector<size_t> &local) {
+  reference_ = KernelInfo{source, kernel_name, global, local};
+}
+
+// Sets the parameters, constraints, and local memory usage
+void TuningSession::AddParameter(const size_t, const std::string &name,
+                                 const std::vector<size_t> &values) {
+  parameters_.push_back({name, values});
+}
+void TuningSession::AddParameterReference(const std::string &name, const size_t value) {
+  reference_parameters_.push_back({name, value});
+}
+void TuningSession::AddConstraint(const size_t, ConstraintFunction valid_if,
+                                  const std::vector<std::string> &parameters) {
+  constraints_.push_back({valid_if, parameters});
+}
+void TuningSession::SetLocalMemoryUsage(const size_t, LocalMemoryFunction amount,
+                                        const std::vector<std::string> &parameters) {
+  local_memory_.push_back({amount, parameters});
+}
+
+// Sets the thread-configuration transformations
+void TuningSession::MulLocalSize(const size_t, const std::vector<std::string> &parameters) {
+  transforms_.push_back({Transform::kMulLocal, parameters});
+}
+void TuningSession::DivLocalSize(const size_t, const std::vector<std::string> &parameters) {
+  transforms_.push_back({Transform::kDivLocal, parameters});
+}
+void TuningSession::MulGlobalSize(const size_t, const std::vector<std::string> &parameters) {
+  transforms_.push_back({Transform::kMulGlobal, parameters});
+}
+void TuningSession::DivGlobalSize(const size_t, const std::vector<std::string> &parameters) {
+  transforms_.push_back({Transform::kDivGlobal, parameters});
+}
+
+// Sets the search strategy and the settings
+void TuningSession::UseFullSearch() { fraction_ = 1.0; }
+void TuningSession::UseRandomSearch(const double fraction) { fraction_ = fraction; }
+void TuningSession::SetNumRuns(const size_t num_runs) { num_runs_ = std::max(num_runs, size_t{1}); }
+void TuningSession::SetCompileThreads(const size_t num_threads) {
+  compile_threads_ = std::max(num_threads, size_t{1});
+}
+void TuningSession::SetTimeBudget(const double seconds) { time_budget_ = seconds; }
+void TuningSession::SetCheckpoint(const std::string &filename, const std::string &identifier) {
+  checkpoint_file_ = filename;
+  checkpoint_identifier_ = identifier;
+}
+
+// =================================================================================================
+
+// Runs the reference kernel and then measures all (remaining) configurations of the search-space
+void TuningSession::Tune() {
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  const auto start_time = std::chrono::steady_clock::now();
+  results_.clear();
+
+  // Runs the reference kernel and stores its output to verify against later
+  printf("[ RUN      ] Running the reference kernel '%s'\n", reference_.name.c_str());
+  {
+    auto program = Program(context_, ConfigurationSource(reference_parameters_, reference_.source));
+    auto options = std::vector<std::string>{"-cl-std=" + CompilerStandard(device_)};
+    program.Build(device_, options);
+    auto time_ms = Measure(program, reference_.name, reference_.global, reference_.local, 1);
+    if (time_ms < 0.0f) { throw RuntimeError("TuningSession: reference kernel failed to run"); }
+    for (auto &argument: arguments_) {
+      if (argument.store) { argument.store(); }
+    }
+  }
+
+  // Collects the configurations to measure, possibly a random sample of the full search-space
+  auto configurations = ExploreSearchSpace();
+  if (fraction_ < 1.0) {
+    std::mt19937 mt(kSeed);
+    std::shuffle(configurations.begin(), configurations.end(), mt);
+    const auto num_samples = static_cast<size_t>(fraction_ * configurations.size());
+    configurations.resize(std::max(num_samples, std::min(size_t{1}, configurations.size())));
+  }
+
+  // Restores the results measured by an earlier run of the same session
+  auto checkpoint = std::vector<std::pair<std::string, float>>();
+  LoadCheckpoint(checkpoint);
+  auto remaining = std::vector<Configuration>();
+  for (const auto &configuration: configurations) {
+    const auto key = ConfigurationKey(configuration);
+    auto found = std::find_if(checkpoint.begin(), checkpoint.end(),
+                              [&key](const std::pair<std::string, float> &entry) {
+                                return entry.first == key;
+                              });
+    if (found != checkpoint.end()) { results_.push_back(Result{configuration, found->second}); }
+    else { remaining.push_back(configuration); }
+  }
+  printf("[ -------> ] %d configurations to explore", static_cast<int>(configurations.size()));
+  if (!results_.empty()) {
+    printf(", %d restored from '%s'", static_cast<int>(results_.size()), checkpoint_file_.c_str());
+  }
+  printf(", compiling on %d threads\n", static_cast<int>(compile_threads_));
+
+  // Compiles the programs ahead of the measurements
+  const auto source_of = [this, &remaining](const size_t index) {
+    return ConfigurationSource(remaining[index], kernel_.source);
+  };
+  ProgramCompiler compiler(context_, device_, source_of, remaining.size(),
+                           compile_threads_, 2 * compile_threads_);
+
+  // Measures the configurations in order, stopping when the time budget is exceeded
+  auto budget_exceeded = false;
+  for (auto i = size_t{0}; i < remaining.size(); ++i) {
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time);
+    if (time_budget_ > 0.0 && elapsed.count() > time_budget_) {
+      budget_exceeded = true;
+      break;
+    }
+    const auto &configuration = remaining[i];
+    auto global = std::vector<size_t>();
+    auto local = std::vector<size_t>();
+    ThreadConfiguration(configuration, global, local);
+    auto time_ms = -1.0f;
+    auto message = std::string{};
+    try {
+      const auto program = compiler.Get(i);
+      time_ms = Measure(program, kernel_.name, global, local, num_runs_);
+      if (time_ms < 0.0f) { message = "kernel failed to run"; }
+      for (auto &argument: arguments_) {
+        if (time_ms >= 0.0f && argument.verify && !argument.verify()) {
+          time_ms = -1.0f;
+          message = "results differ from the reference";
+        }
+      }
+    } catch (const std::exception &e) {
+      message = e.what();
+    }
+    results_.push_back(Result{configuration, time_ms});
+    StoreCheckpoint(results_.back());
+
+    // Reports the progress
+    printf("[ %4d/%4d ] ", static_cast<int>(results_.size()),
+           static_cast<int>(configurations.size()));
+    if (time_ms >= 0.0f) { printf("%9.3lf ms;", time_ms); }
+    else { printf("  skipped;"); }
+    for (const auto &parameter: configuration) {
+      printf(" %s %d", parameter.first.c_str(), static_cast<int>(parameter.second));
+    }
+    if (!message.empty()) { printf(" (%s)", message.substr(0, message.find('\n')).c_str()); }
+    printf("\n");
+  }
+
+  // Keeps the checkpoint only if the session is not completed yet
+  if (budget_exceeded) {
+    printf("[ -------> ] Time budget of %.0lf seconds exceeded after %d of %d configurations, "
+           "re-run to resume from '%s'\n", time_budget_, static_cast<int>(results_.size()),
+           static_cast<int>(configurations.size()), checkpoint_file_.c_str());
+  }
+  else if (!checkpoint_file_.empty()) {
+    std::remove(checkpoint_file_.c_str());
+  }
+}
+
+// =================================================================================================
+
+// Returns the time of the best configuration and prints it to screen
+double TuningSession::PrintToScreen() const {
+  auto best = results_.end();
+  for (auto it = results_.begin(); it != results_.end(); ++it) {
+    if (it->time >= 0.0f && (best == results_.end() || it->time < best->time)) { best = it; }
+  }
+  if (best == results_.end()) {
+    printf("[ -------> ] No valid configuration found\n");
+    return 0.0;
+  }
+  printf("[ -------> ] The best configuration is: ");
+  for (const auto &parameter: best->configuration) {
+    printf("%s %d; ", parameter.first.c_str(), static_cast<int>(parameter.second));
+  }
+  printf("\n");
+  return best->time;
+}
+
+// Prints the best configuration in the format of the database
+void TuningSession::PrintFormatted() const {
+  auto best = results_.end();
+  for (auto it = results_.begin(); it != results_.end(); ++it) {
+    if (it->time >= 0.0f && (best == results_.end() || it->time < best->time)) { best = it; }
+  }
+  if (best == results_.end()) { return; }
+  printf("[ -------> ] { \"%s\", { ", kernel_.name.c_str());
+  auto first = true;
+  for (const auto &parameter: best->configuration) {
+    if (parameter.first == "PRECISION") { continue; }
+    printf("%s{\"%s\",%d}", (first) ? "" : ", ", parameter.first.c_str(),
+           static_cast<int>(parameter.second));
+    first = false;
+  }
+  printf(" } }\n");
+}
+
+// Outputs all valid results to a JSON file, in the format expected by the database scripts
+void TuningSession::PrintJSON(const std::string &filename,
+                              const std::vector<std::pair<std::string,std::string>> &metadata) const {
+  auto file = fopen(filename.c_str(), "w");
+  if (file == nullptr) { throw RuntimeError("TuningSession: unable to write to '" + filename + "'"); }
+  fprintf(file, "{\n");
+  for (const auto &data: metadata) {
+    fprintf(file, "  \"%s\": \"%s\",\n", data.first.c_str(), data.second.c_str());
+  }
+  fprintf(file, "  \"device\": \"%s\",\n", device_.Name().c_str());
+  fprintf(file, "  \"device_vendor\": \"%s\",\n", device_.Vendor().c_str());
+  fprintf(file, "  \"device_type\": \"%s\",\n", device_.Type().c_str());
+  fprintf(file, "  \"device_core_clock\": \"%d\",\n", static_cast<int>(device_.CoreClock()));
+  fprintf(file, "  \"device_compute_units\": \"%d\",\n", static_cast<int>(device_.ComputeUnits()));
+  fprintf(file, "  \"results\": [\n");
+  auto first = true;
+  for (const auto &result: results_) {
+    if (result.time < 0.0f) { continue; }
+    fprintf(file, "%s    {\n", (first) ? "" : ",\n");
+    fprintf(file, "      \"kernel\": \"%s\",\n", kernel_.name.c_str());
+    fprintf(file, "      \"time\": %.3lf,\n", result.time);
+    fprintf(file, "      \"parameters\": {");
+    for (auto i = size_t{0}; i < result.configuration.size(); ++i) {
+      fprintf(file, "\"%s\": %d%s", result.configuration[i].first.c_str(),
+              static_cast<int>(result.configuration[i].second),
+              (i + 1 < result.configuration.size()) ? "," : "");
+    }
+    fprintf(file, "}\n    }");
+    first = false;
+  }
+  fprintf(file, "\n  ]\n}\n");
+  fclose(file);
+  printf("[ -------> ] Results written to '%s'\n", filename.c_str());
+}
+
+// =================================================================================================
+
+// Enumerates all combinations of parameter values, keeping only those which satisfy the
+// constraints, which fit in local memory, and which have a valid thread configuration
+std::vector<TuningSession::Configuration> TuningSession::ExploreSearchSpace() const {
+  auto configurations = std::vector<Configuration>();
+  auto indices = std::vector<size_t>(parameters_.size(), 0);
+  for (const auto &parameter: parameters_) {
+    if (parameter.second.empty()) { return configurations; }
+  }
+  while (true) {
+    auto configuration = Configuration();
+    for (auto p = size_t{0}; p < parameters_.size(); ++p) {
+      configuration.push_back({parameters_[p].first, parameters_[p].second[indices[p]]});
+    }
+
+    // Tests the validity of this configuration
+    auto valid = true;
+    for (const auto &constraint: constraints_) {
+      if (!constraint.first(Values(configuration, constraint.second))) { valid = false; break; }
+    }
+    for (const auto &local_memory: local_memory_) {
+      if (!valid) { break; }
+      const auto bytes = local_memory.first(Values(configuration, local_memory.second));
+      valid = device_.IsLocalMemoryValid(bytes);
+    }
+    if (valid) {
+      auto global = std::vector<size_t>();
+      auto local = std::vector<size_t>();
+      ThreadConfiguration(configuration, global, local);
+      valid = device_.IsThreadConfigValid(local);
+    }
+    if (valid) { configurations.push_back(configuration); }
+
+    // Moves on to the next combination of values
+    auto p = size_t{0};
+    for (; p < parameters_.size(); ++p) {
+      if (++indices[p] < parameters_[p].second.size()) { break; }
+      indices[p] = 0;
+    }
+    if (p == parameters_.size()) { break; }
+  }
+  return configurations;
+}
+
+// Retrieves the values of the named parameters from a configuration
+std::vector<size_t> TuningSession::Values(const Configuration &configuration,
+                                          const std::vector<std::string> &parameters) {
+  auto values = std::vector<size_t>();
+  for (const auto &name: parameters) {
+    auto found = std::find_if(configuration.begin(), configuration.end(),
+                              [&name](const std::pair<std::string, size_t> &parameter) {
+                                return parameter.first == name;
+                              });
+    if (found == configuration.end()) {
+      throw LogicError("TuningSession: unknown parameter '" + name + "'");
+    }
+    values.push_back(found->second);
+  }
+  return values;
+}
+
+// Computes the global and local thread-sizes of a configuration
+void TuningSession::ThreadConfiguration(const Configuration &configuration,
+                                        std::vector<size_t> &global,
+                                        std::vector<size_t> &local) const {
+  global = kernel_.global;
+  local = kernel_.local;
+  for (const auto &transform: transforms_) {
+    const auto values = Values(configuration, transform.second);
+    auto &sizes = (transform.first == Transform::kMulLocal ||
+                   transform.first == Transform::kDivLocal) ? local : global;
+    for (auto i = size_t{0}; i < values.size() && i < sizes.size(); ++i) {
+      if (transform.first == Transform::kMulLocal || transform.first == Transform::kMulGlobal) {
+        sizes[i] *= values[i];
+      }
+      else {
+        sizes[i] /= values[i];
+      }
+    }
+  }
+}
+
+// Prepends the values of the parameters as defines to the kernel source
+std::string TuningSession::ConfigurationSource(const Configuration &configuration,
+                                               const std::string &source) {
+  auto defines = std::string{""};
+  for (const auto &parameter: configuration) {
+    defines += "#define " + parameter.first + " " + std::to_string(parameter.second) + "\n";
+  }
+  return defines + source;
+}
+
+// Identifies a configuration in the checkpoint file
+std::string TuningSession::ConfigurationKey(const Configuration &configuration) {
+  auto key = std::string{""};
+  for (const auto &parameter: configuration) {
+    key += parameter.first + "=" + std::to_string(parameter.second) + ",";
+  }
+  return key;
+}
+
+// Runs a compiled kernel a number of times and returns the average time in ms (or -1 on failure)
+float TuningSession::Measure(const Program &program, const std::string &kernel_name,
+                             const std::vector<size_t> &global, const std::vector<size_t> &local,
+                             const size_t num_runs) {
+  try {
+    auto kernel = Kernel(program, kernel_name);
+    for (auto i = size_t{0}; i < arguments_.size(); ++i) {
+      arguments_[i].set(kernel, i);
+    }
+    auto total_time = 0.0f;
+    for (auto run = size_t{0}; run < num_runs; ++run) {
+      for (auto &argument: arguments_) {
+        if (argument.reset) { argument.reset(); }
+      }
+      auto event = Event();
+      kernel.Launch(queue_, global, local, event.pointer());
+      queue_.Finish();
+      total_time += event.GetElapsedTime();
+    }
+    return total_time / static_cast<float>(num_runs);
+  } catch (const CLError &) {
+    return -1.0f;
+  }
+}
+
+// =================================================================================================
+
+// Loads the measurements of an earlier run of this session. A checkpoint of another session
+// (e.g. for another device or other arguments) is ignored and will be overwritten.
+void TuningSession::LoadCheckpoint(std::vector<std::pair<std::string, float>> &entries) const {
+  if (checkpoint_file_.empty()) { return; }
+  std::ifstream file(checkpoint_file_);
+  auto line = std::string{};
+  if (!file.is_open() || !std::getline(file, line)) { return; }
+  if (line != checkpoint_identifier_) {
+    printf("[ -------> ] Ignoring checkpoint '%s' of a different session\n",
+           checkpoint_file_.c_str());
+    std::remove(checkpoint_file_.c_str());
+    return;
+  }
+  // Each record is of the form "key;time;", the final separator marking it as completely written.
+  // Malformed records (e.g. a partially written last line) are skipped and measured again.
+  auto line_number = size_t{1};
+  while (std::getline(file, line)) {
+    line_number++;
+    const auto separator = line.find(';');
+    auto valid = (separator != std::string::npos && separator > 0 &&
+                  line.size() > separator + 2 && line.back() == ';');
+    auto time = 0.0f;
+    if (valid) {
+      const auto value = line.substr(separator + 1, line.size() - separator - 2);
+      auto parsed = size_t{0};
+      try { time = std::stof(value, &parsed); } catch (const std::exception &) { parsed = 0; }
+      valid = (parsed == value.size() && std::isfinite(time));
+    }
+    if (!valid) {
+      printf("[ -------> ] Skipping malformed line %d of checkpoint '%s'\n",
+             static_cast<int>(line_number), checkpoint_file_.c_str());
+      continue;
+    }
+    entries.push_back({line.substr(0, separator), time});
+  }
+}
+
+// Appends a single measurement to the checkpoint, creating the file if needed. Each record is
+// terminated by a separator and flushed, such that a partially written record can be detected.
+void TuningSession::StoreCheckpoint(const Result &result) const {
+  if (checkpoint_file_.empty()) { return; }
+  const auto exists = std::ifstream(checkpoint_file_).good();
+  std::ofstream file(checkpoint_file_, std::ios::app);
+  if (!exists) { file << checkpoint_identifier_ << std::endl; }
+  file << ConfigurationKey(result.configuration) << ";" << result.time << ";" << std::endl;
+}
+
+// =================================================================================================
+
+// Squared differences of the various data-types, used to verify against the reference
+double TuningSession::SquaredDifference(const half a, const half b) {
+  return SquaredDifference(HalfToFloat(a), HalfToFloat(b));
+}
+double TuningSession::SquaredDifference(const bfloat16 a, const bfloat16 b) {
+  return SquaredDifference(BFloat16ToFloat(a), BFloat16ToFloat(b));
+}
+double TuningSession::SquaredDifference(const float a, const float b) {
+  return static_cast<double>((a - b) * (a - b));
+}
+double TuningSession::SquaredDifference(const double a, const double b) {
+  return (a - b) * (a - b);
+}
+double TuningSession::SquaredDifference(const float2 a, const float2 b) {
+  return static_cast<double>(std::norm(a - b));
+}
+double TuningSession::SquaredDifference(const double2 a, const double2 b) {
+  return std::norm(a - b);
+}
+
+// =================================================================================================
+} // namespace clblast
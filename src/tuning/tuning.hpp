@@ -7,8 +7,11 @@
 // Author(s):
 //   Cedric Nugteren <www.cedricnugteren.nl>
 //
-// This file implements the interface to the CLTune auto-tuner. This is only used for the optional
-// and stand-alone tuner binaries and not part of the core of CLBlast.
+// This file implements the auto-tuner used by the tuner binaries. It explores the search-space of
+// a kernel's parameters, compiles the candidate programs ahead of time on a pool of threads while
+// the device measures previously compiled candidates, and checkpoints each measurement to disk so
+// that an interrupted session can be resumed. This is only used for the optional and stand-alone
+// tuner binaries and not part of the core of CLBlast.
 //
 // =================================================================================================
 
@@ -17,15 +20,202 @@
 
 #include <vector>
 #include <string>
+#include <algorithm>
 #include <random>
-
-#include <cltune.h>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <thread>
 
 #include "utilities/utilities.hpp"
 
 namespace clblast {
 // =================================================================================================
 
+// A tuning session for a single kernel. The interface follows that of CLTune: the kernel and its
+// reference are added from source, followed by the tunable parameters, the constraints, the
+// thread-configuration transformations, and the arguments. Calling 'Tune' runs the search.
+class TuningSession {
+ public:
+  using Configuration = std::vector<std::pair<std::string, size_t>>;
+  using ConstraintFunction = std::function<bool(std::vector<size_t>)>;
+  using LocalMemoryFunction = std::function<size_t(std::vector<size_t>)>;
+
+  // Initializes the OpenCL context and queue for the chosen device
+  explicit TuningSession(const size_t platform_id, const size_t device_id);
+
+  // Sets the kernel to tune and the reference kernel to verify against. Only a single kernel is
+  // supported per session, its identifier is returned for compatibility with the CLTune interface.
+  size_t AddKernelFromString(const std::string &source, const std::string &kernel_name,
+                             const std::vector<size_t> &global, const std::vector<size_t> &local);
+  void SetReferenceFromString(const std::string &source, const std::string &kernel_name,
+                              const std::vector<size_t> &global, const std::vector<size_t> &local);
+
+  // Sets the tunable parameters, the constraints among them, and the local memory they require
+  void AddParameter(const size_t id, const std::string &name, const std::vector<size_t> &values);
+  void AddParameterReference(const std::string &name, const size_t value);
+  void AddConstraint(const size_t id, ConstraintFunction valid_if,
+                     const std::vector<std::string> &parameters);
+  void SetLocalMemoryUsage(const size_t id, LocalMemoryFunction amount,
+                           const std::vector<std::string> &parameters);
+
+  // Modifies the global and local thread-sizes based on the parameters (applied in order)
+  void MulLocalSize(const size_t id, const std::vector<std::string> &parameters);
+  void DivLocalSize(const size_t id, const std::vector<std::string> &parameters);
+  void MulGlobalSize(const size_t id, const std::vector<std::string> &parameters);
+  void DivGlobalSize(const size_t id, const std::vector<std::string> &parameters);
+
+  // Adds kernel arguments in order: scalars, read-only buffers, and buffers which are verified
+  template <typename U>
+  void AddArgumentScalar(const U value) {
+    auto argument = Argument{};
+    argument.set = [value](Kernel &kernel, const size_t index) { kernel.SetArgument(index, value); };
+    arguments_.push_back(argument);
+  }
+  template <typename U>
+  void AddArgumentInput(std::vector<U> &source) {
+    auto buffer = Buffer<U>(context_, source.size());
+    arguments_.push_back(BufferArgument(buffer, source));
+  }
+  template <typename U>
+  void AddArgumentOutput(std::vector<U> &source) {
+    auto buffer = Buffer<U>(context_, source.size());
+    auto argument = BufferArgument(buffer, source);
+    auto reference = std::make_shared<std::vector<U>>(source.size());
+    auto queue = queue_;
+    auto tolerance = (sizeof(U) == sizeof(half)) ? kToleranceHalf : kTolerance;
+    argument.store = [queue, buffer, reference]() {
+      buffer.Read(queue, reference->size(), *reference);
+    };
+    argument.verify = [queue, buffer, reference, tolerance]() {
+      auto result = std::vector<U>(reference->size());
+      buffer.Read(queue, result.size(), result);
+      auto difference = 0.0;
+      auto magnitude = 0.0;
+      for (auto i = size_t{0}; i < result.size(); ++i) {
+        difference += SquaredDifference((*reference)[i], result[i]);
+        magnitude += SquaredDifference((*reference)[i], U{});
+      }
+      return difference <= tolerance * tolerance * std::max(magnitude, 1.0);
+    };
+    arguments_.push_back(argument);
+  }
+
+  // Search strategies: either all configurations or a random fraction of them
+  void UseFullSearch();
+  void UseRandomSearch(const double fraction);
+
+  // Settings of the measurement loop: the number of runs per configuration (averaged), the number
+  // of threads compiling ahead, the wall-clock time budget in seconds (0 for unlimited), and the
+  // checkpoint file with the identifier of the session it belongs to
+  void SetNumRuns(const size_t num_runs);
+  void SetCompileThreads(const size_t num_threads);
+  void SetTimeBudget(const double seconds);
+  void SetCheckpoint(const std::string &filename, const std::string &identifier);
+
+  // Runs the reference and explores the search-space
+  void Tune();
+
+  // Reports the results: returns the time of the best configuration (0 if none), prints the best
+  // configuration in database format, or writes all results to a JSON file for the database scripts
+  double PrintToScreen() const;
+  void PrintFormatted() const;
+  void PrintJSON(const std::string &filename,
+                 const std::vector<std::pair<std::string,std::string>> &metadata) const;
+
+ private:
+
+  // Tolerances for the relative L2-norm of the difference with the reference
+  static constexpr auto kTolerance = 1.0e-4;
+  static constexpr auto kToleranceHalf = 1.0e-2;
+
+  // Kernel arguments: a function to set it, and for buffers functions to reset its contents and
+  // optionally to store the reference output and to verify against it
+  struct Argument {
+    std::function<void(Kernel&, const size_t)> set;
+    std::function<void()> reset;
+    std::function<void()> store;
+    std::function<bool()> verify;
+  };
+  template <typename U>
+  Argument BufferArgument(Buffer<U> buffer, std::vector<U> &source) const {
+    auto argument = Argument{};
+    auto queue = queue_;
+    argument.set = [buffer](Kernel &kernel, const size_t index) mutable {
+      kernel.SetArgument(index, buffer);
+    };
+    argument.reset = [queue, buffer, &source]() mutable {
+      buffer.Write(queue, source.size(), source);
+    };
+    return argument;
+  }
+  static double SquaredDifference(const half a, const half b);
+  static double SquaredDifference(const bfloat16 a, const bfloat16 b);
+  static double SquaredDifference(const float a, const float b);
+  static double SquaredDifference(const double a, const double b);
+  static double SquaredDifference(const float2 a, const float2 b);
+  static double SquaredDifference(const double2 a, const double2 b);
+
+  // A kernel with its thread configuration
+  struct KernelInfo {
+    std::string source;
+    std::string name;
+    std::vector<size_t> global;
+    std::vector<size_t> local;
+  };
+
+  // A transformation of the thread configuration by the values of parameters
+  enum class Transform { kMulLocal, kDivLocal, kMulGlobal, kDivGlobal };
+
+  // The outcome of a single configuration
+  struct Result {
+    Configuration configuration;
+    float time; // in ms, negative for configurations which failed or produced wrong results
+  };
+
+  // Helpers for the search, the measurements, and the checkpoint
+  std::vector<Configuration> ExploreSearchSpace() const;
+  static std::vector<size_t> Values(const Configuration &configuration,
+                                    const std::vector<std::string> &parameters);
+  void ThreadConfiguration(const Configuration &configuration,
+                           std::vector<size_t> &global, std::vector<size_t> &local) const;
+  static std::string ConfigurationSource(const Configuration &configuration,
+                                         const std::string &source);
+  static std::string ConfigurationKey(const Configuration &configuration);
+  float Measure(const Program &program, const std::string &kernel_name,
+                const std::vector<size_t> &global, const std::vector<size_t> &local,
+                const size_t num_runs);
+  void LoadCheckpoint(std::vector<std::pair<std::string, float>> &entries) const;
+  void StoreCheckpoint(const Result &result) const;
+
+  // The OpenCL objects and the data
+  Platform platform_;
+  Device device_;
+  Context context_;
+  Queue queue_;
+  std::vector<Argument> arguments_;
+
+  // The kernels and the search-space
+  KernelInfo kernel_;
+  KernelInfo reference_;
+  Configuration reference_parameters_;
+  std::vector<std::pair<std::string, std::vector<size_t>>> parameters_;
+  std::vector<std::pair<ConstraintFunction, std::vector<std::string>>> constraints_;
+  std::vector<std::pair<LocalMemoryFunction, std::vector<std::string>>> local_memory_;
+  std::vector<std::pair<Transform, std::vector<std::string>>> transforms_;
+
+  // Settings and results
+  double fraction_ = 1.0;
+  size_t num_runs_ = 1;
+  size_t compile_threads_ = 1;
+  double time_budget_ = 0.0;
+  std::string checkpoint_file_;
+  std::string checkpoint_identifier_;
+  std::vector<Result> results_;
+};
+
+// =================================================================================================
+
 // Function to get command-line argument, set-up the input buffers, configure the tuner, and collect
 // the results. Used for all types of kernel families. Note that this is a header-only function so
 // that it is automatically compiled for the various kernels (given as the 'C' template argument).
@@ -50,6 +240,9 @@ void Tuner(int argc, char* argv[]) {
     if (o == kArgBatchCount) { args.batch_count = GetArgument(command_line_args, help, kArgBatchCount, C::DefaultBatchCount()); }
   }
   const auto num_runs = GetArgument(command_line_args, help, kArgNumRuns, C::DefaultNumRuns());
+  const auto default_threads = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  const auto compile_threads = GetArgument(command_line_args, help, kArgCompileThreads, default_threads);
+  const auto time_budget = GetArgument(command_line_args, help, kArgTimeBudget, 0.0);
 
   fprintf(stdout, "%s\n", help.c_str());
 
@@ -60,6 +253,7 @@ void Tuner(int argc, char* argv[]) {
   auto isAMD = false;
   auto isARM = false;
   auto isGPU = false;
+  auto device_name = std::string{""};
   {
     const auto platform = Platform(args.platform_id);
     const auto device = Device(platform, args.device_id);
@@ -70,6 +264,7 @@ void Tuner(int argc, char* argv[]) {
     isAMD = device.IsAMD();
     isARM = device.IsARM();
     isGPU = device.IsGPU();
+    device_name = device.Name();
   }
 
   // Creates input buffers with random data
@@ -89,7 +284,7 @@ void Tuner(int argc, char* argv[]) {
   PopulateVector(temp, mt, dist);
 
   // Initializes the tuner for the chosen device
-  cltune::Tuner tuner(args.platform_id, args.device_id);
+  TuningSession tuner(args.platform_id, args.device_id);
 
   // Use full-search to explore all parameter combinations or random-search to search only a part of
   // the parameter values. The fraction is set as a command-line argument.
@@ -133,8 +328,28 @@ void Tuner(int argc, char* argv[]) {
   // Sets the function's arguments
   C::SetArguments(tuner, args, x_vec, y_vec, a_mat, b_mat, c_mat, temp);
 
-  // Starts the tuning process
+  // Collects the meta-data of this run, used both to identify the checkpoint and in the JSON output
+  auto precision_string = std::to_string(static_cast<size_t>(args.precision));
+  auto metadata = std::vector<std::pair<std::string,std::string>>{
+    {"kernel_family", C::KernelFamily()},
+    {"precision", precision_string}
+  };
+  for (auto &o: C::GetOptions()) {
+    if (o == kArgM)     { metadata.push_back({"arg_m", std::to_string(args.m)}); }
+    if (o == kArgN)     { metadata.push_back({"arg_n", std::to_string(args.n)}); }
+    if (o == kArgK)     { metadata.push_back({"arg_k", std::to_string(args.k)}); }
+    if (o == kArgAlpha) { metadata.push_back({"arg_alpha", ToString(args.alpha)}); }
+    if (o == kArgBeta)  { metadata.push_back({"arg_beta", ToString(args.beta)}); }
+    if (o == kArgBatchCount) { metadata.push_back({"arg_batch_count", ToString(args.batch_count)}); }
+  }
+  auto identifier = device_name + ";fraction=" + ToString(args.fraction);
+  for (auto &data: metadata) { identifier += ";" + data.first + "=" + data.second; }
+
+  // Starts the tuning process, resuming from the checkpoint of an earlier interrupted run if any
   tuner.SetNumRuns(num_runs);
+  tuner.SetCompileThreads(compile_threads);
+  tuner.SetTimeBudget(time_budget);
+  tuner.SetCheckpoint("clblast_"+C::KernelFamily()+"_"+precision_string+".checkpoint", identifier);
   tuner.Tune();
 
   // Prints the results to screen
@@ -148,19 +363,6 @@ void Tuner(int argc, char* argv[]) {
   }
 
   // Outputs the results as JSON to disk, including some meta-data
-  auto precision_string = std::to_string(static_cast<size_t>(args.precision));
-  auto metadata = std::vector<std::pair<std::string,std::string>>{
-    {"kernel_family", C::KernelFamily()},
-    {"precision", precision_string}
-  };
-  for (auto &o: C::GetOptions()) {
-    if (o == kArgM)     { metadata.push_back({"arg_m", std::to_string(args.m)}); }
-    if (o == kArgN)     { metadata.push_back({"arg_n", std::to_string(args.n)}); }
-    if (o == kArgK)     { metadata.push_back({"arg_k", std::to_string(args.k)}); }
-    if (o == kArgAlpha) { metadata.push_back({"arg_alpha", ToString(args.alpha)}); }
-    if (o == kArgBeta)  { metadata.push_back({"arg_beta", ToString(args.beta)}); }
-    if (o == kArgBatchCount) { metadata.push_back({"arg_batch_count", ToString(args.batch_count)}); }
-  }
   tuner.PrintJSON("clblast_"+C::KernelFamily()+"_"+precision_string+".json", metadata);
 }
 
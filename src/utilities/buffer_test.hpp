@@ -62,6 +62,24 @@ void TestMatrixAP(const size_t n, const Buffer<T> &buffer, const size_t offset)
   } catch (const Error<std::runtime_error> &e) { throw BLASError(StatusCode::kInvalidMatrixA, e.what()); }
 }
 
+// Tests whether an output matrix is allowed to share its buffer with an input matrix. This is only
+// valid if the two don't overlap, or if they are the exact same matrix and the input is processed
+// element-wise (e.g. not transposed), such that every value is read and written by the same thread.
+template <typename T>
+void TestMatrixAliasing(const size_t in_one, const size_t in_two, const Buffer<T> &in_buffer,
+                        const size_t in_offset, const size_t in_ld, const bool element_wise,
+                        const size_t out_one, const size_t out_two, const Buffer<T> &out_buffer,
+                        const size_t out_offset, const size_t out_ld) {
+  if (in_buffer() != out_buffer()) { return; }
+  const auto same_matrix = element_wise && (in_offset == out_offset) && (in_ld == out_ld);
+  if (same_matrix) { return; }
+  const auto in_end = in_ld * (in_two - 1) + in_one + in_offset;
+  const auto out_end = out_ld * (out_two - 1) + out_one + out_offset;
+  if (in_offset < out_end && out_offset < in_end) {
+    throw BLASError(StatusCode::kInvalidOperation, "overlapping input and output matrices");
+  }
+}
+
 // =================================================================================================
 
 // Tests vector 'X' for validity
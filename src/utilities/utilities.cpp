@@ -28,6 +28,7 @@ template <typename T> T GetScalar() { return static_cast<T>(2.0); }
 template float GetScalar<float>();
 template double GetScalar<double>();
 template <> half GetScalar() { return FloatToHalf(2.0f); }
+template <> bfloat16 GetScalar() { return FloatToBFloat16(2.0f); }
 template <> float2 GetScalar() { return {2.0f, 0.5f}; }
 template <> double2 GetScalar() { return {2.0, 0.5}; }
 
@@ -36,6 +37,7 @@ template <typename T> T ConstantZero() { return static_cast<T>(0.0); }
 template float ConstantZero<float>();
 template double ConstantZero<double>();
 template <> half ConstantZero() { return FloatToHalf(0.0f); }
+template <> bfloat16 ConstantZero() { return FloatToBFloat16(0.0f); }
 template <> float2 ConstantZero() { return {0.0f, 0.0f}; }
 template <> double2 ConstantZero() { return {0.0, 0.0}; }
 
@@ -44,6 +46,7 @@ template <typename T> T ConstantOne() { return static_cast<T>(1.0); }
 template float ConstantOne<float>();
 template double ConstantOne<double>();
 template <> half ConstantOne() { return FloatToHalf(1.0f); }
+template <> bfloat16 ConstantOne() { return FloatToBFloat16(1.0f); }
 template <> float2 ConstantOne() { return {1.0f, 0.0f}; }
 template <> double2 ConstantOne() { return {1.0, 0.0}; }
 
@@ -52,6 +55,7 @@ template <typename T> T ConstantNegOne() { return static_cast<T>(-1.0); }
 template float ConstantNegOne<float>();
 template double ConstantNegOne<double>();
 template <> half ConstantNegOne() { return FloatToHalf(-1.0f); }
+template <> bfloat16 ConstantNegOne() { return FloatToBFloat16(-1.0f); }
 template <> float2 ConstantNegOne() { return {-1.0f, 0.0f}; }
 template <> double2 ConstantNegOne() { return {-1.0, 0.0}; }
 
@@ -60,6 +64,7 @@ template <typename T> T Constant(const double val) { return static_cast<T>(val);
 template float Constant<float>(const double);
 template double Constant<double>(const double);
 template <> half Constant(const double val) { return FloatToHalf(static_cast<float>(val)); }
+template <> bfloat16 Constant(const double val) { return FloatToBFloat16(static_cast<float>(val)); }
 template <> float2 Constant(const double val) { return {static_cast<float>(val), 0.0f}; }
 template <> double2 Constant(const double val) { return {val, 0.0}; }
 
@@ -68,6 +73,7 @@ template <typename T> T SmallConstant() { return static_cast<T>(1e-4); }
 template float SmallConstant<float>();
 template double SmallConstant<double>();
 template <> half SmallConstant() { return FloatToHalf(1e-4f); }
+template <> bfloat16 SmallConstant() { return FloatToBFloat16(1e-4f); }
 template <> float2 SmallConstant() { return {1e-4f, 0.0f}; }
 template <> double2 SmallConstant() { return {1e-4, 0.0}; }
 
@@ -76,6 +82,7 @@ template <typename T> typename BaseType<T>::Type AbsoluteValue(const T value) {
 template float AbsoluteValue<float>(const float);
 template double AbsoluteValue<double>(const double);
 template <> half AbsoluteValue(const half value) { return FloatToHalf(std::fabs(HalfToFloat(value))); }
+template <> bfloat16 AbsoluteValue(const bfloat16 value) { return FloatToBFloat16(std::fabs(BFloat16ToFloat(value))); }
 template <> float AbsoluteValue(const float2 value) {
   if (value.real() == 0.0f && value.imag() == 0.0f) { return 0.0f; }
   return std::sqrt(value.real() * value.real() + value.imag() * value.imag());
@@ -90,6 +97,7 @@ template <typename T> bool IsCloseToZero(const T value) { return (value > -Small
 template bool IsCloseToZero<float>(const float);
 template bool IsCloseToZero<double>(const double);
 template <> bool IsCloseToZero(const half value) { return IsCloseToZero(HalfToFloat(value)); }
+template <> bool IsCloseToZero(const bfloat16 value) { return IsCloseToZero(BFloat16ToFloat(value)); }
 template <> bool IsCloseToZero(const float2 value) { return IsCloseToZero(value.real()) || IsCloseToZero(value.imag()); }
 template <> bool IsCloseToZero(const double2 value) { return IsCloseToZero(value.real()) || IsCloseToZero(value.imag()); }
 
@@ -131,6 +139,12 @@ std::string ToString(half value) {
   return std::to_string(HalfToFloat(value));
 }
 
+// If not possible directly: special case for bfloat16
+template <>
+std::string ToString(bfloat16 value) {
+  return std::to_string(BFloat16ToFloat(value));
+}
+
 // If not possible directly: special cases for CLBlast data-types
 template <>
 std::string ToString(Layout value) {
@@ -176,6 +190,7 @@ std::string ToString(Precision value) {
     case Precision::kDouble: return ToString(static_cast<int>(value))+" (double)";
     case Precision::kComplexSingle: return ToString(static_cast<int>(value))+" (complex-single)";
     case Precision::kComplexDouble: return ToString(static_cast<int>(value))+" (complex-double)";
+    case Precision::kBFloat16: return ToString(static_cast<int>(value))+" (bfloat16)";
     case Precision::kAny: return ToString(static_cast<int>(value))+" (any)";
   }
 }
@@ -222,6 +237,9 @@ template <> std::string ConvertArgument(const char* value) {
 template <> half ConvertArgument(const char* value) {
   return FloatToHalf(static_cast<float>(std::stod(value)));
 }
+template <> bfloat16 ConvertArgument(const char* value) {
+  return FloatToBFloat16(static_cast<float>(std::stod(value)));
+}
 template <> float ConvertArgument(const char* value) {
   return static_cast<float>(std::stod(value));
 }
@@ -275,6 +293,7 @@ T GetArgument(const std::vector<std::string> &arguments, std::string &help,
 template int GetArgument<int>(const std::vector<std::string>&, std::string&, const std::string&, const int);
 template size_t GetArgument<size_t>(const std::vector<std::string>&, std::string&, const std::string&, const size_t);
 template half GetArgument<half>(const std::vector<std::string>&, std::string&, const std::string&, const half);
+template bfloat16 GetArgument<bfloat16>(const std::vector<std::string>&, std::string&, const std::string&, const bfloat16);
 template float GetArgument<float>(const std::vector<std::string>&, std::string&, const std::string&, const float);
 template double GetArgument<double>(const std::vector<std::string>&, std::string&, const std::string&, const double);
 template float2 GetArgument<float2>(const std::vector<std::string>&, std::string&, const std::string&, const float2);
@@ -352,19 +371,25 @@ void PopulateVector(std::vector<half> &vector, std::mt19937 &mt, std::uniform_re
   for (auto &element: vector) { element = FloatToHalf(static_cast<float>(dist(mt))); }
 }
 
+// Specialized versions of the above for bfloat16
+template <>
+void PopulateVector(std::vector<bfloat16> &vector, std::mt19937 &mt, std::uniform_real_distribution<double> &dist) {
+  for (auto &element: vector) { element = FloatToBFloat16(static_cast<float>(dist(mt))); }
+}
+
 // =================================================================================================
 
 template <typename T, typename U>
 void DeviceToHost(const Arguments<U> &args, Buffers<T> &buffers, BuffersHost<T> &buffers_host,
                   Queue &queue, const std::vector<std::string> &names) {
   for (auto &name: names) {
-    if (name == kBufVecX) {buffers_host.x_vec = std::vector<T>(args.x_size, static_cast<T>(0)); buffers.x_vec.Read(queue, args.x_size, buffers_host.x_vec); }
-    else if (name == kBufVecY) { buffers_host.y_vec = std::vector<T>(args.y_size, static_cast<T>(0)); buffers.y_vec.Read(queue, args.y_size, buffers_host.y_vec); }
-    else if (name == kBufMatA) { buffers_host.a_mat = std::vector<T>(args.a_size, static_cast<T>(0)); buffers.a_mat.Read(queue, args.a_size, buffers_host.a_mat); }
-    else if (name == kBufMatB) { buffers_host.b_mat = std::vector<T>(args.b_size, static_cast<T>(0)); buffers.b_mat.Read(queue, args.b_size, buffers_host.b_mat); }
-    else if (name == kBufMatC) { buffers_host.c_mat = std::vector<T>(args.c_size, static_cast<T>(0)); buffers.c_mat.Read(queue, args.c_size, buffers_host.c_mat); }
-    else if (name == kBufMatAP) { buffers_host.ap_mat = std::vector<T>(args.ap_size, static_cast<T>(0)); buffers.ap_mat.Read(queue, args.ap_size, buffers_host.ap_mat); }
-    else if (name == kBufScalar) { buffers_host.scalar = std::vector<T>(args.scalar_size, static_cast<T>(0)); buffers.scalar.Read(queue, args.scalar_size, buffers_host.scalar); }
+    if (name == kBufVecX) {buffers_host.x_vec = std::vector<T>(args.x_size, ConstantZero<T>()); buffers.x_vec.Read(queue, args.x_size, buffers_host.x_vec); }
+    else if (name == kBufVecY) { buffers_host.y_vec = std::vector<T>(args.y_size, ConstantZero<T>()); buffers.y_vec.Read(queue, args.y_size, buffers_host.y_vec); }
+    else if (name == kBufMatA) { buffers_host.a_mat = std::vector<T>(args.a_size, ConstantZero<T>()); buffers.a_mat.Read(queue, args.a_size, buffers_host.a_mat); }
+    else if (name == kBufMatB) { buffers_host.b_mat = std::vector<T>(args.b_size, ConstantZero<T>()); buffers.b_mat.Read(queue, args.b_size, buffers_host.b_mat); }
+    else if (name == kBufMatC) { buffers_host.c_mat = std::vector<T>(args.c_size, ConstantZero<T>()); buffers.c_mat.Read(queue, args.c_size, buffers_host.c_mat); }
+    else if (name == kBufMatAP) { buffers_host.ap_mat = std::vector<T>(args.ap_size, ConstantZero<T>()); buffers.ap_mat.Read(queue, args.ap_size, buffers_host.ap_mat); }
+    else if (name == kBufScalar) { buffers_host.scalar = std::vector<T>(args.scalar_size, ConstantZero<T>()); buffers.scalar.Read(queue, args.scalar_size, buffers_host.scalar); }
     else { throw std::runtime_error("Invalid buffer name"); }
   }
 }
@@ -386,6 +411,7 @@ void HostToDevice(const Arguments<U> &args, Buffers<T> &buffers, BuffersHost<T>
 
 // Compiles the above functions
 template void DeviceToHost(const Arguments<half>&, Buffers<half>&, BuffersHost<half>&, Queue&, const std::vector<std::string>&);
+template void DeviceToHost(const Arguments<bfloat16>&, Buffers<bfloat16>&, BuffersHost<bfloat16>&, Queue&, const std::vector<std::string>&);
 template void DeviceToHost(const Arguments<float>&, Buffers<float>&, BuffersHost<float>&, Queue&, const std::vector<std::string>&);
 template void DeviceToHost(const Arguments<double>&, Buffers<double>&, BuffersHost<double>&, Queue&, const std::vector<std::string>&);
 template void DeviceToHost(const Arguments<float>&, Buffers<float2>&, BuffersHost<float2>&, Queue&, const std::vector<std::string>&);
@@ -393,6 +419,7 @@ template void DeviceToHost(const Arguments<double>&, Buffers<double2>&, BuffersH
 template void DeviceToHost(const Arguments<float2>&, Buffers<float2>&, BuffersHost<float2>&, Queue&, const std::vector<std::string>&);
 template void DeviceToHost(const Arguments<double2>&, Buffers<double2>&, BuffersHost<double2>&, Queue&, const std::vector<std::string>&);
 template void HostToDevice(const Arguments<half>&, Buffers<half>&, BuffersHost<half>&, Queue&, const std::vector<std::string>&);
+template void HostToDevice(const Arguments<bfloat16>&, Buffers<bfloat16>&, BuffersHost<bfloat16>&, Queue&, const std::vector<std::string>&);
 template void HostToDevice(const Arguments<float>&, Buffers<float>&, BuffersHost<float>&, Queue&, const std::vector<std::string>&);
 template void HostToDevice(const Arguments<double>&, Buffers<double>&, BuffersHost<double>&, Queue&, const std::vector<std::string>&);
 template void HostToDevice(const Arguments<float>&, Buffers<float2>&, BuffersHost<float2>&, Queue&, const std::vector<std::string>&);
@@ -435,14 +462,63 @@ void FloatToHalfBuffer(Buffer<half>& result, const Buffer<float>& source, cl_com
   result.Write(queue, size, result_cpu);
 }
 
+// Conversion between bfloat16 and single-precision
+std::vector<float> BFloat16ToFloatBuffer(const std::vector<bfloat16>& source) {
+  auto result = std::vector<float>(source.size());
+  for (auto i = size_t(0); i < source.size(); ++i) { result[i] = BFloat16ToFloat(source[i]); }
+  return result;
+}
+void FloatToBFloat16Buffer(std::vector<bfloat16>& result, const std::vector<float>& source) {
+  for (auto i = size_t(0); i < source.size(); ++i) { result[i] = FloatToBFloat16(source[i]); }
+}
+
+// As above, but now for OpenCL data-types instead of std::vectors
+Buffer<float> BFloat16ToFloatBuffer(const Buffer<bfloat16>& source, cl_command_queue queue_raw) {
+  const auto size = source.GetSize() / sizeof(bfloat16);
+  auto queue = Queue(queue_raw);
+  auto context = queue.GetContext();
+  auto source_cpu = std::vector<bfloat16>(size);
+  source.Read(queue, size, source_cpu);
+  auto result_cpu = BFloat16ToFloatBuffer(source_cpu);
+  auto result = Buffer<float>(context, size);
+  result.Write(queue, size, result_cpu);
+  return result;
+}
+void FloatToBFloat16Buffer(Buffer<bfloat16>& result, const Buffer<float>& source,
+                           cl_command_queue queue_raw) {
+  const auto size = source.GetSize() / sizeof(float);
+  auto queue = Queue(queue_raw);
+  auto context = queue.GetContext();
+  auto source_cpu = std::vector<float>(size);
+  source.Read(queue, size, source_cpu);
+  auto result_cpu = std::vector<bfloat16>(size);
+  FloatToBFloat16Buffer(result_cpu, source_cpu);
+  result.Write(queue, size, result_cpu);
+}
+
 // Converts a 'real' value to a 'real argument' value to be passed to a kernel. Normally there is
 // no conversion, but half-precision is not supported as kernel argument so it is converted to float.
 template <> typename RealArg<half>::Type GetRealArg(const half value) { return HalfToFloat(value); }
+template <> typename RealArg<bfloat16>::Type GetRealArg(const bfloat16 value) { return BFloat16ToFloat(value); }
 template <> typename RealArg<float>::Type GetRealArg(const float value) { return value; }
 template <> typename RealArg<double>::Type GetRealArg(const double value) { return value; }
 template <> typename RealArg<float2>::Type GetRealArg(const float2 value) { return value; }
 template <> typename RealArg<double2>::Type GetRealArg(const double2 value) { return value; }
 
+// Converts a vector of values to their compute type. This is only an actual conversion for bfloat16.
+template <typename T>
+std::vector<typename ComputeType<T>::Type> ToComputeType(const std::vector<T> &values) {
+  return values;
+}
+template std::vector<half> ToComputeType<half>(const std::vector<half>&);
+template std::vector<float> ToComputeType<float>(const std::vector<float>&);
+template std::vector<double> ToComputeType<double>(const std::vector<double>&);
+template std::vector<float2> ToComputeType<float2>(const std::vector<float2>&);
+template std::vector<double2> ToComputeType<double2>(const std::vector<double2>&);
+template <> std::vector<float> ToComputeType(const std::vector<bfloat16> &values) {
+  return BFloat16ToFloatBuffer(values);
+}
+
 // =================================================================================================
 
 // Rounding functions performing ceiling and division operations
@@ -468,6 +544,7 @@ size_t GetBytes(const Precision precision) {
     case Precision::kDouble: return 8;
     case Precision::kComplexSingle: return 8;
     case Precision::kComplexDouble: return 16;
+    case Precision::kBFloat16: return 2;
     case Precision::kAny: return -1;
   }
 }
@@ -478,12 +555,14 @@ template <> Precision PrecisionValue<float>() { return Precision::kSingle; }
 template <> Precision PrecisionValue<double>() { return Precision::kDouble; }
 template <> Precision PrecisionValue<float2>() { return Precision::kComplexSingle; }
 template <> Precision PrecisionValue<double2>() { return Precision::kComplexDouble; }
+template <> Precision PrecisionValue<bfloat16>() { return Precision::kBFloat16; }
 
 // =================================================================================================
 
 // Returns false is this precision is not supported by the device
 template <> bool PrecisionSupported<float>(const Device &) { return true; }
 template <> bool PrecisionSupported<float2>(const Device &) { return true; }
+template <> bool PrecisionSupported<bfloat16>(const Device &) { return true; } // computes in float
 template <> bool PrecisionSupported<double>(const Device &device) {
   auto extensions = device.Capabilities();
   return (extensions.find(kKhronosDoublePrecision) == std::string::npos) ? false : true;
@@ -498,5 +577,15 @@ template <> bool PrecisionSupported<half>(const Device &device) {
   return (extensions.find(kKhronosHalfPrecision) == std::string::npos) ? false : true;
 }
 
+// =================================================================================================
+
+// Returns the OpenCL C standard to compile the kernels with. OpenCL 3.0 devices always support
+// OpenCL C 3.0, but might report an older version through CL_DEVICE_OPENCL_C_VERSION.
+std::string CompilerStandard(const Device &device) {
+  if (device.VersionNumber() >= 300) { return "CL3.0"; }
+  if (device.CVersionNumber() >= 200) { return "CL2.0"; }
+  return "CL1.1";
+}
+
 // =================================================================================================
 } // namespace clblast
@@ -34,6 +34,14 @@ namespace clblast {
 // Shorthands for half-precision
 using half = cl_half; // based on the OpenCL type, which is actually an 'unsigned short'
 
+// Shorthands for bfloat16: a storage-only type, host-side arithmetic is performed in single-precision
+using bfloat16 = CLBlastBFloat16;
+inline bool operator==(const bfloat16 a, const bfloat16 b) { return a.bits == b.bits; }
+inline bool operator!=(const bfloat16 a, const bfloat16 b) { return a.bits != b.bits; }
+inline bfloat16 operator+(const bfloat16 a, const bfloat16 b) {
+  return FloatToBFloat16(BFloat16ToFloat(a) + BFloat16ToFloat(b));
+}
+
 // Shorthands for complex data-types
 using float2 = std::complex<float>;
 using double2 = std::complex<double>;
@@ -80,6 +88,8 @@ constexpr auto kArgBatchCount = "batch_num";
 
 // The tuner-specific arguments in string form
 constexpr auto kArgFraction = "fraction";
+constexpr auto kArgCompileThreads = "compile_threads";
+constexpr auto kArgTimeBudget = "budget";
 
 // The client-specific arguments in string form
 constexpr auto kArgCompareclblas = "clblas";
@@ -118,6 +128,11 @@ template <typename T> struct BaseType { using Type = T; };
 template <> struct BaseType<float2> { using Type = float; };
 template <> struct BaseType<double2> { using Type = double; };
 
+// Converts a storage type to the type in which intermediate results are kept (e.g. in temporary
+// buffers). These are the same, except for bfloat16 which is only used as a storage format.
+template <typename T> struct ComputeType { using Type = T; };
+template <> struct ComputeType<bfloat16> { using Type = float; };
+
 // =================================================================================================
 
 // Returns a scalar with a default value
@@ -297,12 +312,24 @@ void FloatToHalfBuffer(std::vector<half>& result, const std::vector<float>& sour
 Buffer<float> HalfToFloatBuffer(const Buffer<half>& source, cl_command_queue queue_raw);
 void FloatToHalfBuffer(Buffer<half>& result, const Buffer<float>& source, cl_command_queue queue_raw);
 
+// Conversion between bfloat16 and single-precision, as above for both std::vectors and OpenCL data
+std::vector<float> BFloat16ToFloatBuffer(const std::vector<bfloat16>& source);
+void FloatToBFloat16Buffer(std::vector<bfloat16>& result, const std::vector<float>& source);
+Buffer<float> BFloat16ToFloatBuffer(const Buffer<bfloat16>& source, cl_command_queue queue_raw);
+void FloatToBFloat16Buffer(Buffer<bfloat16>& result, const Buffer<float>& source,
+                           cl_command_queue queue_raw);
+
 // Converts a 'real' value to a 'real argument' value to be passed to a kernel. Normally there is
 // no conversion, but half-precision is not supported as kernel argument so it is converted to float.
 template <typename T> struct RealArg { using Type = T; };
 template <> struct RealArg<half> { using Type = float; };
+template <> struct RealArg<bfloat16> { using Type = float; };
 template <typename T> typename RealArg<T>::Type GetRealArg(const T value);
 
+// Converts a vector of values to their compute type, e.g. to upload bfloat16 scalars as floats
+template <typename T>
+std::vector<typename ComputeType<T>::Type> ToComputeType(const std::vector<T> &values);
+
 // =================================================================================================
 
 // Rounding functions
@@ -327,6 +354,10 @@ Precision PrecisionValue();
 template <typename T>
 bool PrecisionSupported(const Device &device);
 
+// Returns the OpenCL C standard to compile the kernels with for this device (e.g. "CL2.0"): the
+// newest one supported by the device, or "CL1.1" for OpenCL 1.x devices
+std::string CompilerStandard(const Device &device);
+
 // =================================================================================================
 } // namespace clblast
 
@@ -0,0 +1,129 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the derivation of the architecture family of a device from its
+// name and (for NVIDIA GPUs) its compute capability, as used by the database fall-back. These tests
+// run on the host only and don't require an OpenCL device.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <cstdio>
+
+#include "utilities/utilities.hpp"
+#include "database/database.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+struct ArchitectureFamilyTest {
+  std::string vendor;
+  std::string type;
+  std::string name;
+  size_t compute_capability;
+  std::string family;
+};
+
+size_t RunArchitectureFamilyTests() {
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  const auto gpu = std::string{database::kDeviceTypeGPU};
+  const auto cpu = std::string{database::kDeviceTypeCPU};
+  const auto tests = std::vector<ArchitectureFamilyTest>{
+
+    // NVIDIA: by name only (as for the entries of the database)
+    {"NVIDIA", gpu, "GeForce GTX 480", 0, "Fermi"},
+    {"NVIDIA", gpu, "GeForce GTX 680", 0, "Kepler"},
+    {"NVIDIA", gpu, "GeForce GTX 750 Ti", 0, "Maxwell"},
+    {"NVIDIA", gpu, "GeForce GTX 980", 0, "Maxwell"},
+    {"NVIDIA", gpu, "GeForce GTX 1080", 0, "Pascal"},
+    {"NVIDIA", gpu, "GeForce GTX 1650", 0, "Turing"},
+    {"NVIDIA", gpu, "GeForce GTX 1660 Ti", 0, "Turing"},
+    {"NVIDIA", gpu, "GeForce RTX 2080 Ti", 0, "Turing"},
+    {"NVIDIA", gpu, "GeForce RTX 3090", 0, "Ampere"},
+    {"NVIDIA", gpu, "GeForce GTX TITAN", 0, "Kepler"},
+    {"NVIDIA", gpu, "GeForce GTX TITAN Black", 0, "Kepler"},
+    {"NVIDIA", gpu, "GeForce GTX TITAN X", 0, "Maxwell"},
+    {"NVIDIA", gpu, "TITAN X (Pascal)", 0, "Pascal"},
+    {"NVIDIA", gpu, "TITAN Xp", 0, "Pascal"},
+    {"NVIDIA", gpu, "TITAN V", 0, "Volta"},
+    {"NVIDIA", gpu, "TITAN RTX", 0, "Turing"},
+    {"NVIDIA", gpu, "Tesla C2050", 0, "Fermi"},
+    {"NVIDIA", gpu, "Tesla M2090", 0, "Fermi"},
+    {"NVIDIA", gpu, "Tesla K40m", 0, "Kepler"},
+    {"NVIDIA", gpu, "Tesla M40", 0, "Maxwell"},
+    {"NVIDIA", gpu, "Tesla P100-PCIE-16GB", 0, "Pascal"},
+    {"NVIDIA", gpu, "Tesla V100-SXM2-16GB", 0, "Volta"},
+    {"NVIDIA", gpu, "Tesla T4", 0, "Turing"},
+    {"NVIDIA", gpu, "Quadro 4000", 0, "Fermi"},
+    {"NVIDIA", gpu, "Quadro K4000", 0, "Kepler"},
+    {"NVIDIA", gpu, "Quadro M2000", 0, "Maxwell"},
+    {"NVIDIA", gpu, "Quadro P5000", 0, "Pascal"},
+    {"NVIDIA", gpu, "Quadro GP100", 0, "Pascal"},
+    {"NVIDIA", gpu, "Quadro GV100", 0, "Volta"},
+    {"NVIDIA", gpu, "Quadro T1000", 0, "Turing"},
+    {"NVIDIA", gpu, "Quadro RTX 6000", 0, "Turing"},
+    {"NVIDIA", gpu, "NVIDIA RTX A6000", 0, "Ampere"},
+    {"NVIDIA", gpu, "Some Future GPU", 0, ""},
+
+    // NVIDIA: the compute capability takes precedence over the name
+    {"NVIDIA", gpu, "TITAN V", 70, "Volta"},
+    {"NVIDIA", gpu, "TITAN RTX", 75, "Turing"},
+    {"NVIDIA", gpu, "Quadro M2000", 52, "Maxwell"},
+    {"NVIDIA", gpu, "GeForce GTX 1660", 75, "Turing"},
+    {"NVIDIA", gpu, "Jetson AGX Xavier", 72, "Volta"},
+    {"NVIDIA", gpu, "A100-SXM4-40GB", 80, "Ampere"},
+    {"NVIDIA", gpu, "Some Future GPU", 35, "Kepler"},
+    {"NVIDIA", gpu, "GeForce GTX 1080", 99, "Pascal"},
+
+    // Other vendors
+    {"AMD", gpu, "Tahiti", 0, "GFX6"},
+    {"AMD", gpu, "Ellesmere", 0, "GFX8"},
+    {"AMD", gpu, "gfx906", 0, "GFX9"},
+    {"AMD", gpu, "AMD Radeon HD 6970", 0, "TeraScale"},
+    {"Intel", gpu, "Intel(R) HD Graphics 620", 0, "Gen9"},
+    {"Intel", gpu, "Intel(R) HD Graphics Haswell GT2 Desktop", 0, "Gen7.5"},
+    {"Intel", cpu, "Intel(R) Core(TM) i7-6770HQ CPU @ 2.60GHz", 0, "Core gen6"},
+    {"Intel", cpu, "Intel(R) Xeon(R) CPU E5-2630 v3 @ 2.40GHz", 0, "Xeon v3"},
+    {"ARM", gpu, "Mali-T628", 0, "Midgard"},
+  };
+
+  fprintf(stdout, "* Testing the architecture families\n");
+  for (const auto &test : tests) {
+    const auto family = Database::GetArchitectureFamily(test.vendor, test.type, test.name,
+                                                        test.compute_capability);
+    if (family == test.family) {
+      passed++;
+    }
+    else {
+      fprintf(stdout, "   Error for '%s' (compute capability %d): expected '%s', got '%s'\n",
+              test.name.c_str(), static_cast<int>(test.compute_capability), test.family.c_str(),
+              family.c_str());
+      errors++;
+    }
+  }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int, char *[]) {
+  const auto errors = clblast::RunArchitectureFamilyTests();
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
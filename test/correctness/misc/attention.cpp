@@ -0,0 +1,200 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the Attention function
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Computes the attention of a single head on the host, materializing the scores of each row
+template <typename T>
+void ReferenceAttention(const Layout layout, const bool causal,
+                        const size_t m, const size_t n, const size_t d, const T scale,
+                        const std::vector<T> &q, const size_t q_offset,
+                        const std::vector<T> &k, const size_t k_offset,
+                        const std::vector<T> &v, const size_t v_offset,
+                        std::vector<T> &o, const size_t o_offset, const size_t ld) {
+  const auto index = [&](const size_t row, const size_t col) {
+    return (layout == Layout::kRowMajor) ? row * ld + col : col * ld + row;
+  };
+  auto scores = std::vector<T>(n);
+  for (auto i = size_t{0}; i < m; ++i) {
+    const auto keys = (causal) ? i + n - m + 1 : n;
+    auto max_score = -std::numeric_limits<T>::infinity();
+    for (auto j = size_t{0}; j < keys; ++j) {
+      auto score = T{0};
+      for (auto l = size_t{0}; l < d; ++l) {
+        score += q[index(i, l) + q_offset] * k[index(j, l) + k_offset];
+      }
+      scores[j] = scale * score;
+      max_score = std::max(max_score, scores[j]);
+    }
+    auto sum = T{0};
+    for (auto j = size_t{0}; j < keys; ++j) {
+      scores[j] = std::exp(scores[j] - max_score);
+      sum += scores[j];
+    }
+    for (auto l = size_t{0}; l < d; ++l) {
+      auto result = T{0};
+      for (auto j = size_t{0}; j < keys; ++j) {
+        result += scores[j] * v[index(j, l) + v_offset];
+      }
+      o[index(i, l) + o_offset] = result / sum;
+    }
+  }
+}
+
+// Half-precision version calling the above reference implementation after conversions
+void ReferenceAttention(const Layout layout, const bool causal,
+                        const size_t m, const size_t n, const size_t d, const half scale,
+                        const std::vector<half> &q, const size_t q_offset,
+                        const std::vector<half> &k, const size_t k_offset,
+                        const std::vector<half> &v, const size_t v_offset,
+                        std::vector<half> &o, const size_t o_offset, const size_t ld) {
+  auto o_float = HalfToFloatBuffer(o);
+  ReferenceAttention(layout, causal, m, n, d, HalfToFloat(scale), HalfToFloatBuffer(q), q_offset,
+                     HalfToFloatBuffer(k), k_offset, HalfToFloatBuffer(v), v_offset,
+                     o_float, o_offset, ld);
+  FloatToHalfBuffer(o, o_float);
+}
+
+template <typename T>
+size_t RunAttentionTests(int argc, char *argv[], const bool silent,
+                         const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto m = GetArgument(arguments, help, kArgM, size_t{37});
+  const auto n = GetArgument(arguments, help, kArgN, size_t{83});
+  const auto d = GetArgument(arguments, help, kArgK, size_t{71});
+  const auto batch_count = GetArgument(arguments, help, kArgBatchCount, size_t{3});
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  if (!PrecisionSupported<T>(device)) {
+    fprintf(stdout, "* Skipping Attention for '%s': precision not supported\n\n",
+            routine_name.c_str());
+    return 0;
+  }
+
+  // All matrices share a leading dimension large enough for both layouts and are stored one after
+  // the other in their buffers, each head at its own offset
+  const auto ld = std::max(std::max(m, n), d) + 3;
+  const auto head_size = ld * std::max(std::max(m, n), d);
+  auto offsets = std::vector<size_t>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    offsets[batch] = 2 + batch * head_size;
+  }
+  const auto buffer_size = batch_count * head_size + 2;
+
+  // Populates the input matrices with some example data and copies them to the device
+  auto host_q = std::vector<T>(buffer_size);
+  auto host_k = std::vector<T>(buffer_size);
+  auto host_v = std::vector<T>(buffer_size);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_q, mt, dist);
+  PopulateVector(host_k, mt, dist);
+  PopulateVector(host_v, mt, dist);
+  auto device_q = Buffer<T>(context, buffer_size);
+  auto device_k = Buffer<T>(context, buffer_size);
+  auto device_v = Buffer<T>(context, buffer_size);
+  auto device_o = Buffer<T>(context, buffer_size);
+  device_q.Write(queue, buffer_size, host_q);
+  device_k.Write(queue, buffer_size, host_k);
+  device_v.Write(queue, buffer_size, host_v);
+
+  fprintf(stdout, "* Testing Attention for '%s'\n", routine_name.c_str());
+
+  // Tests both layouts with and without the causal mask
+  const auto scale = Constant<T>(1.0 / std::sqrt(static_cast<double>(d)));
+  for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+    for (const auto causal : {false, true}) {
+      auto reference = std::vector<T>(buffer_size, T{0});
+      for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+        ReferenceAttention(layout, causal, m, n, d, scale, host_q, offsets[batch],
+                           host_k, offsets[batch], host_v, offsets[batch],
+                           reference, offsets[batch], ld);
+      }
+      auto result = std::vector<T>(buffer_size, T{0});
+      device_o.Write(queue, buffer_size, result);
+      auto queue_plain = queue();
+      auto event = cl_event{};
+      const auto status = Attention<T>(layout, causal, m, n, d, scale,
+                                       device_q(), offsets.data(), ld,
+                                       device_k(), offsets.data(), ld,
+                                       device_v(), offsets.data(), ld,
+                                       device_o(), offsets.data(), ld,
+                                       batch_count, &queue_plain, &event);
+      if (status != StatusCode::kSuccess) { errors++; continue; }
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+      device_o.Read(queue, buffer_size, result);
+      auto diff = size_t{0};
+      for (auto i = size_t{0}; i < buffer_size; ++i) {
+        if (!TestSimilarity(reference[i], result[i])) { diff++; }
+      }
+      if (diff == 0) { passed++; } else { errors++; }
+    }
+  }
+
+  // With the causal mask there can't be more queries than keys
+  auto queue_plain = queue();
+  const auto status = Attention<T>(Layout::kRowMajor, true, n + 1, n, d, scale,
+                                   device_q(), offsets.data(), ld,
+                                   device_k(), offsets.data(), ld,
+                                   device_v(), offsets.data(), ld,
+                                   device_o(), offsets.data(), ld,
+                                   batch_count, &queue_plain, nullptr);
+  if (status != StatusCode::kInvalidDimension) { errors++; } else { passed++; }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunAttentionTests<float>(argc, argv, false, "SATTENTION");
+  errors += clblast::RunAttentionTests<double>(argc, argv, true, "DATTENTION");
+  errors += clblast::RunAttentionTests<clblast::half>(argc, argv, true, "HATTENTION");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
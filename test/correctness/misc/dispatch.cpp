@@ -0,0 +1,187 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the multi-queue dispatchers (EnableDispatch, DispatchJoin and
+// DisableDispatch): many small independent routine calls are dispatched and checked afterwards.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Runs a batch of independent small GEMMs (of varying sizes) and AXPYs through a dispatcher and
+// compares them with a host reference
+template <typename T>
+size_t TestDispatch(const Context &context, Queue &queue, const Dispatch policy,
+                    const size_t num_queues, const size_t num_calls, size_t &passed) {
+  fprintf(stdout, "* Testing dispatch: %s, %zu queue(s), %zu call(s)\n",
+          (policy == Dispatch::kRoundRobin) ? "round-robin" : "least-loaded",
+          num_queues, num_calls);
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  auto queue_plain = queue();
+  if (EnableDispatch(queue_plain, num_queues, policy) != StatusCode::kSuccess) {
+    fprintf(stdout, "   Failed to enable the dispatcher\n");
+    return 1;
+  }
+
+  // Each call has its own matrices, written asynchronously on the user's queue
+  const auto size = [](const size_t call) { return 8 + (call * 7) % 57; };
+  auto host_a = std::vector<std::vector<T>>();
+  auto host_b = std::vector<std::vector<T>>();
+  auto device_a = std::vector<Buffer<T>>();
+  auto device_b = std::vector<Buffer<T>>();
+  auto device_c = std::vector<Buffer<T>>();
+  for (auto call = size_t{0}; call < num_calls; ++call) {
+    const auto n = size(call);
+    host_a.push_back(std::vector<T>(n * n));
+    host_b.push_back(std::vector<T>(n * n));
+    PopulateVector(host_a.back(), mt, dist);
+    PopulateVector(host_b.back(), mt, dist);
+    device_a.push_back(Buffer<T>(context, n * n));
+    device_b.push_back(Buffer<T>(context, n * n));
+    device_c.push_back(Buffer<T>(context, n * n));
+    device_a.back().WriteAsync(queue, n * n, host_a.back());
+    device_b.back().WriteAsync(queue, n * n, host_b.back());
+  }
+
+  // Dispatches the calls: even ones are GEMMs (C = A * B), odd ones AXPYs (C = B; C += 2 * A)
+  auto errors = size_t{0};
+  for (auto call = size_t{0}; call < num_calls; ++call) {
+    const auto n = size(call);
+    auto status = StatusCode::kSuccess;
+    if (call % 2 == 0) {
+      status = Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo, n, n, n,
+                    ConstantOne<T>(), device_a[call](), 0, n, device_b[call](), 0, n,
+                    ConstantZero<T>(), device_c[call](), 0, n, &queue_plain);
+    }
+    else {
+      status = Copy<T>(n * n, device_b[call](), 0, 1, device_c[call](), 0, 1, &queue_plain);
+      if (status == StatusCode::kSuccess) { // the copy and the axpy go to different queues
+        status = DispatchJoin(queue_plain);
+      }
+      if (status == StatusCode::kSuccess) {
+        status = Axpy(n * n, static_cast<T>(2), device_a[call](), 0, 1,
+                      device_c[call](), 0, 1, &queue_plain);
+      }
+    }
+    if (status != StatusCode::kSuccess) {
+      fprintf(stdout, "   Call %zu failed with status %d\n", call, static_cast<int>(status));
+      errors++;
+    }
+  }
+
+  // Joins the calls and reads the results on the user's queue
+  auto event = cl_event{};
+  if (DispatchJoin(queue_plain, &event) != StatusCode::kSuccess) {
+    fprintf(stdout, "   Failed to join\n");
+    return 1;
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+  for (auto call = size_t{0}; call < num_calls; ++call) {
+    const auto n = size(call);
+    auto result = std::vector<T>(n * n);
+    device_c[call].Read(queue, n * n, result);
+    auto call_errors = size_t{0};
+    for (auto i = size_t{0}; i < n; ++i) {
+      for (auto j = size_t{0}; j < n; ++j) {
+        auto reference = 0.0;
+        if (call % 2 == 0) {
+          for (auto l = size_t{0}; l < n; ++l) {
+            reference += static_cast<double>(host_a[call][l*n + i]) *
+                         static_cast<double>(host_b[call][j*n + l]);
+          }
+        }
+        else {
+          reference = static_cast<double>(host_b[call][j*n + i]) +
+                      2.0 * static_cast<double>(host_a[call][j*n + i]);
+        }
+        const auto difference = std::abs(static_cast<double>(result[j*n + i]) - reference);
+        if (difference > 1.0e-4 * (std::abs(reference) + static_cast<double>(n))) { call_errors++; }
+      }
+    }
+    if (call_errors != 0) {
+      fprintf(stdout, "   Call %zu: %zu element(s) differ\n", call, call_errors);
+      errors++;
+    }
+  }
+  if (DisableDispatch(queue_plain) != StatusCode::kSuccess) {
+    fprintf(stdout, "   Failed to disable the dispatcher\n");
+    errors++;
+  }
+  if (errors == 0) { passed++; return 0; }
+  return 1;
+}
+
+template <typename T>
+size_t RunDispatchTests(const Context &context, Queue &queue, const std::string &precision,
+                        size_t &passed) {
+  if (!PrecisionSupported<T>(queue.GetDevice())) {
+    fprintf(stdout, "* Skipping dispatch for precision '%s': not supported\n", precision.c_str());
+    return 0;
+  }
+  fprintf(stdout, "* Testing dispatch for precision '%s'\n", precision.c_str());
+  auto errors = size_t{0};
+  errors += TestDispatch<T>(context, queue, Dispatch::kRoundRobin, 1, 10, passed);
+  errors += TestDispatch<T>(context, queue, Dispatch::kRoundRobin, 4, 64, passed);
+  errors += TestDispatch<T>(context, queue, Dispatch::kLeastLoaded, 3, 64, passed);
+  errors += TestDispatch<T>(context, queue, Dispatch::kLeastLoaded, 8, 200, passed);
+  return errors;
+}
+
+size_t RunDispatchTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Runs the tests for the single and double precisions
+  errors += RunDispatchTests<float>(context, queue, "single", passed);
+  errors += RunDispatchTests<double>(context, queue, "double", passed);
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunDispatchTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
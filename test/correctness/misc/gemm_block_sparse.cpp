@@ -0,0 +1,239 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the GemmBlockSparse function
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <limits>
+#include <cmath>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// A single test-case: the fraction of occupied blocks is given in percentages
+struct GemmBlockSparseCase {
+  Layout layout;
+  Transpose a_transpose;
+  Transpose b_transpose;
+  Side sparse_side;
+  size_t block_size;
+  size_t m, n, k;
+  size_t percentage_occupied;
+};
+
+// The tolerance relative to the magnitude of the result and the number of summed terms
+template <typename T> double GemmBlockSparseTolerance() { return 1.0e-4; }
+template <> double GemmBlockSparseTolerance<half>() { return 1.0e-2; }
+
+// Tests a single configuration against a host reference
+template <typename T>
+size_t TestGemmBlockSparse(const Context &context, Queue &queue, const GemmBlockSparseCase &test,
+                           size_t &passed) {
+  const auto sparse_b = (test.sparse_side == Side::kRight);
+  fprintf(stdout, "* Testing GemmBlockSparse: %s, %s%s, sparse %s, blocks of %zu, "
+          "m=%zu n=%zu k=%zu, %zu%% occupied\n",
+          (test.layout == Layout::kRowMajor) ? "row-major" : "col-major",
+          (test.a_transpose == Transpose::kNo) ? "A" : "A^T",
+          (test.b_transpose == Transpose::kNo) ? "B" : "B^T",
+          (sparse_b) ? "B" : "A", test.block_size, test.m, test.n, test.k,
+          test.percentage_occupied);
+  const auto m = test.m;
+  const auto n = test.n;
+  const auto k = test.k;
+  const auto bs = test.block_size;
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+
+  // Creates the matrices. Element (i,l) of op(A) is at index 'a_index(i,l)', etc.
+  const auto a_rotated = (test.layout == Layout::kColMajor) != (test.a_transpose == Transpose::kNo);
+  const auto b_rotated = (test.layout == Layout::kColMajor) != (test.b_transpose == Transpose::kNo);
+  const auto a_ld = ((a_rotated) ? k : m) + 3;
+  const auto b_ld = ((b_rotated) ? n : k) + 2;
+  const auto c_ld = (test.layout == Layout::kRowMajor) ? n : m;
+  const auto a_size = a_ld * ((a_rotated) ? m : k);
+  const auto b_size = b_ld * ((b_rotated) ? k : n);
+  const auto a_index = [&](const size_t i, const size_t l) {
+    return (a_rotated) ? i*a_ld + l : l*a_ld + i;
+  };
+  const auto b_index = [&](const size_t l, const size_t j) {
+    return (b_rotated) ? l*b_ld + j : j*b_ld + l;
+  };
+  const auto c_index = [&](const size_t i, const size_t j) {
+    return (test.layout == Layout::kRowMajor) ? i*c_ld + j : j*c_ld + i;
+  };
+  auto host_a = std::vector<T>(a_size);
+  auto host_b = std::vector<T>(b_size);
+  auto host_c = std::vector<T>(m * n);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+
+  // Creates the occupancy map of the sparse matrix. The unoccupied blocks are filled with NaNs to
+  // verify that they are never used.
+  const auto rows = (sparse_b) ? k : m;
+  const auto cols = (sparse_b) ? n : k;
+  const auto num_block_cols = CeilDiv(cols, bs);
+  auto occupancy = std::vector<unsigned char>(CeilDiv(rows, bs) * num_block_cols);
+  std::uniform_int_distribution<size_t> percentage_dist(0, 99);
+  for (auto &block : occupancy) {
+    block = (percentage_dist(mt) < test.percentage_occupied) ? 1 : 0;
+  }
+  const auto occupied = [&](const size_t row, const size_t col) {
+    return occupancy[(row / bs) * num_block_cols + col / bs] != 0;
+  };
+  const auto nan = Constant<T>(std::numeric_limits<double>::quiet_NaN());
+  for (auto row = size_t{0}; row < rows; ++row) {
+    for (auto col = size_t{0}; col < cols; ++col) {
+      if (!occupied(row, col)) {
+        if (sparse_b) { host_b[b_index(row, col)] = nan; }
+        else { host_a[a_index(row, col)] = nan; }
+      }
+    }
+  }
+
+  // Copies the data to the device
+  const auto occupancy_offset = size_t{5};
+  auto host_occupancy = std::vector<unsigned char>(occupancy_offset, 1);
+  host_occupancy.insert(host_occupancy.end(), occupancy.begin(), occupancy.end());
+  auto device_a = Buffer<T>(context, a_size);
+  auto device_b = Buffer<T>(context, b_size);
+  auto device_c = Buffer<T>(context, host_c.size());
+  auto device_occupancy = Buffer<unsigned char>(context, host_occupancy.size());
+  device_a.Write(queue, a_size, host_a);
+  device_b.Write(queue, b_size, host_b);
+  device_c.Write(queue, host_c.size(), host_c);
+  device_occupancy.Write(queue, host_occupancy.size(), host_occupancy);
+
+  // Runs the routine
+  const auto alpha = Constant<T>(0.75);
+  const auto beta = Constant<T>(0.5);
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  const auto status = GemmBlockSparse<T>(test.layout, test.a_transpose, test.b_transpose,
+                                         test.sparse_side, bs, m, n, k, alpha,
+                                         device_a(), 0, a_ld, device_b(), 0, b_ld,
+                                         device_occupancy(), occupancy_offset,
+                                         beta, device_c(), 0, c_ld,
+                                         &queue_plain, &event);
+  if (status != StatusCode::kSuccess) {
+    fprintf(stdout, "   Failed with status %d\n", static_cast<int>(status));
+    return 1;
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+  auto result = std::vector<T>(host_c.size());
+  device_c.Read(queue, result.size(), result);
+
+  // Computes the reference on the host (in single-precision for half-precision), treating the
+  // unoccupied blocks as zeros. Differences are compared such that NaNs in the result count as
+  // errors.
+  auto errors = size_t{0};
+  for (auto i = size_t{0}; i < m; ++i) {
+    for (auto j = size_t{0}; j < n; ++j) {
+      auto sum = GetRealArg(ConstantZero<T>());
+      for (auto l = size_t{0}; l < k; ++l) {
+        if ((sparse_b && !occupied(l, j)) || (!sparse_b && !occupied(i, l))) { continue; }
+        sum += GetRealArg(host_a[a_index(i, l)]) * GetRealArg(host_b[b_index(l, j)]);
+      }
+      const auto reference = GetRealArg(alpha) * sum + GetRealArg(beta) *
+                             GetRealArg(host_c[c_index(i, j)]);
+      const auto difference = std::abs(GetRealArg(result[c_index(i, j)]) - reference);
+      const auto margin = std::abs(reference) + static_cast<double>(k);
+      if (!(difference <= GemmBlockSparseTolerance<T>() * margin)) { errors++; }
+    }
+  }
+  if (errors == 0) { passed++; return 0; }
+  fprintf(stdout, "   %zu element(s) differ\n", errors);
+  return 1;
+}
+
+template <typename T>
+size_t RunGemmBlockSparseTests(const Context &context, Queue &queue, const std::string &precision,
+                               size_t &passed) {
+  if (!PrecisionSupported<T>(queue.GetDevice())) {
+    fprintf(stdout, "* Skipping GemmBlockSparse for precision '%s': not supported\n",
+            precision.c_str());
+    return 0;
+  }
+  fprintf(stdout, "* Testing GemmBlockSparse for precision '%s'\n", precision.c_str());
+  const auto col = Layout::kColMajor;
+  const auto row = Layout::kRowMajor;
+  const auto no = Transpose::kNo;
+  const auto yes = Transpose::kYes;
+  const auto left = Side::kLeft;
+  const auto right = Side::kRight;
+  const auto tests = std::vector<GemmBlockSparseCase>{
+    {col, no, no, left, 32, 128, 128, 256, 10},
+    {col, no, no, right, 64, 128, 192, 256, 25},
+    {row, no, no, left, 16, 96, 64, 160, 50},
+    {row, yes, no, right, 16, 64, 80, 128, 30},
+    {col, yes, yes, left, 8, 40, 72, 100, 40},
+    {row, no, yes, right, 13, 37, 53, 150, 40},
+    {col, no, yes, left, 7, 65, 33, 71, 60},
+    {col, no, no, right, 32, 64, 64, 64, 0},
+    {row, no, no, left, 32, 64, 64, 96, 100},
+  };
+  auto errors = size_t{0};
+  for (const auto &test : tests) {
+    errors += TestGemmBlockSparse<T>(context, queue, test, passed);
+  }
+  return errors;
+}
+
+size_t RunGemmBlockSparseTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Runs the tests for all precisions
+  errors += RunGemmBlockSparseTests<float>(context, queue, "single", passed);
+  errors += RunGemmBlockSparseTests<double>(context, queue, "double", passed);
+  errors += RunGemmBlockSparseTests<float2>(context, queue, "complex single", passed);
+  errors += RunGemmBlockSparseTests<double2>(context, queue, "complex double", passed);
+  errors += RunGemmBlockSparseTests<half>(context, queue, "half", passed);
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunGemmBlockSparseTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
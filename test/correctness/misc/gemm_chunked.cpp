@@ -0,0 +1,186 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for GEMM split into sub-GEMMs: a memory budget too small for the
+// temporary buffers of the indirect kernel forces the chunked version for bfloat16 data (which
+// can't fall back to the direct kernel). Its results are compared against those of the unchunked
+// version and against a host reference, with sizes which aren't multiples of the chunk sizes.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <algorithm>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Computes the offset of element (row, col) of op(X) within the buffer of matrix X
+size_t ElementOffset(const Layout layout, const Transpose transpose,
+                     const size_t offset, const size_t ld, const size_t row, const size_t col) {
+  const auto one = (transpose == Transpose::kNo) ? row : col;
+  const auto two = (transpose == Transpose::kNo) ? col : row;
+  return (layout == Layout::kColMajor) ? offset + one + two * ld : offset + one * ld + two;
+}
+
+size_t RunGemmChunkedTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments. The default sizes are primes, such that they are no multiple of the
+  // chunk sizes (which are multiples of the work-group tile sizes).
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto m = GetArgument(arguments, help, kArgM, size_t{257});
+  const auto n = GetArgument(arguments, help, kArgN, size_t{193});
+  const auto k = GetArgument(arguments, help, kArgK, size_t{301});
+
+  // Prints the help message (command-line arguments)
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Populates the matrices (all stored with a leading dimension of 'ld' and an offset) with some
+  // example data
+  const auto ld = std::max(std::max(m, n), k) + 3;
+  const auto offset = size_t{5};
+  const auto buffer_size = ld * ld + offset;
+  auto host_a = std::vector<bfloat16>(buffer_size);
+  auto host_b = std::vector<bfloat16>(buffer_size);
+  auto host_c = std::vector<bfloat16>(buffer_size);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  auto device_a = Buffer<bfloat16>(context, buffer_size);
+  auto device_b = Buffer<bfloat16>(context, buffer_size);
+  auto device_c = Buffer<bfloat16>(context, buffer_size);
+  device_a.Write(queue, buffer_size, host_a);
+  device_b.Write(queue, buffer_size, host_b);
+  auto queue_plain = queue();
+  const auto alpha = FloatToBFloat16(1.0f);
+  const auto beta = FloatToBFloat16(0.5f);
+
+  // Runs GEMM within the given budget, returning the resulting output matrix
+  const auto run = [&](const Layout layout, const Transpose a_transpose,
+                       const Transpose b_transpose, const size_t budget,
+                       std::vector<bfloat16> &result) {
+    device_c.Write(queue, buffer_size, host_c);
+    SetMemoryBudget(context(), budget);
+    const auto status = Gemm<bfloat16>(layout, a_transpose, b_transpose, m, n, k, alpha,
+                                       device_a(), offset, ld, device_b(), offset, ld, beta,
+                                       device_c(), offset, ld, &queue_plain);
+    queue.Finish();
+    SetMemoryBudget(context(), 0);
+    result = std::vector<bfloat16>(buffer_size);
+    device_c.Read(queue, buffer_size, result);
+    return status;
+  };
+
+  // Compares a result against a host reference (computed in double-precision) per element, with
+  // an error margin relative to the sum of the magnitudes of all the terms
+  const auto count_differences = [&](const Layout layout, const Transpose a_transpose,
+                                     const Transpose b_transpose,
+                                     const std::vector<bfloat16> &result) {
+    auto diff = size_t{0};
+    for (auto i = size_t{0}; i < m; ++i) {
+      for (auto j = size_t{0}; j < n; ++j) {
+        auto sum = 0.0;
+        auto magnitude = 0.0;
+        for (auto l = size_t{0}; l < k; ++l) {
+          const auto a = static_cast<double>(BFloat16ToFloat(
+              host_a[ElementOffset(layout, a_transpose, offset, ld, i, l)]));
+          const auto b = static_cast<double>(BFloat16ToFloat(
+              host_b[ElementOffset(layout, b_transpose, offset, ld, l, j)]));
+          sum += a * b;
+          magnitude += std::fabs(a * b);
+        }
+        const auto c_index = ElementOffset(layout, Transpose::kNo, offset, ld, i, j);
+        const auto c = 0.5 * static_cast<double>(BFloat16ToFloat(host_c[c_index]));
+        const auto reference = sum + c;
+        const auto value = static_cast<double>(BFloat16ToFloat(result[c_index]));
+        if (std::fabs(value - reference) > 0.02 * (magnitude + std::fabs(c)) + 1e-3) { diff++; }
+      }
+    }
+    return diff;
+  };
+
+  fprintf(stdout, "* Testing chunked GEMM for bfloat16\n");
+
+  // The budget is a third of the regular temporary buffers of the indirect kernel
+  const auto budget = (m * k + k * n + m * n) * sizeof(bfloat16) / 3;
+  for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+    for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+      for (const auto b_transpose : {Transpose::kNo, Transpose::kYes}) {
+        auto reference = std::vector<bfloat16>();
+        auto fallbacks = std::vector<std::string>();
+        const auto status_reference = run(layout, a_transpose, b_transpose, 0, reference);
+        RetrieveMemoryFallbacks(context(), fallbacks);
+        const auto fallbacks_reference = fallbacks.size();
+
+        auto result = std::vector<bfloat16>();
+        const auto status = run(layout, a_transpose, b_transpose, budget, result);
+        RetrieveMemoryFallbacks(context(), fallbacks);
+        auto chunked = false;
+        for (const auto &fallback : fallbacks) {
+          if (fallback.find("split into sub-GEMMs") != std::string::npos) { chunked = true; }
+        }
+
+        // Both results are compared against the host reference, the untouched parts of C should
+        // be identical
+        auto diff = count_differences(layout, a_transpose, b_transpose, reference) +
+                    count_differences(layout, a_transpose, b_transpose, result);
+        for (auto i = size_t{0}; i < buffer_size; ++i) {
+          if (!TestSimilarity(reference[i], result[i])) {
+            const auto one = (layout == Layout::kColMajor) ? (i - offset) % ld : (i - offset) / ld;
+            const auto two = (layout == Layout::kColMajor) ? (i - offset) / ld : (i - offset) % ld;
+            if (i < offset || one >= m || two >= n) { diff++; }
+          }
+        }
+        if (status_reference == StatusCode::kSuccess && status == StatusCode::kSuccess &&
+            fallbacks_reference == 0 && chunked && diff == 0) {
+          passed++;
+        }
+        else {
+          errors++;
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunGemmChunkedTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
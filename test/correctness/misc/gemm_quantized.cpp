@@ -0,0 +1,220 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the GemmQuantized function
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// A single test-case
+struct GemmQuantizedCase {
+  Layout layout;
+  Transpose a_transpose;
+  size_t m, n, k;
+  Quantization quantization;
+  size_t group_size;
+  bool has_zeros;
+  size_t b_offset;
+};
+
+// The tolerance relative to the magnitude of the result and the number of summed terms
+template <typename T> double GemmQuantizedTolerance() { return 1.0e-4; }
+template <> double GemmQuantizedTolerance<half>() { return 1.0e-2; }
+
+// Tests a single configuration against a host reference
+template <typename T>
+size_t TestGemmQuantized(const Context &context, Queue &queue, const GemmQuantizedCase &test,
+                         size_t &passed) {
+  const auto bits = static_cast<size_t>(test.quantization);
+  fprintf(stdout, "* Testing GemmQuantized: %s, %s, m=%zu n=%zu k=%zu, %zu-bits, group=%zu%s\n",
+          (test.layout == Layout::kRowMajor) ? "row-major" : "col-major",
+          (test.a_transpose == Transpose::kNo) ? "A" : "A^T", test.m, test.n, test.k, bits,
+          test.group_size, (test.has_zeros) ? ", with zero-points" : "");
+  const auto m = test.m;
+  const auto n = test.n;
+  const auto k = test.k;
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+
+  // Creates the matrices A and C. Element (i,l) of A is at index 'a_index(i,l)'.
+  const auto a_rotated = (test.layout == Layout::kColMajor) != (test.a_transpose == Transpose::kNo);
+  const auto a_ld = ((a_rotated) ? k : m) + 3;
+  const auto a_size = a_ld * ((a_rotated) ? m : k);
+  const auto a_index = [&](const size_t i, const size_t l) {
+    return (a_rotated) ? i*a_ld + l : l*a_ld + i;
+  };
+  const auto c_ld = (test.layout == Layout::kRowMajor) ? n : m;
+  const auto c_index = [&](const size_t i, const size_t j) {
+    return (test.layout == Layout::kRowMajor) ? i*c_ld + j : j*c_ld + i;
+  };
+  auto host_a = std::vector<T>(a_size);
+  auto host_c = std::vector<T>(m * n);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_c, mt, dist);
+
+  // Creates the quantized matrix B with its scales and zero-points
+  const auto b_ld = k + 1;
+  const auto num_codes = test.b_offset + b_ld * n;
+  const auto num_groups = CeilDiv(k, test.group_size);
+  const auto max_code = (size_t{1} << bits) - 1;
+  std::uniform_int_distribution<size_t> code_dist(0, max_code);
+  auto codes = std::vector<size_t>(num_codes);
+  for (auto &code : codes) { code = code_dist(mt); }
+  auto host_b = std::vector<unsigned char>(CeilDiv(num_codes * bits, size_t{8}), 0);
+  for (auto i = size_t{0}; i < num_codes; ++i) {
+    if (bits == 8) { host_b[i] = static_cast<unsigned char>(codes[i]); }
+    else { host_b[i / 2] |= static_cast<unsigned char>(codes[i] << (4 * (i % 2))); }
+  }
+  auto scales = std::vector<T>(num_groups * n);
+  auto zeros = std::vector<T>(num_groups * n);
+  for (auto &scale : scales) { scale = Constant<T>(dist(mt) / static_cast<double>(max_code)); }
+  for (auto &zero : zeros) { zero = Constant<T>(static_cast<double>(code_dist(mt))); }
+
+  // Copies the data to the device
+  auto device_a = Buffer<T>(context, a_size);
+  auto device_b = Buffer<unsigned char>(context, host_b.size());
+  auto device_scales = Buffer<T>(context, scales.size());
+  auto device_zeros = Buffer<T>(context, zeros.size());
+  auto device_c = Buffer<T>(context, host_c.size());
+  device_a.Write(queue, a_size, host_a);
+  device_b.Write(queue, host_b.size(), host_b);
+  device_scales.Write(queue, scales.size(), scales);
+  device_zeros.Write(queue, zeros.size(), zeros);
+  device_c.Write(queue, host_c.size(), host_c);
+
+  // Runs the routine
+  const auto alpha = Constant<T>(0.75);
+  const auto beta = Constant<T>(0.5);
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  const auto status = GemmQuantized<T>(test.layout, test.a_transpose, m, n, k, alpha,
+                                       device_a(), 0, a_ld,
+                                       device_b(), test.b_offset, b_ld,
+                                       test.quantization, test.group_size,
+                                       device_scales(), 0,
+                                       (test.has_zeros) ? device_zeros() : nullptr, 0,
+                                       beta, device_c(), 0, c_ld,
+                                       &queue_plain, &event);
+  if (status != StatusCode::kSuccess) {
+    fprintf(stdout, "   Failed with status %d\n", static_cast<int>(status));
+    return 1;
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+  auto result = std::vector<T>(host_c.size());
+  device_c.Read(queue, result.size(), result);
+
+  // Computes the reference on the host in double-precision and compares the results
+  const auto to_double = [](const T value) { return static_cast<double>(GetRealArg(value)); };
+  const auto default_zero = static_cast<double>(size_t{1} << (bits - 1));
+  auto errors = size_t{0};
+  for (auto i = size_t{0}; i < m; ++i) {
+    for (auto j = size_t{0}; j < n; ++j) {
+      auto sum = 0.0;
+      for (auto l = size_t{0}; l < k; ++l) {
+        const auto group = j * num_groups + l / test.group_size;
+        const auto zero = (test.has_zeros) ? to_double(zeros[group]) : default_zero;
+        const auto code = static_cast<double>(codes[test.b_offset + j * b_ld + l]);
+        const auto b_value = to_double(scales[group]) * (code - zero);
+        sum += to_double(host_a[a_index(i, l)]) * b_value;
+      }
+      const auto reference = to_double(alpha) * sum +
+                             to_double(beta) * to_double(host_c[c_index(i, j)]);
+      const auto difference = std::abs(to_double(result[c_index(i, j)]) - reference);
+      const auto margin = std::abs(reference) + static_cast<double>(k);
+      if (difference > GemmQuantizedTolerance<T>() * margin) { errors++; }
+    }
+  }
+  if (errors == 0) { passed++; return 0; }
+  fprintf(stdout, "   %zu element(s) differ\n", errors);
+  return 1;
+}
+
+template <typename T>
+size_t RunGemmQuantizedTests(const Context &context, Queue &queue, const std::string &precision,
+                             size_t &passed) {
+  if (!PrecisionSupported<T>(queue.GetDevice())) {
+    fprintf(stdout, "* Skipping GemmQuantized for precision '%s': not supported\n",
+            precision.c_str());
+    return 0;
+  }
+  fprintf(stdout, "* Testing GemmQuantized for precision '%s'\n", precision.c_str());
+  const auto col = Layout::kColMajor;
+  const auto row = Layout::kRowMajor;
+  const auto no = Transpose::kNo;
+  const auto yes = Transpose::kYes;
+  const auto int8 = Quantization::kInt8;
+  const auto int4 = Quantization::kInt4;
+  const auto tests = std::vector<GemmQuantizedCase>{
+    {row, no, 64, 64, 128, int4, 32, true, 0},
+    {row, no, 37, 53, 150, int4, 32, false, 1},
+    {col, no, 64, 96, 256, int8, 64, true, 0},
+    {col, yes, 33, 17, 100, int8, 128, false, 5},
+    {row, yes, 8, 129, 64, int4, 16, true, 3},
+    {col, no, 1, 200, 333, int4, 64, true, 0},
+  };
+  auto errors = size_t{0};
+  for (const auto &test : tests) {
+    errors += TestGemmQuantized<T>(context, queue, test, passed);
+  }
+  return errors;
+}
+
+size_t RunGemmQuantizedTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Runs the tests for all precisions
+  errors += RunGemmQuantizedTests<float>(context, queue, "single", passed);
+  errors += RunGemmQuantizedTests<double>(context, queue, "double", passed);
+  errors += RunGemmQuantizedTests<half>(context, queue, "half", passed);
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunGemmQuantizedTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
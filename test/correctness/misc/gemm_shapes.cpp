@@ -0,0 +1,175 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the RegisterGemmShape and ClearGemmShapes functions: the results
+// of the GEMM kernels specialised for a registered shape are compared against those of the regular
+// kernels, for both the direct and the indirect GEMM kernel.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_map>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunGemmShapesTests(int argc, char *argv[], const bool silent,
+                          const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  if (!PrecisionSupported<T>(device)) {
+    fprintf(stdout, "* Skipping GEMM shapes for '%s': precision not supported\n\n",
+            routine_name.c_str());
+    return 0;
+  }
+
+  // Populates the matrices with some example data, large enough for all shapes tested below
+  const auto buffer_size = size_t{160 * 160 + 3};
+  auto host_a = std::vector<T>(buffer_size);
+  auto host_b = std::vector<T>(buffer_size);
+  auto host_c = std::vector<T>(buffer_size);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  auto device_a = Buffer<T>(context, buffer_size);
+  auto device_b = Buffer<T>(context, buffer_size);
+  auto device_c = Buffer<T>(context, buffer_size);
+  device_a.Write(queue, buffer_size, host_a);
+  device_b.Write(queue, buffer_size, host_b);
+  auto queue_plain = queue();
+
+  // Runs GEMM for a shape, returning the resulting output matrix
+  const auto run = [&](const Layout layout, const Transpose a_transpose,
+                       const Transpose b_transpose, const size_t m, const size_t n, const size_t k,
+                       const size_t a_ld, const size_t b_ld, const size_t c_ld,
+                       const size_t offset, std::vector<T> &result) {
+    device_c.Write(queue, buffer_size, host_c);
+    const auto status = Gemm<T>(layout, a_transpose, b_transpose, m, n, k,
+                                ConstantOne<T>(), device_a(), offset, a_ld,
+                                device_b(), offset, b_ld,
+                                ConstantOne<T>(), device_c(), offset, c_ld, &queue_plain);
+    queue.Finish();
+    result = std::vector<T>(buffer_size);
+    device_c.Read(queue, buffer_size, result);
+    return status;
+  };
+
+  fprintf(stdout, "* Testing GEMM shapes for '%s'\n", routine_name.c_str());
+
+  // Makes sure the kernel-selection database is in the cache, such that it can be overridden below
+  auto reference = std::vector<T>();
+  run(Layout::kColMajor, Transpose::kNo, Transpose::kNo, 8, 8, 8, 8, 8, 8, 0, reference);
+
+  // Tests the validation of the arguments
+  const auto status_dimension = RegisterGemmShape(Layout::kColMajor, Transpose::kNo,
+                                                  Transpose::kNo, 0, 64, 64, 64, 64, 64);
+  const auto status_lead_dim = RegisterGemmShape(Layout::kColMajor, Transpose::kNo,
+                                                 Transpose::kNo, 64, 64, 64, 32, 64, 64);
+  if (status_dimension == StatusCode::kInvalidDimension &&
+      status_lead_dim == StatusCode::kInvalidLeadDimA) { passed++; } else { errors++; }
+
+  // Tests both the direct and the indirect GEMM kernel for shapes which are (likely) multiples of
+  // the tile sizes and shapes which aren't, with and without padded leading dimensions
+  for (const auto min_indirect_size : {size_t{0}, size_t{160 * 160 * 160}}) {
+    OverrideParameters(device(), "KernelSelection", PrecisionValue<T>(),
+                       std::unordered_map<std::string,size_t>{{"XGEMM_MIN_INDIRECT_SIZE",
+                                                               min_indirect_size}});
+    for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+      for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+        for (const auto b_transpose : {Transpose::kNo, Transpose::kYes}) {
+          for (const auto size : {size_t{64}, size_t{75}}) {
+            for (const auto ld_padding : {size_t{0}, size_t{5}}) {
+              const auto m = size;
+              const auto n = size + 32;
+              const auto k = size - 16;
+              const auto col_major = (layout == Layout::kColMajor);
+              const auto a_rotated = col_major != (a_transpose == Transpose::kNo);
+              const auto b_rotated = col_major != (b_transpose == Transpose::kNo);
+              const auto c_rotated = !col_major;
+              const auto a_ld = ((a_rotated) ? k : m) + ld_padding;
+              const auto b_ld = ((b_rotated) ? n : k) + ld_padding;
+              const auto c_ld = ((c_rotated) ? n : m) + ld_padding;
+              const auto offset = ld_padding / 2;
+
+              // Runs with the regular kernels, the specialised kernels, and the regular ones again
+              const auto status_reference = run(layout, a_transpose, b_transpose, m, n, k,
+                                                a_ld, b_ld, c_ld, offset, reference);
+              const auto status_register = RegisterGemmShape(layout, a_transpose, b_transpose,
+                                                             m, n, k, a_ld, b_ld, c_ld);
+              auto result = std::vector<T>();
+              const auto status = run(layout, a_transpose, b_transpose, m, n, k,
+                                      a_ld, b_ld, c_ld, offset, result);
+              ClearGemmShapes();
+              auto result_cleared = std::vector<T>();
+              const auto status_cleared = run(layout, a_transpose, b_transpose, m, n, k,
+                                              a_ld, b_ld, c_ld, offset, result_cleared);
+
+              auto diff = size_t{0};
+              for (auto i = size_t{0}; i < buffer_size; ++i) {
+                if (!TestSimilarity(reference[i], result[i])) { diff++; }
+                if (!TestSimilarity(reference[i], result_cleared[i])) { diff++; }
+              }
+              if (status_reference == StatusCode::kSuccess &&
+                  status_register == StatusCode::kSuccess && status == StatusCode::kSuccess &&
+                  status_cleared == StatusCode::kSuccess && diff == 0) {
+                passed++;
+              }
+              else {
+                errors++;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunGemmShapesTests<float>(argc, argv, false, "SGEMMSHAPES");
+  errors += clblast::RunGemmShapesTests<clblast::float2>(argc, argv, true, "CGEMMSHAPES");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,198 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the SetMemoryBudget and RetrieveMemoryFallbacks functions: the
+// results of the low-memory algorithms are compared against those without a budget.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_map>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunMemoryBudgetTests(int argc, char *argv[], const bool silent,
+                            const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto m = GetArgument(arguments, help, kArgM, size_t{131});
+  const auto n = GetArgument(arguments, help, kArgN, size_t{97});
+  const auto k = GetArgument(arguments, help, kArgK, size_t{75});
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  if (!PrecisionSupported<T>(device)) {
+    fprintf(stdout, "* Skipping memory budget for '%s': precision not supported\n\n",
+            routine_name.c_str());
+    return 0;
+  }
+
+  // Populates the matrices (all stored with a leading dimension of 'ld' and an offset, such that
+  // the indirect GEMM kernel requires temporary buffers) with some example data
+  const auto ld = std::max(std::max(m, n), k) + 5;
+  const auto offset = size_t{3};
+  const auto buffer_size = ld * ld + offset;
+  auto host_a = std::vector<T>(buffer_size);
+  auto host_b = std::vector<T>(buffer_size);
+  auto host_c = std::vector<T>(buffer_size);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  auto device_a = Buffer<T>(context, buffer_size);
+  auto device_b = Buffer<T>(context, buffer_size);
+  auto device_c = Buffer<T>(context, buffer_size);
+  device_a.Write(queue, buffer_size, host_a);
+  auto queue_plain = queue();
+
+  // Runs either GEMM or TRMM, returning the resulting output matrix
+  const auto run = [&](const bool is_gemm, const Layout layout, const Side side,
+                       std::vector<T> &result) {
+    device_b.Write(queue, buffer_size, host_b);
+    device_c.Write(queue, buffer_size, host_c);
+    auto status = StatusCode::kSuccess;
+    if (is_gemm) {
+      status = Gemm<T>(layout, Transpose::kYes, Transpose::kNo, m, n, k,
+                       ConstantOne<T>(), device_a(), offset, ld, device_b(), offset, ld,
+                       ConstantOne<T>(), device_c(), offset, ld, &queue_plain);
+    }
+    else {
+      status = Trmm<T>(layout, side, Triangle::kLower, Transpose::kNo, Diagonal::kNonUnit, m, n,
+                       ConstantOne<T>(), device_a(), offset, ld, device_b(), offset, ld,
+                       &queue_plain);
+    }
+    queue.Finish();
+    result = std::vector<T>(buffer_size);
+    if (is_gemm) { device_c.Read(queue, buffer_size, result); }
+    else { device_b.Read(queue, buffer_size, result); }
+    return status;
+  };
+
+  fprintf(stdout, "* Testing memory budget for '%s'\n", routine_name.c_str());
+
+  // The test cases: GEMM and TRMM for both layouts and sides with a budget too small for the
+  // temporary buffers, and TRMM with a budget which just fits its own temporary buffers, such that
+  // it doesn't process B in blocks but its GEMM call has to fall back instead
+  struct TestCase {
+    bool is_gemm;
+    Layout layout;
+    Side side;
+    bool trmm_blocked;
+  };
+  auto test_cases = std::vector<TestCase>();
+  for (const auto is_gemm : {true, false}) {
+    for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+      for (const auto side : {Side::kLeft, Side::kRight}) {
+        if (is_gemm && side == Side::kRight) { continue; }
+        test_cases.push_back(TestCase{is_gemm, layout, side, true});
+        if (!is_gemm) { test_cases.push_back(TestCase{is_gemm, layout, side, false}); }
+      }
+    }
+  }
+
+  // Computes the references without a budget. This also makes sure the kernel-selection database is
+  // in the cache, such that it can be overridden below.
+  auto references = std::vector<std::vector<T>>(test_cases.size());
+  auto statuses_reference = std::vector<StatusCode>(test_cases.size());
+  auto fallbacks_reference = std::vector<std::string>();
+  SetMemoryBudget(context(), 0);
+  for (auto i = size_t{0}; i < test_cases.size(); ++i) {
+    const auto &test_case = test_cases[i];
+    statuses_reference[i] = run(test_case.is_gemm, test_case.layout, test_case.side,
+                                references[i]);
+  }
+  RetrieveMemoryFallbacks(context(), fallbacks_reference);
+
+  // Makes sure that GEMM uses the indirect kernel regardless of the problem size
+  OverrideParameters(device(), "KernelSelection", PrecisionValue<T>(),
+                     std::unordered_map<std::string,size_t>{{"XGEMM_MIN_INDIRECT_SIZE", 0}});
+
+  for (auto i = size_t{0}; i < test_cases.size(); ++i) {
+    const auto &test_case = test_cases[i];
+
+    // Computes the budget: either too small for a copy of the matrices or just large enough for
+    // the triangular matrix and the copy of B of TRMM
+    auto budget = ld * ld * sizeof(T) + 1024;
+    if (!test_case.trmm_blocked) {
+      const auto trmm_k = (test_case.side == Side::kLeft) ? m : n;
+      const auto b_one = (test_case.layout == Layout::kRowMajor) ? n : m;
+      const auto b_two = (test_case.layout == Layout::kRowMajor) ? m : n;
+      const auto b_size = ld * (b_two - 1) + b_one + offset;
+      budget = (trmm_k * trmm_k + b_size) * sizeof(T) + 1024;
+    }
+
+    auto result = std::vector<T>();
+    auto fallbacks = std::vector<std::string>();
+    SetMemoryBudget(context(), budget);
+    const auto status = run(test_case.is_gemm, test_case.layout, test_case.side, result);
+    RetrieveMemoryFallbacks(context(), fallbacks);
+    SetMemoryBudget(context(), 0);
+
+    // The non-blocked TRMM cases should only have fallbacks of the GEMM call
+    auto unexpected_fallbacks = size_t{0};
+    if (!test_case.trmm_blocked) {
+      for (const auto &fallback : fallbacks) {
+        if (fallback.find("blocks of") != std::string::npos) { unexpected_fallbacks++; }
+      }
+    }
+
+    auto diff = size_t{0};
+    for (auto j = size_t{0}; j < buffer_size; ++j) {
+      if (!TestSimilarity(references[i][j], result[j])) { diff++; }
+    }
+    if (statuses_reference[i] == StatusCode::kSuccess && status == StatusCode::kSuccess &&
+        fallbacks.size() > 0 && unexpected_fallbacks == 0 && diff == 0) {
+      passed++;
+    }
+    else {
+      errors++;
+    }
+  }
+  if (fallbacks_reference.size() == 0) { passed++; } else { errors++; }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunMemoryBudgetTests<float>(argc, argv, false, "SMEMORYBUDGET");
+  errors += clblast::RunMemoryBudgetTests<clblast::float2>(argc, argv, true, "CMEMORYBUDGET");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,122 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the SetNumerics function
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+#include "test/routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+size_t RunNumericsTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  auto example_routine = TestXgemm<T>();
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  auto args = Arguments<T>{};
+  args.m = GetArgument(arguments, help, kArgM, size_t{64});
+  args.n = GetArgument(arguments, help, kArgN, size_t{64});
+  args.k = GetArgument(arguments, help, kArgK, size_t{64});
+  args.a_ld = args.k;
+  args.b_ld = args.n;
+  args.c_ld = args.n;
+  args.layout = Layout::kRowMajor;
+  args.a_transpose = Transpose::kNo;
+  args.b_transpose = Transpose::kNo;
+  args.alpha = GetScalar<T>();
+  args.beta = GetScalar<T>();
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Populate host matrices with some example data and copies them to the device
+  auto host_a = std::vector<T>(args.m * args.k);
+  auto host_b = std::vector<T>(args.n * args.k);
+  auto host_c = std::vector<T>(args.m * args.n);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  auto device_a = Buffer<T>(context, host_a.size());
+  auto device_b = Buffer<T>(context, host_b.size());
+  auto device_c = Buffer<T>(context, host_c.size());
+  device_a.Write(queue, host_a.size(), host_a);
+  device_b.Write(queue, host_b.size(), host_b);
+  auto dummy = Buffer<T>(context, 1);
+  auto buffers = Buffers<T>{dummy, dummy, device_a, device_b, device_c, dummy, dummy};
+
+  fprintf(stdout, "* Testing SetNumerics for '%s'\n", routine_name.c_str());
+
+  // Runs the routine in each of the numerics modes, starting with the strict reference
+  auto results = std::vector<std::vector<T>>();
+  for (const auto numerics : {Numerics::kStrict, Numerics::kDefault, Numerics::kFast}) {
+    auto result = std::vector<T>(host_c.size());
+    device_c.Write(queue, host_c.size(), host_c);
+    if (SetNumerics(numerics) != StatusCode::kSuccess) { errors++; continue; }
+    const auto status = example_routine.RunRoutine(args, buffers, queue);
+    if (status != StatusCode::kSuccess) { errors++; continue; }
+    device_c.Read(queue, result.size(), result);
+    results.push_back(result);
+  }
+  SetNumerics(Numerics::kDefault);
+
+  // The default and relaxed variants should be numerically close to the strict reference
+  for (auto r = size_t{1}; r < results.size(); ++r) {
+    auto diff = size_t{0};
+    for (auto i = size_t{0}; i < host_c.size(); ++i) {
+      if (!TestSimilarity(results[0][i], results[r][i])) { diff++; }
+    }
+    if (diff == 0) { passed++; } else { errors++; }
+  }
+
+  // An invalid numerics mode should be rejected
+  if (SetNumerics(static_cast<Numerics>(0)) != StatusCode::kInvalidArgValue) { errors++; }
+  else { passed++; }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunNumericsTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunNumericsTests<clblast::float2>(argc, argv, true, "CGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
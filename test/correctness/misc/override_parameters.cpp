@@ -100,6 +100,14 @@ size_t RunOverrideTests(int argc, char *argv[], const bool silent, const std::st
     const auto status = OverrideParameters(device(), kernel_name, precision, override_setting);
     if (status != StatusCode::kSuccess) { errors++; continue; } // error shouldn't occur
 
+    // Retrieves the parameters again, these should now be the overridden ones
+    auto retrieved_setting = std::unordered_map<std::string,size_t>();
+    auto database_entry = std::string{};
+    const auto status_retrieve = RetrieveParameters(device(), kernel_name, precision,
+                                                    retrieved_setting, database_entry);
+    if (status_retrieve != StatusCode::kSuccess) { errors++; continue; }
+    if (retrieved_setting != override_setting) { errors++; continue; }
+
     const auto status_after = example_routine.RunRoutine(args, buffers, queue);
     if (status_after != StatusCode::kSuccess) { errors++; continue; }
     passed++;
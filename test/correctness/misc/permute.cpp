@@ -0,0 +1,204 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the Permute function
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// A single test-case: the shape of A, the permutation, and optionally the strides of A and B
+struct PermuteCase {
+  std::string name;
+  std::vector<size_t> shape;
+  std::vector<size_t> permutation;
+  std::vector<size_t> a_strides;
+  std::vector<size_t> b_strides;
+};
+
+// Computes the strides of a packed tensor
+std::vector<size_t> PackedStrides(const std::vector<size_t> &shape) {
+  auto strides = std::vector<size_t>(shape.size());
+  auto stride = size_t{1};
+  for (auto i = shape.size(); i-- > 0; ) {
+    strides[i] = stride;
+    stride *= shape[i];
+  }
+  return strides;
+}
+
+// Scales a value on the host and compares a result against a reference value, with half-precision
+// versions computing in single-precision
+template <typename T>
+T PermuteScale(const T alpha, const T value) { return alpha * value; }
+half PermuteScale(const half alpha, const half value) {
+  return FloatToHalf(HalfToFloat(alpha) * HalfToFloat(value));
+}
+template <typename T>
+bool PermuteDiffers(const T result, const T reference) {
+  return std::abs(result - reference) > 1.0e-5 * std::abs(reference);
+}
+bool PermuteDiffers(const half result, const half reference) {
+  return PermuteDiffers(HalfToFloat(result), HalfToFloat(reference));
+}
+
+// Tests a single permutation against a host reference
+template <typename T>
+size_t TestPermute(const Context &context, Queue &queue, const PermuteCase &test, size_t &passed) {
+  fprintf(stdout, "* Testing Permute for '%s'\n", test.name.c_str());
+  const auto num_dims = test.shape.size();
+  auto b_shape = std::vector<size_t>(num_dims);
+  for (auto i = size_t{0}; i < num_dims; ++i) { b_shape[i] = test.shape[test.permutation[i]]; }
+  const auto a_strides = (test.a_strides.empty()) ? PackedStrides(test.shape) : test.a_strides;
+  const auto b_strides = (test.b_strides.empty()) ? PackedStrides(b_shape) : test.b_strides;
+  auto a_size = size_t{1};
+  auto b_size = size_t{1};
+  for (auto i = size_t{0}; i < num_dims; ++i) {
+    a_size += (test.shape[i] - 1) * a_strides[i];
+    b_size += (b_shape[i] - 1) * b_strides[i];
+  }
+
+  // Populates the input and output tensors with some example data
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  auto host_a = std::vector<T>(a_size);
+  auto host_b = std::vector<T>(b_size);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  auto device_a = Buffer<T>(context, a_size);
+  auto device_b = Buffer<T>(context, b_size);
+  device_a.Write(queue, a_size, host_a);
+  device_b.Write(queue, b_size, host_b);
+
+  // Runs the routine
+  const auto alpha = Constant<T>(2.0);
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  const auto status = Permute<T>(num_dims, test.shape.data(), test.permutation.data(), alpha,
+                                 device_a(), 0,
+                                 (test.a_strides.empty()) ? nullptr : test.a_strides.data(),
+                                 device_b(), 0,
+                                 (test.b_strides.empty()) ? nullptr : test.b_strides.data(),
+                                 &queue_plain, &event);
+  if (status != StatusCode::kSuccess) {
+    fprintf(stdout, "   Failed with status %d\n", static_cast<int>(status));
+    return 1;
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+  auto result = std::vector<T>(b_size);
+  device_b.Read(queue, b_size, result);
+
+  // Computes the reference on the host: elements of B outside the tensor remain unchanged
+  auto reference = host_b;
+  auto index = std::vector<size_t>(num_dims, 0);
+  auto num_elements = size_t{1};
+  for (const auto size : b_shape) { num_elements *= size; }
+  for (auto e = size_t{0}; e < num_elements; ++e) {
+    auto a_index = size_t{0};
+    auto b_index = size_t{0};
+    for (auto i = size_t{0}; i < num_dims; ++i) {
+      b_index += index[i] * b_strides[i];
+      a_index += index[i] * a_strides[test.permutation[i]];
+    }
+    reference[b_index] = PermuteScale(alpha, host_a[a_index]);
+    for (auto i = num_dims; i-- > 0; ) {
+      if (++index[i] < b_shape[i]) { break; }
+      index[i] = 0;
+    }
+  }
+
+  // Compares the results: the operation is a scaled copy, thus exact up to rounding of the scaling
+  auto diff = size_t{0};
+  for (auto i = size_t{0}; i < b_size; ++i) {
+    if (PermuteDiffers(result[i], reference[i])) { diff++; }
+  }
+  if (diff == 0) { passed++; return 0; }
+  fprintf(stdout, "   %zu element(s) differ\n", diff);
+  return 1;
+}
+
+template <typename T>
+size_t RunPermuteTests(const Context &context, Queue &queue, const std::string &precision,
+                       size_t &passed) {
+  if (!PrecisionSupported<T>(queue.GetDevice())) {
+    fprintf(stdout, "* Skipping Permute for precision '%s': not supported\n", precision.c_str());
+    return 0;
+  }
+  fprintf(stdout, "* Testing Permute for precision '%s'\n", precision.c_str());
+  const auto tests = std::vector<PermuteCase>{
+    {"2D transpose", {67, 45}, {1, 0}, {}, {}},
+    {"NCHW to NHWC", {3, 17, 9, 11}, {0, 2, 3, 1}, {}, {}},
+    {"NHWC to NCHW", {3, 9, 11, 17}, {0, 3, 1, 2}, {}, {}},
+    {"3D rotation", {13, 19, 23}, {2, 0, 1}, {}, {}},
+    {"6D permutation", {2, 3, 4, 5, 3, 2}, {5, 3, 1, 0, 4, 2}, {}, {}},
+    {"contiguous inner dimension", {7, 5, 33}, {1, 0, 2}, {}, {}},
+    {"identity", {5, 6, 7}, {0, 1, 2}, {}, {}},
+    {"strided batched transpose", {4, 20, 30}, {0, 2, 1}, {20*35 + 3, 35, 1}, {30*24 + 5, 24, 1}},
+  };
+  auto errors = size_t{0};
+  for (const auto &test : tests) {
+    errors += TestPermute<T>(context, queue, test, passed);
+  }
+  return errors;
+}
+
+size_t RunPermuteTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Runs the tests for all precisions
+  errors += RunPermuteTests<float>(context, queue, "single", passed);
+  errors += RunPermuteTests<double>(context, queue, "double", passed);
+  errors += RunPermuteTests<float2>(context, queue, "complex single", passed);
+  errors += RunPermuteTests<double2>(context, queue, "complex double", passed);
+  errors += RunPermuteTests<half>(context, queue, "half", passed);
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunPermuteTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
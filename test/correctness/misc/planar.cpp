@@ -0,0 +1,221 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the planar-complex routines. These are compared against the
+// regular (interleaved) complex routines of CLBlast itself, which are tested separately.
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Helper to store a host vector of complex values as planar data on the device and back
+template <typename T>
+class PlanarData {
+ public:
+  using R = typename BaseType<T>::Type;
+  PlanarData(const Context &context, const size_t size):
+      size_(size), real_(context, size), imag_(context, size) { }
+  void Write(Queue &queue, const std::vector<T> &host) {
+    auto host_real = std::vector<R>(size_);
+    auto host_imag = std::vector<R>(size_);
+    for (auto i = size_t{0}; i < size_; ++i) {
+      host_real[i] = host[i].real();
+      host_imag[i] = host[i].imag();
+    }
+    real_.Write(queue, size_, host_real);
+    imag_.Write(queue, size_, host_imag);
+  }
+  std::vector<T> Read(Queue &queue) const {
+    auto host_real = std::vector<R>(size_);
+    auto host_imag = std::vector<R>(size_);
+    real_.Read(queue, size_, host_real);
+    imag_.Read(queue, size_, host_imag);
+    auto host = std::vector<T>(size_);
+    for (auto i = size_t{0}; i < size_; ++i) { host[i] = T{host_real[i], host_imag[i]}; }
+    return host;
+  }
+  cl_mem real() const { return real_(); }
+  cl_mem imag() const { return imag_(); }
+ private:
+  const size_t size_;
+  Buffer<R> real_;
+  Buffer<R> imag_;
+};
+
+// Compares the results of a planar-complex routine against those of the interleaved routine
+template <typename T>
+bool CompareResults(Queue &queue, const Buffer<T> &reference, const PlanarData<T> &result,
+                    const size_t size) {
+  auto host_reference = std::vector<T>(size);
+  reference.Read(queue, size, host_reference);
+  const auto host_result = result.Read(queue);
+  for (auto i = size_t{0}; i < size; ++i) {
+    if (!TestSimilarity(host_reference[i], host_result[i])) { return false; }
+  }
+  return true;
+}
+
+template <typename T>
+size_t RunPlanarTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto m = GetArgument(arguments, help, kArgM, size_t{67});
+  const auto n = GetArgument(arguments, help, kArgN, size_t{45});
+  const auto k = GetArgument(arguments, help, kArgK, size_t{39});
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  if (!PrecisionSupported<T>(device)) {
+    fprintf(stdout, "* Skipping planar-complex routines for '%s': precision not supported\n\n",
+            routine_name.c_str());
+    return 0;
+  }
+
+  // All matrices are square with a leading dimension large enough for all transposes, stored with
+  // an offset. The vectors are strided in the first tests and contiguous in the second ones (for
+  // the vectorized version of the kernel).
+  const auto ld = std::max(std::max(m, n), k) + 3;
+  const auto offset = size_t{2};
+  const auto buffer_size = ld * ld + offset;
+  auto host_a = std::vector<T>(buffer_size);
+  auto host_b = std::vector<T>(buffer_size);
+  auto host_c = std::vector<T>(buffer_size);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  auto device_a = Buffer<T>(context, buffer_size);
+  auto device_b = Buffer<T>(context, buffer_size);
+  auto device_c = Buffer<T>(context, buffer_size);
+  auto planar_a = PlanarData<T>(context, buffer_size);
+  auto planar_b = PlanarData<T>(context, buffer_size);
+  auto planar_c = PlanarData<T>(context, buffer_size);
+  const auto alpha = T{1.5, -0.5};
+  const auto beta = T{-0.75, 0.25};
+
+  // Resets all the buffers to the host data
+  const auto reset = [&]() {
+    device_a.Write(queue, buffer_size, host_a);
+    device_b.Write(queue, buffer_size, host_b);
+    device_c.Write(queue, buffer_size, host_c);
+    planar_a.Write(queue, host_a);
+    planar_b.Write(queue, host_b);
+    planar_c.Write(queue, host_c);
+  };
+  const auto check = [&](const StatusCode reference_status, const StatusCode status,
+                         const Buffer<T> &reference, const PlanarData<T> &result) {
+    if (reference_status != StatusCode::kSuccess || status != StatusCode::kSuccess) { errors++; }
+    else if (CompareResults(queue, reference, result, buffer_size)) { passed++; }
+    else { errors++; }
+  };
+  auto queue_plain = queue();
+
+  fprintf(stdout, "* Testing planar-complex routines for '%s'\n", routine_name.c_str());
+
+  // Tests the level-1 routines, first strided and then contiguous
+  for (const auto inc : {size_t{3}, size_t{1}}) {
+    const auto vec_offset = (inc == 1) ? size_t{0} : offset;
+    const auto vec_size = (inc == 1) ? buffer_size - 2 : (buffer_size - offset - 1) / inc;
+    reset();
+    check(Axpy<T>(vec_size, alpha, device_a(), vec_offset, inc, device_c(), vec_offset, inc,
+                  &queue_plain),
+          AxpyPlanar<T>(vec_size, alpha, planar_a.real(), planar_a.imag(), vec_offset, inc,
+                        planar_c.real(), planar_c.imag(), vec_offset, inc, &queue_plain),
+          device_c, planar_c);
+    reset();
+    check(Scal<T>(vec_size, alpha, device_c(), vec_offset, inc, &queue_plain),
+          ScalPlanar<T>(vec_size, alpha, planar_c.real(), planar_c.imag(), vec_offset, inc,
+                        &queue_plain),
+          device_c, planar_c);
+    reset();
+    check(Copy<T>(vec_size, device_a(), vec_offset, inc, device_c(), vec_offset, inc,
+                  &queue_plain),
+          CopyPlanar<T>(vec_size, planar_a.real(), planar_a.imag(), vec_offset, inc,
+                        planar_c.real(), planar_c.imag(), vec_offset, inc, &queue_plain),
+          device_c, planar_c);
+  }
+
+  // Tests GEMV and GEMM for both layouts and all transpose options
+  const auto transposes = {Transpose::kNo, Transpose::kYes, Transpose::kConjugate};
+  for (const auto layout : {Layout::kRowMajor, Layout::kColMajor}) {
+    for (const auto a_transpose : transposes) {
+      reset();
+      check(Gemv<T>(layout, a_transpose, m, n, alpha, device_a(), offset, ld,
+                    device_b(), offset, 2, beta, device_c(), offset, 1, &queue_plain),
+            GemvPlanar<T>(layout, a_transpose, m, n, alpha,
+                          planar_a.real(), planar_a.imag(), offset, ld,
+                          planar_b.real(), planar_b.imag(), offset, 2, beta,
+                          planar_c.real(), planar_c.imag(), offset, 1, &queue_plain),
+            device_c, planar_c);
+      for (const auto b_transpose : transposes) {
+        reset();
+        check(Gemm<T>(layout, a_transpose, b_transpose, m, n, k, alpha,
+                      device_a(), offset, ld, device_b(), offset, ld, beta,
+                      device_c(), offset, ld, &queue_plain),
+              GemmPlanar<T>(layout, a_transpose, b_transpose, m, n, k, alpha,
+                            planar_a.real(), planar_a.imag(), offset, ld,
+                            planar_b.real(), planar_b.imag(), offset, ld, beta,
+                            planar_c.real(), planar_c.imag(), offset, ld, &queue_plain),
+              device_c, planar_c);
+      }
+    }
+  }
+
+  // Tests GEMM with real-valued scalars, which doesn't need the scaled temporary copy of B
+  reset();
+  check(Gemm<T>(Layout::kColMajor, Transpose::kNo, Transpose::kConjugate, m, n, k,
+                T{2.0, 0.0}, device_a(), offset, ld, device_b(), offset, ld, T{0.0, 0.0},
+                device_c(), offset, ld, &queue_plain),
+        GemmPlanar<T>(Layout::kColMajor, Transpose::kNo, Transpose::kConjugate, m, n, k,
+                      T{2.0, 0.0}, planar_a.real(), planar_a.imag(), offset, ld,
+                      planar_b.real(), planar_b.imag(), offset, ld, T{0.0, 0.0},
+                      planar_c.real(), planar_c.imag(), offset, ld, &queue_plain),
+        device_c, planar_c);
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunPlanarTests<clblast::float2>(argc, argv, false, "CPLANAR");
+  errors += clblast::RunPlanarTests<clblast::double2>(argc, argv, true, "ZPLANAR");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,382 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the QR functions: Geqrf, Ormqr, Tsqr and GeqrfBatched
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <algorithm>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Host-side matrices are stored column-major in double-precision, device-side matrices follow the
+// layout of the test-case
+inline size_t QrTestIndex(const size_t i, const size_t j, const size_t ld, const Layout layout) {
+  return (layout == Layout::kRowMajor) ? i*ld + j : j*ld + i;
+}
+
+// Converts a device matrix into a host matrix and vice-versa
+template <typename T>
+std::vector<double> QrToHost(const std::vector<T> &device_matrix, const size_t offset,
+                             const size_t m, const size_t n, const size_t ld,
+                             const Layout layout) {
+  auto result = std::vector<double>(m * n);
+  for (auto i = size_t{0}; i < m; ++i) {
+    for (auto j = size_t{0}; j < n; ++j) {
+      result[j*m + i] = static_cast<double>(device_matrix[offset + QrTestIndex(i, j, ld, layout)]);
+    }
+  }
+  return result;
+}
+
+// Applies the k reflectors stored below the diagonal of the m-row matrix 'v' (column-major) to the
+// m by n matrix C (column-major): C = Q * C or C = Q^T * C, with Q = H(0) * H(1) * ... * H(k-1)
+inline void QrApplyHost(const bool transpose_q, const size_t m, const size_t n, const size_t k,
+                        const std::vector<double> &v, const std::vector<double> &tau,
+                        std::vector<double> &c) {
+  for (auto step = size_t{0}; step < k; ++step) {
+    const auto r = (transpose_q) ? step : k - 1 - step;
+    for (auto j = size_t{0}; j < n; ++j) {
+      auto dot = c[j*m + r];
+      for (auto i = r + 1; i < m; ++i) { dot += v[r*m + i] * c[j*m + i]; }
+      dot *= tau[r];
+      c[j*m + r] -= dot;
+      for (auto i = r + 1; i < m; ++i) { c[j*m + i] -= dot * v[r*m + i]; }
+    }
+  }
+}
+
+// Verifies a QR factorization (R in the upper triangle of 'qr', the reflectors below) by
+// reconstructing A = Q * R on the host. Returns the number of erroneous elements.
+inline size_t QrVerifyFactorization(const size_t m, const size_t n,
+                                    const std::vector<double> &a, const std::vector<double> &qr,
+                                    const std::vector<double> &tau, const double tolerance) {
+  auto reconstructed = std::vector<double>(m * n, 0.0);
+  for (auto j = size_t{0}; j < n; ++j) {
+    for (auto i = size_t{0}; i <= std::min(j, m - 1); ++i) { reconstructed[j*m + i] = qr[j*m + i]; }
+  }
+  QrApplyHost(false, m, n, std::min(m, n), qr, tau, reconstructed);
+  auto errors = size_t{0};
+  for (auto index = size_t{0}; index < m * n; ++index) {
+    if (std::abs(reconstructed[index] - a[index]) > tolerance * static_cast<double>(m)) { errors++; }
+  }
+  return errors;
+}
+
+// The tolerance relative to the machine precision
+template <typename T> double QrTolerance() { return 1.0e-4; }
+template <> double QrTolerance<double>() { return 1.0e-10; }
+
+// =================================================================================================
+
+// Tests Geqrf and, based on its result, Ormqr for all sides and transposes
+template <typename T>
+size_t TestGeqrf(const Context &context, Queue &queue, const Layout layout,
+                 const size_t m, const size_t n, size_t &passed) {
+  fprintf(stdout, "* Testing Geqrf and Ormqr: %s, m=%zu n=%zu\n",
+          (layout == Layout::kRowMajor) ? "row-major" : "col-major", m, n);
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  const auto k = std::min(m, n);
+  const auto a_offset = size_t{3};
+  const auto a_ld = ((layout == Layout::kRowMajor) ? n : m) + 2;
+  const auto a_size = a_offset + a_ld * ((layout == Layout::kRowMajor) ? m : n);
+  auto host_a = std::vector<T>(a_size);
+  PopulateVector(host_a, mt, dist);
+
+  // Runs the factorization
+  auto device_a = Buffer<T>(context, a_size);
+  auto device_tau = Buffer<T>(context, k);
+  device_a.Write(queue, a_size, host_a);
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  auto status = Geqrf<T>(layout, m, n, device_a(), a_offset, a_ld, device_tau(), 0,
+                         &queue_plain, &event);
+  if (status != StatusCode::kSuccess) {
+    fprintf(stdout, "   Geqrf failed with status %d\n", static_cast<int>(status));
+    return 1;
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+  auto result_a = std::vector<T>(a_size);
+  auto result_tau = std::vector<T>(k);
+  device_a.Read(queue, a_size, result_a);
+  device_tau.Read(queue, k, result_tau);
+
+  // Verifies the factorization
+  const auto a = QrToHost(host_a, a_offset, m, n, a_ld, layout);
+  const auto qr = QrToHost(result_a, a_offset, m, n, a_ld, layout);
+  const auto tau = QrToHost(result_tau, 0, k, 1, k, Layout::kColMajor);
+  auto errors = size_t{0};
+  const auto factorization_errors = QrVerifyFactorization(m, n, a, qr, tau, QrTolerance<T>());
+  if (factorization_errors == 0) { passed++; }
+  else { fprintf(stdout, "   Geqrf: %zu element(s) differ\n", factorization_errors); errors++; }
+
+  // Applies Q from both sides and compares with a host reference using the reflectors from above
+  for (const auto side : {Side::kLeft, Side::kRight}) {
+    for (const auto a_transpose : {Transpose::kNo, Transpose::kYes}) {
+      const auto c_m = (side == Side::kLeft) ? m : size_t{19};
+      const auto c_n = (side == Side::kLeft) ? size_t{23} : m;
+      const auto c_ld = ((layout == Layout::kRowMajor) ? c_n : c_m) + 1;
+      const auto c_size = c_ld * ((layout == Layout::kRowMajor) ? c_m : c_n);
+      auto host_c = std::vector<T>(c_size);
+      PopulateVector(host_c, mt, dist);
+      auto device_c = Buffer<T>(context, c_size);
+      device_c.Write(queue, c_size, host_c);
+
+      // The reflectors are those of an m-row matrix: A is used as the 'A' matrix of Ormqr directly
+      status = Ormqr<T>(layout, side, a_transpose, c_m, c_n, k,
+                        device_a(), a_offset, a_ld, device_tau(), 0,
+                        device_c(), 0, c_ld, &queue_plain, &event);
+      if (status != StatusCode::kSuccess) {
+        fprintf(stdout, "   Ormqr failed with status %d\n", static_cast<int>(status));
+        errors++;
+        continue;
+      }
+      clWaitForEvents(1, &event);
+      clReleaseEvent(event);
+      auto result_c = std::vector<T>(c_size);
+      device_c.Read(queue, c_size, result_c);
+
+      // Computes the reference: C * op(Q) is computed as (op(Q)^T * C^T)^T
+      auto reference = QrToHost(host_c, 0, c_m, c_n, c_ld, layout);
+      const auto transpose_q = (a_transpose == Transpose::kYes);
+      if (side == Side::kLeft) {
+        QrApplyHost(transpose_q, m, c_n, k, qr, tau, reference);
+      }
+      else {
+        auto transposed = std::vector<double>(c_m * c_n);
+        for (auto i = size_t{0}; i < c_m; ++i) {
+          for (auto j = size_t{0}; j < c_n; ++j) { transposed[i*c_n + j] = reference[j*c_m + i]; }
+        }
+        QrApplyHost(!transpose_q, m, c_m, k, qr, tau, transposed);
+        for (auto i = size_t{0}; i < c_m; ++i) {
+          for (auto j = size_t{0}; j < c_n; ++j) { reference[j*c_m + i] = transposed[i*c_n + j]; }
+        }
+      }
+      const auto result = QrToHost(result_c, 0, c_m, c_n, c_ld, layout);
+      auto ormqr_errors = size_t{0};
+      for (auto index = size_t{0}; index < c_m * c_n; ++index) {
+        if (std::abs(result[index] - reference[index]) > QrTolerance<T>() * static_cast<double>(m)) {
+          ormqr_errors++;
+        }
+      }
+      if (ormqr_errors == 0) { passed++; }
+      else {
+        fprintf(stdout, "   Ormqr (%s, %s): %zu element(s) differ\n",
+                (side == Side::kLeft) ? "left" : "right",
+                (transpose_q) ? "Q^T" : "Q", ormqr_errors);
+        errors++;
+      }
+    }
+  }
+  return errors;
+}
+
+// =================================================================================================
+
+// Tests Tsqr by verifying that Q has orthonormal columns, that R is upper-triangular, and that
+// Q * R equals the original matrix
+template <typename T>
+size_t TestTsqr(const Context &context, Queue &queue, const Layout layout,
+                const size_t m, const size_t n, size_t &passed) {
+  fprintf(stdout, "* Testing Tsqr: %s, m=%zu n=%zu\n",
+          (layout == Layout::kRowMajor) ? "row-major" : "col-major", m, n);
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  const auto a_ld = (layout == Layout::kRowMajor) ? n : m + 1;
+  const auto a_size = a_ld * ((layout == Layout::kRowMajor) ? m : n);
+  const auto r_ld = n + 1;
+  const auto r_size = r_ld * n;
+  auto host_a = std::vector<T>(a_size);
+  auto host_r = std::vector<T>(r_size);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_r, mt, dist);
+
+  // Runs the factorization
+  auto device_a = Buffer<T>(context, a_size);
+  auto device_r = Buffer<T>(context, r_size);
+  device_a.Write(queue, a_size, host_a);
+  device_r.Write(queue, r_size, host_r);
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  const auto status = Tsqr<T>(layout, m, n, device_a(), 0, a_ld, device_r(), 0, r_ld,
+                              &queue_plain, &event);
+  if (status != StatusCode::kSuccess) {
+    fprintf(stdout, "   Failed with status %d\n", static_cast<int>(status));
+    return 1;
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+  auto result_q = std::vector<T>(a_size);
+  auto result_r = std::vector<T>(r_size);
+  device_a.Read(queue, a_size, result_q);
+  device_r.Read(queue, r_size, result_r);
+  const auto a = QrToHost(host_a, 0, m, n, a_ld, layout);
+  const auto q = QrToHost(result_q, 0, m, n, a_ld, layout);
+  const auto r = QrToHost(result_r, 0, n, n, r_ld, layout);
+
+  // Verifies the results
+  const auto tolerance = QrTolerance<T>() * static_cast<double>(n);
+  auto errors = size_t{0};
+  for (auto i = size_t{0}; i < n; ++i) {
+    for (auto j = size_t{0}; j < n; ++j) {
+      if (i > j && r[j*n + i] != 0.0) { errors++; }
+      auto dot = 0.0;
+      for (auto l = size_t{0}; l < m; ++l) { dot += q[i*m + l] * q[j*m + l]; }
+      if (std::abs(dot - ((i == j) ? 1.0 : 0.0)) > tolerance * 10.0) { errors++; }
+    }
+  }
+  for (auto i = size_t{0}; i < m; ++i) {
+    for (auto j = size_t{0}; j < n; ++j) {
+      auto sum = 0.0;
+      for (auto l = size_t{0}; l <= j; ++l) { sum += q[l*m + i] * r[j*n + l]; }
+      if (std::abs(sum - a[j*m + i]) > tolerance * std::sqrt(static_cast<double>(m))) { errors++; }
+    }
+  }
+  if (errors == 0) { passed++; return 0; }
+  fprintf(stdout, "   %zu element(s) differ\n", errors);
+  return 1;
+}
+
+// =================================================================================================
+
+// Tests GeqrfBatched on matrices at irregular offsets
+template <typename T>
+size_t TestGeqrfBatched(const Context &context, Queue &queue, const Layout layout,
+                        const size_t m, const size_t n, const size_t batch_count,
+                        size_t &passed) {
+  fprintf(stdout, "* Testing GeqrfBatched: %s, m=%zu n=%zu, batch=%zu\n",
+          (layout == Layout::kRowMajor) ? "row-major" : "col-major", m, n, batch_count);
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  const auto k = std::min(m, n);
+  const auto a_ld = (layout == Layout::kRowMajor) ? n : m;
+  const auto a_stride = a_ld * ((layout == Layout::kRowMajor) ? m : n) + 5;
+  auto a_offsets = std::vector<size_t>(batch_count);
+  auto tau_offsets = std::vector<size_t>(batch_count);
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    a_offsets[batch] = (batch_count - 1 - batch) * a_stride + 1; // in reverse order
+    tau_offsets[batch] = batch * (k + 2);
+  }
+  const auto a_size = batch_count * a_stride + 1;
+  const auto tau_size = batch_count * (k + 2);
+  auto host_a = std::vector<T>(a_size);
+  PopulateVector(host_a, mt, dist);
+
+  // Runs the factorization
+  auto device_a = Buffer<T>(context, a_size);
+  auto device_tau = Buffer<T>(context, tau_size);
+  device_a.Write(queue, a_size, host_a);
+  auto queue_plain = queue();
+  auto event = cl_event{};
+  const auto status = GeqrfBatched<T>(layout, m, n, device_a(), a_offsets.data(), a_ld,
+                                      device_tau(), tau_offsets.data(), batch_count,
+                                      &queue_plain, &event);
+  if (status != StatusCode::kSuccess) {
+    fprintf(stdout, "   Failed with status %d\n", static_cast<int>(status));
+    return 1;
+  }
+  clWaitForEvents(1, &event);
+  clReleaseEvent(event);
+  auto result_a = std::vector<T>(a_size);
+  auto result_tau = std::vector<T>(tau_size);
+  device_a.Read(queue, a_size, result_a);
+  device_tau.Read(queue, tau_size, result_tau);
+
+  // Verifies each of the factorizations
+  auto errors = size_t{0};
+  for (auto batch = size_t{0}; batch < batch_count; ++batch) {
+    const auto a = QrToHost(host_a, a_offsets[batch], m, n, a_ld, layout);
+    const auto qr = QrToHost(result_a, a_offsets[batch], m, n, a_ld, layout);
+    const auto tau = QrToHost(result_tau, tau_offsets[batch], k, 1, k, Layout::kColMajor);
+    errors += QrVerifyFactorization(m, n, a, qr, tau, QrTolerance<T>());
+  }
+  if (errors == 0) { passed++; return 0; }
+  fprintf(stdout, "   %zu element(s) differ\n", errors);
+  return 1;
+}
+
+// =================================================================================================
+
+template <typename T>
+size_t RunQrTests(const Context &context, Queue &queue, const std::string &precision,
+                  size_t &passed) {
+  if (!PrecisionSupported<T>(queue.GetDevice())) {
+    fprintf(stdout, "* Skipping QR for precision '%s': not supported\n", precision.c_str());
+    return 0;
+  }
+  fprintf(stdout, "* Testing QR for precision '%s'\n", precision.c_str());
+  const auto col = Layout::kColMajor;
+  const auto row = Layout::kRowMajor;
+  auto errors = size_t{0};
+  errors += TestGeqrf<T>(context, queue, col, 100, 60, passed);
+  errors += TestGeqrf<T>(context, queue, row, 37, 80, passed);
+  errors += TestGeqrf<T>(context, queue, col, 130, 130, passed);
+  errors += TestGeqrf<T>(context, queue, row, 65, 33, passed);
+  errors += TestTsqr<T>(context, queue, col, 5000, 8, passed);
+  errors += TestTsqr<T>(context, queue, row, 1000, 32, passed);
+  errors += TestTsqr<T>(context, queue, col, 100, 100, passed);
+  errors += TestTsqr<T>(context, queue, row, 70000, 4, passed);
+  errors += TestGeqrfBatched<T>(context, queue, col, 16, 16, 50, passed);
+  errors += TestGeqrfBatched<T>(context, queue, row, 33, 7, 9, passed);
+  return errors;
+}
+
+size_t RunQrTests(int argc, char *argv[]) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+
+  // Prints the help message (command-line arguments)
+  fprintf(stdout, "\n* %s\n", help.c_str());
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Runs the tests for the single and double precisions
+  errors += RunQrTests<float>(context, queue, "single", passed);
+  errors += RunQrTests<double>(context, queue, "double", passed);
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  const auto errors = clblast::RunQrTests(argc, argv);
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,155 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the VectorStats function
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <random>
+#include <cmath>
+
+#include "utilities/utilities.hpp"
+#include "test/correctness/tester.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Computes the requested statistics on the host in the same order as the VectorStats function
+template <typename T>
+std::vector<T> ReferenceStats(const Statistic statistics, const std::vector<T> &x,
+                              const size_t n, const size_t x_offset, const size_t x_inc) {
+  auto sum = T{0};
+  auto abs_sum = T{0};
+  auto sum_squares = T{0};
+  auto imin = size_t{0};
+  auto imax = size_t{0};
+  for (auto i = size_t{0}; i < n; ++i) {
+    const auto value = x[i * x_inc + x_offset];
+    sum += value;
+    abs_sum += std::abs(value);
+    sum_squares += value * value;
+    if (value < x[imin * x_inc + x_offset]) { imin = i; }
+    if (value > x[imax * x_inc + x_offset]) { imax = i; }
+  }
+  const auto flags = static_cast<int>(statistics);
+  auto result = std::vector<T>();
+  if (flags & static_cast<int>(Statistic::kSum)) { result.push_back(sum); }
+  if (flags & static_cast<int>(Statistic::kAbsSum)) { result.push_back(abs_sum); }
+  if (flags & static_cast<int>(Statistic::kSumSquares)) { result.push_back(sum_squares); }
+  if (flags & static_cast<int>(Statistic::kMin)) { result.push_back(x[imin * x_inc + x_offset]); }
+  if (flags & static_cast<int>(Statistic::kArgMin)) { result.push_back(static_cast<T>(imin)); }
+  if (flags & static_cast<int>(Statistic::kMax)) { result.push_back(x[imax * x_inc + x_offset]); }
+  if (flags & static_cast<int>(Statistic::kArgMax)) { result.push_back(static_cast<T>(imax)); }
+  return result;
+}
+
+// Half-precision version calling the above reference implementation after conversions
+std::vector<half> ReferenceStats(const Statistic statistics, const std::vector<half> &x,
+                                 const size_t n, const size_t x_offset, const size_t x_inc) {
+  const auto result = ReferenceStats(statistics, HalfToFloatBuffer(x), n, x_offset, x_inc);
+  auto result_half = std::vector<half>(result.size());
+  FloatToHalfBuffer(result_half, result);
+  return result_half;
+}
+
+template <typename T>
+size_t RunVectorStatsTests(int argc, char *argv[], const bool silent,
+                           const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  const auto n = GetArgument(arguments, help, kArgN, size_t{4099});
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+  if (!PrecisionSupported<T>(device)) {
+    fprintf(stdout, "* Skipping VectorStats for '%s': precision not supported\n\n",
+            routine_name.c_str());
+    return 0;
+  }
+
+  // Populates the input vector with some example data and copies it to the device
+  const auto x_offset = size_t{3};
+  const auto x_inc = size_t{2};
+  auto host_x = std::vector<T>(n * x_inc + x_offset);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_x, mt, dist);
+  auto device_x = Buffer<T>(context, host_x.size());
+  device_x.Write(queue, host_x.size(), host_x);
+
+  fprintf(stdout, "* Testing VectorStats for '%s'\n", routine_name.c_str());
+
+  // Tests a couple of different combinations of statistics
+  const auto all = Statistic::kSum | Statistic::kAbsSum | Statistic::kSumSquares |
+                   Statistic::kMin | Statistic::kArgMin | Statistic::kMax | Statistic::kArgMax;
+  const auto stats_offset = size_t{1};
+  for (const auto statistics : {all, Statistic::kSum, Statistic::kMin | Statistic::kArgMax,
+                                Statistic::kAbsSum | Statistic::kSumSquares | Statistic::kMax}) {
+    const auto reference = ReferenceStats(statistics, host_x, n, x_offset, x_inc);
+    auto device_stats = Buffer<T>(context, reference.size() + stats_offset);
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    const auto status = VectorStats<T>(statistics, n, device_stats(), stats_offset,
+                                       device_x(), x_offset, x_inc, &queue_plain, &event);
+    if (status != StatusCode::kSuccess) { errors++; continue; }
+    clWaitForEvents(1, &event);
+    clReleaseEvent(event);
+    auto result = std::vector<T>(reference.size() + stats_offset);
+    device_stats.Read(queue, result.size(), result);
+    auto diff = size_t{0};
+    for (auto i = size_t{0}; i < reference.size(); ++i) {
+      if (!TestSimilarity(reference[i], result[i + stats_offset])) { diff++; }
+    }
+    if (diff == 0) { passed++; } else { errors++; }
+  }
+
+  // Requesting no or unknown statistics is invalid
+  auto queue_plain = queue();
+  auto dummy = Buffer<T>(context, 8);
+  for (const auto statistics : {0, 128}) {
+    const auto status = VectorStats<T>(static_cast<Statistic>(statistics), n, dummy(), 0,
+                                       device_x(), x_offset, x_inc, &queue_plain, nullptr);
+    if (status != StatusCode::kInvalidArgValue) { errors++; } else { passed++; }
+  }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunVectorStatsTests<float>(argc, argv, false, "SVECTORSTATS");
+  errors += clblast::RunVectorStatsTests<double>(argc, argv, true, "DVECTORSTATS");
+  errors += clblast::RunVectorStatsTests<clblast::half>(argc, argv, true, "HVECTORSTATS");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -0,0 +1,157 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file contains the tests for the RecordManifest and WarmUp functions
+//
+// =================================================================================================
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cstdio>
+#include <random>
+
+#include "utilities/utilities.hpp"
+#include "test/routines/level3/xgemm.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Returns whether the manifest file contains an entry for the given routine and precision
+bool ManifestContains(const std::string &manifest_file, const std::string &entry_start) {
+  std::ifstream file(manifest_file);
+  auto line = std::string{};
+  while (std::getline(file, line)) {
+    if (line.compare(0, entry_start.size(), entry_start) == 0) { return true; }
+  }
+  return false;
+}
+
+template <typename T>
+size_t RunWarmUpTests(int argc, char *argv[], const bool silent, const std::string &routine_name) {
+  auto arguments = RetrieveCommandLineArguments(argc, argv);
+  auto errors = size_t{0};
+  auto passed = size_t{0};
+  auto example_routine = TestXgemm<T>();
+  constexpr auto kSeed = 42; // fixed seed for reproducibility
+  const auto manifest_file = std::string{"clblast_test_warm_up_manifest.txt"};
+  const auto manifest_entry = std::string{"GEMM "} +
+                              ToString(static_cast<int>(PrecisionValue<T>())) + " " +
+                              ToString(static_cast<int>(Numerics::kDefault)) + " - ";
+
+  // Retrieves the arguments
+  auto help = std::string{"Options given/available:\n"};
+  const auto platform_id = GetArgument(arguments, help, kArgPlatform, ConvertArgument(std::getenv("CLBLAST_PLATFORM"), size_t{0}));
+  const auto device_id = GetArgument(arguments, help, kArgDevice, ConvertArgument(std::getenv("CLBLAST_DEVICE"), size_t{0}));
+  auto args = Arguments<T>{};
+  args.m = GetArgument(arguments, help, kArgM, size_t{64});
+  args.n = GetArgument(arguments, help, kArgN, size_t{64});
+  args.k = GetArgument(arguments, help, kArgK, size_t{64});
+  args.a_ld = args.k;
+  args.b_ld = args.n;
+  args.c_ld = args.n;
+  args.layout = Layout::kRowMajor;
+  args.a_transpose = Transpose::kNo;
+  args.b_transpose = Transpose::kNo;
+  args.alpha = GetScalar<T>();
+  args.beta = GetScalar<T>();
+
+  // Prints the help message (command-line arguments)
+  if (!silent) { fprintf(stdout, "\n* %s\n", help.c_str()); }
+
+  // Initializes OpenCL
+  const auto platform = Platform(platform_id);
+  const auto device = Device(platform, device_id);
+  const auto context = Context(device);
+  auto queue = Queue(context, device);
+
+  // Populate host matrices with some example data and copies them to the device
+  auto host_a = std::vector<T>(args.m * args.k);
+  auto host_b = std::vector<T>(args.n * args.k);
+  auto host_c = std::vector<T>(args.m * args.n);
+  std::mt19937 mt(kSeed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  PopulateVector(host_a, mt, dist);
+  PopulateVector(host_b, mt, dist);
+  PopulateVector(host_c, mt, dist);
+  auto device_a = Buffer<T>(context, host_a.size());
+  auto device_b = Buffer<T>(context, host_b.size());
+  auto device_c = Buffer<T>(context, host_c.size());
+  device_a.Write(queue, host_a.size(), host_a);
+  device_b.Write(queue, host_b.size(), host_b);
+  device_c.Write(queue, host_c.size(), host_c);
+  auto dummy = Buffer<T>(context, 1);
+  auto buffers = Buffers<T>{dummy, dummy, device_a, device_b, device_c, dummy, dummy};
+
+  fprintf(stdout, "* Testing RecordManifest and WarmUp for '%s'\n", routine_name.c_str());
+  std::remove(manifest_file.c_str());
+
+  // Records the manifest: the routine should be listed afterwards
+  if (RecordManifest(manifest_file) != StatusCode::kSuccess) { errors++; }
+  else if (example_routine.RunRoutine(args, buffers, queue) != StatusCode::kSuccess) { errors++; }
+  else if (RecordManifest("") != StatusCode::kSuccess) { errors++; }
+  else if (!ManifestContains(manifest_file, manifest_entry)) { errors++; }
+  else { passed++; }
+
+  // Pre-compiles the routines in the manifest in the foreground and in the background, after which
+  // the routine should still run correctly
+  for (const auto background : {false, true}) {
+    if (ClearCache() != StatusCode::kSuccess) { errors++; continue; }
+    if (WarmUp(device(), manifest_file, background) != StatusCode::kSuccess) { errors++; continue; }
+    const auto status = example_routine.RunRoutine(args, buffers, queue);
+    if (status != StatusCode::kSuccess) { errors++; continue; }
+    passed++;
+  }
+
+  // Records the manifest for a GEMM shape variant in the fast numerics mode: both should be listed
+  // afterwards and the variant should be pre-compiled and run correctly in that mode
+  const auto variant_entry = std::string{"GEMM "} +
+                             ToString(static_cast<int>(PrecisionValue<T>())) + " " +
+                             ToString(static_cast<int>(Numerics::kFast)) + " SHAPE_R_NN_" +
+                             ToString(args.m) + "_" + ToString(args.n) + "_" + ToString(args.k) +
+                             "_" + ToString(args.a_ld) + "_" + ToString(args.b_ld) + "_" +
+                             ToString(args.c_ld) + " ";
+  SetNumerics(Numerics::kFast);
+  RegisterGemmShape(args.layout, args.a_transpose, args.b_transpose, args.m, args.n, args.k,
+                    args.a_ld, args.b_ld, args.c_ld);
+  if (RecordManifest(manifest_file) != StatusCode::kSuccess) { errors++; }
+  else if (example_routine.RunRoutine(args, buffers, queue) != StatusCode::kSuccess) { errors++; }
+  else if (RecordManifest("") != StatusCode::kSuccess) { errors++; }
+  else if (!ManifestContains(manifest_file, variant_entry)) { errors++; }
+  else if (ClearCache() != StatusCode::kSuccess) { errors++; }
+  else if (WarmUp(device(), manifest_file, false) != StatusCode::kSuccess) { errors++; }
+  else if (example_routine.RunRoutine(args, buffers, queue) != StatusCode::kSuccess) { errors++; }
+  else { passed++; }
+  ClearGemmShapes();
+  SetNumerics(Numerics::kDefault);
+
+  // A missing manifest is no error: there is simply nothing to pre-compile
+  std::remove(manifest_file.c_str());
+  if (WarmUp(device(), manifest_file, false) != StatusCode::kSuccess) { errors++; }
+  else { passed++; }
+
+  // Prints and returns the statistics
+  fprintf(stdout, "    %zu test(s) passed\n", passed);
+  fprintf(stdout, "    %zu test(s) failed\n", errors);
+  fprintf(stdout, "\n");
+  return errors;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunWarmUpTests<float>(argc, argv, false, "SGEMM");
+  errors += clblast::RunWarmUpTests<clblast::float2>(argc, argv, true, "CGEMM");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
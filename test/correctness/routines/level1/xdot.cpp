@@ -18,6 +18,7 @@ int main(int argc, char *argv[]) {
   errors += clblast::RunTests<clblast::TestXdot<float>, float, float>(argc, argv, false, "SDOT");
   errors += clblast::RunTests<clblast::TestXdot<double>, double, double>(argc, argv, true, "DDOT");
   errors += clblast::RunTests<clblast::TestXdot<clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HDOT");
+  errors += clblast::RunTests<clblast::TestXdot<clblast::bfloat16>, clblast::bfloat16, clblast::bfloat16>(argc, argv, true, "BDOT");
   if (errors > 0) { return 1; } else { return 0; }
 }
 
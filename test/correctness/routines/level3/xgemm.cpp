@@ -20,6 +20,12 @@ int main(int argc, char *argv[]) {
   errors += clblast::RunTests<clblast::TestXgemm<clblast::float2>, clblast::float2, clblast::float2>(argc, argv, true, "CGEMM");
   errors += clblast::RunTests<clblast::TestXgemm<clblast::double2>, clblast::double2, clblast::double2>(argc, argv, true, "ZGEMM");
   errors += clblast::RunTests<clblast::TestXgemm<clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HGEMM");
+  errors += clblast::RunTests<clblast::TestXgemm<clblast::bfloat16>, clblast::bfloat16, clblast::bfloat16>(argc, argv, true, "BGEMM");
+  errors += clblast::RunTests<clblast::TestXgemmDirect<float>, float, float>(argc, argv, true, "SGEMM (direct)");
+  errors += clblast::RunTests<clblast::TestXgemmDirect<double>, double, double>(argc, argv, true, "DGEMM (direct)");
+  errors += clblast::RunTests<clblast::TestXgemmDirect<clblast::float2>, clblast::float2, clblast::float2>(argc, argv, true, "CGEMM (direct)");
+  errors += clblast::RunTests<clblast::TestXgemmDirect<clblast::double2>, clblast::double2, clblast::double2>(argc, argv, true, "ZGEMM (direct)");
+  errors += clblast::RunTests<clblast::TestXgemmDirect<clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HGEMM (direct)");
   if (errors > 0) { return 1; } else { return 0; }
 }
 
@@ -0,0 +1,53 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/correctness/testblas.hpp"
+#include "test/routines/levelx/xconvert.hpp"
+
+// Shortcuts to the data-types
+using clblast::half;
+using clblast::bfloat16;
+using clblast::float2;
+using clblast::double2;
+
+// Tests a conversion from the input precision Ti to the output precision To
+template <typename Ti, typename To>
+size_t RunConvertTests(int argc, char *argv[], const bool silent, const std::string &name) {
+  return clblast::RunTests<clblast::TestXconvert<Ti, To>, To, To>(argc, argv, silent, name);
+}
+
+// Main function (not within the clblast namespace): all real precisions to and from each other, and
+// the complex precisions to and from each other
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += RunConvertTests<half, half>(argc, argv, false, "CONVERT (half to half)");
+  errors += RunConvertTests<half, float>(argc, argv, true, "CONVERT (half to float)");
+  errors += RunConvertTests<half, double>(argc, argv, true, "CONVERT (half to double)");
+  errors += RunConvertTests<half, bfloat16>(argc, argv, true, "CONVERT (half to bfloat16)");
+  errors += RunConvertTests<float, half>(argc, argv, true, "CONVERT (float to half)");
+  errors += RunConvertTests<float, float>(argc, argv, true, "CONVERT (float to float)");
+  errors += RunConvertTests<float, double>(argc, argv, true, "CONVERT (float to double)");
+  errors += RunConvertTests<float, bfloat16>(argc, argv, true, "CONVERT (float to bfloat16)");
+  errors += RunConvertTests<double, half>(argc, argv, true, "CONVERT (double to half)");
+  errors += RunConvertTests<double, float>(argc, argv, true, "CONVERT (double to float)");
+  errors += RunConvertTests<double, double>(argc, argv, true, "CONVERT (double to double)");
+  errors += RunConvertTests<double, bfloat16>(argc, argv, true, "CONVERT (double to bfloat16)");
+  errors += RunConvertTests<bfloat16, half>(argc, argv, true, "CONVERT (bfloat16 to half)");
+  errors += RunConvertTests<bfloat16, float>(argc, argv, true, "CONVERT (bfloat16 to float)");
+  errors += RunConvertTests<bfloat16, double>(argc, argv, true, "CONVERT (bfloat16 to double)");
+  errors += RunConvertTests<bfloat16, bfloat16>(argc, argv, true, "CONVERT (bfloat16 to bfloat16)");
+  errors += RunConvertTests<float2, float2>(argc, argv, true, "CONVERT (complex float to complex float)");
+  errors += RunConvertTests<float2, double2>(argc, argv, true, "CONVERT (complex float to complex double)");
+  errors += RunConvertTests<double2, float2>(argc, argv, true, "CONVERT (complex double to complex float)");
+  errors += RunConvertTests<double2, double2>(argc, argv, true, "CONVERT (complex double to complex double)");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
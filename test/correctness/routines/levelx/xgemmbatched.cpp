@@ -20,6 +20,7 @@ int main(int argc, char *argv[]) {
   errors += clblast::RunTests<clblast::TestXgemmBatched<clblast::float2>, clblast::float2, clblast::float2>(argc, argv, true, "CGEMMBATCHED");
   errors += clblast::RunTests<clblast::TestXgemmBatched<clblast::double2>, clblast::double2, clblast::double2>(argc, argv, true, "ZGEMMBATCHED");
   errors += clblast::RunTests<clblast::TestXgemmBatched<clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HGEMMBATCHED");
+  errors += clblast::RunTests<clblast::TestXgemmBatched<clblast::bfloat16>, clblast::bfloat16, clblast::bfloat16>(argc, argv, true, "BGEMMBATCHED");
   if (errors > 0) { return 1; } else { return 0; }
 }
 
@@ -0,0 +1,40 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/correctness/testblas.hpp"
+#include "test/routines/levelx/xreduce.hpp"
+
+// Shortcuts to the reduction operators
+using clblast::Reduction;
+
+// Tests all reduction operators for a single precision
+template <typename T>
+size_t RunReduceTests(int argc, char *argv[], const bool silent, const std::string &name) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXreduce<T, Reduction::kSum>, T, T>(argc, argv, silent, name + " (sum)");
+  errors += clblast::RunTests<clblast::TestXreduce<T, Reduction::kAbsSum>, T, T>(argc, argv, true, name + " (absolute sum)");
+  errors += clblast::RunTests<clblast::TestXreduce<T, Reduction::kNrm2>, T, T>(argc, argv, true, name + " (2-norm)");
+  errors += clblast::RunTests<clblast::TestXreduce<T, Reduction::kMax>, T, T>(argc, argv, true, name + " (max)");
+  errors += clblast::RunTests<clblast::TestXreduce<T, Reduction::kArgMax>, T, T>(argc, argv, true, name + " (argmax)");
+  errors += clblast::RunTests<clblast::TestXreduce<T, Reduction::kMin>, T, T>(argc, argv, true, name + " (min)");
+  errors += clblast::RunTests<clblast::TestXreduce<T, Reduction::kArgMin>, T, T>(argc, argv, true, name + " (argmin)");
+  return errors;
+}
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += RunReduceTests<float>(argc, argv, false, "SREDUCEMATRIX");
+  errors += RunReduceTests<double>(argc, argv, true, "DREDUCEMATRIX");
+  errors += RunReduceTests<clblast::half>(argc, argv, true, "HREDUCEMATRIX");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
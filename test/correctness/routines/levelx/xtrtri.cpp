@@ -0,0 +1,30 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// =================================================================================================
+
+#include "test/correctness/testblas.hpp"
+#include "test/routines/levelx/xtrtri.hpp"
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  auto errors = size_t{0};
+  errors += clblast::RunTests<clblast::TestXtrtri<float>, float, float>(argc, argv, false, "STRTRI");
+  errors += clblast::RunTests<clblast::TestXtrtri<double>, double, double>(argc, argv, true, "DTRTRI");
+  errors += clblast::RunTests<clblast::TestXtrtri<clblast::float2>, clblast::float2, clblast::float2>(argc, argv, true, "CTRTRI");
+  errors += clblast::RunTests<clblast::TestXtrtri<clblast::double2>, clblast::double2, clblast::double2>(argc, argv, true, "ZTRTRI");
+  errors += clblast::RunTests<clblast::TestXtrtri<clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HTRTRI");
+  errors += clblast::RunTests<clblast::TestXtrtriBatched<float>, float, float>(argc, argv, true, "STRTRIBATCHED");
+  errors += clblast::RunTests<clblast::TestXtrtriBatched<double>, double, double>(argc, argv, true, "DTRTRIBATCHED");
+  errors += clblast::RunTests<clblast::TestXtrtriBatched<clblast::float2>, clblast::float2, clblast::float2>(argc, argv, true, "CTRTRIBATCHED");
+  errors += clblast::RunTests<clblast::TestXtrtriBatched<clblast::double2>, clblast::double2, clblast::double2>(argc, argv, true, "ZTRTRIBATCHED");
+  errors += clblast::RunTests<clblast::TestXtrtriBatched<clblast::half>, clblast::half, clblast::half>(argc, argv, true, "HTRTRIBATCHED");
+  if (errors > 0) { return 1; } else { return 0; }
+}
+
+// =================================================================================================
@@ -47,6 +47,7 @@ template <> const std::vector<Transpose> TestBlas<float,float>::kTransposes = {T
 template <> const std::vector<Transpose> TestBlas<double,double>::kTransposes = {Transpose::kNo, Transpose::kYes};
 template <> const std::vector<Transpose> TestBlas<float2,float2>::kTransposes = {Transpose::kNo, Transpose::kYes, Transpose::kConjugate};
 template <> const std::vector<Transpose> TestBlas<double2,double2>::kTransposes = {Transpose::kNo, Transpose::kYes, Transpose::kConjugate};
+template <> const std::vector<Transpose> TestBlas<bfloat16,bfloat16>::kTransposes = {Transpose::kNo, Transpose::kYes};
 template <> const std::vector<Transpose> TestBlas<float2,float>::kTransposes = {Transpose::kNo, Transpose::kConjugate};
 template <> const std::vector<Transpose> TestBlas<double2,double>::kTransposes = {Transpose::kNo, Transpose::kConjugate};
 
@@ -252,6 +253,7 @@ void TestBlas<T,U>::TestInvalid(std::vector<Arguments<U>> &test_vector, const st
   if (!PrecisionSupported<T>(device_)) { return; }
   if (!compare_clblas_) { return; } // not supported for CPU BLAS routines
   if (std::is_same<T, half>::value) { return; } // not supported for half-precision
+  if (std::is_same<T, bfloat16>::value) { return; } // not supported for bfloat16
   TestStart("invalid buffer sizes", name);
 
   // Iterates over all the to-be-tested combinations of arguments
@@ -328,6 +330,7 @@ template class TestBlas<float, float>;
 template class TestBlas<double, double>;
 template class TestBlas<float2, float2>;
 template class TestBlas<double2, double2>;
+template class TestBlas<bfloat16, bfloat16>;
 template class TestBlas<float2, float>;
 template class TestBlas<double2, double>;
 
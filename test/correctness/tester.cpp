@@ -35,6 +35,10 @@ template <>
 float getRelativeErrorMargin<half>() {
   return 0.080f; // 8% (!) error is considered acceptable for half-precision
 }
+template <>
+float getRelativeErrorMargin<bfloat16>() {
+  return 0.020f; // 2% error is acceptable for bfloat16, as it has only an 8-bit mantissa in memory
+}
 
 // Absolute error margins
 template <typename T>
@@ -49,6 +53,10 @@ template <>
 float getAbsoluteErrorMargin<half>() {
   return 0.15f; // especially small values are inaccurate for half-precision
 }
+template <>
+float getAbsoluteErrorMargin<bfloat16>() {
+  return 0.05f; // computations are in single-precision, but inputs and outputs are rounded
+}
 
 // L2 error margins
 template <typename T>
@@ -63,6 +71,10 @@ template <>
 double getL2ErrorMargin<half>() {
   return 0.05; // half-precision results are considered OK as long as the L2 error is low enough
 }
+template <>
+double getL2ErrorMargin<bfloat16>() {
+  return 0.02; // as above, but bfloat16 accumulates in single-precision so is more accurate
+}
 
 // Error margin: numbers beyond this value are considered equal to inf or NaN
 template <typename T>
@@ -546,6 +558,13 @@ bool TestSimilarity(const half val1, const half val2) {
   return TestSimilarityNear(HalfToFloat(val1), HalfToFloat(val2),
                             kErrorMarginAbsolute, kErrorMarginRelative);
 }
+template <>
+bool TestSimilarity(const bfloat16 val1, const bfloat16 val2) {
+  const auto kErrorMarginRelative = getRelativeErrorMargin<bfloat16>();
+  const auto kErrorMarginAbsolute = getAbsoluteErrorMargin<bfloat16>();
+  return TestSimilarityNear(BFloat16ToFloat(val1), BFloat16ToFloat(val2),
+                            kErrorMarginAbsolute, kErrorMarginRelative);
+}
 
 // =================================================================================================
 
@@ -577,6 +596,10 @@ template <>
 double SquaredDifference(const half val1, const half val2) {
   return SquaredDifference(HalfToFloat(val1), HalfToFloat(val2));
 }
+template <>
+double SquaredDifference(const bfloat16 val1, const bfloat16 val2) {
+  return SquaredDifference(BFloat16ToFloat(val1), BFloat16ToFloat(val2));
+}
 
 // =================================================================================================
 
@@ -602,6 +625,10 @@ template <> const std::vector<half> GetExampleScalars(const bool full_test) {
   if (full_test) { return {FloatToHalf(0.0f), FloatToHalf(1.0f), FloatToHalf(3.14f)}; }
   else { return {FloatToHalf(3.14f)}; }
 }
+template <> const std::vector<bfloat16> GetExampleScalars(const bool full_test) {
+  if (full_test) { return {FloatToBFloat16(0.0f), FloatToBFloat16(1.0f), FloatToBFloat16(3.14f)}; }
+  else { return {FloatToBFloat16(3.14f)}; }
+}
 
 // =================================================================================================
 
@@ -613,6 +640,7 @@ template class Tester<float2, float2>;
 template class Tester<double2, double2>;
 template class Tester<float2, float>;
 template class Tester<double2, double>;
+template class Tester<bfloat16, bfloat16>;
 
 // =================================================================================================
 } // namespace clblast
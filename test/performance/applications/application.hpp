@@ -0,0 +1,303 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the common functionality of the application benchmarks. Contrary to the
+// per-routine clients, these benchmarks run realistic sequences of calls and are written against
+// the public API only (the OpenCL C API and 'clblast.h'), just like a user application would be.
+//
+// The time of a sequence is measured end-to-end on the host, including synchronisation. The time
+// spent in kernels is measured per CLBlast call from the START of its first command to the END of
+// its last one: before the call a marker is enqueued which waits on a user event, and that event
+// is only completed once the call has returned. The device thus runs all kernels of the call
+// back-to-back, including its auxiliary kernels (e.g. the padding and transposing of matrices for
+// the indirect GEMM kernel), and the kernel time is taken from the END of that gate marker to the
+// END of a marker enqueued after the call. Device idle time while the host is inside the call is
+// therefore not counted as kernel time but as overhead, together with all other host-side work and
+// synchronisation. Routines which wait for the queue internally (e.g. TRSM, or the batched routines
+// with their blocking upload of the offsets) can't be gated, nor can any routine in a VERBOSE
+// build: those are run through 'CallSynchronising' and measured from the END of the previous
+// command instead, which means that for them the idle gaps around their internal waits still count
+// as kernel time.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_PERFORMANCE_APPLICATION_H_
+#define CLBLAST_TEST_PERFORMANCE_APPLICATION_H_
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#define CL_USE_DEPRECATED_OPENCL_1_1_APIS // to disable deprecation warnings
+#define CL_USE_DEPRECATED_OPENCL_1_2_APIS // to disable deprecation warnings
+
+// Includes the CLBlast library (which also includes the OpenCL headers)
+#include <clblast.h>
+
+namespace clblast {
+// =================================================================================================
+
+// Throws a run-time error in case of a failed OpenCL call
+inline void CheckOpenCL(const cl_int status, const std::string &where) {
+  if (status != CL_SUCCESS) {
+    throw std::runtime_error(where + " failed with OpenCL error " + std::to_string(status));
+  }
+}
+
+// Enqueues a marker event, which completes once all earlier commands in the queue have completed
+// and, if given, once the event to wait for has completed as well
+inline void EnqueueMarker(const cl_command_queue queue, cl_event *marker,
+                          const cl_event wait_for = nullptr) {
+  const auto num_wait_for = static_cast<cl_uint>((wait_for) ? 1 : 0);
+  #ifdef CL_VERSION_1_2
+    CheckOpenCL(clEnqueueMarkerWithWaitList(queue, num_wait_for, (wait_for) ? &wait_for : nullptr,
+                                            marker), "clEnqueueMarker");
+  #else
+    if (num_wait_for > 0) {
+      CheckOpenCL(clEnqueueWaitForEvents(queue, num_wait_for, &wait_for), "clEnqueueWaitForEvents");
+    }
+    CheckOpenCL(clEnqueueMarker(queue, marker), "clEnqueueMarker");
+  #endif
+}
+
+// Retrieves an unsigned integer command-line argument of the form '-option value'
+inline size_t GetApplicationArgument(const int argc, char *argv[], const std::string &option,
+                                     const size_t default_value) {
+  for (auto i = 1; i < argc - 1; ++i) {
+    if (std::string{argv[i]} == "-" + option) {
+      return static_cast<size_t>(std::strtoull(argv[i + 1], nullptr, 10));
+    }
+  }
+  return default_value;
+}
+
+// =================================================================================================
+
+// Sets-up OpenCL with a profiling-enabled queue, owns the benchmark's buffers, and times sequences
+// of CLBlast calls
+class ApplicationBenchmark {
+ public:
+
+  // Initializes OpenCL for the platform and device given on the command-line ('-platform' and
+  // '-device') or in the CLBLAST_PLATFORM and CLBLAST_DEVICE environmental variables
+  ApplicationBenchmark(const int argc, char *argv[]):
+      runs_(GetApplicationArgument(argc, argv, "runs", 10)),
+      generator_(42) {
+    const auto platform_env = std::getenv("CLBLAST_PLATFORM");
+    const auto device_env = std::getenv("CLBLAST_DEVICE");
+    const auto platform_id = GetApplicationArgument(argc, argv, "platform",
+        (platform_env) ? static_cast<size_t>(std::strtoull(platform_env, nullptr, 10)) : 0);
+    const auto device_id = GetApplicationArgument(argc, argv, "device",
+        (device_env) ? static_cast<size_t>(std::strtoull(device_env, nullptr, 10)) : 0);
+
+    auto num_platforms = cl_uint{0};
+    CheckOpenCL(clGetPlatformIDs(0, nullptr, &num_platforms), "clGetPlatformIDs");
+    if (platform_id >= num_platforms) { throw std::runtime_error("invalid platform ID"); }
+    auto platforms = std::vector<cl_platform_id>(num_platforms);
+    CheckOpenCL(clGetPlatformIDs(num_platforms, platforms.data(), nullptr), "clGetPlatformIDs");
+
+    auto num_devices = cl_uint{0};
+    CheckOpenCL(clGetDeviceIDs(platforms[platform_id], CL_DEVICE_TYPE_ALL, 0, nullptr,
+                               &num_devices), "clGetDeviceIDs");
+    if (device_id >= num_devices) { throw std::runtime_error("invalid device ID"); }
+    auto devices = std::vector<cl_device_id>(num_devices);
+    CheckOpenCL(clGetDeviceIDs(platforms[platform_id], CL_DEVICE_TYPE_ALL, num_devices,
+                               devices.data(), nullptr), "clGetDeviceIDs");
+    device_ = devices[device_id];
+
+    auto status = cl_int{CL_SUCCESS};
+    context_ = clCreateContext(nullptr, 1, &device_, nullptr, nullptr, &status);
+    CheckOpenCL(status, "clCreateContext");
+    queue_ = clCreateCommandQueue(context_, device_, CL_QUEUE_PROFILING_ENABLE, &status);
+    CheckOpenCL(status, "clCreateCommandQueue");
+
+    auto name = std::string(256, '\0');
+    clGetDeviceInfo(device_, CL_DEVICE_NAME, name.size(), &name[0], nullptr);
+    fprintf(stdout, "* Device: %s\n", name.c_str());
+  }
+
+  // Releases all OpenCL objects
+  ~ApplicationBenchmark() {
+    ReleaseEvents();
+    for (auto &buffer: buffers_) { clReleaseMemObject(buffer); }
+    clReleaseCommandQueue(queue_);
+    clReleaseContext(context_);
+  }
+  ApplicationBenchmark(const ApplicationBenchmark&) = delete;
+  ApplicationBenchmark& operator=(const ApplicationBenchmark&) = delete;
+
+  // Creates a host vector with uniformly distributed random values in [-1, 1]
+  std::vector<float> RandomVector(const size_t size) {
+    auto distribution = std::uniform_real_distribution<float>(-1.0f, 1.0f);
+    auto result = std::vector<float>(size);
+    for (auto &value: result) { value = distribution(generator_); }
+    return result;
+  }
+
+  // Creates a device buffer initialized with the host data, released with the benchmark
+  cl_mem CreateBuffer(const std::vector<float> &host) {
+    auto status = cl_int{CL_SUCCESS};
+    auto buffer = clCreateBuffer(context_, CL_MEM_READ_WRITE, host.size() * sizeof(float), nullptr,
+                                 &status);
+    CheckOpenCL(status, "clCreateBuffer");
+    buffers_.push_back(buffer);
+    Write(buffer, host);
+    return buffer;
+  }
+
+  // Blocking transfers between the host and a device buffer
+  void Write(const cl_mem buffer, const std::vector<float> &host) {
+    CheckOpenCL(clEnqueueWriteBuffer(queue_, buffer, CL_TRUE, 0, host.size() * sizeof(float),
+                                     host.data(), 0, nullptr, nullptr), "clEnqueueWriteBuffer");
+  }
+  void Read(const cl_mem buffer, std::vector<float> &host) {
+    CheckOpenCL(clEnqueueReadBuffer(queue_, buffer, CL_TRUE, 0, host.size() * sizeof(float),
+                                    host.data(), 0, nullptr, nullptr), "clEnqueueReadBuffer");
+  }
+
+  // Runs a single CLBlast call, given as a function of the queue and the event pointer, in between
+  // two marker events which are kept for the kernel-time measurement. The first marker is gated by
+  // a user event until the call has returned, see the explanation at the top of this file.
+  template <typename F>
+  void Call(F routine) {
+    auto status = cl_int{CL_SUCCESS};
+    auto gate = clCreateUserEvent(context_, &status);
+    CheckOpenCL(status, "clCreateUserEvent");
+    auto before = cl_event{nullptr};
+    EnqueueMarker(queue_, &before, gate);
+    events_.push_back(before);
+    auto event = cl_event{nullptr};
+    const auto routine_status = routine(&queue_, &event);
+    clSetUserEventStatus(gate, CL_COMPLETE);
+    clReleaseEvent(gate);
+    Finalize(routine_status, event);
+  }
+
+  // As above, but for calls of routines which wait for their own kernels internally: these would
+  // never return with a gated queue, so only a regular marker is enqueued before the call
+  template <typename F>
+  void CallSynchronising(F routine) {
+    auto before = cl_event{nullptr};
+    EnqueueMarker(queue_, &before);
+    events_.push_back(before);
+    auto event = cl_event{nullptr};
+    const auto status = routine(&queue_, &event);
+    Finalize(status, event);
+  }
+
+  // Runs a sequence of calls once as a warm-up (compiling the kernels) and then a number of times
+  // while timing it. Before each run the (un-timed) preparation function can reset the input data.
+  // Reports the average end-to-end time and its split into kernels and overhead.
+  template <typename P, typename F>
+  void Run(const std::string &description, P prepare, F sequence) {
+    prepare();
+    sequence();
+    CheckOpenCL(clFinish(queue_), "clFinish");
+    ReleaseEvents();
+
+    auto total_ms = 0.0;
+    auto kernel_ms = 0.0;
+    auto num_calls = size_t{0};
+    for (auto run = size_t{0}; run < runs_; ++run) {
+      prepare();
+      CheckOpenCL(clFinish(queue_), "clFinish");
+      const auto start_time = std::chrono::steady_clock::now();
+      sequence();
+      CheckOpenCL(clFinish(queue_), "clFinish");
+      const auto elapsed_time = std::chrono::steady_clock::now() - start_time;
+      total_ms += std::chrono::duration<double,std::milli>(elapsed_time).count();
+      for (auto i = size_t{0}; i + 1 < events_.size(); i += 2) {
+        auto start = cl_ulong{0};
+        auto end = cl_ulong{0};
+        clGetEventProfilingInfo(events_[i], CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &start,
+                                nullptr);
+        clGetEventProfilingInfo(events_[i + 1], CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &end,
+                                nullptr);
+        if (end > start) { kernel_ms += static_cast<double>(end - start) * 1.0e-6; }
+      }
+      num_calls += events_.size() / 2;
+      ReleaseEvents();
+    }
+
+    const auto runs = static_cast<double>(std::max(runs_, size_t{1}));
+    const auto average_ms = total_ms / runs;
+    const auto average_kernel_ms = kernel_ms / runs;
+    const auto average_overhead_ms = average_ms - average_kernel_ms;
+    const auto percentage = [average_ms](const double value) {
+      return (average_ms > 0.0) ? 100.0 * value / average_ms : 0.0;
+    };
+    fprintf(stdout, "* %s (average of %zu runs)\n", description.c_str(), runs_);
+    fprintf(stdout, "    end-to-end time:  %10.3lf ms, %zu CLBlast calls\n", average_ms,
+            num_calls / std::max(runs_, size_t{1}));
+    fprintf(stdout, "    in kernels:       %10.3lf ms (%5.1lf%%)\n", average_kernel_ms,
+            percentage(average_kernel_ms));
+    fprintf(stdout, "    overhead:         %10.3lf ms (%5.1lf%%)\n", average_overhead_ms,
+            percentage(average_overhead_ms));
+  }
+
+  // Accessors for applications which need direct OpenCL access
+  cl_command_queue& queue() { return queue_; }
+  cl_context context() const { return context_; }
+
+ private:
+
+  // Releases the event returned by a call, checks its status, and enqueues the marker which
+  // ends the kernel-time measurement of the call
+  void Finalize(const StatusCode status, const cl_event event) {
+    if (event) { clReleaseEvent(event); }
+    if (status != StatusCode::kSuccess) {
+      throw std::runtime_error("CLBlast call failed with status " +
+                               std::to_string(static_cast<int>(status)));
+    }
+    auto after = cl_event{nullptr};
+    EnqueueMarker(queue_, &after);
+    events_.push_back(after);
+  }
+
+  // Releases the events of the calls made so far
+  void ReleaseEvents() {
+    for (auto &event: events_) { if (event) { clReleaseEvent(event); } }
+    events_.clear();
+  }
+
+  const size_t runs_;
+  std::mt19937 generator_;
+  cl_device_id device_;
+  cl_context context_;
+  cl_command_queue queue_;
+  std::vector<cl_mem> buffers_;
+  std::vector<cl_event> events_;
+};
+
+// =================================================================================================
+
+// Runs an application benchmark, reporting errors instead of throwing them
+template <typename F>
+int RunApplication(const std::string &name, F application) {
+  fprintf(stdout, "\n* Application benchmark: %s\n", name.c_str());
+  try {
+    application();
+  } catch (const std::exception &e) {
+    fprintf(stderr, "* Error: %s\n", e.what());
+    return 1;
+  }
+  fprintf(stdout, "\n");
+  return 0;
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_PERFORMANCE_APPLICATION_H_
+#endif
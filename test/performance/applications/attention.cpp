@@ -0,0 +1,119 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the batched attention application benchmark: the scaled-dot-product
+// attention O = softmax(scale * Q * K^T) * V of a number of heads. The unfused version computes
+// the scores of all heads with one GemmBatched call, applies the softmax on the host (the BLAS has
+// no softmax routine), and multiplies with V using a second GemmBatched call. For comparison, the
+// same computation is also run with the fused Attention function. Options: -heads, -sequence (the
+// sequence length) and -d (the head dimension), see 'application.hpp' for the others.
+//
+// =================================================================================================
+
+#include <cmath>
+#include <cstddef>
+
+#include "test/performance/applications/application.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Computes a row-wise softmax of a row-major matrix of 'rows' by 'columns' elements in-place
+void HostSoftmax(std::vector<float> &matrix, const size_t offset, const size_t rows,
+                 const size_t columns) {
+  for (auto row = size_t{0}; row < rows; ++row) {
+    const auto begin = matrix.begin() + static_cast<std::ptrdiff_t>(offset + row * columns);
+    const auto end = begin + static_cast<std::ptrdiff_t>(columns);
+    const auto maximum = *std::max_element(begin, end);
+    auto sum = 0.0f;
+    for (auto it = begin; it != end; ++it) { *it = std::exp(*it - maximum); sum += *it; }
+    for (auto it = begin; it != end; ++it) { *it /= sum; }
+  }
+}
+
+// =================================================================================================
+
+void RunAttention(int argc, char *argv[]) {
+  ApplicationBenchmark benchmark(argc, argv);
+  const auto heads = GetApplicationArgument(argc, argv, "heads", 32);
+  const auto sequence_length = GetApplicationArgument(argc, argv, "sequence", 512);
+  const auto d = GetApplicationArgument(argc, argv, "d", 64);
+  const auto scale = 1.0f / std::sqrt(static_cast<float>(d));
+
+  // Row-major matrices of each head, stored one after the other: Q, K, V and O are of size
+  // sequence-by-d, the scores are of size sequence-by-sequence
+  const auto head_size = sequence_length * d;
+  const auto scores_size = sequence_length * sequence_length;
+  const auto q = benchmark.CreateBuffer(benchmark.RandomVector(heads * head_size));
+  const auto k = benchmark.CreateBuffer(benchmark.RandomVector(heads * head_size));
+  const auto v = benchmark.CreateBuffer(benchmark.RandomVector(heads * head_size));
+  const auto o = benchmark.CreateBuffer(std::vector<float>(heads * head_size));
+  const auto scores = benchmark.CreateBuffer(std::vector<float>(heads * scores_size));
+  auto host_scores = std::vector<float>(heads * scores_size);
+
+  // The batched arguments
+  auto head_offsets = std::vector<size_t>(heads);
+  auto scores_offsets = std::vector<size_t>(heads);
+  for (auto head = size_t{0}; head < heads; ++head) {
+    head_offsets[head] = head * head_size;
+    scores_offsets[head] = head * scores_size;
+  }
+  const auto scales = std::vector<float>(heads, scale);
+  const auto ones = std::vector<float>(heads, 1.0f);
+  const auto zeros = std::vector<float>(heads, 0.0f);
+
+  // The unfused version: GemmBatched, softmax on the host, and GemmBatched again
+  const auto unfused = [&]() {
+    benchmark.CallSynchronising([&](cl_command_queue* queue, cl_event* event) {
+      return GemmBatched(Layout::kRowMajor, Transpose::kNo, Transpose::kYes,
+                         sequence_length, sequence_length, d, scales.data(),
+                         q, head_offsets.data(), d, k, head_offsets.data(), d, zeros.data(),
+                         scores, scores_offsets.data(), sequence_length, heads, queue, event);
+    });
+    benchmark.Read(scores, host_scores);
+    for (auto head = size_t{0}; head < heads; ++head) {
+      HostSoftmax(host_scores, head * scores_size, sequence_length, sequence_length);
+    }
+    benchmark.Write(scores, host_scores);
+    benchmark.CallSynchronising([&](cl_command_queue* queue, cl_event* event) {
+      return GemmBatched(Layout::kRowMajor, Transpose::kNo, Transpose::kNo,
+                         sequence_length, d, sequence_length, ones.data(),
+                         scores, scores_offsets.data(), sequence_length,
+                         v, head_offsets.data(), d, zeros.data(),
+                         o, head_offsets.data(), d, heads, queue, event);
+    });
+  };
+
+  // The fused version
+  const auto fused = [&]() {
+    benchmark.CallSynchronising([&](cl_command_queue* queue, cl_event* event) {
+      return Attention(Layout::kRowMajor, false, sequence_length, sequence_length, d, scale,
+                       q, head_offsets.data(), d, k, head_offsets.data(), d,
+                       v, head_offsets.data(), d, o, head_offsets.data(), d, heads,
+                       queue, event);
+    });
+  };
+
+  const auto description = "heads=" + std::to_string(heads) + ", sequence=" +
+                            std::to_string(sequence_length) + ", d=" + std::to_string(d);
+  benchmark.Run("Attention with GemmBatched: " + description, []() {}, unfused);
+  benchmark.Run("Attention fused: " + description, []() {}, fused);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  return clblast::RunApplication("batched attention", [&]() {
+    clblast::RunAttention(argc, argv);
+  });
+}
+
+// =================================================================================================
@@ -0,0 +1,115 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the conjugate-gradient application benchmark: a fixed number of iterations
+// of the CG method to solve A * x = b for a dense symmetric positive-definite matrix A. Each
+// iteration consists of one GEMV, two DOTs, three AXPYs and a SCAL, and reads the two scalars
+// produced by the DOTs back to the host, as these are needed as the alpha arguments of the next
+// calls. Options: -n (the matrix size) and -iterations, see 'application.hpp' for the others.
+//
+// =================================================================================================
+
+#include <cmath>
+
+#include "test/performance/applications/application.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+void RunConjugateGradient(int argc, char *argv[]) {
+  ApplicationBenchmark benchmark(argc, argv);
+  const auto n = GetApplicationArgument(argc, argv, "n", 2048);
+  const auto iterations = GetApplicationArgument(argc, argv, "iterations", 50);
+
+  // Creates a diagonally dominant symmetric matrix, which is thus positive definite
+  auto host_a = benchmark.RandomVector(n * n);
+  for (auto i = size_t{0}; i < n; ++i) {
+    for (auto j = size_t{0}; j < i; ++j) { host_a[i * n + j] = host_a[j * n + i]; }
+    host_a[i * n + i] = static_cast<float>(n);
+  }
+  const auto host_b = benchmark.RandomVector(n);
+  const auto host_zero = std::vector<float>(n, 0.0f);
+
+  // The device buffers: the matrix, the vectors, and the two scalars of the dot-products
+  const auto a = benchmark.CreateBuffer(host_a);
+  const auto x = benchmark.CreateBuffer(host_zero);
+  const auto r = benchmark.CreateBuffer(host_b);
+  const auto p = benchmark.CreateBuffer(host_b);
+  const auto q = benchmark.CreateBuffer(host_zero);
+  const auto dot = benchmark.CreateBuffer(std::vector<float>(2, 0.0f));
+  auto host_dot = std::vector<float>(1);
+  auto residual = 0.0f;
+
+  // Starts from x = 0, such that r = p = b
+  const auto prepare = [&]() {
+    benchmark.Write(x, host_zero);
+    benchmark.Write(r, host_b);
+    benchmark.Write(p, host_b);
+  };
+
+  const auto sequence = [&]() {
+    benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+      return Dot<float>(n, dot, 0, r, 0, 1, r, 0, 1, queue, event);
+    });
+    benchmark.Read(dot, host_dot);
+    auto rho = host_dot[0];
+    for (auto iteration = size_t{0}; iteration < iterations; ++iteration) {
+
+      // q = A * p and alpha = rho / (p^T * q)
+      benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+        return Gemv(Layout::kColMajor, Transpose::kNo, n, n, 1.0f, a, 0, n, p, 0, 1,
+                    0.0f, q, 0, 1, queue, event);
+      });
+      benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+        return Dot<float>(n, dot, 0, p, 0, 1, q, 0, 1, queue, event);
+      });
+      benchmark.Read(dot, host_dot);
+      const auto alpha = rho / host_dot[0];
+
+      // x = x + alpha * p and r = r - alpha * q
+      benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+        return Axpy(n, alpha, p, 0, 1, x, 0, 1, queue, event);
+      });
+      benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+        return Axpy(n, -alpha, q, 0, 1, r, 0, 1, queue, event);
+      });
+
+      // beta = rho_new / rho and p = r + beta * p
+      benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+        return Dot<float>(n, dot, 0, r, 0, 1, r, 0, 1, queue, event);
+      });
+      benchmark.Read(dot, host_dot);
+      const auto beta = host_dot[0] / rho;
+      rho = host_dot[0];
+      benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+        return Scal(n, beta, p, 0, 1, queue, event);
+      });
+      benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+        return Axpy(n, 1.0f, r, 0, 1, p, 0, 1, queue, event);
+      });
+    }
+    residual = std::sqrt(rho);
+  };
+
+  benchmark.Run("CG: n=" + std::to_string(n) + ", " + std::to_string(iterations) + " iterations",
+                prepare, sequence);
+  fprintf(stdout, "    final residual:   %10.3e\n", static_cast<double>(residual));
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  return clblast::RunApplication("conjugate gradient", [&]() {
+    clblast::RunConjugateGradient(argc, argv);
+  });
+}
+
+// =================================================================================================
@@ -0,0 +1,120 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the blocked Cholesky application benchmark: the in-place factorization
+// A = L * L^T of a symmetric positive-definite column-major matrix, using the left-looking blocked
+// algorithm. For each block-column, the diagonal block is updated with SYRK and the panel below it
+// with GEMM. The small diagonal block is then factorized on the host (as the BLAS has no Cholesky
+// routine), after which the panel is solved with TRSM. Options: -n (the matrix size) and -block
+// (the block size), see 'application.hpp' for the others.
+//
+// =================================================================================================
+
+#include <cmath>
+
+#include "test/performance/applications/application.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Factorizes a column-major block of size n on the host, only the lower triangle is used
+void HostCholesky(std::vector<float> &block, const size_t n) {
+  for (auto j = size_t{0}; j < n; ++j) {
+    auto diagonal = block[j * n + j];
+    for (auto k = size_t{0}; k < j; ++k) { diagonal -= block[k * n + j] * block[k * n + j]; }
+    if (diagonal <= 0.0f) { throw std::runtime_error("matrix is not positive-definite"); }
+    diagonal = std::sqrt(diagonal);
+    block[j * n + j] = diagonal;
+    for (auto i = j + 1; i < n; ++i) {
+      auto value = block[j * n + i];
+      for (auto k = size_t{0}; k < j; ++k) { value -= block[k * n + i] * block[k * n + j]; }
+      block[j * n + i] = value / diagonal;
+    }
+  }
+}
+
+// =================================================================================================
+
+void RunCholesky(int argc, char *argv[]) {
+  ApplicationBenchmark benchmark(argc, argv);
+  const auto n = GetApplicationArgument(argc, argv, "n", 4096);
+  const auto block = std::max(GetApplicationArgument(argc, argv, "block", 256), size_t{1});
+
+  // Creates a diagonally dominant symmetric matrix, which is thus positive definite
+  auto host_a = benchmark.RandomVector(n * n);
+  for (auto i = size_t{0}; i < n; ++i) {
+    for (auto j = size_t{0}; j < i; ++j) { host_a[i * n + j] = host_a[j * n + i]; }
+    host_a[i * n + i] = static_cast<float>(n);
+  }
+  const auto a = benchmark.CreateBuffer(host_a);
+  auto host_block = std::vector<float>(block * block);
+
+  // The factorization is in-place, so the original matrix is restored before each run
+  const auto prepare = [&]() { benchmark.Write(a, host_a); };
+
+  const auto sequence = [&]() {
+    for (auto j = size_t{0}; j < n; j += block) {
+      const auto jb = std::min(block, n - j);
+      const auto rows_below = n - j - jb;
+
+      // Updates the diagonal block and the panel below it with the already factorized columns
+      if (j > 0) {
+        benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+          return Syrk(Layout::kColMajor, Triangle::kLower, Transpose::kNo, jb, j, -1.0f,
+                      a, j, n, 1.0f, a, j * n + j, n, queue, event);
+        });
+        if (rows_below > 0) {
+          benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+            return Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kYes, rows_below, jb, j,
+                        -1.0f, a, j + jb, n, a, j, n, 1.0f, a, j * n + j + jb, n, queue, event);
+          });
+        }
+      }
+
+      // Factorizes the diagonal block on the host. The write doesn't block: the in-order queue
+      // completes it before the blocking read of the next block into the same host memory.
+      const size_t buffer_origin[] = {j * sizeof(float), j, 0};
+      const size_t host_origin[] = {0, 0, 0};
+      const size_t region[] = {jb * sizeof(float), jb, 1};
+      CheckOpenCL(clEnqueueReadBufferRect(benchmark.queue(), a, CL_TRUE, buffer_origin,
+                                          host_origin, region, n * sizeof(float), 0,
+                                          jb * sizeof(float), 0, host_block.data(),
+                                          0, nullptr, nullptr), "clEnqueueReadBufferRect");
+      HostCholesky(host_block, jb);
+      CheckOpenCL(clEnqueueWriteBufferRect(benchmark.queue(), a, CL_FALSE, buffer_origin,
+                                           host_origin, region, n * sizeof(float), 0,
+                                           jb * sizeof(float), 0, host_block.data(),
+                                           0, nullptr, nullptr), "clEnqueueWriteBufferRect");
+
+      // Solves the panel: L21 = A21 * L11^-T
+      if (rows_below > 0) {
+        benchmark.CallSynchronising([&](cl_command_queue* queue, cl_event* event) {
+          return Trsm(Layout::kColMajor, Side::kRight, Triangle::kLower, Transpose::kYes,
+                      Diagonal::kNonUnit, rows_below, jb, 1.0f, a, j * n + j, n,
+                      a, j * n + j + jb, n, queue, event);
+        });
+      }
+    }
+  };
+
+  benchmark.Run("Cholesky: n=" + std::to_string(n) + ", block=" + std::to_string(block),
+                prepare, sequence);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  return clblast::RunApplication("blocked Cholesky", [&]() {
+    clblast::RunCholesky(argc, argv);
+  });
+}
+
+// =================================================================================================
@@ -0,0 +1,86 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements the multi-layer perceptron application benchmark: the forward pass of a
+// batch through a chain of fully-connected layers. Each layer computes Y = W * X with GEMM and
+// adds the bias to every column of Y through a rank-1 update (GER) with a vector of ones. The
+// element-wise activation functions are not part of the BLAS and are thus left out. Options:
+// -batch, -input, -hidden, -output and -layers (the number of layers, at least two), see
+// 'application.hpp' for the others.
+//
+// =================================================================================================
+
+#include "test/performance/applications/application.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+void RunMultiLayerPerceptron(int argc, char *argv[]) {
+  ApplicationBenchmark benchmark(argc, argv);
+  const auto batch = GetApplicationArgument(argc, argv, "batch", 256);
+  const auto input = GetApplicationArgument(argc, argv, "input", 1024);
+  const auto hidden = GetApplicationArgument(argc, argv, "hidden", 4096);
+  const auto output = GetApplicationArgument(argc, argv, "output", 1024);
+  const auto layers = std::max(GetApplicationArgument(argc, argv, "layers", 4), size_t{2});
+
+  // The sizes of the activations: the input, the hidden layers, and the output
+  auto sizes = std::vector<size_t>{input};
+  for (auto layer = size_t{1}; layer < layers; ++layer) { sizes.push_back(hidden); }
+  sizes.push_back(output);
+
+  // Creates the weights and biases of each layer and the column-major activations (one column per
+  // item in the batch)
+  auto weights = std::vector<cl_mem>();
+  auto biases = std::vector<cl_mem>();
+  auto activations = std::vector<cl_mem>();
+  activations.push_back(benchmark.CreateBuffer(benchmark.RandomVector(input * batch)));
+  auto flops = 0.0;
+  for (auto layer = size_t{0}; layer < layers; ++layer) {
+    const auto layer_weights = benchmark.RandomVector(sizes[layer + 1] * sizes[layer]);
+    weights.push_back(benchmark.CreateBuffer(layer_weights));
+    biases.push_back(benchmark.CreateBuffer(benchmark.RandomVector(sizes[layer + 1])));
+    activations.push_back(benchmark.CreateBuffer(std::vector<float>(sizes[layer + 1] * batch)));
+    flops += 2.0 * sizes[layer + 1] * sizes[layer] * batch;
+  }
+  const auto ones = benchmark.CreateBuffer(std::vector<float>(batch, 1.0f));
+
+  const auto sequence = [&]() {
+    for (auto layer = size_t{0}; layer < layers; ++layer) {
+      const auto m = sizes[layer + 1];
+      const auto k = sizes[layer];
+      benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+        return Gemm(Layout::kColMajor, Transpose::kNo, Transpose::kNo, m, batch, k, 1.0f,
+                    weights[layer], 0, m, activations[layer], 0, k, 0.0f,
+                    activations[layer + 1], 0, m, queue, event);
+      });
+      benchmark.Call([&](cl_command_queue* queue, cl_event* event) {
+        return Ger(Layout::kColMajor, m, batch, 1.0f, biases[layer], 0, 1, ones, 0, 1,
+                   activations[layer + 1], 0, m, queue, event);
+      });
+    }
+  };
+
+  const auto mflop = static_cast<size_t>(flops * 1.0e-6);
+  benchmark.Run("MLP forward: batch=" + std::to_string(batch) + ", " + std::to_string(layers) +
+                " layers of " + std::to_string(input) + "-" + std::to_string(hidden) + "-" +
+                std::to_string(output) + " (" + std::to_string(mflop) + " MFLOP)",
+                []() {}, sequence);
+}
+
+// =================================================================================================
+} // namespace clblast
+
+// Main function (not within the clblast namespace)
+int main(int argc, char *argv[]) {
+  return clblast::RunApplication("multi-layer perceptron", [&]() {
+    clblast::RunMultiLayerPerceptron(argc, argv);
+  });
+}
+
+// =================================================================================================
@@ -149,11 +149,11 @@ Arguments<U> Client<T,U>::ParseArguments(int argc, char *argv[], const size_t le
     args.compare_cublas = 0;
   }
 
-  // Comparison against other BLAS libraries is not supported in case of half-precision
-  if (args.precision == Precision::kHalf) {
+  // Comparison against other BLAS libraries is not supported in case of half-precision or bfloat16
+  if (args.precision == Precision::kHalf || args.precision == Precision::kBFloat16) {
     if (args.compare_clblas != 0 || args.compare_cblas != 0 || args.compare_cublas != 0) {
       if (!args.silent) {
-        fprintf(stdout, "* Disabling clBLAS/CBLAS/cuBLAS comparisons for half-precision\n\n");
+        fprintf(stdout, "* Disabling clBLAS/CBLAS/cuBLAS comparisons for half-precision/bfloat16\n\n");
       }
     }
     args.compare_clblas = 0;
@@ -428,6 +428,7 @@ template class Client<float2,float2>;
 template class Client<double2,double2>;
 template class Client<float2,float>;
 template class Client<double2,double>;
+template class Client<bfloat16,bfloat16>;
 
 // =================================================================================================
 } // namespace clblast
@@ -26,6 +26,7 @@ int main(int argc, char *argv[]) {
       clblast::RunClient<clblast::TestXcopy<clblast::float2>, clblast::float2, clblast::float2>(argc, argv); break;
     case clblast::Precision::kComplexDouble:
       clblast::RunClient<clblast::TestXcopy<clblast::double2>, clblast::double2, clblast::double2>(argc, argv); break;
+    case clblast::Precision::kBFloat16: throw std::runtime_error("Unsupported precision mode");
   }
   return 0;
 }
@@ -24,6 +24,8 @@ int main(int argc, char *argv[]) {
       clblast::RunClient<clblast::TestXdot<double>, double, double>(argc, argv); break;
     case clblast::Precision::kComplexSingle: throw std::runtime_error("Unsupported precision mode");
     case clblast::Precision::kComplexDouble: throw std::runtime_error("Unsupported precision mode");
+    case clblast::Precision::kBFloat16:
+      clblast::RunClient<clblast::TestXdot<clblast::bfloat16>, clblast::bfloat16, clblast::bfloat16>(argc, argv); break;
   }
   return 0;
 }
@@ -23,6 +23,7 @@ int main(int argc, char *argv[]) {
       clblast::RunClient<clblast::TestXrotg<double>, double, double>(argc, argv); break;
     case clblast::Precision::kComplexSingle: throw std::runtime_error("Unsupported precision mode");
     case clblast::Precision::kComplexDouble: throw std::runtime_error("Unsupported precision mode");
+    case clblast::Precision::kBFloat16: throw std::runtime_error("Unsupported precision mode");
   }
   return 0;
 }
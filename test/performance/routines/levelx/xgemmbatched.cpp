@@ -26,6 +26,8 @@ int main(int argc, char *argv[]) {
       clblast::RunClient<clblast::TestXgemmBatched<clblast::float2>, clblast::float2, clblast::float2>(argc, argv); break;
     case clblast::Precision::kComplexDouble:
       clblast::RunClient<clblast::TestXgemmBatched<clblast::double2>, clblast::double2, clblast::double2>(argc, argv); break;
+    case clblast::Precision::kBFloat16:
+      clblast::RunClient<clblast::TestXgemmBatched<clblast::bfloat16>, clblast::bfloat16, clblast::bfloat16>(argc, argv); break;
   }
   return 0;
 }
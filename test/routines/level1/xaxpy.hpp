@@ -116,7 +116,7 @@ class TestXaxpy {
 
   // Describes how to download the results of the computation (more importantly: which buffer)
   static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
-    std::vector<T> result(args.y_size, static_cast<T>(0));
+    std::vector<T> result(args.y_size, ConstantZero<T>());
     buffers.y_vec.Read(queue, args.y_size, result);
     return result;
   }
@@ -123,7 +123,7 @@ class TestXdot {
 
   // Describes how to download the results of the computation (more importantly: which buffer)
   static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
-    std::vector<T> result(args.scalar_size, static_cast<T>(0));
+    std::vector<T> result(args.scalar_size, ConstantZero<T>());
     buffers.scalar.Read(queue, args.scalar_size, result);
     return result;
   }
@@ -143,7 +143,7 @@ class TestXgemm {
 
   // Describes how to download the results of the computation (more importantly: which buffer)
   static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
-    std::vector<T> result(args.c_size, static_cast<T>(0));
+    std::vector<T> result(args.c_size, ConstantZero<T>());
     buffers.c_mat.Read(queue, args.c_size, result);
     return result;
   }
@@ -166,6 +166,33 @@ class TestXgemm {
   }
 };
 
+// =================================================================================================
+
+// Same as above, but always runs the direct GEMM kernel by overriding the kernel-selection
+// threshold. With the default test sizes this covers transposed A and B matrices with m and n not
+// being a multiple of the work-group tile size WGD, for which the edge work-groups must not load
+// beyond the end of the matrices (a regression test for the bounds-checks of the direct kernel's
+// 'GlobalToLocalCheckedA/B').
+template <typename T>
+class TestXgemmDirect: public TestXgemm<T> {
+ public:
+
+  // Describes how to run the CLBlast routine. The threshold is overridden only once per precision,
+  // since an override clears the compiled GEMM programs.
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    static auto overridden = false;
+    if (!overridden) {
+      const auto device = queue.GetDevice();
+      const auto switch_threshold = size_t{1024 * 1024 * 1024}; // larger than any test size
+      const auto status = OverrideParameters(device(), "KernelSelection", PrecisionValue<T>(),
+                                             {{"XGEMM_MIN_INDIRECT_SIZE", switch_threshold}});
+      if (status != StatusCode::kSuccess) { return status; }
+      overridden = true;
+    }
+    return TestXgemm<T>::RunRoutine(args, buffers, queue);
+  }
+};
+
 // =================================================================================================
 } // namespace clblast
 
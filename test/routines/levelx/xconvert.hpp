@@ -0,0 +1,219 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xconvert routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XCONVERT_H_
+#define CLBLAST_TEST_ROUTINES_XCONVERT_H_
+
+#include <vector>
+#include <type_traits>
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Conversion of the (real-valued) components of the data-types to and from double-precision
+template <typename T> std::vector<double> ToComponents(const T value);
+template <> std::vector<double> ToComponents(const half value) { return {HalfToFloat(value)}; }
+template <> std::vector<double> ToComponents(const float value) { return {value}; }
+template <> std::vector<double> ToComponents(const double value) { return {value}; }
+template <> std::vector<double> ToComponents(const bfloat16 value) {
+  return {BFloat16ToFloat(value)};
+}
+template <> std::vector<double> ToComponents(const float2 value) {
+  return {value.real(), value.imag()};
+}
+template <> std::vector<double> ToComponents(const double2 value) {
+  return {value.real(), value.imag()};
+}
+template <typename T> T FromComponents(const std::vector<double> &values);
+template <> half FromComponents(const std::vector<double> &values) {
+  return FloatToHalf(static_cast<float>(values[0]));
+}
+template <> float FromComponents(const std::vector<double> &values) {
+  return static_cast<float>(values[0]);
+}
+template <> double FromComponents(const std::vector<double> &values) { return values[0]; }
+template <> bfloat16 FromComponents(const std::vector<double> &values) {
+  return FloatToBFloat16(static_cast<float>(values[0]));
+}
+template <> float2 FromComponents(const std::vector<double> &values) {
+  return float2{static_cast<float>(values[0]), static_cast<float>(values[1])};
+}
+template <> double2 FromComponents(const std::vector<double> &values) {
+  return double2{values[0], values[1]};
+}
+
+// The test data is held in the output precision To, the input vector is first converted to the
+// input precision Ti on the host. The scale is given by the (real part of the) alpha argument.
+template <typename Ti, typename To>
+StatusCode RunReference(const Arguments<To> &args, BuffersHost<To> &buffers_host) {
+
+  // Checking for invalid arguments
+  const auto x_base = (args.n - 1) * args.x_inc + 1;
+  const auto y_base = (args.n - 1) * args.y_inc + 1;
+  if (args.n == 0) { return StatusCode::kInvalidDimension; }
+  if (args.x_inc == 0) { return StatusCode::kInvalidIncrementX; }
+  if (args.y_inc == 0) { return StatusCode::kInvalidIncrementY; }
+  const auto x_size = buffers_host.x_vec.size();
+  const auto y_size = buffers_host.y_vec.size();
+  if (x_size < x_base + args.x_offset) { return StatusCode::kInsufficientMemoryX; }
+  if (y_size < y_base + args.y_offset) { return StatusCode::kInsufficientMemoryY; }
+
+  // Converts and scales the vector, component by component
+  const auto scale = ToComponents(args.alpha)[0];
+  for (auto id = size_t{0}; id < args.n; ++id) {
+    const auto x_value = buffers_host.x_vec[id*args.x_inc + args.x_offset];
+    auto values = ToComponents(FromComponents<Ti>(ToComponents(x_value)));
+    for (auto &value : values) { value *= scale; }
+    buffers_host.y_vec[id*args.y_inc + args.y_offset] = FromComponents<To>(values);
+  }
+  return StatusCode::kSuccess;
+}
+
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename Ti, typename To>
+class TestXconvert {
+ public:
+
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN,
+            kArgXInc, kArgYInc,
+            kArgXOffset, kArgYOffset,
+            kArgAlpha};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufVecX, kBufVecY}; }
+  static std::vector<std::string> BuffersOut() { return {kBufVecY}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<To> &args) {
+    return args.n * args.x_inc + args.x_offset;
+  }
+  static size_t GetSizeY(const Arguments<To> &args) {
+    return args.n * args.y_inc + args.y_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<To> &args) {
+    args.x_size = GetSizeX(args);
+    args.y_size = GetSizeY(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<To> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDB(const Arguments<To> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<To> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<To>&, Queue&, const int, std::vector<To>&,
+                          std::vector<To>&, std::vector<To>&, std::vector<To>&, std::vector<To>&,
+                          std::vector<To>&, std::vector<To>&) {} // N/A for this routine
+
+  // The input vector in the input precision: converted on the host from the test data, unless the
+  // precisions are the same
+  static Buffer<Ti> InputBuffer(const Arguments<To> &args, Buffers<To> &buffers, Queue &queue) {
+    if (std::is_same<Ti, To>::value) { return Buffer<Ti>(buffers.x_vec()); }
+    auto x_host = std::vector<To>(args.x_size);
+    buffers.x_vec.Read(queue, args.x_size, x_host);
+    auto x_input = std::vector<Ti>(args.x_size);
+    for (auto i = size_t{0}; i < args.x_size; ++i) {
+      x_input[i] = FromComponents<Ti>(ToComponents(x_host[i]));
+    }
+    auto x_buffer = Buffer<Ti>(queue.GetContext(), args.x_size);
+    x_buffer.Write(queue, args.x_size, x_input);
+    return x_buffer;
+  }
+
+  // The status of the routine in case the device doesn't support the input precision
+  static StatusCode InputPrecisionStatus(const Queue &queue) {
+    if (PrecisionSupported<Ti>(queue.GetDevice())) { return StatusCode::kSuccess; }
+    return (PrecisionValue<Ti>() == Precision::kHalf) ? StatusCode::kNoHalfPrecision :
+                                                         StatusCode::kNoDoublePrecision;
+  }
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<To> &args, Buffers<To> &buffers, Queue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    const auto x_buffer = InputBuffer(args, buffers, queue);
+    auto status = Convert<Ti,To>(args.n, ToComponents(args.alpha)[0],
+                                 x_buffer(), args.x_offset, args.x_inc,
+                                 buffers.y_vec(), args.y_offset, args.y_inc,
+                                 &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<To> &args, Buffers<To> &buffers, Queue &queue) {
+    const auto precision_status = InputPrecisionStatus(queue);
+    if (precision_status != StatusCode::kSuccess) { return precision_status; }
+    auto buffers_host = BuffersHost<To>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference<Ti,To>(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<To> &args, BuffersHost<To> &buffers_host,
+                                  Queue &queue) {
+    const auto precision_status = InputPrecisionStatus(queue);
+    if (precision_status != StatusCode::kSuccess) { return precision_status; }
+    return RunReference<Ti,To>(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<To> &, BuffersCUDA<To> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<To> DownloadResult(const Arguments<To> &args, Buffers<To> &buffers,
+                                        Queue &queue) {
+    std::vector<To> result(args.y_size, ConstantZero<To>());
+    buffers.y_vec.Read(queue, args.y_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<To> &args) { return args.n; }
+  static size_t ResultID2(const Arguments<To> &) { return 1; } // N/A for this routine
+  static size_t GetResultIndex(const Arguments<To> &args, const size_t id1, const size_t) {
+    return id1*args.y_inc + args.y_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<To> &args) {
+    return args.n * ToComponents(ConstantZero<To>()).size();
+  }
+  static size_t GetBytes(const Arguments<To> &args) {
+    return args.n * (sizeof(Ti) + sizeof(To));
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XCONVERT_H_
+#endif
@@ -0,0 +1,192 @@
+
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xdgmm routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XDGMM_H_
+#define CLBLAST_TEST_ROUTINES_XDGMM_H_
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+template <typename T>
+StatusCode RunReference(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
+
+  // Checking for invalid arguments
+  const auto rotated = (args.layout == Layout::kRowMajor);
+  const auto x_length = (args.side == Side::kLeft) ? args.m : args.n;
+  const auto a_base = (rotated) ? args.a_ld*(args.m-1) + args.n : args.a_ld*(args.n-1) + args.m;
+  const auto c_base = (rotated) ? args.c_ld*(args.m-1) + args.n : args.c_ld*(args.n-1) + args.m;
+  const auto x_base = (x_length - 1) * args.x_inc + 1;
+  if ((args.m == 0) || (args.n == 0)) { return StatusCode::kInvalidDimension; }
+  if ((args.a_ld < args.m && !rotated) || (args.a_ld < args.n && rotated)) { return StatusCode::kInvalidLeadDimA; }
+  if ((args.c_ld < args.m && !rotated) || (args.c_ld < args.n && rotated)) { return StatusCode::kInvalidLeadDimC; }
+  if (args.x_inc == 0) { return StatusCode::kInvalidIncrementX; }
+  if (buffers_host.a_mat.size() * sizeof(T) < (a_base + args.a_offset) * sizeof(T)) { return StatusCode::kInsufficientMemoryA; }
+  if (buffers_host.x_vec.size() * sizeof(T) < (x_base + args.x_offset) * sizeof(T)) { return StatusCode::kInsufficientMemoryX; }
+  if (buffers_host.c_mat.size() * sizeof(T) < (c_base + args.c_offset) * sizeof(T)) { return StatusCode::kInsufficientMemoryC; }
+
+  // Scaling of the rows (left) or the columns (right) of the matrix
+  for (auto id1 = size_t{0}; id1 < args.m; ++id1) {
+    for (auto id2 = size_t{0}; id2 < args.n; ++id2) {
+      const auto a_index = (rotated) ? id1 * args.a_ld + id2 : id2 * args.a_ld + id1;
+      const auto c_index = (rotated) ? id1 * args.c_ld + id2 : id2 * args.c_ld + id1;
+      const auto x_index = (args.side == Side::kLeft) ? id1 : id2;
+      const auto scale = buffers_host.x_vec[x_index * args.x_inc + args.x_offset];
+      buffers_host.c_mat[c_index + args.c_offset] = scale * buffers_host.a_mat[a_index + args.a_offset];
+    }
+  }
+  return StatusCode::kSuccess;
+}
+
+// Half-precision version calling the above reference implementation after conversions
+template <>
+StatusCode RunReference<half>(const Arguments<half> &args, BuffersHost<half> &buffers_host) {
+  auto x_buffer2 = HalfToFloatBuffer(buffers_host.x_vec);
+  auto a_buffer2 = HalfToFloatBuffer(buffers_host.a_mat);
+  auto c_buffer2 = HalfToFloatBuffer(buffers_host.c_mat);
+  auto dummy = std::vector<float>(0);
+  auto buffers2 = BuffersHost<float>{x_buffer2, dummy, a_buffer2, dummy, c_buffer2, dummy, dummy};
+  auto args2 = Arguments<float>();
+  args2.x_size = args.x_size; args2.a_size = args.a_size; args2.c_size = args.c_size;
+  args2.x_inc = args.x_inc; args2.a_ld = args.a_ld; args2.c_ld = args.c_ld;
+  args2.m = args.m; args2.n = args.n;
+  args2.x_offset = args.x_offset; args2.a_offset = args.a_offset; args2.c_offset = args.c_offset;
+  args2.layout = args.layout; args2.side = args.side;
+  auto status = RunReference(args2, buffers2);
+  FloatToHalfBuffer(buffers_host.c_mat, c_buffer2);
+  return status;
+}
+
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXdgmm {
+ public:
+
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM, kArgN,
+            kArgLayout, kArgSide,
+            kArgALeadDim, kArgCLeadDim, kArgXInc,
+            kArgAOffset, kArgCOffset, kArgXOffset};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufVecX, kBufMatC}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatC}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeX(const Arguments<T> &args) {
+    const auto x_length = (args.side == Side::kLeft) ? args.m : args.n;
+    return x_length * args.x_inc + args.x_offset;
+  }
+  static size_t GetSizeA(const Arguments<T> &args) {
+    const auto a_rotated = (args.layout == Layout::kRowMajor);
+    const auto a_two = (a_rotated) ? args.m : args.n;
+    return a_two * args.a_ld + args.a_offset;
+  }
+  static size_t GetSizeC(const Arguments<T> &args) {
+    const auto c_rotated = (args.layout == Layout::kRowMajor);
+    const auto c_two = (c_rotated) ? args.m : args.n;
+    return c_two * args.c_ld + args.c_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args) {
+    args.x_size = GetSizeX(args);
+    args.a_size = GetSizeA(args);
+    args.c_size = GetSizeC(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return std::max(args.m, args.n); }
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &args) { return std::max(args.m, args.n); }
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {} // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = Dgmm<T>(args.layout, args.side,
+                          args.m, args.n,
+                          buffers.a_mat(), args.a_offset, args.a_ld,
+                          buffers.x_vec(), args.x_offset, args.x_inc,
+                          buffers.c_mat(), args.c_offset, args.c_ld,
+                          &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunReference(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.c_size, static_cast<T>(0));
+    buffers.c_mat.Read(queue, args.c_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.m; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.n; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return (args.layout == Layout::kRowMajor) ?
+           id1*args.c_ld + id2 + args.c_offset:
+           id2*args.c_ld + id1 + args.c_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return args.m * args.n;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    const auto x_length = (args.side == Side::kLeft) ? args.m : args.n;
+    return (2 * args.m * args.n + x_length) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XDGMM_H_
+#endif
@@ -179,7 +179,7 @@ class TestXgemmBatched {
 
   // Describes how to download the results of the computation (more importantly: which buffer)
   static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
-    std::vector<T> result(args.c_size, static_cast<T>(0));
+    std::vector<T> result(args.c_size, ConstantZero<T>());
     buffers.c_mat.Read(queue, args.c_size, result);
     return result;
   }
@@ -0,0 +1,205 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements a class with static methods to describe the Xreduce routine. Examples of
+// such 'descriptions' are how to calculate the size a of buffer or how to run the routine. These
+// static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XREDUCE_H_
+#define CLBLAST_TEST_ROUTINES_XREDUCE_H_
+
+#include <cmath>
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Reduces each row (no transpose) or column (transpose) of the matrix. The arg-variants store the
+// index of the first extreme value as a value of type T.
+template <typename T>
+StatusCode RunReference(const Reduction reduction, const Arguments<T> &args,
+                        BuffersHost<T> &buffers_host) {
+
+  // Checking for invalid arguments
+  const auto rotated = (args.layout == Layout::kRowMajor);
+  const auto transposed = (args.a_transpose != Transpose::kNo);
+  const auto results = (transposed) ? args.n : args.m;
+  const auto elements = (transposed) ? args.m : args.n;
+  const auto a_base = (rotated) ? args.a_ld*(args.m-1) + args.n : args.a_ld*(args.n-1) + args.m;
+  const auto y_base = (results - 1) * args.y_inc + 1;
+  if ((args.m == 0) || (args.n == 0)) { return StatusCode::kInvalidDimension; }
+  if ((args.a_ld < args.m && !rotated) || (args.a_ld < args.n && rotated)) { return StatusCode::kInvalidLeadDimA; }
+  if (buffers_host.a_mat.size() * sizeof(T) < (a_base + args.a_offset) * sizeof(T)) { return StatusCode::kInsufficientMemoryA; }
+  if (args.y_inc == 0) { return StatusCode::kInvalidIncrementY; }
+  if (buffers_host.y_vec.size() * sizeof(T) < (y_base + args.y_offset) * sizeof(T)) { return StatusCode::kInsufficientMemoryY; }
+
+  // Reduces each of the results over its elements
+  for (auto r = size_t{0}; r < results; ++r) {
+    auto acc = T{0};
+    auto index = size_t{0};
+    for (auto e = size_t{0}; e < elements; ++e) {
+      const auto row = (transposed) ? e : r;
+      const auto col = (transposed) ? r : e;
+      const auto a_index = (rotated) ? row * args.a_ld + col : col * args.a_ld + row;
+      const auto value = buffers_host.a_mat[a_index + args.a_offset];
+      if (e == 0) { acc = (reduction == Reduction::kSum || reduction == Reduction::kAbsSum ||
+                           reduction == Reduction::kNrm2) ? T{0} : value; }
+      switch (reduction) {
+        case Reduction::kSum: acc += value; break;
+        case Reduction::kAbsSum: acc += std::abs(value); break;
+        case Reduction::kNrm2: acc += value * value; break;
+        case Reduction::kMax: case Reduction::kArgMax:
+          if (value > acc) { acc = value; index = e; } break;
+        case Reduction::kMin: case Reduction::kArgMin:
+          if (value < acc) { acc = value; index = e; } break;
+      }
+    }
+    if (reduction == Reduction::kNrm2) { acc = std::sqrt(acc); }
+    if (reduction == Reduction::kArgMax || reduction == Reduction::kArgMin) {
+      acc = static_cast<T>(index);
+    }
+    buffers_host.y_vec[r * args.y_inc + args.y_offset] = acc;
+  }
+  return StatusCode::kSuccess;
+}
+
+// Half-precision version calling the above reference implementation after conversions
+template <>
+StatusCode RunReference<half>(const Reduction reduction, const Arguments<half> &args,
+                              BuffersHost<half> &buffers_host) {
+  auto a_buffer2 = HalfToFloatBuffer(buffers_host.a_mat);
+  auto y_buffer2 = HalfToFloatBuffer(buffers_host.y_vec);
+  auto dummy = std::vector<float>(0);
+  auto buffers2 = BuffersHost<float>{dummy, y_buffer2, a_buffer2, dummy, dummy, dummy, dummy};
+  auto args2 = Arguments<float>();
+  args2.a_size = args.a_size; args2.y_size = args.y_size;
+  args2.a_ld = args.a_ld; args2.y_inc = args.y_inc;
+  args2.m = args.m; args2.n = args.n;
+  args2.a_offset = args.a_offset; args2.y_offset = args.y_offset;
+  args2.layout = args.layout; args2.a_transpose = args.a_transpose;
+  auto status = RunReference(reduction, args2, buffers2);
+  FloatToHalfBuffer(buffers_host.y_vec, y_buffer2);
+  return status;
+}
+
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T, Reduction reduction>
+class TestXreduce {
+ public:
+
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgM, kArgN,
+            kArgLayout, kArgATransp,
+            kArgALeadDim, kArgYInc,
+            kArgAOffset, kArgYOffset};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA, kBufVecY}; }
+  static std::vector<std::string> BuffersOut() { return {kBufVecY}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeY(const Arguments<T> &args) {
+    const auto results = (args.a_transpose != Transpose::kNo) ? args.n : args.m;
+    return results * args.y_inc + args.y_offset;
+  }
+  static size_t GetSizeA(const Arguments<T> &args) {
+    const auto a_rotated = (args.layout == Layout::kRowMajor);
+    const auto a_two = (a_rotated) ? args.m : args.n;
+    return a_two * args.a_ld + args.a_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args) {
+    args.a_size = GetSizeA(args);
+    args.y_size = GetSizeY(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return std::max(args.m, args.n); }
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &all) { return all; }
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T>&, Queue&, const int, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {} // N/A for this routine
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = ReduceMatrix<T>(reduction, args.layout, args.a_transpose,
+                                  args.m, args.n,
+                                  buffers.a_mat(), args.a_offset, args.a_ld,
+                                  buffers.y_vec(), args.y_offset, args.y_inc,
+                                  &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference(reduction, args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunReference(reduction, args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.y_size, static_cast<T>(0));
+    buffers.y_vec.Read(queue, args.y_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) {
+    return (args.a_transpose != Transpose::kNo) ? args.n : args.m;
+  }
+  static size_t ResultID2(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t) {
+    return id1*args.y_inc + args.y_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return args.m * args.n;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    const auto results = (args.a_transpose != Transpose::kNo) ? args.n : args.m;
+    return (args.m * args.n + results) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XREDUCE_H_
+#endif
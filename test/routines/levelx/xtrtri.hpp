@@ -0,0 +1,345 @@
+// =================================================================================================
+// This file is part of the CLBlast project. The project is licensed under Apache Version 2.0. This
+// project loosely follows the Google C++ styleguide and uses a tab-size of two spaces and a max-
+// width of 100 characters per line.
+//
+// Author(s):
+//   Cedric Nugteren <www.cedricnugteren.nl>
+//
+// This file implements classes with static methods to describe the Xtrtri and XtrtriBatched
+// routines. Examples of such 'descriptions' are how to calculate the size a of buffer or how to run
+// the routine. These static methods are used by the correctness tester and the performance tester.
+//
+// =================================================================================================
+
+#ifndef CLBLAST_TEST_ROUTINES_XTRTRI_H_
+#define CLBLAST_TEST_ROUTINES_XTRTRI_H_
+
+#include <random>
+#include <cmath>
+
+#include "test/routines/common.hpp"
+
+namespace clblast {
+// =================================================================================================
+
+// Creates a test value from a real and an imaginary part, the latter is ignored for real data-types
+template <typename T>
+T TrtriTestValue(const double real, const double) { return Constant<T>(real); }
+template <> float2 TrtriTestValue<float2>(const double real, const double imag) {
+  return {static_cast<float>(real), static_cast<float>(imag)};
+}
+template <> double2 TrtriTestValue<double2>(const double real, const double imag) {
+  return {real, imag};
+}
+
+// Fills the triangle of the matrix with values which keep its inverse well-conditioned: small
+// values off the diagonal and values with a real part of at least one on the diagonal
+template <typename T>
+void PrepareTriangularMatrix(const Arguments<T> &args, const size_t a_offset, const int seed,
+                             std::vector<T> &a_source) {
+  std::mt19937 mt(seed);
+  std::uniform_real_distribution<double> dist(kTestDataLowerLimit, kTestDataUpperLimit);
+  const auto off_diagonal_scale = 1.0 / (kTestDataUpperLimit * static_cast<double>(args.n));
+  for (auto i = size_t{0}; i < args.n; ++i) {
+    for (auto j = size_t{0}; j < args.n; ++j) {
+      const auto in_triangle = (args.triangle == Triangle::kUpper) ? (i <= j) : (i >= j);
+      if (!in_triangle) { continue; }
+      const auto real = dist(mt);
+      const auto imag = dist(mt) * off_diagonal_scale;
+      const auto index = (args.layout == Layout::kRowMajor) ? i*args.a_ld + j : j*args.a_ld + i;
+      a_source[index + a_offset] = (i == j) ? TrtriTestValue<T>(1.0 + std::abs(real), imag) :
+                                   TrtriTestValue<T>(real * off_diagonal_scale, imag);
+    }
+  }
+}
+
+// Inverts the triangular matrix in-place column by column: the elements of column j of the
+// inverse follow from the diagonal one towards the other end of the triangle
+template <typename T>
+StatusCode RunReference(const Arguments<T> &args, BuffersHost<T> &buffers_host) {
+
+  // Checking for invalid arguments
+  const auto a_base = args.a_ld * (args.n - 1) + args.n;
+  if (args.n == 0) { return StatusCode::kInvalidDimension; }
+  if (args.a_ld < args.n) { return StatusCode::kInvalidLeadDimA; }
+  if (buffers_host.a_mat.size() * sizeof(T) < (a_base + args.a_offset) * sizeof(T)) { return StatusCode::kInsufficientMemoryA; }
+
+  // Reads the input matrix (with an implicit unit diagonal) and writes its inverse
+  const auto upper = (args.triangle == Triangle::kUpper);
+  const auto unit = (args.diagonal == Diagonal::kUnit);
+  const auto rotated = (args.layout == Layout::kRowMajor);
+  const auto index = [&](const size_t i, const size_t j) {
+    return args.a_offset + ((rotated) ? i*args.a_ld + j : j*args.a_ld + i);
+  };
+  const auto a = buffers_host.a_mat;
+  const auto a_element = [&](const size_t i, const size_t j) {
+    return (unit && i == j) ? ConstantOne<T>() : a[index(i, j)];
+  };
+  auto &x = buffers_host.a_mat;
+  for (auto j = size_t{0}; j < args.n; ++j) {
+    const auto x_diagonal = ConstantOne<T>() / a_element(j, j);
+    if (!unit) { x[index(j, j)] = x_diagonal; }
+    const auto x_element = [&](const size_t l) { return (l == j) ? x_diagonal : x[index(l, j)]; };
+    const auto num_elements = (upper) ? j : args.n - 1 - j;
+    for (auto step = size_t{1}; step <= num_elements; ++step) {
+      const auto i = (upper) ? j - step : j + step;
+      auto sum = ConstantZero<T>();
+      const auto l_start = (upper) ? i + 1 : j;
+      const auto l_end = (upper) ? j + 1 : i;
+      for (auto l = l_start; l < l_end; ++l) { sum += a_element(i, l) * x_element(l); }
+      x[index(i, j)] = ConstantZero<T>() - sum / a_element(i, i);
+    }
+  }
+  return StatusCode::kSuccess;
+}
+
+// Half-precision version calling the above reference implementation after conversions
+template <>
+StatusCode RunReference<half>(const Arguments<half> &args, BuffersHost<half> &buffers_host) {
+  auto a_buffer2 = HalfToFloatBuffer(buffers_host.a_mat);
+  auto dummy = std::vector<float>(0);
+  auto buffers2 = BuffersHost<float>{dummy, dummy, a_buffer2, dummy, dummy, dummy, dummy};
+  auto args2 = Arguments<float>();
+  args2.a_size = args.a_size; args2.a_ld = args.a_ld; args2.a_offset = args.a_offset;
+  args2.n = args.n;
+  args2.layout = args.layout; args2.triangle = args.triangle; args2.diagonal = args.diagonal;
+  auto status = RunReference(args2, buffers2);
+  FloatToHalfBuffer(buffers_host.a_mat, a_buffer2);
+  return status;
+}
+
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXtrtri {
+ public:
+
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN,
+            kArgLayout, kArgTriangle, kArgDiagonal,
+            kArgALeadDim, kArgAOffset};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatA}; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeA(const Arguments<T> &args) {
+    return args.n * args.a_ld + args.a_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args) {
+    args.a_size = GetSizeA(args);
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return args.n; }
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T> &args, Queue&, const int seed,
+                          std::vector<T>&, std::vector<T>&,
+                          std::vector<T>& a_source_, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {
+    if (args.a_ld < args.n) { return; }
+    if (args.a_size < GetSizeA(args)) { return; }
+    PrepareTriangularMatrix(args, args.a_offset, seed, a_source_);
+  }
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = Trtri<T>(args.layout, args.triangle, args.diagonal,
+                           args.n,
+                           buffers.a_mat(), args.a_offset, args.a_ld,
+                           &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference(args, buffers_host);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    return RunReference(args, buffers_host);
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.a_size, static_cast<T>(0));
+    buffers.a_mat.Read(queue, args.a_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.n; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.n; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2) {
+    return (args.layout == Layout::kRowMajor) ?
+           id1*args.a_ld + id2 + args.a_offset:
+           id2*args.a_ld + id1 + args.a_offset;
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return (args.n * args.n * args.n) / 3;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return args.n * (args.n + 1) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+
+// See comment at top of file for a description of the class
+template <typename T>
+class TestXtrtriBatched {
+ public:
+
+  // The BLAS level: 4 for the extra routines
+  static size_t BLASLevel() { return 4; }
+
+  // The list of arguments relevant for this routine
+  static std::vector<std::string> GetOptions() {
+    return {kArgN,
+            kArgLayout, kArgTriangle, kArgDiagonal,
+            kArgALeadDim, kArgAOffset,
+            kArgBatchCount};
+  }
+  static std::vector<std::string> BuffersIn() { return {kBufMatA}; }
+  static std::vector<std::string> BuffersOut() { return {kBufMatA}; }
+
+  // Helper for the sizes per batch
+  static size_t PerBatchSizeA(const Arguments<T> &args) { return args.n * args.a_ld; }
+
+  // Describes how to obtain the sizes of the buffers
+  static size_t GetSizeA(const Arguments<T> &args) {
+    return PerBatchSizeA(args) * args.batch_count + args.a_offset;
+  }
+
+  // Describes how to set the sizes of all the buffers
+  static void SetSizes(Arguments<T> &args) {
+    args.a_size = GetSizeA(args);
+
+    // Also sets the batch-related variables
+    args.a_offsets = std::vector<size_t>(args.batch_count);
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      args.a_offsets[batch] = batch * PerBatchSizeA(args) + args.a_offset;
+    }
+  }
+
+  // Describes what the default values of the leading dimensions of the matrices are
+  static size_t DefaultLDA(const Arguments<T> &args) { return args.n; }
+  static size_t DefaultLDB(const Arguments<T> &) { return 1; } // N/A for this routine
+  static size_t DefaultLDC(const Arguments<T> &) { return 1; } // N/A for this routine
+
+  // Describes which transpose options are relevant for this routine
+  using Transposes = std::vector<Transpose>;
+  static Transposes GetATransposes(const Transposes &) { return {}; } // N/A for this routine
+  static Transposes GetBTransposes(const Transposes &) { return {}; } // N/A for this routine
+
+  // Describes how to prepare the input data
+  static void PrepareData(const Arguments<T> &args, Queue&, const int seed,
+                          std::vector<T>&, std::vector<T>&,
+                          std::vector<T>& a_source_, std::vector<T>&, std::vector<T>&,
+                          std::vector<T>&, std::vector<T>&) {
+    if (args.a_ld < args.n) { return; }
+    if (args.a_size < GetSizeA(args)) { return; }
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      PrepareTriangularMatrix(args, args.a_offsets[batch], seed + static_cast<int>(batch),
+                              a_source_);
+    }
+  }
+
+  // Describes how to run the CLBlast routine
+  static StatusCode RunRoutine(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto queue_plain = queue();
+    auto event = cl_event{};
+    auto status = TrtriBatched<T>(args.layout, args.triangle, args.diagonal,
+                                  args.n,
+                                  buffers.a_mat(), args.a_offsets.data(), args.a_ld,
+                                  args.batch_count,
+                                  &queue_plain, &event);
+    if (status == StatusCode::kSuccess) { clWaitForEvents(1, &event); clReleaseEvent(event); }
+    return status;
+  }
+
+  // Describes how to run a naive version of the routine (for correctness/performance comparison).
+  // Note that a proper clBLAS or CPU BLAS comparison is not available for non-BLAS routines.
+  static StatusCode RunReference1(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    auto buffers_host = BuffersHost<T>();
+    DeviceToHost(args, buffers, buffers_host, queue, BuffersIn());
+    const auto status = RunReference2(args, buffers_host, queue);
+    HostToDevice(args, buffers, buffers_host, queue, BuffersOut());
+    return status;
+  }
+
+  static StatusCode RunReference2(const Arguments<T> &args, BuffersHost<T> &buffers_host, Queue&) {
+    if (args.batch_count == 0) { return StatusCode::kInvalidBatchCount; }
+    for (auto batch = size_t{0}; batch < args.batch_count; ++batch) {
+      auto batch_args = args;
+      batch_args.a_offset = args.a_offsets[batch];
+      const auto status = RunReference(batch_args, buffers_host);
+      if (status != StatusCode::kSuccess) { return status; }
+    }
+    return StatusCode::kSuccess;
+  }
+  static StatusCode RunReference3(const Arguments<T> &, BuffersCUDA<T> &, Queue &) {
+    return StatusCode::kUnknownError;
+  }
+
+  // Describes how to download the results of the computation (more importantly: which buffer)
+  static std::vector<T> DownloadResult(const Arguments<T> &args, Buffers<T> &buffers, Queue &queue) {
+    std::vector<T> result(args.a_size, static_cast<T>(0));
+    buffers.a_mat.Read(queue, args.a_size, result);
+    return result;
+  }
+
+  // Describes how to compute the indices of the result buffer
+  static size_t ResultID1(const Arguments<T> &args) { return args.n; }
+  static size_t ResultID2(const Arguments<T> &args) { return args.n * args.batch_count; }
+  static size_t GetResultIndex(const Arguments<T> &args, const size_t id1, const size_t id2_3) {
+    const size_t id2 = id2_3 % args.n;
+    const size_t id3 = id2_3 / args.n;
+    return (args.layout == Layout::kRowMajor) ?
+           id1*args.a_ld + id2 + args.a_offsets[id3]:
+           id2*args.a_ld + id1 + args.a_offsets[id3];
+  }
+
+  // Describes how to compute performance metrics
+  static size_t GetFlops(const Arguments<T> &args) {
+    return args.batch_count * (args.n * args.n * args.n) / 3;
+  }
+  static size_t GetBytes(const Arguments<T> &args) {
+    return args.batch_count * args.n * (args.n + 1) * sizeof(T);
+  }
+};
+
+// =================================================================================================
+} // namespace clblast
+
+// CLBLAST_TEST_ROUTINES_XTRTRI_H_
+#endif
@@ -305,6 +305,18 @@ void cblasXaxpy(const size_t n,
              y_buffer_bis, y_offset, y_inc);
   FloatToHalfBuffer(y_buffer, y_buffer_bis);
 }
+void cblasXaxpy(const size_t n,
+                const bfloat16 alpha,
+                const std::vector<bfloat16>& x_buffer, const size_t x_offset, const size_t x_inc,
+                std::vector<bfloat16>& y_buffer, const size_t y_offset, const size_t y_inc) {
+  auto x_buffer_bis = BFloat16ToFloatBuffer(x_buffer);
+  auto y_buffer_bis = BFloat16ToFloatBuffer(y_buffer);
+  cblasXaxpy(n,
+             BFloat16ToFloat(alpha),
+             x_buffer_bis, x_offset, x_inc,
+             y_buffer_bis, y_offset, y_inc);
+  FloatToBFloat16Buffer(y_buffer, y_buffer_bis);
+}
 
 // Forwards the Netlib BLAS calls for SDOT/DDOT
 void cblasXdot(const size_t n,
@@ -336,6 +348,19 @@ void cblasXdot(const size_t n,
             y_buffer_bis, y_offset, y_inc);
   FloatToHalfBuffer(dot_buffer, dot_buffer_bis);
 }
+void cblasXdot(const size_t n,
+               std::vector<bfloat16>& dot_buffer, const size_t dot_offset,
+               const std::vector<bfloat16>& x_buffer, const size_t x_offset, const size_t x_inc,
+               const std::vector<bfloat16>& y_buffer, const size_t y_offset, const size_t y_inc) {
+  auto x_buffer_bis = BFloat16ToFloatBuffer(x_buffer);
+  auto y_buffer_bis = BFloat16ToFloatBuffer(y_buffer);
+  auto dot_buffer_bis = BFloat16ToFloatBuffer(dot_buffer);
+  cblasXdot(n,
+            dot_buffer_bis, dot_offset,
+            x_buffer_bis, x_offset, x_inc,
+            y_buffer_bis, y_offset, y_inc);
+  FloatToBFloat16Buffer(dot_buffer, dot_buffer_bis);
+}
 
 // Forwards the Netlib BLAS calls for CDOTU/ZDOTU
 void cblasXdotu(const size_t n,
@@ -1651,6 +1676,25 @@ void cblasXgemm(const CBLAS_ORDER layout, const CBLAS_TRANSPOSE a_transpose, con
              c_buffer_bis, c_offset, c_ld);
   FloatToHalfBuffer(c_buffer, c_buffer_bis);
 }
+void cblasXgemm(const CBLAS_ORDER layout, const CBLAS_TRANSPOSE a_transpose, const CBLAS_TRANSPOSE b_transpose,
+                const size_t m, const size_t n, const size_t k,
+                const bfloat16 alpha,
+                const std::vector<bfloat16>& a_buffer, const size_t a_offset, const size_t a_ld,
+                const std::vector<bfloat16>& b_buffer, const size_t b_offset, const size_t b_ld,
+                const bfloat16 beta,
+                std::vector<bfloat16>& c_buffer, const size_t c_offset, const size_t c_ld) {
+  auto a_buffer_bis = BFloat16ToFloatBuffer(a_buffer);
+  auto b_buffer_bis = BFloat16ToFloatBuffer(b_buffer);
+  auto c_buffer_bis = BFloat16ToFloatBuffer(c_buffer);
+  cblasXgemm(layout, a_transpose, b_transpose,
+             m, n, k,
+             BFloat16ToFloat(alpha),
+             a_buffer_bis, a_offset, a_ld,
+             b_buffer_bis, b_offset, b_ld,
+             BFloat16ToFloat(beta),
+             c_buffer_bis, c_offset, c_ld);
+  FloatToBFloat16Buffer(c_buffer, c_buffer_bis);
+}
 
 // Forwards the Netlib BLAS calls for SSYMM/DSYMM/CSYMM/ZSYMM
 void cblasXsymm(const CBLAS_ORDER layout, const CBLAS_SIDE side, const CBLAS_UPLO triangle,
@@ -427,6 +427,22 @@ clblasStatus clblasXaxpy(const size_t n,
   FloatToHalfBuffer(y_buffer, y_buffer_bis, queues[0]);
   return status;
 }
+clblasStatus clblasXaxpy(const size_t n,
+                         const bfloat16 alpha,
+                         const Buffer<bfloat16>& x_buffer, const size_t x_offset, const size_t x_inc,
+                         Buffer<bfloat16>& y_buffer, const size_t y_offset, const size_t y_inc,
+                         cl_uint num_queues, cl_command_queue *queues,
+                         cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto x_buffer_bis = BFloat16ToFloatBuffer(x_buffer, queues[0]);
+  auto y_buffer_bis = BFloat16ToFloatBuffer(y_buffer, queues[0]);
+  auto status = clblasXaxpy(n,
+                            BFloat16ToFloat(alpha),
+                            x_buffer_bis, x_offset, x_inc,
+                            y_buffer_bis, y_offset, y_inc,
+                            num_queues, queues, num_wait_events, wait_events, events);
+  FloatToBFloat16Buffer(y_buffer, y_buffer_bis, queues[0]);
+  return status;
+}
 
 // Forwards the clBLAS calls for SDOT/DDOT
 template <typename T>
@@ -488,6 +504,24 @@ clblasStatus clblasXdot<half>(const size_t n,
   FloatToHalfBuffer(dot_buffer, dot_buffer_bis, queues[0]);
   return status;
 }
+template <>
+clblasStatus clblasXdot<bfloat16>(const size_t n,
+                                  Buffer<bfloat16>& dot_buffer, const size_t dot_offset,
+                                  const Buffer<bfloat16>& x_buffer, const size_t x_offset, const size_t x_inc,
+                                  const Buffer<bfloat16>& y_buffer, const size_t y_offset, const size_t y_inc,
+                                  cl_uint num_queues, cl_command_queue *queues,
+                                  cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto x_buffer_bis = BFloat16ToFloatBuffer(x_buffer, queues[0]);
+  auto y_buffer_bis = BFloat16ToFloatBuffer(y_buffer, queues[0]);
+  auto dot_buffer_bis = BFloat16ToFloatBuffer(dot_buffer, queues[0]);
+  auto status = clblasXdot(n,
+                           dot_buffer_bis, dot_offset,
+                           x_buffer_bis, x_offset, x_inc,
+                           y_buffer_bis, y_offset, y_inc,
+                           num_queues, queues, num_wait_events, wait_events, events);
+  FloatToBFloat16Buffer(dot_buffer, dot_buffer_bis, queues[0]);
+  return status;
+}
 
 // Forwards the clBLAS calls for CDOTU/ZDOTU
 template <typename T>
@@ -2341,6 +2375,29 @@ clblasStatus clblasXgemm(const clblasOrder layout, const clblasTranspose a_trans
   FloatToHalfBuffer(c_buffer, c_buffer_bis, queues[0]);
   return status;
 }
+clblasStatus clblasXgemm(const clblasOrder layout, const clblasTranspose a_transpose, const clblasTranspose b_transpose,
+                         const size_t m, const size_t n, const size_t k,
+                         const bfloat16 alpha,
+                         const Buffer<bfloat16>& a_buffer, const size_t a_offset, const size_t a_ld,
+                         const Buffer<bfloat16>& b_buffer, const size_t b_offset, const size_t b_ld,
+                         const bfloat16 beta,
+                         Buffer<bfloat16>& c_buffer, const size_t c_offset, const size_t c_ld,
+                         cl_uint num_queues, cl_command_queue *queues,
+                         cl_uint num_wait_events, const cl_event *wait_events, cl_event *events) {
+  auto a_buffer_bis = BFloat16ToFloatBuffer(a_buffer, queues[0]);
+  auto b_buffer_bis = BFloat16ToFloatBuffer(b_buffer, queues[0]);
+  auto c_buffer_bis = BFloat16ToFloatBuffer(c_buffer, queues[0]);
+  auto status = clblasXgemm(layout, a_transpose, b_transpose,
+                            m, n, k,
+                            BFloat16ToFloat(alpha),
+                            a_buffer_bis, a_offset, a_ld,
+                            b_buffer_bis, b_offset, b_ld,
+                            BFloat16ToFloat(beta),
+                            c_buffer_bis, c_offset, c_ld,
+                            num_queues, queues, num_wait_events, wait_events, events);
+  FloatToBFloat16Buffer(c_buffer, c_buffer_bis, queues[0]);
+  return status;
+}
 
 // Forwards the clBLAS calls for SSYMM/DSYMM/CSYMM/ZSYMM
 clblasStatus clblasXsymm(const clblasOrder layout, const clblasSide side, const clblasUplo triangle,
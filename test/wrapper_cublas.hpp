@@ -368,6 +368,12 @@ cublasStatus_t cublasXaxpy(cublasHandle_t handle, const size_t n,
                            half* y_buffer, const size_t y_offset, const size_t y_inc) {
   return CUBLAS_STATUS_NOT_SUPPORTED;
 }
+cublasStatus_t cublasXaxpy(cublasHandle_t handle, const size_t n,
+                           const bfloat16 alpha,
+                           const bfloat16* x_buffer, const size_t x_offset, const size_t x_inc,
+                           bfloat16* y_buffer, const size_t y_offset, const size_t y_inc) {
+  return CUBLAS_STATUS_NOT_SUPPORTED;
+}
 
 // Forwards the cuBLAS calls for SDOT/DDOT
 template <typename T>
@@ -406,6 +412,13 @@ cublasStatus_t cublasXdot<half>(cublasHandle_t handle, const size_t n,
                                 const half* y_buffer, const size_t y_offset, const size_t y_inc) {
   return CUBLAS_STATUS_NOT_SUPPORTED;
 }
+template <>
+cublasStatus_t cublasXdot<bfloat16>(cublasHandle_t handle, const size_t n,
+                                    bfloat16* dot_buffer, const size_t dot_offset,
+                                    const bfloat16* x_buffer, const size_t x_offset, const size_t x_inc,
+                                    const bfloat16* y_buffer, const size_t y_offset, const size_t y_inc) {
+  return CUBLAS_STATUS_NOT_SUPPORTED;
+}
 
 // Forwards the cuBLAS calls for CDOTU/ZDOTU
 template <typename T>
@@ -1997,6 +2010,15 @@ cublasStatus_t cublasXgemm(cublasHandle_t handle, const Layout layout, const cub
                            half* c_buffer, const size_t c_offset, const size_t c_ld) {
   return CUBLAS_STATUS_NOT_SUPPORTED;
 }
+cublasStatus_t cublasXgemm(cublasHandle_t handle, const Layout layout, const cublasOperation_t a_transpose, const cublasOperation_t b_transpose,
+                           const size_t m, const size_t n, const size_t k,
+                           const bfloat16 alpha,
+                           const bfloat16* a_buffer, const size_t a_offset, const size_t a_ld,
+                           const bfloat16* b_buffer, const size_t b_offset, const size_t b_ld,
+                           const bfloat16 beta,
+                           bfloat16* c_buffer, const size_t c_offset, const size_t c_ld) {
+  return CUBLAS_STATUS_NOT_SUPPORTED;
+}
 
 // Forwards the cuBLAS calls for SSYMM/DSYMM/CSYMM/ZSYMM
 cublasStatus_t cublasXsymm(cublasHandle_t handle, const Layout layout, const cublasSideMode_t side, const cublasFillMode_t triangle,